@@ -0,0 +1,518 @@
+#include "ansi.h"
+
+// Screen height assumed when AT$TH is 0 and the height is not known
+#define ANSI_DEFAULT_ROWS 24
+
+// Longest relative move sent as repeated VT52 codes
+#define VT52_MAX_REPEAT 80
+
+#define ESC 0x1B
+#define CAN 0x18
+#define SUB 0x1A
+#define BEL 0x07
+
+AnsiStats ansiStats = {0, 0};
+
+static const char *const ANSI_MODE_NAMES[ANSI_MODE_COUNT] = {"OFF", "MONO", "DUMB", "VT52"};
+
+const char *ansiModeName(uint8_t mode)
+{
+    return mode < ANSI_MODE_COUNT ? ANSI_MODE_NAMES[mode] : "?";
+}
+
+int ansiModeFromName(const String &name)
+{
+    String up = name;
+    up.trim();
+    up.toUpperCase();
+    if (up.length() == 1 && up[0] >= '0' && up[0] < '0' + ANSI_MODE_COUNT)
+        return up[0] - '0';
+    for (int i = 0; i < ANSI_MODE_COUNT; i++)
+    {
+        if (up == ANSI_MODE_NAMES[i])
+            return i;
+    }
+    return -1;
+}
+
+void AnsiFilter::begin(uint8_t mode, uint8_t rows, uint8_t cols)
+{
+    mode_ = mode < ANSI_MODE_COUNT ? mode : (uint8_t)ANSI_OFF;
+    rows_ = rows ? rows : ANSI_DEFAULT_ROWS;
+    cols_ = cols;
+    state_ = GROUND;
+    move_ = MOVE_NONE;
+    bufLen_ = 0;
+}
+
+void AnsiFilter::put(uint8_t c)
+{
+    if (bufLen_ == sizeof(buf_))
+        drain();
+    buf_[bufLen_++] = c;
+}
+
+void AnsiFilter::putNumber(int n)
+{
+    char digits[6];
+    int len = 0;
+    do
+    {
+        digits[len++] = '0' + n % 10;
+        n /= 10;
+    } while (n > 0 && len < (int)sizeof(digits));
+    while (len > 0)
+        put(digits[--len]);
+}
+
+void AnsiFilter::putCSI(char final, const int16_t *params, uint8_t count, char prefix, char inter)
+{
+    put(ESC);
+    put('[');
+    if (prefix)
+        put(prefix);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (i > 0)
+            put(';');
+        if (params[i] >= 0)
+            putNumber(params[i]);
+    }
+    if (inter)
+        put(inter);
+    put(final);
+}
+
+void AnsiFilter::drain()
+{
+    if (bufLen_ == 0)
+        return;
+    out_.write(buf_, bufLen_);
+    ansiStats.bytesOut += bufLen_;
+    bufLen_ = 0;
+}
+
+void AnsiFilter::flush()
+{
+    emitMove();
+    drain();
+}
+
+void AnsiFilter::putMove(char final, int n)
+{
+    if (mode_ == ANSI_VT52)
+    {
+        if (n > VT52_MAX_REPEAT)
+            n = VT52_MAX_REPEAT;
+        while (n-- > 0)
+        {
+            put(ESC);
+            put(final);
+        }
+        return;
+    }
+    int16_t count = n;
+    putCSI(final, &count, n == 1 ? 0 : 1, 0, 0);
+}
+
+void AnsiFilter::emitMove()
+{
+    Move move = move_;
+    move_ = MOVE_NONE;
+    if (move == MOVE_NONE || mode_ == ANSI_DUMB)
+        return;
+
+    if (move == MOVE_ABS)
+    {
+        if (mode_ == ANSI_VT52 && row_ == 1 && col_ == 1)
+        {
+            put(ESC);
+            put('H');
+        }
+        else if (mode_ == ANSI_VT52)
+        {
+            put(ESC);
+            put('Y');
+            put(31 + constrain(row_, 1, 94));
+            put(31 + constrain(col_, 1, 94));
+        }
+        else
+        {
+            int16_t pos[2] = {row_, col_};
+            putCSI('H', pos, col_ > 1 ? 2 : row_ > 1 ? 1 : 0, 0, 0);
+        }
+        return;
+    }
+
+    // VT52 uses the same letters for up, down, right and left
+    if (row_)
+        putMove(row_ < 0 ? 'A' : 'B', abs(row_));
+    if (col_)
+        putMove(col_ < 0 ? 'D' : 'C', abs(col_));
+}
+
+void AnsiFilter::moveTo(int row, int col)
+{
+    move_ = MOVE_ABS;
+    row_ = row;
+    col_ = col;
+}
+
+void AnsiFilter::moveBy(int rows, int cols)
+{
+    if (move_ == MOVE_ABS)
+    {
+        int row = max(1, row_ + rows);
+        int col = max(1, col_ + cols);
+        // Merged moves that would leave the screen are sent as they came,
+        // since a terminal clamps each move at the edge and the sum differs
+        if (row <= rows_ && col <= cols_)
+        {
+            row_ = row;
+            col_ = col;
+            return;
+        }
+        emitMove();
+    }
+    else if (move_ == MOVE_REL)
+    {
+        // Up then down (or right then left) is not a no-op at an edge
+        if ((rows && row_ && (rows > 0) != (row_ > 0)) || (cols && col_ && (cols > 0) != (col_ > 0)))
+            emitMove();
+    }
+    if (move_ == MOVE_NONE)
+    {
+        move_ = MOVE_REL;
+        row_ = 0;
+        col_ = 0;
+    }
+    row_ = constrain(row_ + rows, -9999, 9999);
+    col_ = constrain(col_ + cols, -9999, 9999);
+}
+
+// C0 controls run even in the middle of a sequence
+void AnsiFilter::control(uint8_t c)
+{
+    emitMove();
+    put(c);
+}
+
+// Two character sequences, ESC and a final byte
+void AnsiFilter::escape(uint8_t c)
+{
+    if (mode_ == ANSI_MONO)
+    {
+        emitMove();
+        put(ESC);
+        put(c);
+        return;
+    }
+    switch (c)
+    {
+    case 'D': // Index
+        control('\n');
+        break;
+    case 'E': // Next line
+        control('\r');
+        control('\n');
+        break;
+    case 'M': // Reverse index
+        if (mode_ == ANSI_VT52)
+        {
+            emitMove();
+            put(ESC);
+            put('I');
+        }
+        break;
+    }
+}
+
+int AnsiFilter::param(uint8_t i, int def) const
+{
+    return i < paramCount_ && params_[i] > 0 ? params_[i] : def;
+}
+
+void AnsiFilter::sgr()
+{
+    if (mode_ != ANSI_MONO)
+        return;
+
+    // Attributes change no position, so a pending move can stay pending
+    int16_t keep[ANSI_MAX_PARAMS];
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < paramCount_; i++)
+    {
+        int p = params_[i];
+        if (p == 38 || p == 48 || p == 58)
+        {
+            // Extended colour: 5;n or 2;r;g;b follows
+            if (param(i + 1, 0) == 5)
+                i += 2;
+            else if (param(i + 1, 0) == 2)
+                i += 4;
+            continue;
+        }
+        if ((p >= 30 && p <= 37) || p == 39 || (p >= 40 && p <= 47) || p == 49 || p == 59 ||
+            (p >= 90 && p <= 97) || (p >= 100 && p <= 107))
+            continue;
+        keep[count++] = params_[i];
+    }
+    if (paramCount_ > 0 && count == 0)
+        return; // Colours only
+    putCSI('m', keep, count, 0, 0);
+}
+
+void AnsiFilter::dispatch(uint8_t final)
+{
+    if (private_ || inter_)
+    {
+        if (mode_ == ANSI_MONO)
+        {
+            emitMove();
+            putCSI(final, params_, paramCount_, private_, inter_);
+        }
+        return;
+    }
+
+    switch (final)
+    {
+    case 'A':
+        moveBy(-param(0, 1), 0);
+        return;
+    case 'B':
+        moveBy(param(0, 1), 0);
+        return;
+    case 'C':
+        moveBy(0, param(0, 1));
+        return;
+    case 'D':
+        moveBy(0, -param(0, 1));
+        return;
+    case 'H':
+    case 'f':
+        moveTo(param(0, 1), param(1, 1));
+        return;
+    case 'm':
+        sgr();
+        return;
+    }
+
+    if (mode_ == ANSI_MONO)
+    {
+        emitMove();
+        putCSI(final, params_, paramCount_, 0, 0);
+        return;
+    }
+
+    // Clearing the screen homes the cursor on ANSI BBSes, as on ANSI.SYS
+    bool clearScreen = final == 'J' && param(0, 0) == 2;
+    if (mode_ == ANSI_DUMB)
+    {
+        if (clearScreen)
+        {
+            move_ = MOVE_NONE;
+            put('\r');
+            put('\n');
+        }
+        return;
+    }
+
+    if (final == 'J' && (param(0, 0) == 0 || clearScreen))
+    {
+        if (clearScreen)
+        {
+            move_ = MOVE_NONE;
+            put(ESC);
+            put('H');
+        }
+        else
+        {
+            emitMove();
+        }
+        put(ESC);
+        put('J');
+    }
+    else if (final == 'K' && param(0, 0) == 0)
+    {
+        emitMove();
+        put(ESC);
+        put('K');
+    }
+}
+
+size_t AnsiFilter::write(const uint8_t *buf, size_t len)
+{
+    ansiStats.bytesIn += len;
+    if (mode_ == ANSI_OFF)
+    {
+        out_.write(buf, len);
+        ansiStats.bytesOut += len;
+        return len;
+    }
+
+    size_t i = 0;
+    while (i < len)
+    {
+        if (state_ == GROUND)
+        {
+            // Pass text and controls up to the next escape on in one go
+            size_t end = i;
+            while (end < len && buf[end] != ESC)
+                end++;
+            if (end > i)
+            {
+                emitMove();
+                drain();
+                out_.write(buf + i, end - i);
+                ansiStats.bytesOut += end - i;
+                i = end;
+                continue;
+            }
+            state_ = ESCAPE;
+            i++;
+            continue;
+        }
+
+        uint8_t c = buf[i++];
+        switch (state_)
+        {
+        case ESCAPE:
+            if (c == '[')
+            {
+                state_ = CSI;
+                paramCount_ = 0;
+                private_ = 0;
+                inter_ = 0;
+            }
+            else if (c == ']' || c == 'P' || c == 'X' || c == '^' || c == '_')
+            {
+                // OSC, DCS and the other strings run to ST or BEL
+                state_ = STRING;
+                if (mode_ == ANSI_MONO)
+                {
+                    emitMove();
+                    put(ESC);
+                    put(c);
+                }
+            }
+            else if (c >= 0x20 && c <= 0x2F)
+            {
+                inter_ = c;
+                state_ = ESCAPE_INTER;
+            }
+            else if (c == CAN || c == SUB)
+            {
+                state_ = GROUND;
+            }
+            else if (c < 0x20)
+            {
+                if (c != ESC)
+                    control(c);
+            }
+            else
+            {
+                state_ = GROUND;
+                escape(c);
+            }
+            break;
+
+        case ESCAPE_INTER:
+            if (c >= 0x20 && c <= 0x2F)
+            {
+                inter_ = c;
+            }
+            else if (c >= 0x30 && c <= 0x7E)
+            {
+                state_ = GROUND;
+                if (mode_ == ANSI_MONO)
+                {
+                    // Character set selection and the like
+                    emitMove();
+                    put(ESC);
+                    put(inter_);
+                    put(c);
+                }
+            }
+            else if (c == ESC)
+            {
+                state_ = ESCAPE;
+            }
+            else if (c == CAN || c == SUB)
+            {
+                state_ = GROUND;
+            }
+            else if (c < 0x20)
+            {
+                control(c);
+            }
+            break;
+
+        case CSI:
+            if (c >= '0' && c <= '9')
+            {
+                if (paramCount_ == 0)
+                    params_[paramCount_++] = -1;
+                int16_t &p = params_[paramCount_ - 1];
+                p = p < 0 ? c - '0' : min(p * 10 + (c - '0'), 9999);
+            }
+            else if (c == ';' || c == ':')
+            {
+                if (paramCount_ == 0)
+                    params_[paramCount_++] = -1;
+                if (paramCount_ < ANSI_MAX_PARAMS)
+                    params_[paramCount_++] = -1;
+            }
+            else if (c >= 0x3C && c <= 0x3F)
+            {
+                private_ = c;
+            }
+            else if (c >= 0x20 && c <= 0x2F)
+            {
+                inter_ = c;
+            }
+            else if (c >= 0x40 && c <= 0x7E)
+            {
+                state_ = GROUND;
+                dispatch(c);
+            }
+            else if (c == ESC)
+            {
+                state_ = ESCAPE;
+            }
+            else if (c == CAN || c == SUB)
+            {
+                state_ = GROUND;
+            }
+            else if (c < 0x20)
+            {
+                control(c);
+            }
+            break;
+
+        case STRING:
+            if (c == ESC)
+            {
+                state_ = STRING_ESC;
+                break;
+            }
+            if (mode_ == ANSI_MONO)
+                put(c);
+            if (c == BEL || c == CAN || c == SUB)
+                state_ = GROUND;
+            break;
+
+        case STRING_ESC:
+            if (mode_ == ANSI_MONO)
+            {
+                put(ESC);
+                put(c);
+            }
+            state_ = c == '\\' ? GROUND : STRING;
+            break;
+
+        case GROUND:
+            break;
+        }
+    }
+    return len;
+}
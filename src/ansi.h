@@ -0,0 +1,107 @@
+#ifndef ANSI_H
+#define ANSI_H
+
+#include <Arduino.h>
+
+// Escape sequence filter for terminals that do not speak full ANSI. Data
+// written to it is parsed incrementally, so sequences may be split across
+// writes, and passed on to out with:
+//
+//   MONO  colour codes removed from SGR, other sequences kept
+//   DUMB  every escape sequence removed, plain text and controls kept
+//   VT52  cursor movement and erase mapped to VT52, the rest removed
+//
+// In all modes cursor moves with no output between them are merged into
+// one, so a screen redraw costs fewer bytes. A merged move is held until
+// something else is written or flush() is called.
+
+enum AnsiMode : uint8_t
+{
+    ANSI_OFF,
+    ANSI_MONO,
+    ANSI_DUMB,
+    ANSI_VT52,
+    ANSI_MODE_COUNT
+};
+
+#define ANSI_MAX_PARAMS 16
+
+struct AnsiStats
+{
+    uint32_t bytesIn;
+    uint32_t bytesOut;
+};
+
+extern AnsiStats ansiStats;
+
+const char *ansiModeName(uint8_t mode);
+
+// Returns the mode for a name or number, or -1 if there is none
+int ansiModeFromName(const String &name);
+
+class AnsiFilter : public Print
+{
+public:
+    explicit AnsiFilter(Print &out) : out_(out) {}
+
+    // rows and cols are the terminal size, rows 0 when it is not known
+    void begin(uint8_t mode, uint8_t rows, uint8_t cols);
+    uint8_t mode() const { return mode_; }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buf, size_t len) override;
+    void flush() override;
+
+private:
+    enum State
+    {
+        GROUND,
+        ESCAPE,
+        ESCAPE_INTER,
+        CSI,
+        STRING,
+        STRING_ESC
+    };
+
+    enum Move
+    {
+        MOVE_NONE,
+        MOVE_ABS,
+        MOVE_REL
+    };
+
+    Print &out_;
+    uint8_t mode_ = ANSI_OFF;
+    State state_ = GROUND;
+
+    int16_t params_[ANSI_MAX_PARAMS];
+    uint8_t paramCount_ = 0;
+    char private_ = 0;
+    char inter_ = 0;
+
+    uint8_t rows_ = 24;
+    uint8_t cols_ = 80;
+
+    Move move_ = MOVE_NONE;
+    int16_t row_ = 0; // Absolute position, or the relative offsets
+    int16_t col_ = 0;
+
+    uint8_t buf_[64];
+    uint8_t bufLen_ = 0;
+
+    void put(uint8_t c);
+    void putNumber(int n);
+    void putCSI(char final, const int16_t *params, uint8_t count, char prefix, char inter);
+    void putMove(char final, int n);
+    void drain();
+    void emitMove();
+    void moveTo(int row, int col);
+    void moveBy(int rows, int cols);
+    void control(uint8_t c);
+    void escape(uint8_t c);
+    void dispatch(uint8_t final);
+    void sgr();
+    int param(uint8_t i, int def) const;
+};
+
+#endif
@@ -0,0 +1,127 @@
+#include <Arduino.h>
+#include "globals.h"
+#include "boot.h"
+
+#define STAGE_KEY 0
+#define STAGE_WIFI 1
+#define STAGE_READY 2
+
+static const char *const phaseNames[BOOT_PHASES] = {"Setup", "First key", "SD card", "Wi-Fi join", "Update check"};
+
+// millis() at the start and end of each phase, 0 when not reached
+static uint32_t phaseStart[BOOT_PHASES];
+static uint32_t phaseEnd[BOOT_PHASES];
+static uint32_t readyAt = 0;
+static byte stage = STAGE_KEY;
+static byte blinks = 0;
+static uint32_t blinkAt = 0;
+
+void bootPhaseStart(BootPhase phase)
+{
+  phaseStart[phase] = max(millis(), 1UL);
+  phaseEnd[phase] = 0;
+}
+
+void bootPhaseEnd(BootPhase phase)
+{
+  if (phaseStart[phase] && !phaseEnd[phase])
+    phaseEnd[phase] = millis();
+}
+
+void bootBegin()
+{
+  bootPhaseStart(BOOT_SETUP);
+  pinMode(BOOT_LED_PIN, OUTPUT);
+  digitalWrite(BOOT_LED_PIN, HIGH);
+  blinkAt = millis();
+}
+
+void bootSetupDone()
+{
+  bootPhaseEnd(BOOT_SETUP);
+  bootPhaseStart(BOOT_KEY);
+}
+
+// Blinks the LED on startup (3 times) without holding anything up
+static void blinkLed()
+{
+  if (blinks >= BOOT_BLINKS * 2 - 1 || millis() - blinkAt < BOOT_BLINK_MS)
+    return;
+  blinks++;
+  blinkAt = millis();
+  digitalWrite(BOOT_LED_PIN, blinks % 2 ? LOW : HIGH);
+}
+
+bool handleBoot()
+{
+  if (stage == STAGE_READY)
+    return true;
+  blinkLed();
+  if (wifiSetupSettled())
+    bootPhaseEnd(BOOT_WIFI);
+
+  switch (stage)
+  {
+  case STAGE_KEY:
+    if (!Serial.available())
+      break;
+    Serial.read();
+    bootPhaseEnd(BOOT_KEY);
+    welcome();
+    bootPhaseStart(BOOT_SD);
+    initSDCard();
+    bootPhaseEnd(BOOT_SD);
+    stage = STAGE_WIFI;
+    break;
+
+  case STAGE_WIFI:
+    if (!wifiSetupSettled())
+      break;
+    wifiSetupReport();
+    sendResult(RES_OK);
+    readyAt = millis();
+    stage = STAGE_READY;
+    if (WiFi.status() == WL_CONNECTED)
+      startFirmwareCheck();
+    break;
+  }
+  return stage == STAGE_READY;
+}
+
+void printBootTimes()
+{
+  for (int i = 0; i < BOOT_PHASES; i++)
+  {
+    Serial.print(phaseNames[i]);
+    Serial.print(": ");
+    if (!phaseStart[i])
+    {
+      Serial.println("not run");
+      continue;
+    }
+    Serial.print("at ");
+    Serial.print(phaseStart[i]);
+    Serial.print(" ms, ");
+    if (phaseEnd[i])
+    {
+      Serial.print(phaseEnd[i] - phaseStart[i]);
+      Serial.println(" ms");
+    }
+    else
+    {
+      Serial.println("running");
+    }
+  }
+  Serial.print("Ready: ");
+  if (readyAt)
+  {
+    Serial.print("at ");
+    Serial.print(readyAt);
+    Serial.println(" ms");
+  }
+  else
+  {
+    Serial.println("not yet");
+  }
+  printFirmwareCheck();
+}
@@ -0,0 +1,35 @@
+#ifndef BOOT_H
+#define BOOT_H
+
+#include <Arduino.h>
+
+// Startup in stages. setup() only does what has to happen first and
+// starts the Wi-Fi join; loop() then waits for the first key, mounts the
+// SD card and reports the join while the web server is already serving.
+// Every phase is timed from power on for AT$BOOT.
+
+enum BootPhase
+{
+  BOOT_SETUP,  // setup() itself
+  BOOT_KEY,    // Waiting for the first key
+  BOOT_SD,     // SD card
+  BOOT_WIFI,   // Wi-Fi join, runs alongside the others
+  BOOT_UPDATE, // Firmware version check, runs in the background
+  BOOT_PHASES
+};
+
+#define BOOT_BLINKS 3
+#define BOOT_BLINK_MS 200
+#define BOOT_LED_PIN 16
+
+void bootBegin();     // First thing in setup()
+void bootSetupDone(); // Last thing in setup()
+
+// Called from loop(), returns true once the modem is ready for commands
+bool handleBoot();
+
+void bootPhaseStart(BootPhase phase);
+void bootPhaseEnd(BootPhase phase);
+void printBootTimes();
+
+#endif
@@ -0,0 +1,143 @@
+#include <Arduino.h>
+#include "globals.h"
+#include "httpstream.h"
+#include "html.h"
+#include "pager.h"
+#include "charset.h"
+
+// ATWEB<url> fetches a page, renders it as text reflowed to the terminal
+// width and lets the user follow the numbered links. text/* pages other
+// than HTML are shown as they are.
+
+#ifdef ESP8266
+#define WEB_LINK_POOL 1024
+#else
+#define WEB_LINK_POOL 4096
+#endif
+#define WEB_HISTORY 8
+
+// Shows the body of a text/plain page, adding the CR terminals need
+static void showPlainText(Print &out, const uint8_t *buf, size_t len, bool &lastCR)
+{
+  for (size_t i = 0; i < len; i++)
+  {
+    if (buf[i] == '\n' && !lastCR)
+      out.write('\r');
+    lastCR = buf[i] == '\r';
+    out.write(buf[i]);
+  }
+}
+
+void browseWeb(String url)
+{
+  url.trim();
+  if (url.length() == 0)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  if (url.indexOf("://") < 0)
+    url = "http://" + url;
+
+  char *pool = new char[WEB_LINK_POOL];
+  String history[WEB_HISTORY];
+  int depth = 0;
+  bool ok = true;
+
+  while (url.length() > 0)
+  {
+    Serial.println("Loading " + url);
+    HttpStream http;
+    bool got = http.get(url);
+    if (http.notice().length())
+      Serial.println(http.notice());
+    if (!got)
+    {
+      Serial.println(http.lastError());
+      ok = false;
+      break;
+    }
+    if (http.status() != 200)
+    {
+      Serial.println("HTTP status " + String(http.status()));
+      ok = false;
+      break;
+    }
+    String type = http.contentType();
+    type.toLowerCase();
+    bool isHtml = type.length() == 0 || type.indexOf("html") >= 0;
+    if (!isHtml && !type.startsWith("text/"))
+    {
+      Serial.println("Not a text page (" + type + "), use ATGETSD or ATGETX to download it");
+      ok = false;
+      break;
+    }
+
+    Pager pager(Serial, termRows);
+    CharsetPrint terminal(pager, termCharset);
+    HtmlRenderer html(terminal, termCols, pool, WEB_LINK_POOL);
+    uint8_t buf[256];
+    bool lastCR = false;
+    int n;
+    while (!pager.quit() && (n = http.read(buf, sizeof(buf))) >= 0)
+    {
+      if (n == 0)
+      {
+        yield();
+        continue;
+      }
+      if (isHtml)
+        html.write(buf, n);
+      else
+        showPlainText(pager, buf, n, lastCR);
+    }
+    if (isHtml)
+      html.finish();
+    http.stop();
+
+    Serial.println();
+    Serial.print(http.bodyBytes());
+    Serial.print(" bytes received, ");
+    Serial.print(pager.bytesOut());
+    Serial.println(" bytes shown");
+
+    // Ask where to go next
+    String current = http.url();
+    uint16_t links = isHtml ? html.linkCount() : 0;
+    url = "";
+    while (true)
+    {
+      if (links > 0)
+        Serial.print("Link 1-" + String(links) + ", ");
+      if (depth > 0)
+        Serial.print("B=back, ");
+      Serial.print("Enter=quit: ");
+      String choice = readTerminalLine(Serial, 5);
+      choice.trim();
+      choice.toUpperCase();
+      if (choice.length() == 0)
+        break;
+      if (choice == "B" && depth > 0)
+      {
+        url = history[--depth];
+        break;
+      }
+      int pick = choice.toInt();
+      if (pick >= 1 && pick <= links)
+      {
+        if (depth == WEB_HISTORY)
+        {
+          for (int i = 1; i < WEB_HISTORY; i++)
+            history[i - 1] = history[i];
+          depth--;
+        }
+        history[depth++] = current;
+        url = HttpStream::resolve(current, html.link(pick));
+        break;
+      }
+    }
+  }
+
+  delete[] pool;
+  sendResult(ok ? RES_OK : RES_ERROR);
+}
@@ -0,0 +1,315 @@
+#include "charset.h"
+#include "charset_tables.h"
+
+static const char *const CHARSET_NAMES[CHARSET_COUNT] = {"NONE", "CP437", "KOI8-R", "CP1251", "PETSCII"};
+
+const char *charsetName(uint8_t charset)
+{
+    return charset < CHARSET_COUNT ? CHARSET_NAMES[charset] : "?";
+}
+
+int charsetFromName(const String &name)
+{
+    String up = name;
+    up.trim();
+    up.toUpperCase();
+    if (up.length() == 1 && up[0] >= '0' && up[0] < '0' + CHARSET_COUNT)
+        return up[0] - '0';
+    if (up == "KOI8R")
+        return CHARSET_KOI8R;
+    for (int i = 0; i < CHARSET_COUNT; i++)
+    {
+        if (up == CHARSET_NAMES[i])
+            return i;
+    }
+    return -1;
+}
+
+// PETSCII in its shifted (upper and lower case) set. Letters are swapped
+// against ASCII, capitals also have a second range at 0xC1, and a few
+// punctuation marks differ. Colour and cursor codes have no equivalent
+// and are dropped, but the C0 controls pass as they are, so ACK, NAK, CAN,
+// RUN/STOP (Ctrl-C) and ESC still reach the host.
+
+static int32_t petsciiToUnicode(uint8_t b)
+{
+    if (b >= 0x41 && b <= 0x5A)
+        return b + 0x20;
+    if ((b >= 0x61 && b <= 0x7A) || (b >= 0xC1 && b <= 0xDA))
+        return (b & 0x1F) + 0x40;
+    switch (b)
+    {
+    case 0x0D:
+        return '\r';
+    case 0x14:
+        return '\b';
+    case 0x5C:
+        return 0x00A3;
+    case 0x5E:
+        return 0x2191;
+    case 0x5F:
+        return 0x2190;
+    }
+    if (b <= 0x5D)
+        return b;
+    return -1;
+}
+
+static int petsciiFromUnicode(uint32_t cp)
+{
+    if (cp >= 'a' && cp <= 'z')
+        return cp - 0x20;
+    if (cp >= 'A' && cp <= 'Z')
+        return cp + 0x80;
+    switch (cp)
+    {
+    case '\n':
+        return -1; // CR alone starts a new line
+    case '\b':
+    case 0x7F:
+        return 0x14;
+    case 0x00A3:
+        return 0x5C;
+    case 0x2191:
+        return 0x5E;
+    case 0x2190:
+        return 0x5F;
+    case '\\':
+    case '^':
+    case '_':
+    case '`':
+    case '{':
+    case '|':
+    case '}':
+    case '~':
+        return '?';
+    }
+    if (cp < 0x80)
+        return cp;
+    return '?';
+}
+
+static const uint16_t *toUnicodeTable(uint8_t charset)
+{
+    switch (charset)
+    {
+    case CHARSET_CP437:
+        return CP437_TO_UNICODE;
+    case CHARSET_KOI8R:
+        return KOI8R_TO_UNICODE;
+    case CHARSET_CP1251:
+        return CP1251_TO_UNICODE;
+    }
+    return nullptr;
+}
+
+// Byte in the terminal character set to a code point, -1 to drop it
+static int32_t toUnicode(uint8_t charset, uint8_t b)
+{
+    if (charset == CHARSET_PETSCII)
+        return petsciiToUnicode(b);
+    if (b < 0x80)
+        return b;
+    const uint16_t *table = toUnicodeTable(charset);
+    if (!table)
+        return b;
+    uint16_t cp = pgm_read_word(&table[b - 0x80]);
+    return cp ? cp : '?';
+}
+
+// Code point to a byte in the terminal character set, -1 to drop it
+static int fromUnicode(uint8_t charset, uint32_t cp)
+{
+    if (charset == CHARSET_PETSCII)
+        return petsciiFromUnicode(cp);
+    if (cp < 0x80)
+        return cp;
+
+    const CharsetReverse *table;
+    size_t count;
+    switch (charset)
+    {
+    case CHARSET_CP437:
+        table = CP437_FROM_UNICODE;
+        count = sizeof(CP437_FROM_UNICODE) / sizeof(CP437_FROM_UNICODE[0]);
+        break;
+    case CHARSET_KOI8R:
+        table = KOI8R_FROM_UNICODE;
+        count = sizeof(KOI8R_FROM_UNICODE) / sizeof(KOI8R_FROM_UNICODE[0]);
+        break;
+    case CHARSET_CP1251:
+        table = CP1251_FROM_UNICODE;
+        count = sizeof(CP1251_FROM_UNICODE) / sizeof(CP1251_FROM_UNICODE[0]);
+        break;
+    default:
+        return '?';
+    }
+
+    size_t lo = 0;
+    size_t hi = count;
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        uint16_t entry = pgm_read_word(&table[mid].cp);
+        if (entry == cp)
+            return pgm_read_byte(&table[mid].byte);
+        if (entry < cp)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return '?';
+}
+
+size_t Utf8Decoder::convert(const uint8_t *in, size_t len, uint8_t *out)
+{
+    if (charset_ == CHARSET_NONE)
+    {
+        if (out != in)
+            memmove(out, in, len);
+        return len;
+    }
+
+    bool asciiSame = charset_ != CHARSET_PETSCII;
+    size_t o = 0;
+    size_t i = 0;
+    while (i < len)
+    {
+        if (need_ == 0 && asciiSame)
+        {
+            // Copy a run of ASCII in one go
+            size_t end = i;
+            while (end < len && in[end] < 0x80)
+                end++;
+            if (end > i)
+            {
+                if (out + o != in + i)
+                    memmove(out + o, in + i, end - i);
+                o += end - i;
+                i = end;
+                if (i == len)
+                    break;
+            }
+        }
+
+        uint8_t c = in[i++];
+        if (need_ > 0)
+        {
+            if ((c & 0xC0) == 0x80)
+            {
+                cp_ = (cp_ << 6) | (c & 0x3F);
+                if (--need_ == 0)
+                {
+                    int b = fromUnicode(charset_, cp_);
+                    if (b >= 0)
+                        out[o++] = b;
+                }
+                continue;
+            }
+            need_ = 0; // Sequence cut short, drop it
+        }
+
+        if (c < 0x80)
+        {
+            int b = fromUnicode(charset_, c);
+            if (b >= 0)
+                out[o++] = b;
+        }
+        else if ((c & 0xE0) == 0xC0)
+        {
+            cp_ = c & 0x1F;
+            need_ = 1;
+        }
+        else if ((c & 0xF0) == 0xE0)
+        {
+            cp_ = c & 0x0F;
+            need_ = 2;
+        }
+        else if ((c & 0xF8) == 0xF0)
+        {
+            cp_ = c & 0x07;
+            need_ = 3;
+        }
+        else
+        {
+            out[o++] = '?'; // Not UTF-8
+        }
+    }
+    return o;
+}
+
+static uint8_t utf8Length(int32_t cp)
+{
+    if (cp < 0)
+        return 0;
+    if (cp < 0x80)
+        return 1;
+    if (cp < 0x800)
+        return 2;
+    return 3;
+}
+
+size_t encodeUtf8(uint8_t charset, uint8_t *buf, size_t len)
+{
+    if (charset == CHARSET_NONE)
+        return len;
+
+    // Drop bytes with no character and work out the length, so that the
+    // rest can be expanded from the end without overtaking the input
+    size_t total = 0;
+    size_t kept = 0;
+    bool ascii = charset != CHARSET_PETSCII;
+    for (size_t i = 0; i < len; i++)
+    {
+        uint8_t n = utf8Length(toUnicode(charset, buf[i]));
+        if (n == 0)
+            continue;
+        if (n > 1)
+            ascii = false;
+        buf[kept++] = buf[i];
+        total += n;
+    }
+    if (ascii)
+        return kept;
+    len = kept;
+
+    size_t o = total;
+    for (size_t i = len; i-- > 0;)
+    {
+        int32_t cp = toUnicode(charset, buf[i]);
+        switch (utf8Length(cp))
+        {
+        case 1:
+            buf[--o] = cp;
+            break;
+        case 2:
+            buf[--o] = 0x80 | (cp & 0x3F);
+            buf[--o] = 0xC0 | (cp >> 6);
+            break;
+        case 3:
+            buf[--o] = 0x80 | (cp & 0x3F);
+            buf[--o] = 0x80 | ((cp >> 6) & 0x3F);
+            buf[--o] = 0xE0 | (cp >> 12);
+            break;
+        }
+    }
+    return total;
+}
+
+size_t CharsetPrint::write(const uint8_t *buf, size_t len)
+{
+    if (decoder_.charset() == CHARSET_NONE)
+        return out_.write(buf, len);
+
+    uint8_t chunk[64];
+    size_t done = 0;
+    while (done < len)
+    {
+        size_t n = len - done < sizeof(chunk) ? len - done : sizeof(chunk);
+        size_t m = decoder_.convert(buf + done, n, chunk);
+        if (m > 0)
+            out_.write(chunk, m);
+        done += n;
+    }
+    return len;
+}
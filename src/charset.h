@@ -0,0 +1,66 @@
+#ifndef CHARSET_H
+#define CHARSET_H
+
+#include <Arduino.h>
+
+// Character set translation between UTF-8 on the network side and the
+// 8-bit character set of the terminal. Data from the remote end is decoded
+// from UTF-8, keeping the state of sequences split across reads, and what
+// the user types is encoded to UTF-8. Runs of ASCII are copied as they are,
+// so plain text costs no more than with translation off.
+
+enum Charset : uint8_t
+{
+    CHARSET_NONE,
+    CHARSET_CP437,
+    CHARSET_KOI8R,
+    CHARSET_CP1251,
+    CHARSET_PETSCII,
+    CHARSET_COUNT
+};
+
+const char *charsetName(uint8_t charset);
+
+// Returns the charset for a name or number, or -1 if there is none
+int charsetFromName(const String &name);
+
+class Utf8Decoder
+{
+public:
+    void begin(uint8_t charset)
+    {
+        charset_ = charset;
+        reset();
+    }
+    void reset() { need_ = 0; }
+    uint8_t charset() const { return charset_; }
+
+    // Converts len bytes of UTF-8 from in to the terminal character set in
+    // out, which may be the same buffer. Never writes more than len bytes.
+    size_t convert(const uint8_t *in, size_t len, uint8_t *out);
+
+private:
+    uint8_t charset_ = CHARSET_NONE;
+    uint8_t need_ = 0;
+    uint32_t cp_ = 0;
+};
+
+// Encodes len bytes in the terminal character set in buf as UTF-8, in
+// place. Each byte can become up to three, so buf must hold 3 * len bytes.
+size_t encodeUtf8(uint8_t charset, uint8_t *buf, size_t len);
+
+// Print that decodes UTF-8 written to it into the terminal character set
+class CharsetPrint : public Print
+{
+public:
+    CharsetPrint(Print &out, uint8_t charset) : out_(out) { decoder_.begin(charset); }
+
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buf, size_t len) override;
+
+private:
+    Print &out_;
+    Utf8Decoder decoder_;
+};
+
+#endif
@@ -0,0 +1,179 @@
+#ifndef CHARSET_TABLES_H
+#define CHARSET_TABLES_H
+
+#include <Arduino.h>
+
+// Generated from the Unicode mappings of the code pages by
+// tools/gen_charset_tables.py. Bytes 0x80-0xFF to code points, and code
+// points back to bytes sorted for binary search. 0 marks a byte with no
+// character.
+
+struct CharsetReverse
+{
+    uint16_t cp;
+    uint8_t byte;
+};
+
+static const uint16_t CP437_TO_UNICODE[128] PROGMEM = {
+    0x00C7, 0x00FC, 0x00E9, 0x00E2, 0x00E4, 0x00E0, 0x00E5, 0x00E7,
+    0x00EA, 0x00EB, 0x00E8, 0x00EF, 0x00EE, 0x00EC, 0x00C4, 0x00C5,
+    0x00C9, 0x00E6, 0x00C6, 0x00F4, 0x00F6, 0x00F2, 0x00FB, 0x00F9,
+    0x00FF, 0x00D6, 0x00DC, 0x00A2, 0x00A3, 0x00A5, 0x20A7, 0x0192,
+    0x00E1, 0x00ED, 0x00F3, 0x00FA, 0x00F1, 0x00D1, 0x00AA, 0x00BA,
+    0x00BF, 0x2310, 0x00AC, 0x00BD, 0x00BC, 0x00A1, 0x00AB, 0x00BB,
+    0x2591, 0x2592, 0x2593, 0x2502, 0x2524, 0x2561, 0x2562, 0x2556,
+    0x2555, 0x2563, 0x2551, 0x2557, 0x255D, 0x255C, 0x255B, 0x2510,
+    0x2514, 0x2534, 0x252C, 0x251C, 0x2500, 0x253C, 0x255E, 0x255F,
+    0x255A, 0x2554, 0x2569, 0x2566, 0x2560, 0x2550, 0x256C, 0x2567,
+    0x2568, 0x2564, 0x2565, 0x2559, 0x2558, 0x2552, 0x2553, 0x256B,
+    0x256A, 0x2518, 0x250C, 0x2588, 0x2584, 0x258C, 0x2590, 0x2580,
+    0x03B1, 0x00DF, 0x0393, 0x03C0, 0x03A3, 0x03C3, 0x00B5, 0x03C4,
+    0x03A6, 0x0398, 0x03A9, 0x03B4, 0x221E, 0x03C6, 0x03B5, 0x2229,
+    0x2261, 0x00B1, 0x2265, 0x2264, 0x2320, 0x2321, 0x00F7, 0x2248,
+    0x00B0, 0x2219, 0x00B7, 0x221A, 0x207F, 0x00B2, 0x25A0, 0x00A0,
+};
+
+static const CharsetReverse CP437_FROM_UNICODE[128] PROGMEM = {
+    {0x00A0, 0xFF}, {0x00A1, 0xAD}, {0x00A2, 0x9B}, {0x00A3, 0x9C},
+    {0x00A5, 0x9D}, {0x00AA, 0xA6}, {0x00AB, 0xAE}, {0x00AC, 0xAA},
+    {0x00B0, 0xF8}, {0x00B1, 0xF1}, {0x00B2, 0xFD}, {0x00B5, 0xE6},
+    {0x00B7, 0xFA}, {0x00BA, 0xA7}, {0x00BB, 0xAF}, {0x00BC, 0xAC},
+    {0x00BD, 0xAB}, {0x00BF, 0xA8}, {0x00C4, 0x8E}, {0x00C5, 0x8F},
+    {0x00C6, 0x92}, {0x00C7, 0x80}, {0x00C9, 0x90}, {0x00D1, 0xA5},
+    {0x00D6, 0x99}, {0x00DC, 0x9A}, {0x00DF, 0xE1}, {0x00E0, 0x85},
+    {0x00E1, 0xA0}, {0x00E2, 0x83}, {0x00E4, 0x84}, {0x00E5, 0x86},
+    {0x00E6, 0x91}, {0x00E7, 0x87}, {0x00E8, 0x8A}, {0x00E9, 0x82},
+    {0x00EA, 0x88}, {0x00EB, 0x89}, {0x00EC, 0x8D}, {0x00ED, 0xA1},
+    {0x00EE, 0x8C}, {0x00EF, 0x8B}, {0x00F1, 0xA4}, {0x00F2, 0x95},
+    {0x00F3, 0xA2}, {0x00F4, 0x93}, {0x00F6, 0x94}, {0x00F7, 0xF6},
+    {0x00F9, 0x97}, {0x00FA, 0xA3}, {0x00FB, 0x96}, {0x00FC, 0x81},
+    {0x00FF, 0x98}, {0x0192, 0x9F}, {0x0393, 0xE2}, {0x0398, 0xE9},
+    {0x03A3, 0xE4}, {0x03A6, 0xE8}, {0x03A9, 0xEA}, {0x03B1, 0xE0},
+    {0x03B4, 0xEB}, {0x03B5, 0xEE}, {0x03C0, 0xE3}, {0x03C3, 0xE5},
+    {0x03C4, 0xE7}, {0x03C6, 0xED}, {0x207F, 0xFC}, {0x20A7, 0x9E},
+    {0x2219, 0xF9}, {0x221A, 0xFB}, {0x221E, 0xEC}, {0x2229, 0xEF},
+    {0x2248, 0xF7}, {0x2261, 0xF0}, {0x2264, 0xF3}, {0x2265, 0xF2},
+    {0x2310, 0xA9}, {0x2320, 0xF4}, {0x2321, 0xF5}, {0x2500, 0xC4},
+    {0x2502, 0xB3}, {0x250C, 0xDA}, {0x2510, 0xBF}, {0x2514, 0xC0},
+    {0x2518, 0xD9}, {0x251C, 0xC3}, {0x2524, 0xB4}, {0x252C, 0xC2},
+    {0x2534, 0xC1}, {0x253C, 0xC5}, {0x2550, 0xCD}, {0x2551, 0xBA},
+    {0x2552, 0xD5}, {0x2553, 0xD6}, {0x2554, 0xC9}, {0x2555, 0xB8},
+    {0x2556, 0xB7}, {0x2557, 0xBB}, {0x2558, 0xD4}, {0x2559, 0xD3},
+    {0x255A, 0xC8}, {0x255B, 0xBE}, {0x255C, 0xBD}, {0x255D, 0xBC},
+    {0x255E, 0xC6}, {0x255F, 0xC7}, {0x2560, 0xCC}, {0x2561, 0xB5},
+    {0x2562, 0xB6}, {0x2563, 0xB9}, {0x2564, 0xD1}, {0x2565, 0xD2},
+    {0x2566, 0xCB}, {0x2567, 0xCF}, {0x2568, 0xD0}, {0x2569, 0xCA},
+    {0x256A, 0xD8}, {0x256B, 0xD7}, {0x256C, 0xCE}, {0x2580, 0xDF},
+    {0x2584, 0xDC}, {0x2588, 0xDB}, {0x258C, 0xDD}, {0x2590, 0xDE},
+    {0x2591, 0xB0}, {0x2592, 0xB1}, {0x2593, 0xB2}, {0x25A0, 0xFE},
+};
+
+static const uint16_t KOI8R_TO_UNICODE[128] PROGMEM = {
+    0x2500, 0x2502, 0x250C, 0x2510, 0x2514, 0x2518, 0x251C, 0x2524,
+    0x252C, 0x2534, 0x253C, 0x2580, 0x2584, 0x2588, 0x258C, 0x2590,
+    0x2591, 0x2592, 0x2593, 0x2320, 0x25A0, 0x2219, 0x221A, 0x2248,
+    0x2264, 0x2265, 0x00A0, 0x2321, 0x00B0, 0x00B2, 0x00B7, 0x00F7,
+    0x2550, 0x2551, 0x2552, 0x0451, 0x2553, 0x2554, 0x2555, 0x2556,
+    0x2557, 0x2558, 0x2559, 0x255A, 0x255B, 0x255C, 0x255D, 0x255E,
+    0x255F, 0x2560, 0x2561, 0x0401, 0x2562, 0x2563, 0x2564, 0x2565,
+    0x2566, 0x2567, 0x2568, 0x2569, 0x256A, 0x256B, 0x256C, 0x00A9,
+    0x044E, 0x0430, 0x0431, 0x0446, 0x0434, 0x0435, 0x0444, 0x0433,
+    0x0445, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+    0x043F, 0x044F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0436, 0x0432,
+    0x044C, 0x044B, 0x0437, 0x0448, 0x044D, 0x0449, 0x0447, 0x044A,
+    0x042E, 0x0410, 0x0411, 0x0426, 0x0414, 0x0415, 0x0424, 0x0413,
+    0x0425, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+    0x041F, 0x042F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0416, 0x0412,
+    0x042C, 0x042B, 0x0417, 0x0428, 0x042D, 0x0429, 0x0427, 0x042A,
+};
+
+static const CharsetReverse KOI8R_FROM_UNICODE[128] PROGMEM = {
+    {0x00A0, 0x9A}, {0x00A9, 0xBF}, {0x00B0, 0x9C}, {0x00B2, 0x9D},
+    {0x00B7, 0x9E}, {0x00F7, 0x9F}, {0x0401, 0xB3}, {0x0410, 0xE1},
+    {0x0411, 0xE2}, {0x0412, 0xF7}, {0x0413, 0xE7}, {0x0414, 0xE4},
+    {0x0415, 0xE5}, {0x0416, 0xF6}, {0x0417, 0xFA}, {0x0418, 0xE9},
+    {0x0419, 0xEA}, {0x041A, 0xEB}, {0x041B, 0xEC}, {0x041C, 0xED},
+    {0x041D, 0xEE}, {0x041E, 0xEF}, {0x041F, 0xF0}, {0x0420, 0xF2},
+    {0x0421, 0xF3}, {0x0422, 0xF4}, {0x0423, 0xF5}, {0x0424, 0xE6},
+    {0x0425, 0xE8}, {0x0426, 0xE3}, {0x0427, 0xFE}, {0x0428, 0xFB},
+    {0x0429, 0xFD}, {0x042A, 0xFF}, {0x042B, 0xF9}, {0x042C, 0xF8},
+    {0x042D, 0xFC}, {0x042E, 0xE0}, {0x042F, 0xF1}, {0x0430, 0xC1},
+    {0x0431, 0xC2}, {0x0432, 0xD7}, {0x0433, 0xC7}, {0x0434, 0xC4},
+    {0x0435, 0xC5}, {0x0436, 0xD6}, {0x0437, 0xDA}, {0x0438, 0xC9},
+    {0x0439, 0xCA}, {0x043A, 0xCB}, {0x043B, 0xCC}, {0x043C, 0xCD},
+    {0x043D, 0xCE}, {0x043E, 0xCF}, {0x043F, 0xD0}, {0x0440, 0xD2},
+    {0x0441, 0xD3}, {0x0442, 0xD4}, {0x0443, 0xD5}, {0x0444, 0xC6},
+    {0x0445, 0xC8}, {0x0446, 0xC3}, {0x0447, 0xDE}, {0x0448, 0xDB},
+    {0x0449, 0xDD}, {0x044A, 0xDF}, {0x044B, 0xD9}, {0x044C, 0xD8},
+    {0x044D, 0xDC}, {0x044E, 0xC0}, {0x044F, 0xD1}, {0x0451, 0xA3},
+    {0x2219, 0x95}, {0x221A, 0x96}, {0x2248, 0x97}, {0x2264, 0x98},
+    {0x2265, 0x99}, {0x2320, 0x93}, {0x2321, 0x9B}, {0x2500, 0x80},
+    {0x2502, 0x81}, {0x250C, 0x82}, {0x2510, 0x83}, {0x2514, 0x84},
+    {0x2518, 0x85}, {0x251C, 0x86}, {0x2524, 0x87}, {0x252C, 0x88},
+    {0x2534, 0x89}, {0x253C, 0x8A}, {0x2550, 0xA0}, {0x2551, 0xA1},
+    {0x2552, 0xA2}, {0x2553, 0xA4}, {0x2554, 0xA5}, {0x2555, 0xA6},
+    {0x2556, 0xA7}, {0x2557, 0xA8}, {0x2558, 0xA9}, {0x2559, 0xAA},
+    {0x255A, 0xAB}, {0x255B, 0xAC}, {0x255C, 0xAD}, {0x255D, 0xAE},
+    {0x255E, 0xAF}, {0x255F, 0xB0}, {0x2560, 0xB1}, {0x2561, 0xB2},
+    {0x2562, 0xB4}, {0x2563, 0xB5}, {0x2564, 0xB6}, {0x2565, 0xB7},
+    {0x2566, 0xB8}, {0x2567, 0xB9}, {0x2568, 0xBA}, {0x2569, 0xBB},
+    {0x256A, 0xBC}, {0x256B, 0xBD}, {0x256C, 0xBE}, {0x2580, 0x8B},
+    {0x2584, 0x8C}, {0x2588, 0x8D}, {0x258C, 0x8E}, {0x2590, 0x8F},
+    {0x2591, 0x90}, {0x2592, 0x91}, {0x2593, 0x92}, {0x25A0, 0x94},
+};
+
+static const uint16_t CP1251_TO_UNICODE[128] PROGMEM = {
+    0x0402, 0x0403, 0x201A, 0x0453, 0x201E, 0x2026, 0x2020, 0x2021,
+    0x20AC, 0x2030, 0x0409, 0x2039, 0x040A, 0x040C, 0x040B, 0x040F,
+    0x0452, 0x2018, 0x2019, 0x201C, 0x201D, 0x2022, 0x2013, 0x2014,
+    0x0000, 0x2122, 0x0459, 0x203A, 0x045A, 0x045C, 0x045B, 0x045F,
+    0x00A0, 0x040E, 0x045E, 0x0408, 0x00A4, 0x0490, 0x00A6, 0x00A7,
+    0x0401, 0x00A9, 0x0404, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x0407,
+    0x00B0, 0x00B1, 0x0406, 0x0456, 0x0491, 0x00B5, 0x00B6, 0x00B7,
+    0x0451, 0x2116, 0x0454, 0x00BB, 0x0458, 0x0405, 0x0455, 0x0457,
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0416, 0x0417,
+    0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E, 0x041F,
+    0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427,
+    0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E, 0x042F,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0436, 0x0437,
+    0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E, 0x043F,
+    0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447,
+    0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E, 0x044F,
+};
+
+static const CharsetReverse CP1251_FROM_UNICODE[127] PROGMEM = {
+    {0x00A0, 0xA0}, {0x00A4, 0xA4}, {0x00A6, 0xA6}, {0x00A7, 0xA7},
+    {0x00A9, 0xA9}, {0x00AB, 0xAB}, {0x00AC, 0xAC}, {0x00AD, 0xAD},
+    {0x00AE, 0xAE}, {0x00B0, 0xB0}, {0x00B1, 0xB1}, {0x00B5, 0xB5},
+    {0x00B6, 0xB6}, {0x00B7, 0xB7}, {0x00BB, 0xBB}, {0x0401, 0xA8},
+    {0x0402, 0x80}, {0x0403, 0x81}, {0x0404, 0xAA}, {0x0405, 0xBD},
+    {0x0406, 0xB2}, {0x0407, 0xAF}, {0x0408, 0xA3}, {0x0409, 0x8A},
+    {0x040A, 0x8C}, {0x040B, 0x8E}, {0x040C, 0x8D}, {0x040E, 0xA1},
+    {0x040F, 0x8F}, {0x0410, 0xC0}, {0x0411, 0xC1}, {0x0412, 0xC2},
+    {0x0413, 0xC3}, {0x0414, 0xC4}, {0x0415, 0xC5}, {0x0416, 0xC6},
+    {0x0417, 0xC7}, {0x0418, 0xC8}, {0x0419, 0xC9}, {0x041A, 0xCA},
+    {0x041B, 0xCB}, {0x041C, 0xCC}, {0x041D, 0xCD}, {0x041E, 0xCE},
+    {0x041F, 0xCF}, {0x0420, 0xD0}, {0x0421, 0xD1}, {0x0422, 0xD2},
+    {0x0423, 0xD3}, {0x0424, 0xD4}, {0x0425, 0xD5}, {0x0426, 0xD6},
+    {0x0427, 0xD7}, {0x0428, 0xD8}, {0x0429, 0xD9}, {0x042A, 0xDA},
+    {0x042B, 0xDB}, {0x042C, 0xDC}, {0x042D, 0xDD}, {0x042E, 0xDE},
+    {0x042F, 0xDF}, {0x0430, 0xE0}, {0x0431, 0xE1}, {0x0432, 0xE2},
+    {0x0433, 0xE3}, {0x0434, 0xE4}, {0x0435, 0xE5}, {0x0436, 0xE6},
+    {0x0437, 0xE7}, {0x0438, 0xE8}, {0x0439, 0xE9}, {0x043A, 0xEA},
+    {0x043B, 0xEB}, {0x043C, 0xEC}, {0x043D, 0xED}, {0x043E, 0xEE},
+    {0x043F, 0xEF}, {0x0440, 0xF0}, {0x0441, 0xF1}, {0x0442, 0xF2},
+    {0x0443, 0xF3}, {0x0444, 0xF4}, {0x0445, 0xF5}, {0x0446, 0xF6},
+    {0x0447, 0xF7}, {0x0448, 0xF8}, {0x0449, 0xF9}, {0x044A, 0xFA},
+    {0x044B, 0xFB}, {0x044C, 0xFC}, {0x044D, 0xFD}, {0x044E, 0xFE},
+    {0x044F, 0xFF}, {0x0451, 0xB8}, {0x0452, 0x90}, {0x0453, 0x83},
+    {0x0454, 0xBA}, {0x0455, 0xBE}, {0x0456, 0xB3}, {0x0457, 0xBF},
+    {0x0458, 0xBC}, {0x0459, 0x9A}, {0x045A, 0x9C}, {0x045B, 0x9E},
+    {0x045C, 0x9D}, {0x045E, 0xA2}, {0x045F, 0x9F}, {0x0490, 0xA5},
+    {0x0491, 0xB4}, {0x2013, 0x96}, {0x2014, 0x97}, {0x2018, 0x91},
+    {0x2019, 0x92}, {0x201A, 0x82}, {0x201C, 0x93}, {0x201D, 0x94},
+    {0x201E, 0x84}, {0x2020, 0x86}, {0x2021, 0x87}, {0x2022, 0x95},
+    {0x2026, 0x85}, {0x2030, 0x89}, {0x2039, 0x8B}, {0x203A, 0x9B},
+    {0x20AC, 0x88}, {0x2116, 0xB9}, {0x2122, 0x99},
+};
+
+#endif
@@ -0,0 +1,543 @@
+#include "dnsproxy.h"
+#include "globals.h"
+#include "ppp.h"
+#include <WiFiUdp.h>
+
+#define DNS_PORT 53
+#define DNS_UPSTREAM_PORT_MIN 49152 // Our side of the queries to the resolver,
+#define DNS_UPSTREAM_PORTS 16384     // picked at random from the dynamic range
+#define DNS_HEADER 12
+
+// Header flags
+#define DNS_QR 0x80 // In the third byte
+#define DNS_TC 0x02
+#define DNS_RCODE_MASK 0x0F // In the fourth byte
+#define DNS_NXDOMAIN 3
+#define DNS_SERVFAIL 2
+
+#define DNS_TYPE_SOA 6
+#define DNS_TYPE_OPT 41
+
+DnsStats dnsStats = {0, 0, 0, 0, 0};
+
+struct CacheEntry
+{
+    uint8_t *data;        // The answer as received, ID and all
+    uint16_t len;
+    uint16_t questionLen; // Bytes of the question after the header
+    uint32_t stored;      // millis() when cached
+    uint32_t ttl;         // Seconds
+    uint32_t lastUsed;
+};
+
+struct Pending
+{
+    bool used;
+    uint16_t id;       // ID sent upstream, random
+    uint16_t clientId; // ID the computer used
+    uint16_t clientPort;
+    uint32_t server;   // Resolver asked, only it may answer
+    uint16_t questionLen;
+    uint32_t questionHash;
+    uint32_t sent;
+};
+
+static WiFiUDP dnsServer;
+static WiFiUDP dnsUpstream;
+static uint16_t upstreamPort = 0;
+static bool running = false;
+static CacheEntry cache[DNS_CACHE_ENTRIES];
+static size_t cacheBytes = 0;
+static Pending pending[DNS_PENDING];
+
+static uint16_t get16(const uint8_t *p)
+{
+    return (p[0] << 8) | p[1];
+}
+
+static uint32_t get32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static void put16(uint8_t *p, uint16_t v)
+{
+    p[0] = v >> 8;
+    p[1] = v;
+}
+
+static void put32(uint8_t *p, uint32_t v)
+{
+    p[0] = v >> 24;
+    p[1] = v >> 16;
+    p[2] = v >> 8;
+    p[3] = v;
+}
+
+// Position after the name at pos, or 0 if it runs off the end
+static size_t skipName(const uint8_t *msg, size_t len, size_t pos)
+{
+    while (pos < len)
+    {
+        uint8_t b = msg[pos];
+        if (b == 0)
+            return pos + 1;
+        if ((b & 0xC0) == 0xC0)
+            return pos + 2 <= len ? pos + 2 : 0;
+        if (b & 0xC0)
+            return 0;
+        pos += b + 1;
+    }
+    return 0;
+}
+
+// Length of the single question, or 0 if it cannot be used as a cache key
+static size_t questionLength(const uint8_t *msg, size_t len)
+{
+    if (len < DNS_HEADER || get16(msg + 4) != 1)
+        return 0;
+    size_t pos = DNS_HEADER;
+    while (pos < len && msg[pos] != 0)
+    {
+        if (msg[pos] & 0xC0)
+            return 0; // Compressed names are not expected in a question
+        pos += msg[pos] + 1;
+    }
+    pos += 5; // Root label, type and class
+    return pos <= len ? pos - DNS_HEADER : 0;
+}
+
+// Walks the records after the question. Ages every TTL by age seconds and
+// finds the lowest TTL of the answers and authority records, and the
+// negative TTL from an SOA. Returns false on a malformed message.
+static bool scanRecords(uint8_t *msg, size_t len, size_t questionLen, uint32_t age, uint32_t &minTtl,
+                        uint32_t &soaTtl)
+{
+    minTtl = DNS_TTL_MAX;
+    soaTtl = 0;
+    size_t pos = DNS_HEADER + questionLen;
+    uint16_t answers = get16(msg + 6);
+    uint16_t authority = get16(msg + 8);
+    uint16_t total = answers + authority + get16(msg + 10);
+    for (uint16_t i = 0; i < total; i++)
+    {
+        pos = skipName(msg, len, pos);
+        if (pos == 0 || pos + 10 > len)
+            return false;
+        uint16_t type = get16(msg + pos);
+        uint16_t rdlen = get16(msg + pos + 8);
+        if (pos + 10 + rdlen > len)
+            return false;
+        if (type != DNS_TYPE_OPT)
+        {
+            uint32_t ttl = get32(msg + pos + 4);
+            if (i < answers + authority && ttl < minTtl)
+                minTtl = ttl;
+            if (type == DNS_TYPE_SOA && i >= answers && i < answers + authority)
+            {
+                // The SOA minimum is the last field of its data
+                uint32_t minimum = get32(msg + pos + 10 + rdlen - 4);
+                soaTtl = min(ttl, minimum);
+            }
+            if (age > 0)
+                put32(msg + pos + 4, ttl > age ? ttl - age : 0);
+        }
+        pos += 10 + rdlen;
+    }
+    return true;
+}
+
+// FNV-1a of the question, ignoring case as resolvers may change it
+static uint32_t hashQuestion(const uint8_t *msg, size_t questionLen)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < questionLen; i++)
+    {
+        hash ^= tolower(msg[DNS_HEADER + i]);
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static uint32_t random32()
+{
+#ifdef ESP32
+    return esp_random();
+#else
+    return RANDOM_REG32;
+#endif
+}
+
+// Upstream IDs and source ports are random so that an answer cannot be
+// guessed by another host on the Wi-Fi network (RFC 5452). The port is
+// changed whenever no query is in flight, so under a burst of lookups only
+// the ID varies.
+static uint16_t randomId()
+{
+    while (true)
+    {
+        uint16_t id = random32();
+        bool taken = false;
+        for (const Pending &p : pending)
+        {
+            if (p.used && p.id == id)
+                taken = true;
+        }
+        if (!taken)
+            return id;
+    }
+}
+
+static bool anyPending()
+{
+    for (const Pending &p : pending)
+    {
+        if (p.used)
+            return true;
+    }
+    return false;
+}
+
+// Moves the upstream socket to a new random port, false if none would open
+static bool rebindUpstream()
+{
+    if (upstreamPort)
+        dnsUpstream.stop();
+    for (int tries = 0; tries < 8; tries++)
+    {
+        upstreamPort = DNS_UPSTREAM_PORT_MIN + random32() % DNS_UPSTREAM_PORTS;
+        if (dnsUpstream.begin(upstreamPort))
+            return true;
+    }
+    upstreamPort = 0;
+    return false;
+}
+
+// Lowers the UDP payload size of an EDNS0 OPT record to DNS_MAX_PACKET, so
+// the resolver truncates rather than sends more than we can take
+static void clampEdns(uint8_t *msg, size_t len)
+{
+    size_t pos = DNS_HEADER;
+    for (uint16_t i = 0; i < get16(msg + 4); i++)
+    {
+        pos = skipName(msg, len, pos);
+        if (pos == 0 || pos + 4 > len)
+            return;
+        pos += 4;
+    }
+    uint16_t total = get16(msg + 6) + get16(msg + 8) + get16(msg + 10);
+    for (uint16_t i = 0; i < total; i++)
+    {
+        pos = skipName(msg, len, pos);
+        if (pos == 0 || pos + 10 > len)
+            return;
+        if (get16(msg + pos) == DNS_TYPE_OPT && get16(msg + pos + 2) > DNS_MAX_PACKET)
+            put16(msg + pos + 2, DNS_MAX_PACKET);
+        pos += 10 + get16(msg + pos + 8);
+    }
+}
+
+// Cuts msg down to its header and question, for a message that did not
+// fit in DNS_MAX_PACKET. Returns the new length, 0 if there is no usable
+// question.
+static size_t questionOnly(uint8_t *msg, size_t len)
+{
+    size_t questionLen = questionLength(msg, len);
+    if (questionLen == 0)
+        return 0;
+    put16(msg + 6, 0);
+    put16(msg + 8, 0);
+    put16(msg + 10, 0);
+    return DNS_HEADER + questionLen;
+}
+
+static bool sameQuestion(const uint8_t *a, const uint8_t *b, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+    {
+        if (tolower(a[DNS_HEADER + i]) != tolower(b[DNS_HEADER + i]))
+            return false;
+    }
+    return true;
+}
+
+static void dropEntry(CacheEntry &entry)
+{
+    cacheBytes -= entry.len;
+    delete[] entry.data;
+    entry.data = nullptr;
+    entry.len = 0;
+}
+
+static bool expired(const CacheEntry &entry, uint32_t now)
+{
+    return (now - entry.stored) / 1000 >= entry.ttl;
+}
+
+static CacheEntry *lookup(const uint8_t *query, size_t questionLen)
+{
+    uint32_t now = millis();
+    for (CacheEntry &entry : cache)
+    {
+        if (!entry.data || entry.questionLen != questionLen || !sameQuestion(entry.data, query, questionLen))
+            continue;
+        if (expired(entry, now))
+        {
+            dropEntry(entry);
+            return nullptr;
+        }
+        entry.lastUsed = now;
+        return &entry;
+    }
+    return nullptr;
+}
+
+static void store(const uint8_t *answer, size_t len, size_t questionLen)
+{
+    uint8_t rcode = answer[3] & DNS_RCODE_MASK;
+    if ((answer[2] & DNS_TC) || (rcode != 0 && rcode != DNS_NXDOMAIN) || len > DNS_CACHE_BYTES)
+        return;
+
+    uint32_t minTtl;
+    uint32_t soaTtl;
+    if (!scanRecords((uint8_t *)answer, len, questionLen, 0, minTtl, soaTtl))
+        return;
+    bool negative = rcode == DNS_NXDOMAIN || get16(answer + 6) == 0;
+    uint32_t ttl = negative ? min(soaTtl, (uint32_t)DNS_NEGATIVE_TTL_MAX) : minTtl;
+    if (ttl == 0)
+        return;
+
+    // Make room: the same question, expired entries, then the least used
+    uint32_t now = millis();
+    CacheEntry *slot = nullptr;
+    for (CacheEntry &entry : cache)
+    {
+        if (entry.data && (expired(entry, now) ||
+                           (entry.questionLen == questionLen && sameQuestion(entry.data, answer, questionLen))))
+            dropEntry(entry);
+    }
+    while (true)
+    {
+        CacheEntry *oldest = nullptr;
+        slot = nullptr;
+        for (CacheEntry &entry : cache)
+        {
+            if (!entry.data)
+                slot = &entry;
+            else if (!oldest || now - entry.lastUsed > now - oldest->lastUsed)
+                oldest = &entry;
+        }
+        if (slot && cacheBytes + len <= DNS_CACHE_BYTES)
+            break;
+        if (!oldest)
+            return;
+        dropEntry(*oldest);
+    }
+
+    slot->data = new (std::nothrow) uint8_t[len];
+    if (!slot->data)
+        return;
+    memcpy(slot->data, answer, len);
+    slot->len = len;
+    slot->questionLen = questionLen;
+    slot->stored = now;
+    slot->ttl = ttl;
+    slot->lastUsed = now;
+    cacheBytes += len;
+}
+
+static void reply(const uint8_t *msg, size_t len, uint16_t port)
+{
+    dnsServer.beginPacket(PPP_PEER_ADDRESS, port);
+    dnsServer.write(msg, len);
+    dnsServer.endPacket();
+}
+
+static void replyServfail(uint8_t *query, size_t len, uint16_t port)
+{
+    query[2] |= DNS_QR;
+    query[3] = (query[3] & ~DNS_RCODE_MASK) | DNS_SERVFAIL;
+    reply(query, len, port);
+}
+
+static void handleQuery()
+{
+    uint8_t msg[DNS_MAX_PACKET];
+    int size = dnsServer.parsePacket();
+    if (size <= 0)
+        return;
+    IPAddress from = dnsServer.remoteIP();
+    uint16_t port = dnsServer.remotePort();
+    size_t len = dnsServer.read(msg, sizeof(msg));
+    dnsServer.flush();
+    if (from != PPP_PEER_ADDRESS || len < DNS_HEADER || (msg[2] & DNS_QR))
+        return;
+    dnsStats.queries++;
+
+    // A query longer than we can hold would be forwarded cut short
+    if ((size_t)size > sizeof(msg))
+    {
+        dnsStats.failures++;
+        len = questionOnly(msg, len);
+        if (len)
+            replyServfail(msg, len, port);
+        return;
+    }
+
+    size_t questionLen = questionLength(msg, len);
+    CacheEntry *entry = questionLen ? lookup(msg, questionLen) : nullptr;
+    if (entry)
+    {
+        uint8_t answer[DNS_MAX_PACKET];
+        size_t answerLen = min((size_t)entry->len, sizeof(answer));
+        memcpy(answer, entry->data, answerLen);
+        memcpy(answer, msg, 2); // The computer's ID
+        uint32_t minTtl;
+        uint32_t soaTtl;
+        scanRecords(answer, answerLen, questionLen, (millis() - entry->stored) / 1000, minTtl, soaTtl);
+        reply(answer, answerLen, port);
+        dnsStats.hits++;
+        if ((answer[3] & DNS_RCODE_MASK) == DNS_NXDOMAIN || get16(answer + 6) == 0)
+            dnsStats.negativeHits++;
+        return;
+    }
+
+    Pending *slot = nullptr;
+    for (Pending &p : pending)
+    {
+        if (!p.used)
+        {
+            slot = &p;
+            break;
+        }
+    }
+    IPAddress upstream = WiFi.dnsIP(0);
+    if (!slot || (uint32_t)upstream == 0 || (!anyPending() && !rebindUpstream()))
+    {
+        dnsStats.failures++;
+        replyServfail(msg, len, port);
+        return;
+    }
+    slot->used = true;
+    slot->id = randomId();
+    slot->clientId = get16(msg);
+    slot->clientPort = port;
+    slot->server = (uint32_t)upstream;
+    slot->questionLen = questionLen;
+    slot->questionHash = hashQuestion(msg, questionLen);
+    slot->sent = millis();
+    put16(msg, slot->id);
+    clampEdns(msg, len);
+    dnsUpstream.beginPacket(upstream, DNS_PORT);
+    dnsUpstream.write(msg, len);
+    dnsUpstream.endPacket();
+    dnsStats.forwarded++;
+}
+
+static void handleAnswer()
+{
+    uint8_t msg[DNS_MAX_PACKET];
+    int size = dnsUpstream.parsePacket();
+    if (size <= 0)
+        return;
+    IPAddress from = dnsUpstream.remoteIP();
+    uint16_t fromPort = dnsUpstream.remotePort();
+    size_t len = dnsUpstream.read(msg, sizeof(msg));
+    dnsUpstream.flush();
+    if (len < DNS_HEADER || !(msg[2] & DNS_QR) || fromPort != DNS_PORT)
+        return;
+    uint16_t id = get16(msg);
+    size_t questionLen = questionLength(msg, len);
+    for (Pending &p : pending)
+    {
+        // Anything but the resolver we asked, answering the question we
+        // asked, is dropped and the query left to time out
+        if (!p.used || p.id != id || p.server != (uint32_t)from || p.questionLen != questionLen ||
+            p.questionHash != hashQuestion(msg, questionLen))
+            continue;
+        p.used = false;
+        put16(msg, p.clientId);
+        if ((size_t)size > sizeof(msg))
+        {
+            // The resolver ignored the clamped OPT size. Tell the computer
+            // the answer was truncated rather than pass on a cut message.
+            len = questionOnly(msg, len);
+            msg[2] |= DNS_TC;
+            if (len)
+                reply(msg, len, p.clientPort);
+            else
+                dnsStats.failures++;
+            return;
+        }
+        reply(msg, len, p.clientPort);
+        if (questionLen)
+            store(msg, len, questionLen);
+        return;
+    }
+}
+
+bool dnsProxyBegin()
+{
+    if (running)
+        return true;
+    if (!dnsServer.begin(DNS_PORT))
+        return false;
+    if (!rebindUpstream())
+    {
+        dnsServer.stop();
+        return false;
+    }
+    for (Pending &p : pending)
+        p.used = false;
+    running = true;
+    return true;
+}
+
+void dnsProxyEnd()
+{
+    if (!running)
+        return;
+    dnsServer.stop();
+    dnsUpstream.stop();
+    upstreamPort = 0;
+    running = false;
+}
+
+bool dnsProxyRunning()
+{
+    return running;
+}
+
+void handleDNSProxy()
+{
+    if (!running)
+        return;
+    handleQuery();
+    handleAnswer();
+
+    uint32_t now = millis();
+    for (Pending &p : pending)
+    {
+        if (p.used && now - p.sent > DNS_TIMEOUT)
+        {
+            p.used = false;
+            dnsStats.failures++;
+        }
+    }
+}
+
+size_t dnsCacheEntries()
+{
+    size_t n = 0;
+    for (const CacheEntry &entry : cache)
+    {
+        if (entry.data)
+            n++;
+    }
+    return n;
+}
+
+size_t dnsCacheBytes()
+{
+    return cacheBytes;
+}
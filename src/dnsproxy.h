@@ -0,0 +1,49 @@
+#ifndef DNSPROXY_H
+#define DNSPROXY_H
+
+#include <Arduino.h>
+
+// DNS forwarder for the computer on PPP or SLIP. Queries sent to our
+// address are answered from a cache when possible and otherwise passed to
+// the Wi-Fi resolver. Answers are kept for their TTL, and NXDOMAIN or
+// empty answers for the SOA minimum (RFC 2308), up to a fixed number of
+// entries and bytes, least recently used first out.
+
+#ifdef ESP8266
+#define DNS_CACHE_ENTRIES 16
+#define DNS_CACHE_BYTES 4096
+#define DNS_PENDING 4
+#else
+#define DNS_CACHE_ENTRIES 64
+#define DNS_CACHE_BYTES 32768
+#define DNS_PENDING 16
+#endif
+
+#define DNS_MAX_PACKET 512
+#define DNS_TIMEOUT 5000         // ms to wait for the upstream answer
+#define DNS_TTL_MAX 86400        // Longest an answer is kept, seconds
+#define DNS_NEGATIVE_TTL_MAX 300 // Longest a negative answer is kept
+
+struct DnsStats
+{
+    uint32_t queries;
+    uint32_t hits;
+    uint32_t negativeHits;
+    uint32_t forwarded;
+    uint32_t failures; // Timeouts and queries that could not be forwarded
+};
+
+extern DnsStats dnsStats;
+
+// Starts listening on port 53, returns false if that is not possible
+bool dnsProxyBegin();
+void dnsProxyEnd();
+bool dnsProxyRunning();
+
+// Serves queries and answers, called from loop() while the link is up
+void handleDNSProxy();
+
+size_t dnsCacheEntries();
+size_t dnsCacheBytes();
+
+#endif
@@ -14,11 +14,12 @@
 #elif defined(ESP32)
     #include <WiFi.h>
     #include <ESPmDNS.h>
-    // ESP32 doesn't support PPP in Arduino framework by default
 #endif
 
 #include <IPAddress.h>
 #include <EEPROM.h>
+#include "ppp.h"
+#include "wifi.h"
 
 String connectTimeString();
 void readSettings();
@@ -32,12 +33,6 @@ void handleConnectedMode();
 void sendResult(int resultCode);
 void setCarrierDCDPin(byte carrier);
 
-#ifdef ESP8266
-    #if NAPT_SUPPORTED
-        u32_t ppp_output_cb(ppp_pcb *pcb, unsigned char *data, u32_t len, void *ctx);
-        void ppp_status_cb(ppp_pcb *pcb, int err_code, void *ctx);
-    #endif
-#endif
 
 void sendString(String msg);
 void hangUp();
@@ -58,7 +53,6 @@ void handleGopherRequest();
 void welcome();
 void handleFlowControl();
 String ipToString(IPAddress ip);
-void check_for_firmware_update();
 String getWifiStatus();
 void handleGetStatus();
 void redirectToRoot();
@@ -81,17 +75,19 @@ String getCallLength();
 
 WiFiClient tcpClient;
 WiFiServer tcpServer(tcpServerPort);
+#ifdef ESP32
+TlsClient tlsClient;
+bool tlsConnected = false; // Dialled call is running over tlsClient
+#endif
 
 #ifdef ESP8266
     MDNSResponder mdns;
-    #if NAPT_SUPPORTED
-        ppp_pcb *ppp;
-        struct netif ppp_netif;
-    #else
-        void *ppp = NULL; // Placeholder
-    #endif
-#elif defined(ESP32)
-    void *ppp = NULL; // ESP32 doesn't support PPP in this context
+#endif
+#if NAPT_SUPPORTED
+    ppp_pcb *ppp;
+    struct netif ppp_netif;
+#else
+    void *ppp = NULL; // Placeholder
 #endif
 
 String speedDials[10];
@@ -104,6 +100,7 @@ bool cmdMode = true;        // Are we in AT command mode or connected mode
 bool callConnected = false; // Are we currently in a call
 bool telnet = false;        // Is telnet control code handling enabled
 bool sshConnected = false; // Are we currently in a SSH session
+bool sshConnecting = false; // Is an SSH connect still in progress
 bool verboseResults = false;
 bool firmwareUpdating = false;
 int tcpServerPort = LISTEN_PORT;
@@ -120,6 +117,22 @@ byte flowControl = F_NONE; // Use flow control
 bool txPaused = false;     // Has flow control asked us to pause?
 byte pinPolarity = P_NORMAL;
 bool quietMode = false;
+byte termCols = 80;
+byte termRows = 24;
+byte termCharset = 0;     // Character set of the terminal, UTF-8 on the line when set
+byte termAnsi = 0;        // Escape sequence filter for what the terminal understands
+byte sshKeepalive = 60;   // Seconds of SSH idle time before a keepalive, 0 = off
+byte sshReconnects = 0;   // Attempts to re-establish a dropped SSH session
+String sshTermType = "vt100";
+byte pppOptions = PPP_OPT_DEFAULT; // What dialPPP() negotiates
+uint16_t pppMru = 1500;
+uint16_t naptTableSize = NAPT_TABLE_DEFAULT; // NAT entries, takes effect at boot
+PortForward portForwards[PORT_FORWARD_MAX];
+byte wifiBssid[6];   // Cached by connectWiFi(), not part of AT&W
+byte wifiChannel = 0;
+bool staticIp = false; // Use the addresses below instead of DHCP
+IPAddress staticAddress, staticGateway, staticDns, staticMask;
+byte powerSave = PS_DEFAULT; // When the radio may sleep
 
 void setCarrierDCDPin(byte carrier)
 {
@@ -223,15 +236,6 @@ void welcome()
         Serial.println();
 }
 
-void waitForFirstInput()
-{
-        while (!Serial.available())
-        {
-                // Wait for any character
-        }
-        Serial.read();
-}
-
 String ipToString(IPAddress ip)
 {
         return String(ip[0]) + "." + String(ip[1]) + "." + String(ip[2]) + "." + String(ip[3]);
@@ -239,18 +243,31 @@ String ipToString(IPAddress ip)
 
 void hangUp()
 {
-#ifdef ESP8266
-    #if NAPT_SUPPORTED
+#ifdef PPP_ENABLED
         if (ppp)
         {
-                ppp_close(ppp, 0);
+                closePPP(0);
+        }
+        else if (slipActive)
+        {
+                closeSLIP();
         }
         else
-    #endif
 #endif
         {
                 tcpClient.stop();
         }
+#ifdef ESP32
+        if (tlsConnected)
+        {
+                tlsClient.stop();
+                tlsConnected = false;
+        }
+        if (sshConnected || sshConnecting)
+        {
+                cleanupSSHSession();
+        }
+#endif
         callConnected = false;
         cmdMode = true;
         setCarrierDCDPin(callConnected);
@@ -272,7 +289,7 @@ void answerCall()
 
 void handleIncomingConnection()
 {
-        if (callConnected == 1 || (autoAnswer == false && ringCount > 3))
+        if (callConnected == 1 || sshConnecting || (autoAnswer == false && ringCount > 3))
         {
                 ringCount = lastRingMs = 0;
                 WiFiClient anotherClient = tcpServer.accept();
@@ -286,6 +303,7 @@ void handleIncomingConnection()
                 anotherClient.stop();
                 return;
         }
+        powerSaveWake(); // Answer without the sleep delay
         if (autoAnswer == false)
         {
                 if (millis() - lastRingMs > 6000 || lastRingMs == 0)
@@ -365,20 +383,27 @@ void handleCommandMode()
 }void restoreCommandModeIfDisconnected()
 {
         bool pppConnected = false;
-#ifdef ESP8266
-    #if NAPT_SUPPORTED
-        pppConnected = (ppp != NULL);
-    #endif
+#ifdef PPP_ENABLED
+        pppConnected = (ppp != NULL) || slipActive;
 #endif
         
 #ifdef ESP32
         bool sshActive = sshConnected;
+        bool tlsActive = tlsConnected && tlsClient.connected();
 #else
         bool sshActive = false;
+        bool tlsActive = false;
 #endif
         
-        if ((!tcpClient.connected() && !pppConnected && !sshActive) && (cmdMode == false) && callConnected == true)
+        if ((!tcpClient.connected() && !pppConnected && !sshActive && !tlsActive) && (cmdMode == false) && callConnected == true)
         {
+#ifdef ESP32
+                if (tlsConnected)
+                {
+                        tlsClient.stop();
+                        tlsConnected = false;
+                }
+#endif
                 cmdMode = true;
                 sendResult(RES_NOCARRIER);
                 connectTime = 0;
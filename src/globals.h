@@ -15,6 +15,15 @@
 #elif defined(ESP32)
     #include <WiFi.h>
     #include <ESPmDNS.h>
+    #include "tlsclient.h"
+    #if NAPT_SUPPORTED
+        #include <lwip/lwip_napt.h>
+        #include <lwip/dns.h>
+        #include <lwip/netif.h>
+        #include <netif/ppp/ppp.h>
+        #include <netif/ppp/pppos.h>
+        #include <netif/ppp/pppapi.h>
+    #endif
 #endif
 
 #include <IPAddress.h>
@@ -28,11 +37,10 @@
 #define SSID_LEN 32
 #define PASS_ADDRESS 34
 #define PASS_LEN 63
-#define IP_TYPE_ADDRESS 97   // for future use
-#define STATIC_IP_ADDRESS 98 // length 4, for future use
-#define STATIC_GW 102        // length 4, for future use
-#define STATIC_DNS 106       // length 4, for future use
-#define STATIC_MASK 110      // length 4, for future use
+#define IP_TYPE_ADDRESS 97   // "d" for DHCP, "s" for static
+#define STATIC_IP_ADDRESS 98 // length 4
+#define STATIC_GW 102        // length 4
+#define STATIC_DNS 106       // length 4
 #define BAUD_ADDRESS 111
 #define ECHO_ADDRESS 112
 #define SERVER_PORT_ADDRESS 113 // 2 bytes
@@ -42,6 +50,22 @@
 #define FLOW_CONTROL_ADDRESS 119
 #define PIN_POLARITY_ADDRESS 120
 #define QUIET_MODE_ADDRESS 121
+#define TERM_COLS_ADDRESS 122 // 1 byte, terminal width for the text browsers
+#define TERM_ROWS_ADDRESS 123 // 1 byte, terminal height, 0 = no paging
+#define TERM_CHARSET_ADDRESS 124 // 1 byte, terminal character set for calls
+#define TERM_ANSI_ADDRESS 125    // 1 byte, escape sequence filter for calls
+#define SSH_KEEPALIVE_ADDRESS 126 // 1 byte, S40: SSH keepalive interval in seconds, 0 = off
+#define SSH_RECONNECT_ADDRESS 127 // 1 byte, S41: SSH reconnect attempts, 0 = off
+#define TERM_TYPE_ADDRESS 128     // TERM for SSH sessions
+#define TERM_TYPE_LEN 16
+#define PPP_OPTIONS_ADDRESS 144   // 1 byte, PPP_OPT_* flags of the PPP profile
+#define PPP_MRU_ADDRESS 145       // 2 bytes, MRU asked for in LCP
+#define NAPT_TABLE_ADDRESS 147    // 2 bytes, NAT table entries
+#define PORT_FORWARD_ADDRESS 149  // 5 bytes each for PORT_FORWARD_MAX: protocol, port, port on the computer
+#define WIFI_BSSID_ADDRESS 179    // 6 bytes, access point of the last good connect
+#define WIFI_CHANNEL_ADDRESS 185  // 1 byte, its channel, 0 = none
+#define STATIC_MASK 186           // length 4, moved here as 110 overlapped BAUD_ADDRESS
+#define POWER_SAVE_ADDRESS 190    // 1 byte, PS_* Wi-Fi power save policy
 #define DIAL0_ADDRESS 200
 #define DIAL1_ADDRESS 250
 #define DIAL2_ADDRESS 300
@@ -54,7 +78,8 @@
 #define DIAL9_ADDRESS 650
 #define BUSY_MSG_ADDRESS 700
 #define BUSY_MSG_LEN 80
-#define LAST_ADDRESS 780
+#define WIFI_EXTRA_ADDRESS 781    // SSID_LEN + PASS_LEN for each of WIFI_EXTRA_NETWORKS
+#define LAST_ADDRESS 1065
 #define LISTEN_PORT 23 // Listen to this if not connected. Set to zero to disable.
 
 #define DCD_PIN 2 // DCD Carrier Status
@@ -108,23 +133,36 @@ String connectTimeString();
 void readSettings();
 void serialSetup();
 void wifiSetup();
+bool wifiSetupSettled();
+void wifiSetupReport();
 void webserverSetup();
 void command();
 void handleOTAFirmware();
+void startFirmwareCheck();
+void pollFirmwareCheck();
+void printFirmwareCheck();
+void updateFirmwareFromSD(String args);
 void handleWebServer();
 void handleConnectedMode();
 void sendResult(int resultCode);
 void setCarrierDCDPin(byte carrier);
-#ifdef ESP8266
+#if NAPT_SUPPORTED
 u32_t ppp_output_cb(ppp_pcb *pcb, unsigned char *data, u32_t len, void *ctx);
 void ppp_status_cb(ppp_pcb *pcb, int err_code, void *ctx);
+void dialPPP();
+void pppInput(uint8_t *data, size_t len);
+void closePPP(uint8_t nocarrier);
+ip4_addr_t toIp4(IPAddress ip);
 #endif
+void pollPPPStatus();
+void trackEscape(const uint8_t *buf, size_t len);
 void sendString(String msg);
 void hangUp();
 void answerCall();
 void displayHelp();
 void disconnectWiFi();
 void connectWiFi();
+void pollWiFiSignal();
 void setBaudRate(int inSpeed);
 void displayNetworkStatus();
 void displayCurrentSettings();
@@ -135,19 +173,35 @@ void storeSpeedDial(byte num, String location);
 void defaultEEPROM();
 void handleHTTPRequest();
 void handleGopherRequest();
+void browseWeb(String url);
 void connectSSH(String upCmd);
 void cleanupSSHSession();
 void handleSSHData();
+void pollSSHEvents();
+uint32_t sshStackPeak();
+void sshGenerateKey();
+void sshShowKey();
+void sshListKnownHosts();
+void sshForgetHost(String hostPort);
 void welcome();
 void handleFlowControl();
 String ipToString(IPAddress ip);
-void check_for_firmware_update();
+String ipConfigString(bool isStatic, IPAddress ip, IPAddress mask, IPAddress gateway, IPAddress dns);
 String getWifiStatus();
 void handleGetStatus();
 void initSDCard();
 bool isSDCardAvailable();
+bool requireSDCard();
 void manualInitSDCard();
 void testSDCardSpeed();
+void kermitReceiveToSD();
+void kermitSendFromSD(String path);
+void xmodemSendFromSD(String args, bool batch);
+void printTransferSummary(const String &verb, const String &name, size_t bytes, unsigned long ms);
+void printTransferProgress(size_t done, int32_t total, unsigned long ms);
+class XModemSource;
+bool receiveStreamToSD(XModemSource &src, const String &name, int32_t length);
+bool sendStreamToHost(XModemSource &src, const String &name, int32_t length, bool batch);
 void redirectToRoot();
 void handleRoot();
 void handleWebHangUp();
@@ -165,7 +219,6 @@ String getCallLength();
 void sendString(String msg);
 void waitForSpace();
 void welcome();
-void waitForFirstInput();
 String ipToString(IPAddress ip);
 void hangUp();
 void answerCall();
@@ -174,8 +227,13 @@ void handleFlowControl();
 void handleCommandMode();
 extern WiFiServer tcpServer;
 extern WiFiClient tcpClient;
+#ifdef ESP32
+extern TlsClient tlsClient;
+extern bool tlsConnected;
+void dialTLS(const String &host, uint16_t port);
+#endif
 extern MDNSResponder mdns;
-#ifdef ESP8266
+#if NAPT_SUPPORTED
 #define PPP_ENABLED
 extern ppp_pcb *ppp;
 extern struct netif ppp_netif;
@@ -191,6 +249,7 @@ extern String cmd;
 extern bool cmdMode;
 extern bool callConnected;
 extern bool sshConnected;
+extern bool sshConnecting;
 extern bool telnet;
 extern bool verboseResults;
 extern bool firmwareUpdating;
@@ -208,3 +267,18 @@ extern byte flowControl;
 extern bool txPaused;
 extern byte pinPolarity;
 extern bool quietMode;
+extern byte termCols;
+extern byte termRows;
+extern byte termCharset;
+extern byte termAnsi;
+extern byte sshKeepalive;
+extern byte sshReconnects;
+extern String sshTermType;
+extern byte pppOptions;
+extern uint16_t pppMru;
+extern uint16_t naptTableSize;
+extern byte wifiBssid[6];
+extern byte wifiChannel;
+extern bool staticIp;
+extern byte powerSave;
+extern IPAddress staticAddress, staticGateway, staticDns, staticMask;
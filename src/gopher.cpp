@@ -1,46 +1,546 @@
+#if defined(ESP8266)
+  #include <ESP8266WiFi.h>
+#elif defined(ESP32)
+  #include <WiFi.h>
+#endif
 #include <Arduino.h>
+#include <new>
 #include "globals.h"
+#include "xmodem.h"
+#include "pager.h"
 
-void handleGopherRequest()
+// ATGPH<url> browses Gopherspace. Menus (types 1 and 7) are listed with
+// numbered items and paged to the terminal height, text (type 0) is shown
+// through the pager and binaries (9, g, I, s, 5) can be saved to SD or sent
+// over XMODEM/YMODEM. Menus are kept in a small RAM cache so that going back
+// needs no network round trip.
+
+#ifdef ESP8266
+#define GOPHER_MENU_MAX 6144
+#define GOPHER_CACHE_BYTES 8192
+#else
+#define GOPHER_MENU_MAX 32768
+#define GOPHER_CACHE_BYTES 65536
+#endif
+#define GOPHER_CACHE_ENTRIES 8
+#define GOPHER_HISTORY 16
+#define GOPHER_TIMEOUT 15000
+
+namespace
 {
-  int portIndex = cmd.indexOf(":", 14); // Index where port number might begin
-  int pathIndex = cmd.indexOf("/", 14); // Index first host name and possible port ends and path begins
-  int port;
-  String path, host;
-  if (pathIndex < 0)
+  struct GopherLocation
+  {
+    String host;
+    uint16_t port;
+    char type;
+    String selector; // Includes "\t<query>" for searches
+  };
+
+  struct CacheEntry
+  {
+    String key;
+    char *data;
+    size_t len;
+    unsigned long used;
+  };
+
+  CacheEntry cache[GOPHER_CACHE_ENTRIES];
+  size_t cacheBytes = 0;
+
+  String cacheKey(const GopherLocation &loc)
+  {
+    return loc.host + ":" + String(loc.port) + "/" + loc.selector;
+  }
+
+  CacheEntry *cacheFind(const String &key)
+  {
+    for (int i = 0; i < GOPHER_CACHE_ENTRIES; i++)
+    {
+      if (cache[i].data && cache[i].key == key)
+      {
+        cache[i].used = millis();
+        return &cache[i];
+      }
+    }
+    return nullptr;
+  }
+
+  void cacheEvict(CacheEntry &e)
+  {
+    cacheBytes -= e.len;
+    delete[] e.data;
+    e.data = nullptr;
+    e.len = 0;
+    e.key = "";
+  }
+
+  // Takes ownership of data. Least recently used menus make room.
+  CacheEntry *cacheStore(const String &key, char *data, size_t len)
   {
-    pathIndex = cmd.length();
+    CacheEntry *slot = nullptr;
+    while (true)
+    {
+      CacheEntry *oldest = nullptr;
+      slot = nullptr;
+      for (int i = 0; i < GOPHER_CACHE_ENTRIES; i++)
+      {
+        if (!cache[i].data)
+          slot = &cache[i];
+        else if (!oldest || cache[i].used < oldest->used)
+          oldest = &cache[i];
+      }
+      if (slot && cacheBytes + len <= GOPHER_CACHE_BYTES)
+        break;
+      cacheEvict(*oldest);
+    }
+    slot->key = key;
+    slot->data = data;
+    slot->len = len;
+    slot->used = millis();
+    cacheBytes += len;
+    return slot;
   }
-  if (portIndex < 0)
+
+  bool openSelector(WiFiClient &client, const GopherLocation &loc)
   {
-    port = 70;
-    portIndex = pathIndex;
+    if (!client.connect(loc.host.c_str(), loc.port))
+    {
+      Serial.println("Cannot connect to " + loc.host);
+      return false;
+    }
+    client.setNoDelay(true);
+    client.print(loc.selector + "\r\n");
+    return true;
   }
-  else
+
+  // Fetches a menu into the cache, returns nullptr on failure
+  CacheEntry *fetchMenu(const GopherLocation &loc)
   {
-    port = cmd.substring(portIndex + 1, pathIndex).toInt();
+    String key = cacheKey(loc);
+    CacheEntry *cached = cacheFind(key);
+    if (cached)
+      return cached;
+
+    WiFiClient client;
+    if (!openSelector(client, loc))
+      return nullptr;
+    char *data = new (std::nothrow) char[GOPHER_MENU_MAX];
+    if (!data)
+    {
+      client.stop();
+      Serial.println("Out of memory");
+      return nullptr;
+    }
+    size_t len = 0;
+    bool closed = false;
+    unsigned long lastData = millis();
+    while (len < GOPHER_MENU_MAX)
+    {
+      int avail = client.available();
+      if (avail <= 0)
+      {
+        if (!client.connected())
+        {
+          closed = true;
+          break;
+        }
+        if (millis() - lastData > GOPHER_TIMEOUT)
+          break;
+        yield();
+        continue;
+      }
+      int n = client.read((uint8_t *)data + len, min((size_t)avail, (size_t)GOPHER_MENU_MAX - len));
+      if (n > 0)
+      {
+        len += n;
+        lastData = millis();
+      }
+    }
+    // A full buffer is a deterministic truncation, a timeout is not
+    bool truncated = len == GOPHER_MENU_MAX;
+    if (truncated && !closed)
+      Serial.println("Menu truncated");
+    client.stop();
+
+    // Partial menus from a stalled server must not be cached
+    if (len == 0 || !(closed || truncated))
+    {
+      delete[] data;
+      Serial.println(len ? "Server timed out" : "Empty menu");
+      return nullptr;
+    }
+
+    // Shrink to size before caching
+    char *menu = new (std::nothrow) char[len + 1];
+    if (!menu)
+    {
+      delete[] data;
+      Serial.println("Out of memory");
+      return nullptr;
+    }
+    memcpy(menu, data, len);
+    menu[len] = 0;
+    delete[] data;
+    return cacheStore(key, menu, len);
   }
-  host = cmd.substring(14, portIndex);
-  path = cmd.substring(pathIndex, cmd.length());
-  if (path == "")
-    path = "/";
-  char *hostChr = new char[host.length() + 1];
-  host.toCharArray(hostChr, host.length() + 1);
-  if (!tcpClient.connect(hostChr, port))
+
+  struct MenuItem
   {
-    sendResult(RES_NOCARRIER);
-    connectTime = 0;
-    callConnected = false;
-    setCarrierDCDPin(callConnected);
+    char type;
+    String display;
+    String selector;
+    String host;
+    uint16_t port;
+  };
+
+  // Splits one menu line; false for the terminating "." line
+  bool parseMenuLine(const char *line, size_t len, MenuItem &item)
+  {
+    if (len == 0 || (len == 1 && line[0] == '.'))
+      return false;
+    item.type = line[0];
+    String fields[4];
+    int f = 0;
+    for (size_t i = 1; i < len && f < 4; i++)
+    {
+      if (line[i] == '\t')
+        f++;
+      else if (f < 4)
+        fields[f] += line[i];
+    }
+    item.display = fields[0];
+    item.selector = fields[1];
+    item.host = fields[2];
+    item.port = fields[3].length() ? fields[3].toInt() : 70;
+    return true;
   }
-  else
+
+  bool isNumbered(char type)
   {
-    sendResult(RES_CONNECT);
-    connectTime = millis();
-    cmdMode = false;
-    callConnected = true;
-    setCarrierDCDPin(callConnected);
-    tcpClient.print(path + "\r\n");
+    return type != 'i' && type != '3';
   }
-  delete[] hostChr;
+
+  const char *typeLabel(char type)
+  {
+    switch (type)
+    {
+    case '0':
+      return "TXT";
+    case '1':
+      return "DIR";
+    case '7':
+      return "ASK";
+    case '9':
+    case 'g':
+    case 'I':
+    case 's':
+    case '5':
+      return "BIN";
+    case 'h':
+      return "WEB";
+    case '8':
+    case 'T':
+      return "TEL";
+    default:
+      return "???";
+    }
+  }
+
+  // Walks the menu lines. With want == 0 every line is printed and the
+  // number of items returned; otherwise item number want is stored in out.
+  int walkMenu(const CacheEntry &menu, Print *out, int want, MenuItem *found)
+  {
+    int number = 0;
+    const char *p = menu.data;
+    const char *end = menu.data + menu.len;
+    size_t width = termCols > 12 ? termCols - 11 : 1;
+    while (p < end)
+    {
+      const char *eol = (const char *)memchr(p, '\n', end - p);
+      if (!eol)
+        eol = end;
+      size_t len = eol - p;
+      if (len > 0 && p[len - 1] == '\r')
+        len--;
+      MenuItem item;
+      bool more = parseMenuLine(p, len, item);
+      p = eol + 1;
+      if (!more)
+        break;
+      bool numbered = isNumbered(item.type);
+      if (numbered)
+        number++;
+      if (want)
+      {
+        if (numbered && number == want)
+        {
+          *found = item;
+          return number;
+        }
+        continue;
+      }
+      if (item.display.length() > width)
+        item.display = item.display.substring(0, width);
+      if (numbered)
+      {
+        char prefix[12];
+        snprintf(prefix, sizeof(prefix), "%4d %s ", number, typeLabel(item.type));
+        out->print(prefix);
+      }
+      else
+      {
+        out->print("         ");
+      }
+      out->print(item.display);
+      out->print("\r\n");
+    }
+    return want ? 0 : number;
+  }
+
+  // Streams a text document through the pager, stopping at the "." line
+  bool showText(const GopherLocation &loc)
+  {
+    WiFiClient client;
+    if (!openSelector(client, loc))
+      return false;
+    Pager pager(Serial, termRows);
+    bool lineStart = true;
+    bool dot = false;
+    bool lastCR = false;
+    unsigned long lastData = millis();
+    while (!pager.quit())
+    {
+      int avail = client.available();
+      if (avail <= 0)
+      {
+        if (!client.connected() || millis() - lastData > GOPHER_TIMEOUT)
+          break;
+        yield();
+        continue;
+      }
+      lastData = millis();
+      char c = client.read();
+      if (dot)
+      {
+        dot = false;
+        if (c == '\r' || c == '\n')
+          break;
+        if (c != '.')
+          pager.write('.'); // ".." at line start stands for "."
+      }
+      else if (lineStart && c == '.')
+      {
+        dot = true;
+        lineStart = false;
+        continue;
+      }
+      if (c == '\n' && !lastCR)
+        pager.write('\r');
+      lastCR = c == '\r';
+      lineStart = c == '\n';
+      pager.write(c);
+    }
+    client.stop();
+    Serial.println();
+    return true;
+  }
+
+  class GopherSource : public XModemSource
+  {
+  public:
+    explicit GopherSource(WiFiClient &client) : client_(client) {}
+    int read(uint8_t *buf, size_t len) override
+    {
+      int avail = client_.available();
+      if (avail <= 0)
+        return client_.connected() ? 0 : -1;
+      return client_.read(buf, min((size_t)avail, len));
+    }
+
+  private:
+    WiFiClient &client_;
+  };
+
+  bool download(const GopherLocation &loc)
+  {
+    String name = loc.selector.substring(loc.selector.lastIndexOf('/') + 1);
+    if (name.length() == 0)
+      name = "gopher.bin";
+    Serial.print("Save " + name + ": S=SD card, X=XMODEM-1K, Y=YMODEM, Enter=cancel: ");
+    String choice = readTerminalLine(Serial, 1);
+    choice.toUpperCase();
+    if (choice != "S" && choice != "X" && choice != "Y")
+      return true;
+    if (choice == "S" && !isSDCardAvailable())
+    {
+      Serial.println("SD card not initialized, run AT$SDINIT first");
+      return false;
+    }
+
+    WiFiClient client;
+    if (!openSelector(client, loc))
+      return false;
+    GopherSource source(client);
+    bool ok;
+    if (choice == "S")
+      ok = receiveStreamToSD(source, name, -1);
+    else
+      ok = sendStreamToHost(source, name, -1, choice == "Y");
+    client.stop();
+    return ok;
+  }
+
+  // Accepts gopher://host[:port][/<type><selector>] as in RFC 4266, with or
+  // without the scheme
+  bool parseGopherURL(String url, GopherLocation &loc)
+  {
+    url.trim();
+    if (url.length() >= 9 && url.substring(0, 9).equalsIgnoreCase("gopher://"))
+      url = url.substring(9);
+    int pathIndex = url.indexOf('/');
+    if (pathIndex < 0)
+      pathIndex = url.length();
+    int portIndex = url.indexOf(':');
+    if (portIndex >= 0 && portIndex < pathIndex)
+    {
+      loc.port = url.substring(portIndex + 1, pathIndex).toInt();
+    }
+    else
+    {
+      loc.port = 70;
+      portIndex = pathIndex;
+    }
+    loc.host = url.substring(0, portIndex);
+    String path = url.substring(pathIndex);
+    if (path.length() <= 1)
+    {
+      loc.type = '1';
+      loc.selector = "";
+    }
+    else
+    {
+      loc.type = path.charAt(1);
+      loc.selector = path.substring(2);
+    }
+    return loc.host.length() > 0 && loc.port != 0;
+  }
+}
+
+void handleGopherRequest()
+{
+  GopherLocation loc;
+  if (!parseGopherURL(cmd.substring(5), loc))
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+
+  GopherLocation *history = new GopherLocation[GOPHER_HISTORY];
+  int depth = 0;
+  bool ok = true;
+
+  while (true)
+  {
+    CacheEntry *menu = nullptr;
+    int items = 0;
+    if (loc.type == '1' || loc.type == '7')
+    {
+      menu = fetchMenu(loc);
+      if (!menu)
+      {
+        ok = false;
+        break;
+      }
+      Pager pager(Serial, termRows);
+      items = walkMenu(*menu, &pager, 0, nullptr);
+    }
+    else if (loc.type == '0')
+    {
+      if (!showText(loc))
+      {
+        ok = false;
+        break;
+      }
+    }
+    else
+    {
+      download(loc);
+      if (depth == 0)
+        break;
+      loc = history[--depth];
+      continue;
+    }
+
+    // Ask where to go next
+    MenuItem next;
+    bool go = false;
+    bool back = false;
+    while (true)
+    {
+      if (items > 0)
+        Serial.print("Item 1-" + String(items) + ", ");
+      if (depth > 0)
+        Serial.print("B=back, ");
+      Serial.print("Enter=quit: ");
+      String choice = readTerminalLine(Serial, 5);
+      choice.trim();
+      choice.toUpperCase();
+      if (choice.length() == 0)
+        break;
+      if (choice == "B" && depth > 0)
+      {
+        back = true;
+        break;
+      }
+      int pick = choice.toInt();
+      if (pick < 1 || pick > items || !walkMenu(*menu, nullptr, pick, &next))
+        continue;
+      if (next.type == 'h' && next.selector.startsWith("URL:"))
+      {
+        Serial.println("Web link: " + next.selector.substring(4));
+        continue;
+      }
+      if (next.type != '0' && next.type != '1' && next.type != '7' && strcmp(typeLabel(next.type), "BIN") != 0)
+      {
+        Serial.println("Unsupported item type");
+        continue;
+      }
+      go = true;
+      break;
+    }
+
+    if (back)
+    {
+      loc = history[--depth];
+      continue;
+    }
+    if (!go)
+      break;
+
+    if (depth == GOPHER_HISTORY)
+    {
+      for (int i = 1; i < GOPHER_HISTORY; i++)
+        history[i - 1] = history[i];
+      depth--;
+    }
+    history[depth++] = loc;
+    loc.host = next.host;
+    loc.port = next.port;
+    loc.type = next.type;
+    loc.selector = next.selector;
+    if (next.type == '7')
+    {
+      Serial.print("Search for: ");
+      String query = readTerminalLine(Serial, 60);
+      if (query.length() == 0)
+      {
+        loc = history[--depth];
+        continue;
+      }
+      loc.selector += "\t" + query;
+    }
+  }
+
+  delete[] history;
+  sendResult(ok ? RES_OK : RES_ERROR);
 }
@@ -9,20 +9,18 @@
 
 #include <Arduino.h>
 #include "globals.h"
+#include "boot.h"
+#include "dnsproxy.h"
+#include "ppp.h"
+#include "wifi.h"
 
 void restoreCommandModeIfDisconnected();
 
 void setup()
 {
-  // Blink LED on startup (3 times)
-  pinMode(16, OUTPUT);
-  for (int i = 0; i < 3; i++) {
-    digitalWrite(16, HIGH);
-    delay(200);
-    digitalWrite(16, LOW);
-    delay(200);
-  }
-  
+  // The LED blinks from loop() while the rest of the boot goes on
+  bootBegin();
+
   // CRITICAL: GPIO15 (SD card CS) is a boot mode pin on ESP8266!
   // GPIO15 must be LOW during boot for the ESP8266 to boot from flash
   // If SD card holds it HIGH, the ESP8266 won't boot properly
@@ -36,19 +34,20 @@ void setup()
   digitalWrite(15, HIGH);
   delay(50);
   
-  #if NAPT_SUPPORTED
-    ip_napt_init(IP_NAPT_MAX, IP_PORTMAP_MAX);
-  #endif
   EEPROM.begin(LAST_ADDRESS + 1);
   delay(10);
   readSettings();
+  #if NAPT_SUPPORTED && defined(ESP8266)
+    ip_napt_init(naptTableSize, PORT_FORWARD_MAX); // Sized by the core's config on ESP32
+  #endif
   serialSetup();
-  waitForFirstInput();
-  welcome();
-  delay(500); // Give system time to stabilize before SD init
-  initSDCard();
+
+  // Start joining and serving now, the first key, the welcome and the
+  // SD card follow in handleBoot()
+  bootPhaseStart(BOOT_WIFI);
   wifiSetup();
   webserverSetup();
+  bootSetupDone();
 }
 
 void loop()
@@ -58,8 +57,21 @@ void loop()
     handleOTAFirmware();
     return;
   }
+  if (!handleBoot())
+  {
+    handleWebServer();
+    handleWiFiSupervisor();
+    return;
+  }
   handleFlowControl();
   handleWebServer();  
+  pollSSHEvents();
+  pollPPPStatus();
+  pollWiFiSignal();
+  handleWiFiSupervisor();
+  handlePowerSave();
+  pollFirmwareCheck();
+  handleDNSProxy();
   if (tcpServer.hasClient())
   {
     handleIncomingConnection();
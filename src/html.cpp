@@ -0,0 +1,588 @@
+#include "html.h"
+
+namespace
+{
+    const char *const BLOCK_TAGS[] = {
+        "p", "div", "h1", "h2", "h3", "h4", "h5", "h6", "ul", "ol", "dl", "dt", "dd",
+        "table", "tr", "blockquote", "section", "article", "header", "footer", "nav",
+        "main", "aside", "form", "figure", "center", "address", "title", nullptr};
+
+    // Elements whose content is never text for the reader
+    const char *const SKIP_TAGS[] = {"script", "style", "template", "svg", nullptr};
+
+    struct NamedEntity
+    {
+        const char *name;
+        const char *text;
+    };
+
+    const NamedEntity ENTITIES[] = {
+        {"amp", "&"}, {"lt", "<"}, {"gt", ">"}, {"quot", "\""}, {"apos", "'"},
+        {"nbsp", " "}, {"copy", "(c)"}, {"reg", "(R)"}, {"trade", "(TM)"},
+        {"mdash", "--"}, {"ndash", "-"}, {"hellip", "..."}, {"laquo", "<<"},
+        {"raquo", ">>"}, {"lsquo", "'"}, {"rsquo", "'"}, {"ldquo", "\""},
+        {"rdquo", "\""}, {"bull", "*"}, {"middot", "."}, {"times", "x"},
+        {nullptr, nullptr}};
+
+    struct LetterEntity
+    {
+        const char *name;
+        uint16_t cp;
+    };
+
+    // Latin-1 letters seen most often in European pages
+    const LetterEntity LETTERS[] = {
+        {"auml", 0xE4}, {"ouml", 0xF6}, {"uuml", 0xFC}, {"Auml", 0xC4}, {"Ouml", 0xD6},
+        {"Uuml", 0xDC}, {"szlig", 0xDF}, {"eacute", 0xE9}, {"egrave", 0xE8},
+        {"ecirc", 0xEA}, {"aacute", 0xE1}, {"agrave", 0xE0}, {"acirc", 0xE2},
+        {"iacute", 0xED}, {"oacute", 0xF3}, {"uacute", 0xFA}, {"ntilde", 0xF1},
+        {"ccedil", 0xE7}, {"Eacute", 0xC9}, {"aring", 0xE5}, {"oslash", 0xF8},
+        {"aelig", 0xE6}, {"deg", 0xB0}, {"pound", 0xA3}, {"euro", 0x20AC},
+        {nullptr, 0}};
+
+    bool isSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+    }
+}
+
+HtmlRenderer::HtmlRenderer(Print &out, uint8_t width, char *linkPool, size_t poolSize)
+    : out_(out), pool_(linkPool), poolSize_(poolSize)
+{
+    // Stay one column short so terminals that wrap at the margin do not
+    // add a blank line after every full line
+    width_ = width > 10 ? width - 1 : 10;
+    tag_[0] = 0;
+    attrName_[0] = 0;
+}
+
+size_t HtmlRenderer::write(uint8_t c)
+{
+    bytesIn_++;
+    feed((char)c);
+    return 1;
+}
+
+size_t HtmlRenderer::write(const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+        write(buf[i]);
+    return len;
+}
+
+void HtmlRenderer::finish()
+{
+    if (state_ == ENTITY)
+        endEntity(false);
+    closeLink();
+    lineBreak();
+}
+
+const char *HtmlRenderer::link(uint16_t n) const
+{
+    if (n == 0 || n > links_)
+        return nullptr;
+    const char *p = pool_;
+    while (--n)
+        p += strlen(p) + 1;
+    return p;
+}
+
+void HtmlRenderer::feed(char c)
+{
+    switch (state_)
+    {
+    case TEXT:
+        if (c == '<')
+        {
+            state_ = TAG_START;
+            tagLen_ = 0;
+            closing_ = false;
+        }
+        else if (c == '&')
+        {
+            state_ = ENTITY;
+            entityLen_ = 0;
+        }
+        else
+        {
+            text(c);
+        }
+        break;
+
+    case TAG_START:
+        if (c == '/' && !closing_)
+        {
+            closing_ = true;
+        }
+        else if ((c == '!' || c == '?') && !closing_)
+        {
+            state_ = DECLARATION;
+            dashes_ = (c == '!') ? 0 : 3;
+        }
+        else if (isalpha(c))
+        {
+            tag_[0] = tolower(c);
+            tagLen_ = 1;
+            state_ = TAG_NAME;
+        }
+        else
+        {
+            // A bare '<' in text
+            state_ = TEXT;
+            text('<');
+            if (closing_)
+                text('/');
+            feed(c);
+        }
+        break;
+
+    case TAG_NAME:
+        if (isalnum(c))
+        {
+            if (tagLen_ < HTML_TAG_MAX)
+                tag_[tagLen_++] = tolower(c);
+        }
+        else
+        {
+            tag_[tagLen_] = 0;
+            attrNameLen_ = 0;
+            attrLen_ = 0;
+            haveAttr_ = false;
+            state_ = TAG_ATTRS;
+            feed(c);
+        }
+        break;
+
+    case TAG_ATTRS:
+        if (c == '>')
+        {
+            endTag();
+        }
+        else if (c == '=' && attrNameLen_ > 0)
+        {
+            state_ = ATTR_EQ;
+        }
+        else if (isalpha(c))
+        {
+            attrName_[0] = tolower(c);
+            attrNameLen_ = 1;
+            state_ = ATTR_NAME;
+        }
+        break;
+
+    case ATTR_NAME:
+        if (isalnum(c) || c == '-' || c == ':')
+        {
+            if (attrNameLen_ < HTML_TAG_MAX)
+                attrName_[attrNameLen_++] = tolower(c);
+        }
+        else
+        {
+            attrName_[attrNameLen_] = 0;
+            state_ = TAG_ATTRS;
+            feed(c);
+        }
+        break;
+
+    case ATTR_EQ:
+        if (isSpace(c))
+            break;
+        keepAttr_ = !closing_ &&
+                    ((strcmp(tag_, "a") == 0 && strcmp(attrName_, "href") == 0) ||
+                     (strcmp(tag_, "img") == 0 && strcmp(attrName_, "alt") == 0));
+        if (keepAttr_)
+            attrLen_ = 0;
+        if (c == '"' || c == '\'')
+        {
+            quote_ = c;
+            state_ = ATTR_VALUE_QUOTED;
+        }
+        else if (c == '>')
+        {
+            endTag();
+        }
+        else
+        {
+            state_ = ATTR_VALUE;
+            feed(c);
+        }
+        break;
+
+    case ATTR_VALUE:
+        if (isSpace(c))
+        {
+            endAttr();
+            state_ = TAG_ATTRS;
+        }
+        else if (c == '>')
+        {
+            endAttr();
+            endTag();
+        }
+        else if (keepAttr_ && attrLen_ < HTML_ATTR_MAX)
+        {
+            attr_[attrLen_++] = c;
+        }
+        break;
+
+    case ATTR_VALUE_QUOTED:
+        if (c == quote_)
+        {
+            endAttr();
+            state_ = TAG_ATTRS;
+        }
+        else if (keepAttr_ && attrLen_ < HTML_ATTR_MAX)
+        {
+            attr_[attrLen_++] = c;
+        }
+        break;
+
+    case DECLARATION:
+        // <!DOCTYPE ...>, <?xml ...?>, or the start of <!-- comment -->
+        if (c == '-' && dashes_ < 2)
+        {
+            if (++dashes_ == 2)
+            {
+                state_ = COMMENT;
+                dashes_ = 0;
+            }
+        }
+        else
+        {
+            dashes_ = 3;
+            if (c == '>')
+                state_ = TEXT;
+        }
+        break;
+
+    case COMMENT:
+        if (c == '>' && dashes_ >= 2)
+            state_ = TEXT;
+        else if (c == '-')
+            dashes_ = dashes_ < 2 ? dashes_ + 1 : 2;
+        else
+            dashes_ = 0;
+        break;
+
+    case ENTITY:
+        if (c == ';')
+        {
+            endEntity(true);
+        }
+        else if ((isalnum(c) || c == '#') && entityLen_ < sizeof(entity_) - 1)
+        {
+            entity_[entityLen_++] = c;
+        }
+        else
+        {
+            endEntity(false);
+            feed(c);
+        }
+        break;
+
+    case RAWTEXT:
+        // Skip until the matching end tag, e.g. "</script"
+        if (tolower(c) == rawEnd_[rawMatch_])
+        {
+            if (rawEnd_[++rawMatch_] == 0)
+            {
+                strcpy(tag_, rawEnd_ + 2);
+                closing_ = true;
+                attrNameLen_ = 0;
+                state_ = TAG_ATTRS;
+            }
+        }
+        else
+        {
+            rawMatch_ = (c == '<') ? 1 : 0;
+        }
+        break;
+    }
+}
+
+void HtmlRenderer::endAttr()
+{
+    if (!keepAttr_)
+        return;
+    attr_[attrLen_] = 0;
+    haveAttr_ = true;
+    keepAttr_ = false;
+}
+
+void HtmlRenderer::endTag()
+{
+    state_ = TEXT;
+    if (closing_)
+    {
+        if (strcmp(tag_, "a") == 0)
+        {
+            closeLink();
+        }
+        else if (strcmp(tag_, "pre") == 0)
+        {
+            if (pre_)
+                pre_--;
+            paragraph();
+        }
+        else if (isTag(BLOCK_TAGS))
+        {
+            paragraph();
+        }
+        return;
+    }
+
+    if (isTag(SKIP_TAGS))
+    {
+        snprintf(rawEnd_, sizeof(rawEnd_), "</%s", tag_);
+        rawMatch_ = 0;
+        state_ = RAWTEXT;
+    }
+    else if (strcmp(tag_, "br") == 0)
+    {
+        flushWord();
+        newline();
+        space_ = false;
+    }
+    else if (strcmp(tag_, "hr") == 0)
+    {
+        lineBreak();
+        for (uint8_t i = 0; i < width_; i++)
+            out_.write('-');
+        newline();
+    }
+    else if (strcmp(tag_, "li") == 0)
+    {
+        lineBreak();
+        emitText("* ");
+        flushWord();
+    }
+    else if (strcmp(tag_, "pre") == 0)
+    {
+        paragraph();
+        pre_++;
+    }
+    else if (strcmp(tag_, "a") == 0)
+    {
+        closeLink();
+        if (haveAttr_)
+            openLink_ = addLink(attr_);
+    }
+    else if (strcmp(tag_, "img") == 0)
+    {
+        if (haveAttr_ && attrLen_ > 0)
+        {
+            text('[');
+            emitText(attr_);
+            text(']');
+        }
+    }
+    else if (strcmp(tag_, "td") == 0 || strcmp(tag_, "th") == 0)
+    {
+        text(' ');
+    }
+    else if (isTag(BLOCK_TAGS))
+    {
+        paragraph();
+    }
+}
+
+void HtmlRenderer::closeLink()
+{
+    if (!openLink_)
+        return;
+    char marker[8];
+    snprintf(marker, sizeof(marker), "[%u]", openLink_);
+    openLink_ = 0;
+    emitText(marker);
+}
+
+uint16_t HtmlRenderer::addLink(const char *href)
+{
+    if (href[0] == '#' || strncasecmp(href, "javascript:", 11) == 0 || strncasecmp(href, "mailto:", 7) == 0)
+        return 0;
+    size_t len = strcspn(href, "#");
+    if (len == 0 || poolUsed_ + len + 1 > poolSize_)
+        return 0;
+
+    // Copy, undoing &amp; which is the only entity common in URLs
+    char *dst = pool_ + poolUsed_;
+    size_t n = 0;
+    for (size_t i = 0; i < len; i++)
+    {
+        dst[n++] = href[i];
+        if (href[i] == '&' && strncmp(href + i, "&amp;", 5) == 0)
+            i += 4;
+    }
+    dst[n] = 0;
+    poolUsed_ += n + 1;
+    return ++links_;
+}
+
+void HtmlRenderer::endEntity(bool terminated)
+{
+    entity_[entityLen_] = 0;
+    state_ = TEXT;
+    if (entityLen_ == 0)
+    {
+        text('&');
+        if (terminated)
+            text(';');
+        return;
+    }
+    if (entity_[0] == '#')
+    {
+        bool hex = entity_[1] == 'x' || entity_[1] == 'X';
+        emitCodepoint(strtoul(entity_ + (hex ? 2 : 1), nullptr, hex ? 16 : 10));
+        return;
+    }
+    for (const NamedEntity *e = ENTITIES; e->name; e++)
+    {
+        if (strcmp(entity_, e->name) == 0)
+        {
+            emitText(e->text);
+            return;
+        }
+    }
+    for (const LetterEntity *e = LETTERS; e->name; e++)
+    {
+        if (strcmp(entity_, e->name) == 0)
+        {
+            emitCodepoint(e->cp);
+            return;
+        }
+    }
+    text('&');
+    emitText(entity_);
+    if (terminated)
+        text(';');
+}
+
+// Common typography is folded to ASCII, anything else is passed on as UTF-8
+void HtmlRenderer::emitCodepoint(uint32_t cp)
+{
+    if (cp == 0)
+        return;
+    if (cp < 0x80)
+        text((char)cp);
+    else if (cp == 0xA0)
+        text(' ');
+    else if (cp == 0x2013 || cp == 0x2014)
+        text('-');
+    else if (cp >= 0x2018 && cp <= 0x201B)
+        text('\'');
+    else if (cp >= 0x201C && cp <= 0x201F)
+        text('"');
+    else if (cp == 0x2022)
+        text('*');
+    else if (cp == 0x2026)
+        emitText("...");
+    else if (cp < 0x800)
+    {
+        text(0xC0 | (cp >> 6));
+        text(0x80 | (cp & 0x3F));
+    }
+    else if (cp < 0x10000)
+    {
+        text(0xE0 | (cp >> 12));
+        text(0x80 | ((cp >> 6) & 0x3F));
+        text(0x80 | (cp & 0x3F));
+    }
+    else if (cp < 0x110000)
+    {
+        text(0xF0 | (cp >> 18));
+        text(0x80 | ((cp >> 12) & 0x3F));
+        text(0x80 | ((cp >> 6) & 0x3F));
+        text(0x80 | (cp & 0x3F));
+    }
+}
+
+void HtmlRenderer::text(char c)
+{
+    if (pre_)
+    {
+        if (c == '\n')
+        {
+            newline();
+        }
+        else if (c != '\r')
+        {
+            out_.write(c);
+            col_++;
+            blank_ = false;
+        }
+        return;
+    }
+    if (isSpace(c))
+    {
+        flushWord();
+        space_ = true;
+        return;
+    }
+    if (wordLen_ >= HTML_WORD_MAX || wordCols_ >= width_)
+        flushWord(); // Break words longer than a line
+    word_[wordLen_++] = c;
+    if ((c & 0xC0) != 0x80)
+        wordCols_++;
+}
+
+void HtmlRenderer::emitText(const char *s)
+{
+    while (*s)
+        text(*s++);
+}
+
+void HtmlRenderer::flushWord()
+{
+    if (wordLen_ == 0)
+        return;
+    bool gap = space_ && col_ > 0;
+    if (col_ > 0 && col_ + gap + wordCols_ > width_)
+    {
+        newline();
+    }
+    else if (gap)
+    {
+        out_.write(' ');
+        col_++;
+    }
+    out_.write((const uint8_t *)word_, wordLen_);
+    col_ += wordCols_;
+    wordLen_ = wordCols_ = 0;
+    space_ = false;
+    blank_ = false;
+}
+
+void HtmlRenderer::newline()
+{
+    out_.print("\r\n");
+    col_ = 0;
+}
+
+void HtmlRenderer::lineBreak()
+{
+    flushWord();
+    if (col_ > 0)
+        newline();
+    space_ = false;
+}
+
+void HtmlRenderer::paragraph()
+{
+    lineBreak();
+    if (!blank_)
+    {
+        newline();
+        blank_ = true;
+    }
+}
+
+bool HtmlRenderer::isTag(const char *const *names) const
+{
+    for (; *names; names++)
+    {
+        if (strcmp(tag_, *names) == 0)
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,97 @@
+#ifndef HTML_H
+#define HTML_H
+
+#include <Arduino.h>
+
+// Streaming HTML to text converter. Bytes are fed in as they arrive from
+// the network and come out as plain text reflowed to the terminal width, in
+// constant memory: one word, one tag name, one attribute value and the link
+// table. Scripts, styles and comments are dropped. Links are numbered [n]
+// after their text and their targets kept in a caller supplied pool; links
+// that no longer fit in the pool are shown without a number.
+
+#define HTML_WORD_MAX 160
+#define HTML_ATTR_MAX 255
+#define HTML_TAG_MAX 12
+
+class HtmlRenderer : public Print
+{
+public:
+    HtmlRenderer(Print &out, uint8_t width, char *linkPool, size_t poolSize);
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buf, size_t len) override;
+    void finish();
+
+    uint16_t linkCount() const { return links_; }
+    const char *link(uint16_t n) const;
+    size_t bytesIn() const { return bytesIn_; }
+
+private:
+    enum State
+    {
+        TEXT,
+        TAG_START,
+        TAG_NAME,
+        TAG_ATTRS,
+        ATTR_NAME,
+        ATTR_EQ,
+        ATTR_VALUE,
+        ATTR_VALUE_QUOTED,
+        DECLARATION,
+        COMMENT,
+        ENTITY,
+        RAWTEXT
+    };
+
+    Print &out_;
+    uint8_t width_;
+    char *pool_;
+    size_t poolSize_;
+    size_t poolUsed_ = 0;
+    uint16_t links_ = 0;
+    uint16_t openLink_ = 0;
+
+    State state_ = TEXT;
+    char tag_[HTML_TAG_MAX + 1];
+    uint8_t tagLen_ = 0;
+    bool closing_ = false;
+    char attrName_[HTML_TAG_MAX + 1];
+    uint8_t attrNameLen_ = 0;
+    char attr_[HTML_ATTR_MAX + 1];
+    uint16_t attrLen_ = 0;
+    bool keepAttr_ = false;
+    bool haveAttr_ = false;
+    char quote_ = 0;
+    uint8_t dashes_ = 0;
+    char entity_[10];
+    uint8_t entityLen_ = 0;
+    char rawEnd_[HTML_TAG_MAX + 3];
+    uint8_t rawMatch_ = 0;
+
+    char word_[HTML_WORD_MAX + 1];
+    uint8_t wordLen_ = 0;
+    uint8_t wordCols_ = 0;
+    uint8_t col_ = 0;
+    bool space_ = false;
+    bool blank_ = true;
+    uint8_t pre_ = 0;
+    size_t bytesIn_ = 0;
+
+    void feed(char c);
+    void text(char c);
+    void emitText(const char *s);
+    void flushWord();
+    void lineBreak();
+    void paragraph();
+    void newline();
+    void endTag();
+    void endAttr();
+    void closeLink();
+    void endEntity(bool terminated);
+    void emitCodepoint(uint32_t cp);
+    bool isTag(const char *const *names) const;
+    uint16_t addLink(const char *href);
+};
+
+#endif
@@ -4,56 +4,199 @@
   #include <WiFi.h>
 #endif
 #include <Arduino.h>
+#include <SD.h>
 #include "globals.h"
+#include "xmodem.h"
+#include "httpstream.h"
+
+// ATGET<url>    body to the terminal
+// ATGETSD<url>  save the body to the SD card
+// ATGETX<url>   send the body to the computer with XMODEM-1K
+// ATGETY<url>   send the body to the computer with YMODEM
+// ATGETS<url>   body to the terminal over TLS (ESP32); https:// URLs work in
+//               every mode
+
+namespace
+{
+  enum GetMode
+  {
+    GET_TERMINAL,
+    GET_SD,
+    GET_XMODEM,
+    GET_YMODEM
+  };
+
+  String fileNameFromURL(const String &url)
+  {
+    String host, path;
+    uint16_t port;
+    HttpStream::splitURL(url, host, port, path);
+    int q = path.indexOf('?');
+    if (q >= 0)
+      path = path.substring(0, q);
+    String name = path.substring(path.lastIndexOf('/') + 1);
+    if (name.length() == 0)
+      name = "index.htm";
+    return name;
+  }
+
+  class HttpBodySource : public XModemSource
+  {
+  public:
+    explicit HttpBodySource(HttpStream &http) : http_(http) {}
+    int read(uint8_t *buf, size_t len) override
+    {
+      return http_.read(buf, len);
+    }
+
+  private:
+    HttpStream &http_;
+  };
+
+  // Any key typed on the terminal abandons a download
+  bool abortRequested()
+  {
+    if (!Serial.available())
+      return false;
+    while (Serial.available())
+      Serial.read();
+    return true;
+  }
+
+  void downloadToTerminal(HttpStream &http)
+  {
+    sendResult(RES_CONNECT);
+    uint8_t buf[128];
+    int n;
+    while ((n = http.read(buf, sizeof(buf))) >= 0)
+    {
+      if (abortRequested())
+        break;
+      if (n == 0)
+      {
+        yield();
+        continue;
+      }
+      Serial.write(buf, n);
+    }
+    http.stop();
+    sendResult(RES_NOCARRIER);
+  }
+
+  // The stream helpers only see the end of the body, so a connection that
+  // dropped mid-body is caught here
+  bool reportFailure(HttpStream &http)
+  {
+    if (http.complete())
+      return false;
+    Serial.println();
+    Serial.println("Download failed: " + http.lastError());
+    return true;
+  }
+}
 
 void handleHTTPRequest()
 {
-  int portIndex = cmd.indexOf(":", 12); // Index where port number might begin
-  int pathIndex = cmd.indexOf("/", 12); // Index first host name and possible port ends and path begins
-  int port;
-  String path, host;
-  if (pathIndex < 0)
+  // Mode letters sit between "ATGET" and the URL. ATGETS fetches over TLS,
+  // with or without the https:// prefix.
+  String upper = cmd;
+  upper.toUpperCase();
+  int urlIndex = upper.indexOf("HTTP://");
+  int tlsIndex = upper.indexOf("HTTPS://");
+  if (tlsIndex >= 0 && (urlIndex < 0 || tlsIndex < urlIndex))
+    urlIndex = tlsIndex;
+  String modeStr, url;
+  if (urlIndex >= 0)
   {
-    pathIndex = cmd.length();
+    modeStr = upper.substring(5, urlIndex);
+    url = cmd.substring(urlIndex);
   }
-  if (portIndex < 0)
+  else if (upper.startsWith("ATGETS"))
   {
-    port = 80;
-    portIndex = pathIndex;
+    modeStr = "S";
+    url = "https://" + cmd.substring(6);
   }
   else
   {
-    port = cmd.substring(portIndex + 1, pathIndex).toInt();
+    sendResult(RES_ERROR);
+    return;
   }
-  host = cmd.substring(12, portIndex);
-  path = cmd.substring(pathIndex, cmd.length());
-  if (path == "")
-    path = "/";
-  char *hostChr = new char[host.length() + 1];
-  host.toCharArray(hostChr, host.length() + 1);
-  Serial.println("Starting file transfer reception...");
-  delay(5000);
-  // Establish connection
-  if (!tcpClient.connect(hostChr, port))
+  modeStr.trim();
+  url.trim();
+  if (modeStr == "S")
   {
-    sendResult(RES_NOCARRIER);
-    connectTime = 0;
-    callConnected = false;
-    setCarrierDCDPin(callConnected);
+    modeStr = "";
+    if (urlIndex >= 0 && urlIndex != tlsIndex)
+      url = "https://" + url.substring(7);
   }
+
+  GetMode mode;
+  if (modeStr == "")
+    mode = GET_TERMINAL;
+  else if (modeStr == "SD")
+    mode = GET_SD;
+  else if (modeStr == "X")
+    mode = GET_XMODEM;
+  else if (modeStr == "Y")
+    mode = GET_YMODEM;
   else
   {
-    sendResult(RES_CONNECT);
-    connectTime = millis();
-    cmdMode = false;
-    callConnected = true;
-    setCarrierDCDPin(callConnected);
-    String request = "GET ";
-    request += path;
-    request += " HTTP/1.1\r\nHost: ";
-    request += host;
-    request += "\r\nConnection: close\r\n\r\n";
-    tcpClient.print(request);
-  }
-  delete hostChr;
+    sendResult(RES_ERROR);
+    return;
+  }
+  if (mode == GET_SD && !isSDCardAvailable())
+  {
+    Serial.println("\x1b[37;41m SD card not initialized \x1b[0m");
+    Serial.println("Run AT$SDINIT first");
+    sendResult(RES_ERROR);
+    return;
+  }
+
+  HttpStream http;
+  bool got = http.get(url);
+  if (http.notice().length())
+    Serial.println(http.notice());
+  if (!got)
+  {
+    Serial.println(http.lastError());
+    sendResult(http.status() ? RES_ERROR : RES_NOANSWER);
+    return;
+  }
+  if (http.isSecure())
+  {
+    Serial.print("TLS handshake ");
+    Serial.print(http.handshakeMs());
+    Serial.println(http.resumed() ? " ms (session resumed)" : " ms");
+  }
+  if (http.status() != 200)
+  {
+    Serial.println("HTTP status " + String(http.status()));
+    sendResult(RES_ERROR);
+    return;
+  }
+
+  if (mode == GET_TERMINAL)
+  {
+    downloadToTerminal(http);
+    return;
+  }
+
+  String name = fileNameFromURL(http.url());
+  HttpBodySource source(http);
+  bool ok;
+  if (mode == GET_SD)
+  {
+    ok = receiveStreamToSD(source, name, http.contentLength());
+    if (ok && reportFailure(http))
+    {
+      SD.remove("/" + name);
+      ok = false;
+    }
+  }
+  else
+  {
+    ok = sendStreamToHost(source, name, http.contentLength(), mode == GET_YMODEM) && !reportFailure(http);
+  }
+  http.stop();
+  sendResult(ok ? RES_OK : RES_ERROR);
 }
@@ -0,0 +1,398 @@
+#include "httpstream.h"
+#include "globals.h"
+#include <new>
+
+HttpStats httpStats = {0, 0, 0, 0, 0, 0, 0, 0};
+
+static bool startsWithNoCase(const String &s, const char *prefix)
+{
+    return strncasecmp(s.c_str(), prefix, strlen(prefix)) == 0;
+}
+
+// Turns a Location header or link into an absolute URL against base
+String HttpStream::resolve(const String &base, const String &loc)
+{
+    if (startsWithNoCase(loc, "http://") || startsWithNoCase(loc, "https://"))
+        return loc;
+    int schemeEnd = base.indexOf("://");
+    String scheme = base.substring(0, schemeEnd + 1);
+    if (loc.startsWith("//"))
+        return scheme + loc;
+    int pathStart = base.indexOf('/', schemeEnd + 3);
+    String origin = pathStart < 0 ? base : base.substring(0, pathStart);
+    if (loc.startsWith("/"))
+        return origin + loc;
+    String dir = pathStart < 0 ? "/" : base.substring(pathStart, base.lastIndexOf('/') + 1);
+    return origin + dir + loc;
+}
+
+bool HttpStream::splitURL(const String &url, String &host, uint16_t &port, String &path)
+{
+    String rest = url;
+    port = 80;
+    if (startsWithNoCase(rest, "http://"))
+    {
+        rest = rest.substring(7);
+    }
+    else if (startsWithNoCase(rest, "https://"))
+    {
+        rest = rest.substring(8);
+        port = 443;
+    }
+    int pathIndex = rest.indexOf('/');
+    if (pathIndex < 0)
+        pathIndex = rest.length();
+    int portIndex = rest.indexOf(':');
+    if (portIndex >= 0 && portIndex < pathIndex)
+    {
+        port = rest.substring(portIndex + 1, pathIndex).toInt();
+    }
+    else
+    {
+        portIndex = pathIndex;
+    }
+    host = rest.substring(0, portIndex);
+    path = rest.substring(pathIndex);
+    if (path.length() == 0)
+        path = "/";
+    return host.length() > 0 && port != 0;
+}
+
+HttpStream::HttpStream()
+{
+    rx_ = new (std::nothrow) uint8_t[HTTP_RX_BUF];
+    line_ = new (std::nothrow) char[HTTP_LINE_MAX];
+}
+
+HttpStream::~HttpStream()
+{
+    stop();
+    delete[] rx_;
+    delete[] line_;
+}
+
+bool HttpStream::get(const String &url)
+{
+    url_ = url;
+    error_ = "";
+    notice_ = "";
+    if (!rx_ || !line_)
+        return fail("Out of memory");
+    for (uint8_t redirects = 0;; redirects++)
+    {
+        if (!request(url_) || !readHead())
+            return false;
+        bool redirect = status_ == 301 || status_ == 302 || status_ == 303 || status_ == 307 || status_ == 308;
+        if (!redirect || location_.length() == 0)
+            return true;
+        if (redirects >= HTTP_MAX_REDIRECTS)
+            return fail("Too many redirects");
+        httpStats.redirects++;
+        url_ = resolve(url_, location_);
+    }
+}
+
+bool HttpStream::request(const String &url)
+{
+    String host, path;
+    uint16_t port;
+    stop();
+    if (!splitURL(url, host, port, path))
+        return fail("Bad URL");
+    secure_ = startsWithNoCase(url, "https://");
+    if (secure_)
+    {
+#ifdef ESP32
+        client_ = &tls_;
+        if (!tls_.connect(host.c_str(), port))
+            return fail(tls_.lastError());
+        if (tls_.notice().length())
+        {
+            if (notice_.length())
+                notice_ += "\r\n";
+            notice_ += tls_.notice();
+        }
+        handshakeMs_ = tls_.handshakeMs();
+        resumed_ = tls_.resumed();
+#else
+        return fail("HTTPS is not supported");
+#endif
+    }
+    else
+    {
+        client_ = &tcp_;
+        if (!tcp_.connect(host.c_str(), port))
+            return fail("Cannot connect to " + host);
+        tcp_.setNoDelay(true);
+    }
+
+    if (host.length() + path.length() > MAX_CMD_LENGTH)
+        return fail("URL too long");
+    // Built on the heap and sent in one write, so TLS sends one record
+    String req;
+    req.reserve(host.length() + path.length() + 160);
+    req += "GET " + path + " HTTP/1.1\r\nHost: " + host;
+    if (port != (secure_ ? 443 : 80))
+        req += ":" + String(port);
+    req += "\r\nUser-Agent: Hermes/" + hermes_version +
+           "\r\nAccept-Encoding: identity\r\nConnection: close\r\n\r\n";
+    client_->write((const uint8_t *)req.c_str(), req.length());
+    httpStats.requests++;
+
+    rxLen_ = rxPos_ = 0;
+    lineLen_ = 0;
+    state_ = STATUS_LINE;
+    status_ = 0;
+    length_ = -1;
+    chunkLeft_ = 0;
+    chunked_ = false;
+    body_ = 0;
+    location_ = "";
+    contentType_ = "";
+    return true;
+}
+
+bool HttpStream::fill()
+{
+    if (rxPos_ < rxLen_)
+        return true;
+    rxPos_ = rxLen_ = 0;
+    int avail = client_->available();
+    if (avail <= 0)
+        return false;
+    int n = client_->read(rx_, (size_t)avail < HTTP_RX_BUF ? avail : HTTP_RX_BUF);
+    if (n <= 0)
+        return false;
+    rxLen_ = n;
+    return true;
+}
+
+bool HttpStream::takeLine()
+{
+    while (rxPos_ < rxLen_)
+    {
+        char c = rx_[rxPos_++];
+        if (c == '\n')
+        {
+            line_[lineLen_] = 0;
+            lineLen_ = 0;
+            return true;
+        }
+        if (c != '\r' && lineLen_ < HTTP_LINE_MAX - 1)
+            line_[lineLen_++] = c;
+    }
+    return false;
+}
+
+bool HttpStream::readHead()
+{
+    unsigned long start = millis();
+    while (true)
+    {
+        if (!takeLine())
+        {
+            if (fill())
+                continue;
+            if (!client_->connected())
+                return fail("Connection closed");
+            if (millis() - start > HTTP_TIMEOUT)
+                return fail("Timeout");
+            yield();
+            continue;
+        }
+        if (state_ == STATUS_LINE)
+        {
+            if (strncmp(line_, "HTTP/", 5) != 0)
+                return fail("Not an HTTP response");
+            const char *sp = strchr(line_, ' ');
+            status_ = sp ? atoi(sp + 1) : 0;
+            state_ = HEADER_LINE;
+        }
+        else if (line_[0] != 0)
+        {
+            parseHeader();
+        }
+        else if (status_ >= 100 && status_ < 200)
+        {
+            state_ = STATUS_LINE; // Interim response, the real one follows
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    httpStats.lastStatus = status_;
+    start_ = millis();
+    if (chunked_)
+    {
+        length_ = -1;
+        state_ = CHUNK_SIZE;
+        httpStats.chunked++;
+    }
+    else if (status_ == 204 || status_ == 304 || length_ == 0)
+    {
+        finish();
+    }
+    else
+    {
+        state_ = BODY;
+    }
+    return true;
+}
+
+void HttpStream::parseHeader()
+{
+    char *colon = strchr(line_, ':');
+    if (!colon)
+        return;
+    *colon = 0;
+    char *value = colon + 1;
+    while (*value == ' ' || *value == '\t')
+        value++;
+
+    if (strcasecmp(line_, "Content-Length") == 0)
+    {
+        length_ = atol(value);
+    }
+    else if (strcasecmp(line_, "Transfer-Encoding") == 0)
+    {
+        String v = value;
+        v.toLowerCase();
+        chunked_ = v.indexOf("chunked") >= 0;
+    }
+    else if (strcasecmp(line_, "Location") == 0)
+    {
+        location_ = value;
+        location_.trim();
+    }
+    else if (strcasecmp(line_, "Content-Type") == 0)
+    {
+        contentType_ = value;
+    }
+}
+
+int HttpStream::read(uint8_t *buf, size_t len)
+{
+    size_t out = 0;
+    while (out < len && state_ != DONE)
+    {
+        if (rxPos_ >= rxLen_ && !fill())
+        {
+            if (!client_->connected())
+            {
+                // Without a length or chunking the body ends with the connection
+                if (state_ == BODY && length_ < 0)
+                    finish();
+                else
+                    fail("Connection closed early");
+            }
+            break;
+        }
+
+        switch (state_)
+        {
+        case BODY:
+        {
+            size_t n = rxLen_ - rxPos_;
+            if (n > len - out)
+                n = len - out;
+            if (length_ >= 0 && n > (size_t)length_ - body_)
+                n = length_ - body_;
+            memcpy(buf + out, rx_ + rxPos_, n);
+            rxPos_ += n;
+            out += n;
+            body_ += n;
+            if (length_ >= 0 && body_ >= (size_t)length_)
+                finish();
+            break;
+        }
+        case CHUNK_SIZE:
+        case CHUNK_EXT:
+        {
+            char c = rx_[rxPos_++];
+            if (c == '\n')
+            {
+                if (chunkLeft_ == 0)
+                    state_ = TRAILER;
+                else
+                    state_ = CHUNK_DATA;
+            }
+            else if (state_ == CHUNK_EXT || c == '\r')
+            {
+                // Chunk extensions are ignored
+            }
+            else if (isxdigit(c))
+            {
+                if (chunkLeft_ > 0x0FFFFFFF)
+                {
+                    fail("Bad chunk size");
+                    break;
+                }
+                chunkLeft_ = chunkLeft_ * 16 + (isdigit(c) ? c - '0' : (tolower(c) - 'a' + 10));
+            }
+            else if (c == ';' || c == ' ' || c == '\t')
+            {
+                state_ = CHUNK_EXT;
+            }
+            else
+            {
+                fail("Bad chunk size");
+            }
+            break;
+        }
+        case CHUNK_DATA:
+        {
+            size_t n = rxLen_ - rxPos_;
+            if (n > len - out)
+                n = len - out;
+            if (n > chunkLeft_)
+                n = chunkLeft_;
+            memcpy(buf + out, rx_ + rxPos_, n);
+            rxPos_ += n;
+            out += n;
+            body_ += n;
+            chunkLeft_ -= n;
+            if (chunkLeft_ == 0)
+                state_ = CHUNK_DATA_END;
+            break;
+        }
+        case CHUNK_DATA_END:
+            if (rx_[rxPos_++] == '\n')
+                state_ = CHUNK_SIZE;
+            break;
+        case TRAILER:
+            if (takeLine() && line_[0] == 0)
+                finish();
+            break;
+        default:
+            break;
+        }
+    }
+    if (out > 0)
+        return out;
+    return state_ == DONE ? -1 : 0;
+}
+
+void HttpStream::finish()
+{
+    state_ = DONE;
+    httpStats.bodyBytes += body_;
+    httpStats.lastBytes = body_;
+    httpStats.lastMs = millis() - start_;
+}
+
+bool HttpStream::fail(const String &msg)
+{
+    error_ = msg;
+    state_ = DONE;
+    httpStats.failures++;
+    return false;
+}
+
+void HttpStream::stop()
+{
+    if (client_)
+        client_->stop();
+    client_ = nullptr;
+}
@@ -0,0 +1,129 @@
+#ifndef HTTPSTREAM_H
+#define HTTPSTREAM_H
+
+#include <Arduino.h>
+#include <Client.h>
+#if defined(ESP8266)
+#include <ESP8266WiFi.h>
+#elif defined(ESP32)
+#include <WiFi.h>
+#include "tlsclient.h"
+#endif
+
+// Fetches one URL and hands out the decoded body. https:// URLs go through
+// TlsClient on ESP32. The response is parsed
+// incrementally from a fixed receive buffer: the head is consumed line by
+// line, redirects are followed, and chunked transfer coding is removed, so
+// read() returns only body bytes. The receive and line buffers are on the
+// heap, so an HttpStream can live on the ESP8266's 4 KB loop stack.
+
+#ifdef ESP8266
+#define HTTP_RX_BUF 512
+#else
+#define HTTP_RX_BUF 1460
+#endif
+#define HTTP_LINE_MAX 256
+#define HTTP_MAX_REDIRECTS 5
+#define HTTP_TIMEOUT 15000
+
+struct HttpStats
+{
+    uint32_t requests;
+    uint32_t redirects;
+    uint32_t chunked;
+    uint32_t failures;
+    uint32_t bodyBytes;
+    int lastStatus;
+    uint32_t lastBytes;
+    uint32_t lastMs;
+};
+
+extern HttpStats httpStats;
+
+class HttpStream
+{
+public:
+    HttpStream();
+    ~HttpStream();
+    HttpStream(const HttpStream &) = delete;
+    HttpStream &operator=(const HttpStream &) = delete;
+
+    // Connects, sends the request and parses the response head, following
+    // up to HTTP_MAX_REDIRECTS redirects. False when no usable response
+    // arrived; status() is still set if the server answered.
+    bool get(const String &url);
+
+    // Copies up to len body bytes into buf. Returns 0 while nothing is ready
+    // and -1 once the body is complete or the connection has gone.
+    int read(uint8_t *buf, size_t len);
+    void stop();
+
+    int status() const { return status_; }
+    int32_t contentLength() const { return length_; }
+    bool isChunked() const { return chunked_; }
+    bool complete() const { return state_ == DONE && error_.length() == 0; }
+    const String &url() const { return url_; }
+    const String &contentType() const { return contentType_; }
+    const String &lastError() const { return error_; }
+    size_t bodyBytes() const { return body_; }
+    bool isSecure() const { return secure_; }
+    unsigned long handshakeMs() const { return handshakeMs_; }
+    bool resumed() const { return resumed_; }
+    // Certificates pinned on first use while following the request
+    const String &notice() const { return notice_; }
+
+    static bool splitURL(const String &url, String &host, uint16_t &port, String &path);
+    static String resolve(const String &base, const String &ref);
+
+private:
+    enum State
+    {
+        STATUS_LINE,
+        HEADER_LINE,
+        BODY,
+        CHUNK_SIZE,
+        CHUNK_EXT,
+        CHUNK_DATA,
+        CHUNK_DATA_END,
+        TRAILER,
+        DONE
+    };
+
+    WiFiClient tcp_;
+#ifdef ESP32
+    TlsClient tls_;
+#endif
+    Client *client_ = nullptr;
+
+    uint8_t *rx_; // HTTP_RX_BUF bytes
+    size_t rxLen_ = 0;
+    size_t rxPos_ = 0;
+    char *line_; // HTTP_LINE_MAX bytes
+    size_t lineLen_ = 0;
+
+    State state_ = DONE;
+    int status_ = 0;
+    int32_t length_ = -1;
+    uint32_t chunkLeft_ = 0;
+    bool chunked_ = false;
+    bool secure_ = false;
+    unsigned long handshakeMs_ = 0;
+    bool resumed_ = false;
+    size_t body_ = 0;
+    unsigned long start_ = 0;
+    String url_;
+    String location_;
+    String contentType_;
+    String error_;
+    String notice_;
+
+    bool request(const String &url);
+    bool readHead();
+    bool fill();
+    bool takeLine();
+    void parseHeader();
+    void finish();
+    bool fail(const String &msg);
+};
+
+#endif
@@ -0,0 +1,909 @@
+#include "kermit.h"
+
+#include <new>
+#include <SD.h>
+
+#define KERMIT_MAX_RETRIES 10
+#define KERMIT_INIT_RETRIES 20
+#define KERMIT_OUR_TIME 10 // Seconds the peer should wait for our packets
+#define KERMIT_IO_BUF 512
+
+// CAPAS bits
+#define KERMIT_CAP_LONG 0x02
+#define KERMIT_CAP_WINDOW 0x04
+
+namespace
+{
+    // Expand one packet data field, honouring repeat, 8-bit and control
+    // prefixes, and hand each resulting byte to emit().
+    template <typename Emit>
+    void decodeData(const uint8_t *in, size_t len, uint8_t rpt, uint8_t ebq, uint8_t qctl, Emit emit)
+    {
+        size_t i = 0;
+        while (i < len)
+        {
+            uint8_t n = 1;
+            uint8_t c = in[i++];
+            if (rpt && c == rpt && i + 1 < len)
+            {
+                n = in[i++] - 32;
+                c = in[i++];
+            }
+            uint8_t bit8 = 0;
+            if (ebq && c == ebq && i < len)
+            {
+                bit8 = 0x80;
+                c = in[i++];
+            }
+            if (c == qctl && i < len)
+            {
+                c = in[i++];
+                uint8_t a = c & 0x7F;
+                if (a >= 63 && a <= 95)
+                    c ^= 64;
+            }
+            c |= bit8;
+            while (n--)
+                emit(c);
+        }
+    }
+
+    bool validPrefix(uint8_t c)
+    {
+        return (c >= 33 && c <= 62) || (c >= 96 && c <= 126);
+    }
+}
+
+Kermit::Kermit(Stream &link)
+    : link_(link)
+{
+    rxBuf_ = new (std::nothrow) uint8_t[KERMIT_MAX_PACKET + 16];
+    txBuf_ = new (std::nothrow) uint8_t[KERMIT_MAX_PACKET + 16];
+    ioBuf_ = new (std::nothrow) uint8_t[KERMIT_IO_BUF];
+}
+
+Kermit::~Kermit()
+{
+    closeFile(false);
+    freeSlots();
+    delete[] rxBuf_;
+    delete[] txBuf_;
+    delete[] ioBuf_;
+}
+
+uint16_t Kermit::crc16(const uint8_t *data, size_t len)
+{
+    // CRC-CCITT as used by Kermit block check type 3 (reflected, init 0)
+    uint16_t crc = 0;
+    while (len--)
+    {
+        uint8_t c = *data++;
+        uint16_t q = (crc ^ c) & 0x0F;
+        crc = (crc >> 4) ^ (q * 0x1081);
+        q = (crc ^ (c >> 4)) & 0x0F;
+        crc = (crc >> 4) ^ (q * 0x1081);
+    }
+    return crc;
+}
+
+void Kermit::makeCheck(const uint8_t *data, size_t len, uint8_t chk, uint8_t *out)
+{
+    if (chk == 3)
+    {
+        uint16_t crc = crc16(data, len);
+        out[0] = tochar((crc >> 12) & 0x0F);
+        out[1] = tochar((crc >> 6) & 0x3F);
+        out[2] = tochar(crc & 0x3F);
+        return;
+    }
+    uint32_t sum = 0;
+    for (size_t i = 0; i < len; i++)
+        sum += data[i];
+    if (chk == 2)
+    {
+        sum &= 07777;
+        out[0] = tochar((sum >> 6) & 0x3F);
+        out[1] = tochar(sum & 0x3F);
+    }
+    else
+    {
+        out[0] = tochar((sum + ((sum >> 6) & 0x03)) & 0x3F);
+    }
+}
+
+// ========================= Packet I/O =========================
+
+int Kermit::readByte(unsigned long deadline)
+{
+    while (!link_.available())
+    {
+        if ((long)(millis() - deadline) >= 0)
+            return -1;
+        yield();
+    }
+    return link_.read();
+}
+
+Kermit::ReadResult Kermit::readPacket(Packet &pkt, uint32_t timeoutMs)
+{
+    unsigned long deadline = millis() + timeoutMs;
+    uint8_t ctrlC = 0;
+    int c;
+
+resync:
+    // Everything outside a packet is noise, except two Ctrl-C in a row
+    do
+    {
+        c = readByte(deadline);
+        if (c < 0)
+            return READ_TIMEOUT;
+        if (c == 0x03)
+        {
+            if (++ctrlC >= 2)
+                return READ_CANCEL;
+        }
+        else
+        {
+            ctrlC = 0;
+        }
+    } while (c != MARK);
+
+    // LEN SEQ TYPE, plus LENX1 LENX2 HCHECK for long packets
+    size_t hdr = 3;
+    for (size_t i = 0; i < hdr; i++)
+    {
+        c = readByte(deadline);
+        if (c < 0)
+            return READ_TIMEOUT;
+        if (c == MARK)
+            goto resync;
+        rxBuf_[i] = c;
+        if (i == 0 && unchar(rxBuf_[0]) == 0)
+            hdr = 6;
+    }
+
+    size_t rest;
+    if (hdr == 6)
+    {
+        uint8_t hcheck;
+        makeCheck(rxBuf_, 5, 1, &hcheck);
+        if (hcheck != rxBuf_[5])
+            return READ_BAD;
+        rest = unchar(rxBuf_[3]) * 95 + unchar(rxBuf_[4]);
+    }
+    else
+    {
+        uint8_t len = unchar(rxBuf_[0]);
+        if (len < 3)
+            return READ_BAD;
+        rest = len - 2;
+    }
+    if (rest > KERMIT_MAX_PACKET + 3)
+        return READ_BAD;
+
+    for (size_t i = 0; i < rest; i++)
+    {
+        c = readByte(deadline);
+        if (c < 0)
+            return READ_TIMEOUT;
+        if (c == MARK)
+            goto resync;
+        rxBuf_[hdr + i] = c;
+    }
+
+    pkt.seq = unchar(rxBuf_[1]) & 63;
+    pkt.type = rxBuf_[2];
+
+    // Send-Init and its repeats always travel with a type 1 check
+    uint8_t chk = (pkt.type == 'S' || pkt.type == 'I') ? 1 : chk_;
+    if (rest < chk)
+        return READ_BAD;
+    size_t dlen = rest - chk;
+    uint8_t check[3];
+    makeCheck(rxBuf_, hdr + dlen, chk, check);
+    if (memcmp(check, rxBuf_ + hdr + dlen, chk) != 0)
+        return READ_BAD;
+
+    pkt.data = rxBuf_ + hdr;
+    pkt.len = dlen;
+    return READ_OK;
+}
+
+void Kermit::sendPacket(char type, uint8_t seq, const uint8_t *data, size_t len, uint8_t chk)
+{
+    uint8_t *p = txBuf_;
+    size_t n = 0;
+    p[n++] = MARK;
+    size_t start = n;
+    size_t total = len + 2 + chk;
+    if (total <= 94)
+    {
+        p[n++] = tochar(total);
+        p[n++] = tochar(seq);
+        p[n++] = type;
+    }
+    else
+    {
+        size_t ext = len + chk;
+        p[n++] = tochar(0);
+        p[n++] = tochar(seq);
+        p[n++] = type;
+        p[n++] = tochar(ext / 95);
+        p[n++] = tochar(ext % 95);
+        makeCheck(p + start, 5, 1, p + n);
+        n++;
+    }
+    if (len)
+    {
+        memcpy(p + n, data, len);
+        n += len;
+    }
+    makeCheck(p + start, n - start, chk, p + n);
+    n += chk;
+    p[n++] = peerEol_;
+    link_.write(p, n);
+}
+
+void Kermit::sendError(const String &msg)
+{
+    uint8_t buf[80];
+    size_t n = encodeString(msg, buf, sizeof(buf));
+    sendPacket('E', next_ & 63, buf, n);
+}
+
+bool Kermit::fail(const String &msg)
+{
+    error_ = msg;
+    sendError(msg);
+    closeFile(true);
+    return false;
+}
+
+// ========================= Negotiation =========================
+
+size_t Kermit::buildParams(uint8_t *out, uint8_t qbin, uint8_t window, uint16_t maxLong)
+{
+    size_t n = 0;
+    out[n++] = tochar(94);              // MAXL
+    out[n++] = tochar(KERMIT_OUR_TIME); // TIME
+    out[n++] = tochar(0);               // NPAD
+    out[n++] = ctl(0);                  // PADC
+    out[n++] = tochar(EOL);             // EOL
+    out[n++] = qctl_;                   // QCTL
+    out[n++] = qbin;                    // QBIN
+    out[n++] = '3';                     // CHKT
+    out[n++] = '~';                     // REPT
+    out[n++] = tochar(KERMIT_CAP_LONG | KERMIT_CAP_WINDOW);
+    out[n++] = tochar(window);          // WINDO
+    out[n++] = tochar(maxLong / 95);    // MAXLX1
+    out[n++] = tochar(maxLong % 95);    // MAXLX2
+    return n;
+}
+
+// Parses the peer's Send-Init parameters and returns the agreed block check
+// type; the caller switches to it once the S/ACK exchange is complete.
+uint8_t Kermit::applyParams(const uint8_t *data, size_t len)
+{
+    auto field = [&](size_t i, uint8_t def) -> uint8_t
+    {
+        return (i < len && data[i] != ' ') ? data[i] : def;
+    };
+
+    uint8_t maxl = unchar(field(0, tochar(80)));
+    peerTime_ = unchar(field(1, tochar(5)));
+    if (peerTime_ == 0)
+        peerTime_ = 5;
+    peerEol_ = unchar(field(4, tochar(EOL)));
+    peerQctl_ = field(5, '#');
+
+    // 8-bit prefixing only if one side asked for it with an actual prefix
+    uint8_t qbin = field(6, 'N');
+    ebq_ = validPrefix(qbin) ? qbin : 0;
+
+    uint8_t chkt = field(7, '1');
+    uint8_t chk = (chkt == '3') ? 3 : 1;
+
+    rpt_ = (field(8, ' ') == '~') ? '~' : 0;
+
+    size_t i = 9;
+    uint8_t capas = (i < len) ? unchar(data[i]) : 0;
+    while (i < len && (unchar(data[i]) & 1))
+        i++;
+    i++;
+
+    longPackets_ = (capas & KERMIT_CAP_LONG) != 0;
+    window_ = 1;
+    if ((capas & KERMIT_CAP_WINDOW) && i < len)
+    {
+        uint8_t w = unchar(data[i]);
+        window_ = (w == 0) ? 1 : (w > KERMIT_MAX_WINDOW ? KERMIT_MAX_WINDOW : w);
+    }
+
+    uint32_t peerMax = (maxl < 10 ? 80 : maxl) - 2;
+    if (longPackets_)
+    {
+        peerMax = 500;
+        if (i + 2 < len)
+            peerMax = unchar(data[i + 1]) * 95 + unchar(data[i + 2]);
+    }
+    peerMax = (peerMax > chk + 10u) ? peerMax - chk : 10;
+    peerMaxData_ = (peerMax > KERMIT_MAX_PACKET) ? KERMIT_MAX_PACKET : peerMax;
+    return chk;
+}
+
+// Keep window x packet length inside KERMIT_WINDOW_BUF. Long packets are
+// shortened first (down to 1K), then the window is narrowed.
+void Kermit::balanceWindow()
+{
+    if ((uint32_t)maxData_ * window_ <= KERMIT_WINDOW_BUF)
+        return;
+    if (maxData_ > 1024)
+    {
+        uint32_t fit = KERMIT_WINDOW_BUF / window_;
+        maxData_ = fit > 1024 ? fit : 1024;
+    }
+    if ((uint32_t)maxData_ * window_ > KERMIT_WINDOW_BUF)
+    {
+        uint32_t w = KERMIT_WINDOW_BUF / maxData_;
+        window_ = w ? w : 1;
+    }
+}
+
+bool Kermit::allocSlots()
+{
+    freeSlots();
+    // Leave room for a check type 1 fallback on the same frame size
+    slotSize_ = maxData_ + 3;
+    while (true)
+    {
+        slots_ = new (std::nothrow) Slot[window_];
+        slotMem_ = new (std::nothrow) uint8_t[(size_t)slotSize_ * window_];
+        if (slots_ && slotMem_)
+            break;
+        freeSlots();
+        if (window_ == 1)
+            return false;
+        window_ = window_ / 2;
+    }
+    for (uint8_t i = 0; i < window_; i++)
+    {
+        slots_[i].data = slotMem_ + (size_t)i * slotSize_;
+        slots_[i].len = 0;
+        slots_[i].full = false;
+        slots_[i].acked = false;
+        slots_[i].nakked = false;
+        slots_[i].retries = 0;
+    }
+    return true;
+}
+
+void Kermit::freeSlots()
+{
+    delete[] slots_;
+    delete[] slotMem_;
+    slots_ = nullptr;
+    slotMem_ = nullptr;
+}
+
+// ========================= Encoding =========================
+
+size_t Kermit::encodeChar(uint8_t b, uint8_t *out)
+{
+    size_t k = 0;
+    if (ebq_ && (b & 0x80))
+    {
+        out[k++] = ebq_;
+        b &= 0x7F;
+    }
+    uint8_t a = b & 0x7F;
+    if (a < 32 || a == 127)
+    {
+        out[k++] = qctl_;
+        b = ctl(b);
+    }
+    else if (a == qctl_ || (ebq_ && a == ebq_) || (rpt_ && a == rpt_))
+    {
+        out[k++] = qctl_;
+    }
+    out[k++] = b;
+    return k;
+}
+
+size_t Kermit::encodeString(const String &s, uint8_t *out, size_t cap)
+{
+    size_t k = 0;
+    for (size_t i = 0; i < s.length() && k + 3 <= cap; i++)
+        k += encodeChar((uint8_t)s[i], out + k);
+    return k;
+}
+
+size_t Kermit::encodeFromFile(uint8_t *out, size_t cap)
+{
+    size_t k = 0;
+    // Worst case for one run: repeat prefix + count + two-prefix character
+    while (k + 6 <= cap)
+    {
+        // Keep enough lookahead to detect a full 94-byte run
+        if (ioLen_ - ioPos_ < 94 && !ioEof_)
+        {
+            memmove(ioBuf_, ioBuf_ + ioPos_, ioLen_ - ioPos_);
+            ioLen_ -= ioPos_;
+            ioPos_ = 0;
+            int r = file_.read(ioBuf_ + ioLen_, KERMIT_IO_BUF - ioLen_);
+            if (r <= 0)
+                ioEof_ = true;
+            else
+                ioLen_ += r;
+        }
+        if (ioPos_ >= ioLen_)
+            break;
+
+        uint8_t b = ioBuf_[ioPos_++];
+        uint8_t n = 1;
+        while (rpt_ && n < 94 && ioPos_ < ioLen_ && ioBuf_[ioPos_] == b)
+        {
+            n++;
+            ioPos_++;
+        }
+        bytes_ += n;
+        if (n >= 3)
+        {
+            out[k++] = rpt_;
+            out[k++] = tochar(n);
+            k += encodeChar(b, out + k);
+        }
+        else
+        {
+            while (n--)
+                k += encodeChar(b, out + k);
+        }
+    }
+    return k;
+}
+
+String Kermit::decodeString(const uint8_t *in, size_t len)
+{
+    String s;
+    decodeData(in, len, rpt_, ebq_, peerQctl_, [&](uint8_t c)
+               {
+                   if (s.length() < 128)
+                       s += (char)c;
+               });
+    return s;
+}
+
+bool Kermit::writeDecoded(const uint8_t *in, size_t len)
+{
+    size_t n = 0;
+    bool ok = true;
+    decodeData(in, len, rpt_, ebq_, peerQctl_, [&](uint8_t c)
+               {
+                   ioBuf_[n++] = c;
+                   bytes_++;
+                   if (n == KERMIT_IO_BUF)
+                   {
+                       ok = ok && file_.write(ioBuf_, n) == n;
+                       n = 0;
+                   }
+               });
+    if (n)
+        ok = ok && file_.write(ioBuf_, n) == n;
+    return ok;
+}
+
+// ========================= Sending =========================
+
+// Stop-and-wait exchange used for the S, F, Z and B packets.
+bool Kermit::exchange(char type, const uint8_t *data, size_t len, Packet &reply, uint8_t maxRetries)
+{
+    uint8_t seq = next_ & 63;
+    uint8_t chk = (type == 'S') ? 1 : chk_;
+    for (uint8_t tries = 0; tries <= maxRetries; tries++)
+    {
+        if (tries)
+            resent_++;
+        sendPacket(type, seq, data, len, chk);
+
+        // Late ACKs from the data window may still be in flight; skip them
+        for (uint8_t stale = 0; stale < 2 * KERMIT_MAX_WINDOW; stale++)
+        {
+            ReadResult r = readPacket(reply, timeoutMs());
+            if (r == READ_CANCEL)
+            {
+                error_ = "Cancelled";
+                return false;
+            }
+            if (r != READ_OK)
+                break;
+            if (reply.type == 'E')
+            {
+                error_ = "Remote: " + decodeString(reply.data, reply.len);
+                return false;
+            }
+            // A NAK for the following packet implies an ACK for this one
+            if ((reply.type == 'Y' && reply.seq == seq) ||
+                (reply.type == 'N' && reply.seq == ((seq + 1) & 63)))
+            {
+                next_++;
+                return true;
+            }
+            if (reply.type == 'N')
+                break;
+        }
+    }
+    error_ = "Too many retries";
+    return false;
+}
+
+void Kermit::resend(uint32_t abs)
+{
+    Slot &s = slots_[abs % window_];
+    sendPacket('D', abs & 63, s.data, s.len);
+    resent_++;
+}
+
+bool Kermit::sendData()
+{
+    ioLen_ = ioPos_ = 0;
+    ioEof_ = false;
+    base_ = next_;
+    bool eof = false;
+
+    while (true)
+    {
+        // Fill the window
+        while (!eof && !cancelled_ && next_ - base_ < window_)
+        {
+            Slot &s = slots_[next_ % window_];
+            s.len = encodeFromFile(s.data, maxData_);
+            if (s.len == 0)
+            {
+                eof = true;
+                break;
+            }
+            s.acked = false;
+            s.retries = 0;
+            sendPacket('D', next_ & 63, s.data, s.len);
+            next_++;
+        }
+        if (base_ == next_ || cancelled_)
+        {
+            base_ = next_;
+            return true;
+        }
+
+        Packet pkt;
+        ReadResult r = readPacket(pkt, timeoutMs());
+        if (r == READ_CANCEL)
+            return fail("Cancelled");
+        if (r == READ_BAD)
+            continue;
+        if (r != READ_OK)
+        {
+            // Nothing heard: the oldest outstanding packet is the one to repeat
+            Slot &s = slots_[base_ % window_];
+            if (++s.retries > KERMIT_MAX_RETRIES)
+                return fail("Too many retries");
+            resend(base_);
+            continue;
+        }
+        if (pkt.type == 'E')
+        {
+            error_ = "Remote: " + decodeString(pkt.data, pkt.len);
+            return false;
+        }
+
+        uint32_t inFlight = next_ - base_;
+        uint32_t diff = (pkt.seq - (base_ & 63)) & 63;
+        if (pkt.type == 'Y' && diff < inFlight)
+        {
+            slots_[(base_ + diff) % window_].acked = true;
+            if (pkt.len > 0 && (pkt.data[0] == 'X' || pkt.data[0] == 'Z'))
+                cancelled_ = true;
+        }
+        else if (pkt.type == 'N')
+        {
+            if (diff < inFlight)
+            {
+                Slot &s = slots_[(base_ + diff) % window_];
+                if (++s.retries > KERMIT_MAX_RETRIES)
+                    return fail("Too many retries");
+                resend(base_ + diff);
+            }
+            else if (diff == inFlight)
+            {
+                for (uint32_t k = base_; k < next_; k++)
+                    slots_[k % window_].acked = true;
+            }
+        }
+
+        while (base_ < next_ && slots_[base_ % window_].acked)
+            base_++;
+    }
+}
+
+bool Kermit::send(const String &path)
+{
+    bytes_ = 0;
+    resent_ = 0;
+    next_ = 0;
+    chk_ = 1;
+    cancelled_ = false;
+    if (!rxBuf_ || !txBuf_ || !ioBuf_)
+    {
+        error_ = "Out of memory";
+        return false;
+    }
+
+    file_ = SD.open(path, FILE_READ);
+    if (!file_ || file_.isDirectory())
+    {
+        error_ = "Cannot open " + path;
+        file_ = File();
+        return false;
+    }
+    path_ = path;
+    int slash = path.lastIndexOf('/');
+    fileName_ = (slash >= 0) ? path.substring(slash + 1) : path;
+
+    uint8_t params[16];
+    size_t n = buildParams(params, 'Y', KERMIT_MAX_WINDOW, KERMIT_MAX_PACKET);
+    Packet reply;
+    if (!exchange('S', params, n, reply, KERMIT_INIT_RETRIES))
+    {
+        closeFile(false);
+        return false;
+    }
+    chk_ = applyParams(reply.data, reply.len);
+
+    maxData_ = peerMaxData_;
+    balanceWindow();
+    if (!allocSlots())
+        return fail("Out of memory");
+
+    uint8_t name[96];
+    n = encodeString(fileName_, name, sizeof(name));
+    if (!exchange('F', name, n, reply, KERMIT_MAX_RETRIES))
+    {
+        closeFile(false);
+        return false;
+    }
+
+    if (!sendData())
+    {
+        closeFile(false);
+        return false;
+    }
+    closeFile(false);
+
+    const uint8_t discard = 'D';
+    if (!exchange('Z', &discard, cancelled_ ? 1 : 0, reply, KERMIT_MAX_RETRIES))
+        return false;
+    if (!exchange('B', nullptr, 0, reply, KERMIT_MAX_RETRIES))
+        return false;
+    if (cancelled_)
+    {
+        error_ = "Cancelled by receiver";
+        return false;
+    }
+    return true;
+}
+
+// ========================= Receiving =========================
+
+bool Kermit::openForWrite(const String &dir, const String &name)
+{
+    // Strip any directory or device part the sender included
+    String base = name;
+    int cut = -1;
+    for (size_t i = 0; i < base.length(); i++)
+    {
+        char c = base[i];
+        if (c == '/' || c == '\\' || c == ':' || c == ']' || c == '>')
+            cut = i;
+    }
+    base = base.substring(cut + 1);
+    base.trim();
+    if (base.length() == 0)
+        base = "KERMIT.BIN";
+
+    fileName_ = base;
+    path_ = dir.endsWith("/") ? dir + base : dir + "/" + base;
+    if (SD.exists(path_))
+        SD.remove(path_);
+    file_ = SD.open(path_, FILE_WRITE);
+    writing_ = (bool)file_;
+    return writing_;
+}
+
+void Kermit::closeFile(bool discard)
+{
+    if (!file_)
+        return;
+    file_.close();
+    file_ = File();
+    if (discard && writing_)
+        SD.remove(path_);
+    writing_ = false;
+}
+
+bool Kermit::receiveLoop(const String &dir)
+{
+    uint8_t timeouts = 0;
+    bool inFile = false;
+
+    while (true)
+    {
+        Packet pkt;
+        ReadResult r = readPacket(pkt, timeoutMs());
+        if (r == READ_CANCEL)
+            return fail("Cancelled");
+        if (r == READ_BAD)
+        {
+            // Damaged packet of unknown sequence: ask for the oldest missing
+            // one, but only once until it arrives or we time out
+            Slot &s = slots_[base_ % window_];
+            if (!s.nakked)
+            {
+                s.nakked = true;
+                sendPacket('N', base_ & 63);
+            }
+            continue;
+        }
+        if (r != READ_OK)
+        {
+            if (++timeouts > KERMIT_MAX_RETRIES)
+                return fail("Too many retries");
+            slots_[base_ % window_].nakked = true;
+            sendPacket('N', base_ & 63);
+            continue;
+        }
+        timeouts = 0;
+
+        if (pkt.type == 'E')
+        {
+            error_ = "Remote: " + decodeString(pkt.data, pkt.len);
+            closeFile(true);
+            return false;
+        }
+        if (pkt.type == 'S')
+        {
+            // Our ACK to the Send-Init was lost
+            sendPacket('Y', pkt.seq, initAck_, initAckLen_, 1);
+            continue;
+        }
+
+        uint32_t diff = (pkt.seq - (base_ & 63)) & 63;
+        if (diff >= 64u - window_)
+        {
+            // Already handled, the sender missed our ACK
+            sendPacket('Y', pkt.seq);
+            continue;
+        }
+        if (diff >= window_)
+            continue;
+
+        if (pkt.type == 'D')
+        {
+            if (!inFile)
+                return fail("Data before file header");
+            Slot &s = slots_[(base_ + diff) % window_];
+            if (!s.full)
+            {
+                if (pkt.len > slotSize_)
+                    return fail("Packet too long");
+                memcpy(s.data, pkt.data, pkt.len);
+                s.len = pkt.len;
+                s.full = true;
+            }
+            sendPacket('Y', pkt.seq);
+
+            // Ask once for every hole this packet skipped over
+            for (uint32_t k = 0; k < diff; k++)
+            {
+                Slot &h = slots_[(base_ + k) % window_];
+                if (!h.full && !h.nakked)
+                {
+                    h.nakked = true;
+                    sendPacket('N', (base_ + k) & 63);
+                }
+            }
+
+            while (slots_[base_ % window_].full)
+            {
+                Slot &h = slots_[base_ % window_];
+                if (!writeDecoded(h.data, h.len))
+                    return fail("SD card write error");
+                h.full = false;
+                h.nakked = false;
+                base_++;
+            }
+            continue;
+        }
+
+        // File-level packets are never windowed
+        if (diff != 0)
+            continue;
+
+        switch (pkt.type)
+        {
+        case 'F':
+            if (!openForWrite(dir, decodeString(pkt.data, pkt.len)))
+                return fail("Cannot create file");
+            inFile = true;
+            break;
+        case 'A':
+            break;
+        case 'Z':
+            closeFile(pkt.len > 0 && pkt.data[0] == 'D');
+            inFile = false;
+            break;
+        case 'B':
+            sendPacket('Y', pkt.seq);
+            return true;
+        default:
+            return fail(String("Unexpected packet ") + pkt.type);
+        }
+        sendPacket('Y', pkt.seq);
+        base_++;
+    }
+}
+
+bool Kermit::receive(const String &dir)
+{
+    bytes_ = 0;
+    resent_ = 0;
+    next_ = 0;
+    chk_ = 1;
+    if (!rxBuf_ || !txBuf_ || !ioBuf_)
+    {
+        error_ = "Out of memory";
+        return false;
+    }
+
+    // Wait for the sender's Send-Init, prodding it with NAKs
+    Packet pkt;
+    uint8_t tries = 0;
+    while (true)
+    {
+        ReadResult r = readPacket(pkt, timeoutMs());
+        if (r == READ_CANCEL)
+        {
+            error_ = "Cancelled";
+            return false;
+        }
+        if (r == READ_OK && pkt.type == 'S')
+            break;
+        if (r == READ_OK && pkt.type == 'E')
+        {
+            error_ = "Remote: " + decodeString(pkt.data, pkt.len);
+            return false;
+        }
+        if (++tries > KERMIT_INIT_RETRIES)
+        {
+            error_ = "No Send-Init received";
+            return false;
+        }
+        sendPacket('N', 0, nullptr, 0, 1);
+    }
+
+    uint8_t chk = applyParams(pkt.data, pkt.len);
+    maxData_ = longPackets_ ? KERMIT_MAX_PACKET - 3 : 94 - 2 - chk;
+    balanceWindow();
+    if (!allocSlots())
+    {
+        error_ = "Out of memory";
+        sendPacket('E', pkt.seq, (const uint8_t *)"Out of memory", 13, 1);
+        return false;
+    }
+
+    initAckLen_ = buildParams(initAck_, ebq_ ? 'Y' : 'N', window_, maxData_ + 3);
+    sendPacket('Y', pkt.seq, initAck_, initAckLen_, 1);
+    chk_ = chk;
+    next_ = base_ = (pkt.seq + 1) & 63;
+
+    // Each file is written as its D packets complete in order
+    bool ok = receiveLoop(dir);
+    closeFile(!ok);
+    return ok;
+}
@@ -0,0 +1,145 @@
+#ifndef KERMIT_H
+#define KERMIT_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+// Buffer limits. The window buffer holds every unacknowledged (sending) or
+// out-of-order (receiving) packet, so window size x packet length is clamped
+// to it after negotiation.
+#ifdef ESP8266
+#define KERMIT_MAX_PACKET 2048
+#define KERMIT_WINDOW_BUF 8192
+#else
+#define KERMIT_MAX_PACKET 9024
+#define KERMIT_WINDOW_BUF 32768
+#endif
+#define KERMIT_MAX_WINDOW 31
+
+class Kermit
+{
+public:
+    explicit Kermit(Stream &link);
+    ~Kermit();
+
+    bool receive(const String &dir = "/");
+    bool send(const String &path);
+
+    const String &fileName() const { return fileName_; }
+    const String &lastError() const { return error_; }
+    size_t bytesTransferred() const { return bytes_; }
+    uint32_t packetsResent() const { return resent_; }
+    uint8_t windowSize() const { return window_; }
+    uint16_t packetLength() const { return maxData_; }
+
+    static uint16_t crc16(const uint8_t *data, size_t len);
+
+    static const uint8_t MARK = 0x01;
+    static const uint8_t EOL = 0x0D;
+
+private:
+    struct Packet
+    {
+        uint8_t seq;
+        char type;
+        const uint8_t *data;
+        size_t len;
+    };
+
+    struct Slot
+    {
+        uint8_t *data;
+        uint16_t len;
+        bool full;
+        bool acked;
+        bool nakked;
+        uint8_t retries;
+    };
+
+    enum ReadResult
+    {
+        READ_OK,
+        READ_TIMEOUT,
+        READ_BAD,
+        READ_CANCEL
+    };
+
+    Stream &link_;
+
+    // Negotiated parameters
+    uint8_t chk_ = 1;
+    uint8_t qctl_ = '#';
+    uint8_t peerQctl_ = '#';
+    uint8_t ebq_ = 0;
+    uint8_t rpt_ = 0;
+    uint8_t peerEol_ = EOL;
+    uint8_t peerTime_ = 5;
+    bool longPackets_ = false;
+    uint8_t window_ = 1;
+    uint16_t maxData_ = 90;
+    uint16_t peerMaxData_ = 90;
+
+    // Buffers
+    uint8_t *rxBuf_ = nullptr;
+    uint8_t *txBuf_ = nullptr;
+    uint8_t *ioBuf_ = nullptr;
+    size_t ioLen_ = 0;
+    size_t ioPos_ = 0;
+    bool ioEof_ = false;
+    Slot *slots_ = nullptr;
+    uint8_t *slotMem_ = nullptr;
+    uint16_t slotSize_ = 0;
+    uint8_t initAck_[16];
+    size_t initAckLen_ = 0;
+
+    // Sequence numbers counted from the S packet, so window slots never alias
+    // when the 6-bit packet sequence wraps.
+    uint32_t next_ = 0;
+    uint32_t base_ = 0;
+
+    File file_;
+    String path_;
+    String fileName_;
+    String error_;
+    size_t bytes_ = 0;
+    uint32_t resent_ = 0;
+    bool cancelled_ = false;
+    bool writing_ = false;
+
+    int readByte(unsigned long deadline);
+    ReadResult readPacket(Packet &pkt, uint32_t timeoutMs);
+    void sendPacket(char type, uint8_t seq, const uint8_t *data, size_t len, uint8_t chk);
+    void sendPacket(char type, uint8_t seq, const uint8_t *data = nullptr, size_t len = 0)
+    {
+        sendPacket(type, seq, data, len, chk_);
+    }
+    void sendError(const String &msg);
+    void makeCheck(const uint8_t *data, size_t len, uint8_t chk, uint8_t *out);
+
+    size_t buildParams(uint8_t *out, uint8_t qbin, uint8_t window, uint16_t maxLong);
+    uint8_t applyParams(const uint8_t *data, size_t len);
+    void balanceWindow();
+    bool allocSlots();
+    void freeSlots();
+
+    size_t encodeChar(uint8_t b, uint8_t *out);
+    size_t encodeString(const String &s, uint8_t *out, size_t cap);
+    size_t encodeFromFile(uint8_t *out, size_t cap);
+    String decodeString(const uint8_t *in, size_t len);
+    bool writeDecoded(const uint8_t *in, size_t len);
+
+    bool exchange(char type, const uint8_t *data, size_t len, Packet &reply, uint8_t maxRetries);
+    void resend(uint32_t abs);
+    bool sendData();
+    bool receiveLoop(const String &dir);
+    bool openForWrite(const String &dir, const String &name);
+    void closeFile(bool discard);
+    bool fail(const String &msg);
+
+    uint32_t timeoutMs() const { return (uint32_t)peerTime_ * 1000UL; }
+    static uint8_t tochar(uint8_t x) { return x + 32; }
+    static uint8_t unchar(uint8_t x) { return x - 32; }
+    static uint8_t ctl(uint8_t x) { return x ^ 64; }
+};
+
+#endif
@@ -0,0 +1,96 @@
+#include "knownhosts.h"
+
+#ifdef ESP32
+#include <Preferences.h>
+#endif
+
+String knownHostKey(String hostPort, uint16_t defaultPort)
+{
+    hostPort.trim();
+    if (hostPort.indexOf(':') < 0)
+        hostPort += ":" + String(defaultPort);
+    return hostPort;
+}
+
+int findKnownHost(const String &hosts, const String &hostPort)
+{
+    String prefix = hostPort + " ";
+    int pos = 0;
+    while (pos < (int)hosts.length())
+    {
+        if (hosts.startsWith(prefix, pos))
+            return pos;
+        int next = hosts.indexOf('\n', pos);
+        if (next < 0)
+            break;
+        pos = next + 1;
+    }
+    return -1;
+}
+
+static void removeLine(String &hosts, int pos)
+{
+    int end = hosts.indexOf('\n', pos);
+    hosts.remove(pos, end < 0 ? hosts.length() - pos : end - pos + 1);
+}
+
+String knownHostFingerprint(const String &hosts, const String &hostPort)
+{
+    int pos = findKnownHost(hosts, hostPort);
+    if (pos < 0)
+        return "";
+    int start = pos + hostPort.length() + 1;
+    int end = hosts.indexOf('\n', start);
+    return hosts.substring(start, end < 0 ? hosts.length() : end);
+}
+
+void addKnownHost(String &hosts, const String &hostPort, const String &fingerprint)
+{
+    removeKnownHost(hosts, hostPort);
+    String line = hostPort + " " + fingerprint + "\n";
+    while (hosts.length() > 0 && hosts.length() + line.length() > KNOWN_HOSTS_MAX)
+        removeLine(hosts, 0);
+    hosts += line;
+}
+
+bool removeKnownHost(String &hosts, const String &hostPort)
+{
+    int pos = findKnownHost(hosts, hostPort);
+    if (pos < 0)
+        return false;
+    removeLine(hosts, pos);
+    return true;
+}
+
+#ifdef ESP32
+String loadKnownHosts(const char *ns)
+{
+    Preferences prefs;
+    prefs.begin(ns, true);
+    String hosts = prefs.getString(KNOWN_HOSTS_KEY, "");
+    prefs.end();
+    return hosts;
+}
+
+void saveKnownHosts(const char *ns, const String &hosts)
+{
+    Preferences prefs;
+    prefs.begin(ns, false);
+    prefs.putString(KNOWN_HOSTS_KEY, hosts);
+    prefs.end();
+}
+
+void printKnownHosts(const char *ns)
+{
+    String hosts = loadKnownHosts(ns);
+    int pos = 0;
+    while (pos < (int)hosts.length())
+    {
+        int end = hosts.indexOf('\n', pos);
+        if (end < 0)
+            end = hosts.length();
+        Serial.println(hosts.substring(pos, end));
+        pos = end + 1;
+    }
+}
+#endif
@@ -0,0 +1,42 @@
+#ifndef KNOWNHOSTS_H
+#define KNOWNHOSTS_H
+
+#include <Arduino.h>
+
+// Lists of trusted servers, used for SSH host keys and TLS certificate
+// pins. Each list is one NVS string under KNOWN_HOSTS_KEY in the owner's
+// Preferences namespace, one "host:port fingerprint" line per server,
+// oldest first. The line handling works on plain Strings so it can be
+// tested on the host.
+
+#define KNOWN_HOSTS_KEY "known_hosts"
+#define KNOWN_HOSTS_MAX 3000 // NVS strings are limited to about 4000 bytes
+
+// Port assumed when AT$SSHFORGET or AT$TLSFORGET is given a bare host.
+// Most TLS pins come from HTTPS; telnet over TLS pins are on :992.
+#define SSH_KNOWN_HOSTS_PORT 22
+#define TLS_KNOWN_HOSTS_PORT 443
+
+// hostPort trimmed, with ":defaultPort" added when it has no port
+String knownHostKey(String hostPort, uint16_t defaultPort);
+
+// Index of the line for hostPort in hosts, or -1
+int findKnownHost(const String &hosts, const String &hostPort);
+
+// The fingerprint saved for hostPort, empty if there is none
+String knownHostFingerprint(const String &hosts, const String &hostPort);
+
+// Replaces any line for hostPort and drops the oldest lines to stay
+// within KNOWN_HOSTS_MAX
+void addKnownHost(String &hosts, const String &hostPort, const String &fingerprint);
+
+// False if hostPort was not in the list
+bool removeKnownHost(String &hosts, const String &hostPort);
+
+#ifdef ESP32
+String loadKnownHosts(const char *ns);
+void saveKnownHosts(const char *ns, const String &hosts);
+void printKnownHosts(const char *ns);
+#endif
+
+#endif
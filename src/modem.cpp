@@ -1,8 +1,6 @@
 #include <Arduino.h>
 
 #ifdef ESP32
-// ESP32-specific includes for PPP
-#include "netif/ppp/pppos.h"
 #include "lwip/err.h"
 #include "lwip/sockets.h"
 #include "lwip/sys.h"
@@ -16,6 +14,11 @@
 // Note: PPP functionality may not be available on ESP8266
 #endif
 #include <globals.h>
+#include "charset.h"
+#include "ansi.h"
+#include "ppp.h"
+#include "wifi.h"
+#include "boot.h"
 
 // ========================= Utility Functions =========================
 
@@ -68,6 +71,7 @@ void handleNetworkInfo(const String &, const String &);
 void handleProfileView(const String &, const String &);
 void handleProfileWrite(const String &, const String &);
 void handleFirmwareUpdate(const String &, const String &);
+void handleFirmwareFromSD(const String &, const String &);
 void handleSpeedDial(const String &, const String &);
 void handleSSID(const String &, const String &);
 void handlePassword(const String &, const String &);
@@ -86,6 +90,33 @@ void handleQuiet(const String &, const String &);
 void handleSDInit(const String &, const String &);
 void handleHardReset(const String &, const String &);
 void handleSDSpeed(const String &, const String &);
+void handleKermitReceive(const String &, const String &);
+void handleKermitSend(const String &, const String &);
+void handleXModemSend(const String &, const String &);
+void handleYModemSend(const String &, const String &);
+void handleWebBrowse(const String &, const String &);
+void handleTermWidth(const String &, const String &);
+void handleTermHeight(const String &, const String &);
+void handleCharset(const String &, const String &);
+void handleAnsiFilter(const String &, const String &);
+void handleSSHKeygen(const String &, const String &);
+void handleSSHKey(const String &, const String &);
+void handleSSHHosts(const String &, const String &);
+void handleSSHForget(const String &, const String &);
+void handleTLSHosts(const String &, const String &);
+void handleTLSForget(const String &, const String &);
+void handleSSHKeepalive(const String &, const String &);
+void handleSSHReconnects(const String &, const String &);
+void handleTermType(const String &, const String &);
+void handlePPPOptions(const String &, const String &);
+void handlePPPMru(const String &, const String &);
+void handleNatTable(const String &, const String &);
+void handleStaticIP(const String &, const String &);
+void handleExtraNetwork(const String &, const String &);
+void handlePowerSaveMode(const String &, const String &);
+void handleBootTimes(const String &, const String &);
+void handlePortForward(const String &, const String &);
+void handlePortForwardDelete(const String &, const String &);
 
 // ========================= Helper Functions =========================
 
@@ -132,84 +163,58 @@ void handleQuietMode(String upCmd)
 
 void dialOut(String upCmd)
 {
-  if (callConnected)
+  if (callConnected || sshConnecting)
   {
     sendResult(RES_ERROR);
     return;
   }
 
-  String host, port;
-  int portIndex;
+  String host, port, target;
+  bool secure = false;
 
   if (upCmd.indexOf("ATDS") == 0)
   {
     byte speedNum = upCmd.substring(4, 5).toInt();
-    portIndex = speedDials[speedNum].indexOf(':');
-    if (portIndex != -1)
-    {
-      host = speedDials[speedNum].substring(0, portIndex);
-      port = speedDials[speedNum].substring(portIndex + 1);
-    }
-    else
-    {
-      port = "23";
-    }
+    target = speedDials[speedNum];
+    target.toUpperCase();
   }
   else
   {
-    int portIndex = upCmd.indexOf(":");
-    if (portIndex != -1)
-    {
-      host = upCmd.substring(4, portIndex);
-      port = upCmd.substring(portIndex + 1, upCmd.length());
-    }
-    else
-    {
-      host = upCmd.substring(4, upCmd.length());
-      port = "23";
-    }
+    target = upCmd.substring(4);
+  }
+  target.trim();
+
+  // ATDT TLS://HOST:PORT dials a TLS session
+  if (target.startsWith("TLS://"))
+  {
+    secure = true;
+    target = target.substring(6);
+  }
+
+  int portIndex = target.indexOf(':');
+  if (portIndex != -1)
+  {
+    host = target.substring(0, portIndex);
+    port = target.substring(portIndex + 1);
+  }
+  else
+  {
+    host = target;
+    port = secure ? "992" : "23";
   }
 
   host.trim();
   port.trim();
 
-#ifdef ESP8266
+#ifdef PPP_ENABLED
   if (host.equals("PPP") || host.equals("777"))
   {
-    if (ppp)
-    {
-      Serial.println("PPP already active");
-      sendResult(RES_ERROR);
-      return;
-    }
-    ppp = pppos_create(&ppp_netif, ppp_output_cb, ppp_status_cb, NULL);
-    ppp_set_usepeerdns(ppp, 1);
-    ppp_set_ipcp_dnsaddr(ppp, 0, ip_2_ip4((const ip_addr_t *)WiFi.dnsIP(0)));
-    ppp_set_ipcp_dnsaddr(ppp, 1, ip_2_ip4((const ip_addr_t *)WiFi.dnsIP(1)));
-
-#if PPP_AUTH_SUPPORT
-    ppp_set_auth(ppp, PPPAUTHTYPE_NONE, "", "");
-    ppp_set_auth_required(ppp, 0);
-#endif
-    ppp_set_ipcp_ouraddr(ppp, ip_2_ip4((const ip_addr_t *)WiFi.localIP()));
-    ppp_set_ipcp_hisaddr(ppp, ip_2_ip4((const ip_addr_t *)IPAddress(192, 168, 240, 2)));
-    err_t ppp_err;
-    ppp_err = ppp_listen(ppp);
-    if (ppp_err == PPPERR_NONE)
-    {
-      sendResult(RES_CONNECT);
-      connectTime = millis();
-      cmdMode = false;
-      callConnected = true;
-      setCarrierDCDPin(callConnected);
-    }
-    else
-    {
-      Serial.println("ppp_listen failed\n");
-      ppp_status_cb(ppp, ppp_err, NULL);
-      ppp_close(ppp, 1);
-      sendResult(RES_ERROR);
-    }
+    dialPPP();
+    return;
+  }
+  if (host.equals("SLIP") || host.equals("CSLIP"))
+  {
+    dialSLIP(host.equals("CSLIP"));
     return;
   }
 #endif
@@ -218,6 +223,17 @@ void dialOut(String upCmd)
   Serial.print(host);
   Serial.print(":");
   Serial.println(port);
+
+  if (secure)
+  {
+#ifdef ESP32
+    dialTLS(host, port.toInt());
+#else
+    Serial.println("TLS is not supported on this board");
+    sendResult(RES_ERROR);
+#endif
+    return;
+  }
   char *hostChr = new char[host.length() + 1];
   host.toCharArray(hostChr, host.length() + 1);
   int portInt = port.toInt();
@@ -259,6 +275,7 @@ static const ATCommand atCommands[] = {
     {"AT&V", handleProfileView, true},
     {"AT&W", handleProfileWrite, true},
     {"AT$FW", handleFirmwareUpdate, true},
+    {"AT$FWSD=", handleFirmwareFromSD, false},
     {"AT$SSID?", handleSSID, true},
     {"AT$PASS?", handlePassword, true},
     {"AT&F", handleFactoryReset, true},
@@ -276,6 +293,11 @@ static const ATCommand atCommands[] = {
     {"AT$SDINIT", handleSDInit, true},
     {"AT$HRESET", handleHardReset, true},
     {"AT$SDSPEED", handleSDSpeed, true},
+    {"AT$KRECV", handleKermitReceive, true},
+    {"AT$SSHKEYGEN", handleSSHKeygen, true},
+    {"AT$SSHKEY?", handleSSHKey, true},
+    {"AT$SSHHOSTS?", handleSSHHosts, true},
+    {"AT$TLSHOSTS?", handleTLSHosts, true},
 
     // Prefix matches
     {"ATDT", handleDial, false},
@@ -298,6 +320,28 @@ static const ATCommand atCommands[] = {
     {"ATGET", handleHTTPGet, false},
     {"ATGPH", handleGopher, false},
     {"ATQ", handleQuiet, false},
+    {"AT$KSEND=", handleKermitSend, false},
+    {"AT$SEND=", handleXModemSend, false},
+    {"AT$SENDB=", handleYModemSend, false},
+    {"ATWEB", handleWebBrowse, false},
+    {"AT$TW", handleTermWidth, false},
+    {"AT$TH", handleTermHeight, false},
+    {"AT$CS", handleCharset, false},
+    {"AT$AF", handleAnsiFilter, false},
+    {"AT$SSHFORGET=", handleSSHForget, false},
+    {"AT$TLSFORGET=", handleTLSForget, false},
+    {"ATS40", handleSSHKeepalive, false},
+    {"ATS41", handleSSHReconnects, false},
+    {"AT$TT", handleTermType, false},
+    {"AT$PPPMRU", handlePPPMru, false},
+    {"AT$PPP", handlePPPOptions, false},
+    {"AT$NAT", handleNatTable, false},
+    {"AT$IP", handleStaticIP, false},
+    {"AT$WIFI", handleExtraNetwork, false},
+    {"AT$PS", handlePowerSaveMode, false},
+    {"AT$BOOT", handleBootTimes, true},
+    {"AT$FWDDEL=", handlePortForwardDelete, false},
+    {"AT$FWD", handlePortForward, false},
 };
 
 static const int numCommands = sizeof(atCommands) / sizeof(atCommands[0]);
@@ -364,6 +408,46 @@ void handleSSHConnect(const String &up, const String &raw)
   connectSSH(raw);
 }
 
+void handleSSHKeygen(const String &, const String &)
+{
+  sshGenerateKey();
+}
+
+void handleSSHKey(const String &, const String &)
+{
+  sshShowKey();
+}
+
+void handleSSHHosts(const String &, const String &)
+{
+  sshListKnownHosts();
+}
+
+void handleSSHForget(const String &, const String &raw)
+{
+  sshForgetHost(raw.substring(13));
+}
+
+void handleTLSHosts(const String &, const String &)
+{
+#ifdef ESP32
+  tlsListKnownHosts();
+#else
+  Serial.println("TLS is not supported on this board");
+  sendResult(RES_ERROR);
+#endif
+}
+
+void handleTLSForget(const String &, const String &raw)
+{
+#ifdef ESP32
+  tlsForgetHost(raw.substring(13));
+#else
+  Serial.println("TLS is not supported on this board");
+  sendResult(RES_ERROR);
+#endif
+}
+
 void handleTelnetMode(const String &up, const String &)
 {
   if (up == "ATNET0")
@@ -539,6 +623,11 @@ void handleFirmwareUpdate(const String &, const String &)
   firmwareUpdating = true;
 }
 
+void handleFirmwareFromSD(const String &, const String &raw)
+{
+  updateFirmwareFromSD(raw.substring(8)); // preserve case
+}
+
 void handleSpeedDial(const String &up, const String &raw)
 {
   if (up.length() < 5)
@@ -581,7 +670,10 @@ void handleSSID(const String &up, const String &raw)
 {
   if (up.startsWith("AT$SSID="))
   {
-    ssid = raw.substring(8); // preserve case
+    String newSsid = raw.substring(8); // preserve case
+    if (newSsid != ssid)
+      wifiChannel = 0; // The cached access point belongs to the old network
+    ssid = newSsid;
     sendResult(RES_OK);
   }
   else
@@ -784,4 +876,372 @@ void handleSDSpeed(const String &, const String &)
 {
   testSDCardSpeed();
   sendResult(RES_OK);
-}
\ No newline at end of file
+}
+
+void handleKermitReceive(const String &, const String &)
+{
+  kermitReceiveToSD();
+}
+
+void handleKermitSend(const String &, const String &raw)
+{
+  kermitSendFromSD(raw.substring(9)); // preserve case
+}
+
+void handleXModemSend(const String &, const String &raw)
+{
+  xmodemSendFromSD(raw.substring(8), false); // preserve case
+}
+
+void handleYModemSend(const String &, const String &raw)
+{
+  xmodemSendFromSD(raw.substring(9), true); // preserve case
+}
+
+void handleWebBrowse(const String &, const String &raw)
+{
+  browseWeb(raw.substring(5)); // preserve case
+}
+
+// One byte settings with a five character command, such as AT$TW=N to
+// set and AT$TW? to show
+static void handleByteSetting(const String &up, byte &value, int minValue, int maxValue, bool allowZero)
+{
+  String arg = up.substring(5);
+  if (arg == "?")
+  {
+    sendString(String(value));
+    sendResult(RES_OK);
+    return;
+  }
+  if (!arg.startsWith("="))
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  int n = arg.substring(1).toInt();
+  if ((n < minValue || n > maxValue) && !(allowZero && n == 0 && arg == "=0"))
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  value = n;
+  sendResult(RES_OK);
+}
+
+void handleTermWidth(const String &up, const String &)
+{
+  handleByteSetting(up, termCols, 20, 132, false);
+}
+
+void handleTermHeight(const String &up, const String &)
+{
+  handleByteSetting(up, termRows, 8, 72, true);
+}
+
+void handleSSHKeepalive(const String &up, const String &)
+{
+  handleByteSetting(up, sshKeepalive, 0, 255, false);
+}
+
+void handleSSHReconnects(const String &up, const String &)
+{
+  handleByteSetting(up, sshReconnects, 0, 10, false);
+}
+
+void handleTermType(const String &up, const String &raw)
+{
+  if (up == "AT$TT?")
+  {
+    sendString(sshTermType);
+    sendResult(RES_OK);
+    return;
+  }
+  String type = raw.substring(6);
+  type.trim();
+  type.toLowerCase();
+  if (!up.startsWith("AT$TT=") || type.length() == 0 || type.length() >= TERM_TYPE_LEN)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  sshTermType = type;
+  sendResult(RES_OK);
+}
+
+void handleCharset(const String &up, const String &)
+{
+  String arg = up.substring(5);
+  if (arg == "?")
+  {
+    sendString(charsetName(termCharset));
+    sendResult(RES_OK);
+    return;
+  }
+  int charset = arg.startsWith("=") ? charsetFromName(arg.substring(1)) : -1;
+  if (charset < 0)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  termCharset = charset;
+  sendResult(RES_OK);
+}
+
+void handlePPPOptions(const String &up, const String &)
+{
+  String arg = up.substring(6);
+  if (arg == "?")
+  {
+    sendString(pppOptionsName(pppOptions));
+    sendResult(RES_OK);
+    return;
+  }
+  int options = arg.startsWith("=") ? pppOptionsFromName(arg.substring(1)) : -1;
+  if (options < 0)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  pppOptions = options;
+  sendResult(RES_OK);
+}
+
+void handlePPPMru(const String &up, const String &)
+{
+  String arg = up.substring(9);
+  if (arg == "?")
+  {
+    sendString(String(pppMru));
+    sendResult(RES_OK);
+    return;
+  }
+  int mru = arg.startsWith("=") ? arg.substring(1).toInt() : 0;
+  if (mru < PPP_MRU_MIN || mru > PPP_MRU_MAX)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  pppMru = mru;
+  sendResult(RES_OK);
+}
+
+void handleNatTable(const String &up, const String &)
+{
+  String arg = up.substring(6);
+  if (arg == "?")
+  {
+    sendString(String(natTableEntries()));
+    sendResult(RES_OK);
+    return;
+  }
+#ifdef ESP32
+  sendString(F("The NAT table size is fixed by the ESP32 core"));
+  sendResult(RES_ERROR);
+#else
+  int entries = arg.startsWith("=") ? arg.substring(1).toInt() : 0;
+  if (entries < NAPT_TABLE_MIN || entries > NAPT_TABLE_MAX)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  naptTableSize = entries;
+  sendResult(RES_OK);
+#endif
+}
+
+void handlePowerSaveMode(const String &up, const String &)
+{
+  String arg = up.substring(5);
+  if (arg == "?")
+  {
+    sendString(String(powerSaveName(powerSave)) + " (" + sleepModeName() + ")");
+    sendResult(RES_OK);
+    return;
+  }
+  int mode = arg.startsWith("=") ? powerSaveFromName(arg.substring(1)) : -1;
+  if (mode < 0)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  powerSave = mode;
+  handlePowerSave();
+  sendResult(RES_OK);
+}
+
+void handleBootTimes(const String &, const String &)
+{
+  printBootTimes();
+  sendResult(RES_OK);
+}
+
+// AT$WIFI=N,SSID,PASSWORD stores another network for the supervisor to
+// fall back on, AT$WIFI=N removes it. The password may contain commas.
+void handleExtraNetwork(const String &up, const String &raw)
+{
+  String arg = raw.substring(7);
+  if (up.substring(7) == "?")
+  {
+    sendString("0: " + ssid + (WiFi.status() == WL_CONNECTED && WiFi.SSID() == ssid ? " (connected)" : ""));
+    for (int i = 0; i < WIFI_EXTRA_NETWORKS; i++)
+    {
+      if (wifiExtraSsid[i].isEmpty())
+        continue;
+      bool current = WiFi.status() == WL_CONNECTED && WiFi.SSID() == wifiExtraSsid[i];
+      sendString(String(i + 1) + ": " + wifiExtraSsid[i] + (current ? " (connected)" : ""));
+    }
+    sendResult(RES_OK);
+    return;
+  }
+  int slot = arg.startsWith("=") ? arg.substring(1, 2).toInt() : 0;
+  if (slot < 1 || slot > WIFI_EXTRA_NETWORKS || (arg.length() > 2 && arg[2] != ','))
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  if (arg.length() <= 2)
+  {
+    wifiExtraSsid[slot - 1] = "";
+    wifiExtraPass[slot - 1] = "";
+    sendResult(RES_OK);
+    return;
+  }
+  int comma = arg.indexOf(',', 3);
+  String name = comma < 0 ? arg.substring(3) : arg.substring(3, comma);
+  String pass = comma < 0 ? "" : arg.substring(comma + 1);
+  if (name.isEmpty() || name.length() > SSID_LEN || pass.length() > PASS_LEN)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  wifiExtraSsid[slot - 1] = name;
+  wifiExtraPass[slot - 1] = pass;
+  sendResult(RES_OK);
+}
+
+// AT$IP=ADDR,MASK,GATEWAY[,DNS] or AT$IP=DHCP, used from the next connect
+void handleStaticIP(const String &up, const String &)
+{
+  String arg = up.substring(5);
+  if (arg == "?")
+  {
+    sendString(ipConfigString(staticIp, staticAddress, staticMask, staticGateway, staticDns));
+    sendResult(RES_OK);
+    return;
+  }
+  if (arg == "=DHCP")
+  {
+    staticIp = false;
+    sendResult(RES_OK);
+    return;
+  }
+  IPAddress parts[4];
+  int count = 0;
+  int start = 1;
+  while (arg.startsWith("=") && count < 4 && start <= (int)arg.length())
+  {
+    int comma = arg.indexOf(',', start);
+    String part = comma < 0 ? arg.substring(start) : arg.substring(start, comma);
+    if (!parts[count++].fromString(part))
+    {
+      count = 0;
+      break;
+    }
+    if (comma < 0)
+      break;
+    start = comma + 1;
+  }
+  if (count < 3 || (uint32_t)parts[0] == 0 || (uint32_t)parts[1] == 0)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  staticIp = true;
+  staticAddress = parts[0];
+  staticMask = parts[1];
+  staticGateway = parts[2];
+  staticDns = count == 4 ? parts[3] : parts[2];
+  sendResult(RES_OK);
+}
+
+// Splits "TCP,2323,23" into its parts; toPort is port when left out
+static bool parsePortForward(const String &arg, byte &proto, uint16_t &port, uint16_t &toPort)
+{
+  int comma = arg.indexOf(',');
+  if (comma < 0)
+    return false;
+  int kind = forwardProtoFromName(arg.substring(0, comma));
+  String ports = arg.substring(comma + 1);
+  int second = ports.indexOf(',');
+  long from = (second < 0 ? ports : ports.substring(0, second)).toInt();
+  long to = second < 0 ? from : ports.substring(second + 1).toInt();
+  if (kind < 0 || from < 1 || from > 65535 || to < 1 || to > 65535)
+    return false;
+  proto = kind;
+  port = from;
+  toPort = to;
+  return true;
+}
+
+void handlePortForward(const String &up, const String &)
+{
+  String arg = up.substring(6);
+  if (arg == "?")
+  {
+    for (const PortForward &fwd : portForwards)
+    {
+      if (fwd.proto)
+        sendString(String(forwardProtoName(fwd.proto)) + "," + String(fwd.port) + "," + String(fwd.toPort));
+    }
+    sendResult(RES_OK);
+    return;
+  }
+  byte proto;
+  uint16_t port;
+  uint16_t toPort;
+  if (!arg.startsWith("=") || !parsePortForward(arg.substring(1), proto, port, toPort) ||
+      !addPortForward(proto, port, toPort))
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  refreshPortForwards();
+  sendResult(RES_OK);
+}
+
+void handlePortForwardDelete(const String &up, const String &)
+{
+  byte proto;
+  uint16_t port;
+  uint16_t toPort;
+  String arg = up.substring(10);
+  if (arg.indexOf(',') == arg.lastIndexOf(','))
+    arg += ",1"; // The port on the computer does not matter here
+  if (!parsePortForward(arg, proto, port, toPort) || !removePortForward(proto, port))
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  refreshPortForwards();
+  sendResult(RES_OK);
+}
+
+void handleAnsiFilter(const String &up, const String &)
+{
+  String arg = up.substring(5);
+  if (arg == "?")
+  {
+    sendString(ansiModeName(termAnsi));
+    sendResult(RES_OK);
+    return;
+  }
+  int mode = arg.startsWith("=") ? ansiModeFromName(arg.substring(1)) : -1;
+  if (mode < 0)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  termAnsi = mode;
+  sendResult(RES_OK);
+}
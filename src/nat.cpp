@@ -0,0 +1,221 @@
+#include <Arduino.h>
+#include <new>
+#include "globals.h"
+#include "ppp.h"
+
+#ifdef ESP32
+#include <lwip/tcpip.h>
+#endif
+
+const char *forwardProtoName(byte proto)
+{
+  return proto == FORWARD_UDP ? "UDP" : "TCP";
+}
+
+int forwardProtoFromName(const String &name)
+{
+  if (name.equalsIgnoreCase("TCP"))
+    return FORWARD_TCP;
+  if (name.equalsIgnoreCase("UDP"))
+    return FORWARD_UDP;
+  return -1;
+}
+
+bool addPortForward(byte proto, uint16_t port, uint16_t toPort)
+{
+  PortForward *slot = NULL;
+  for (PortForward &fwd : portForwards)
+  {
+    if (fwd.proto == proto && fwd.port == port)
+    {
+      slot = &fwd; // Same port again replaces the old forward
+      break;
+    }
+    if (fwd.proto == 0 && slot == NULL)
+      slot = &fwd;
+  }
+  if (slot == NULL)
+    return false;
+  slot->proto = proto;
+  slot->port = port;
+  slot->toPort = toPort;
+  return true;
+}
+
+bool removePortForward(byte proto, uint16_t port)
+{
+  for (PortForward &fwd : portForwards)
+  {
+    if (fwd.proto == proto && fwd.port == port)
+    {
+      fwd.proto = 0;
+      return true;
+    }
+  }
+  return false;
+}
+
+uint16_t natTableEntries()
+{
+#ifdef ESP32
+  return NAPT_TABLE_DEFAULT;
+#else
+  return naptTableSize;
+#endif
+}
+
+#ifdef PPP_ENABLED
+
+// What is in lwIP's port map, so it can be taken out again. On ESP32 the
+// map is changed from the lwIP task, which gets its own copy of what
+// should be there so nothing it reads is shared with loop().
+static PortForward forwardsApplied[PORT_FORWARD_MAX];
+static bool forwardsUp = false;
+static bool forwardsFailed = false; // The last change never reached lwIP
+
+struct PortForwardSync
+{
+  PortForward wanted[PORT_FORWARD_MAX];
+  uint32_t address;
+};
+
+static void applyPortForwards(const PortForwardSync &sync)
+{
+  for (PortForward &fwd : forwardsApplied)
+  {
+    if (fwd.proto)
+      ip_portmap_remove(fwd.proto, fwd.port);
+    fwd.proto = 0;
+  }
+  for (int i = 0; i < PORT_FORWARD_MAX; i++)
+  {
+    const PortForward &fwd = sync.wanted[i];
+    if (fwd.proto &&
+        ip_portmap_add(fwd.proto, sync.address, fwd.port, (uint32_t)PPP_PEER_ADDRESS, fwd.toPort))
+      forwardsApplied[i] = fwd;
+  }
+}
+
+#ifdef ESP32
+static void applyPortForwardsCallback(void *ctx)
+{
+  PortForwardSync *sync = (PortForwardSync *)ctx;
+  applyPortForwards(*sync);
+  delete sync;
+}
+#endif
+
+void syncPortForwards(bool up)
+{
+  forwardsUp = up;
+#ifdef ESP32
+  PortForwardSync *sync = new (std::nothrow) PortForwardSync;
+  if (!sync)
+  {
+    forwardsFailed = true;
+    return;
+  }
+#else
+  PortForwardSync local;
+  PortForwardSync *sync = &local;
+#endif
+  sync->address = (uint32_t)WiFi.localIP();
+  for (int i = 0; i < PORT_FORWARD_MAX; i++)
+  {
+    sync->wanted[i] = portForwards[i];
+    if (!up)
+      sync->wanted[i].proto = 0;
+  }
+#ifdef ESP32
+  // Waits for room in the lwIP mailbox rather than dropping the change
+  if (tcpip_callback(applyPortForwardsCallback, sync) != ERR_OK)
+  {
+    delete sync;
+    forwardsFailed = true;
+    return;
+  }
+#else
+  applyPortForwards(*sync);
+#endif
+  forwardsFailed = false;
+}
+
+void refreshPortForwards()
+{
+  syncPortForwards(forwardsUp);
+}
+
+bool getNatStats(NatStats &stats)
+{
+#if LWIP_STATS
+  struct stats_ip_napt napt;
+  ip_napt_get_stats(&napt);
+  stats.tcp = napt.nr_active_tcp;
+  stats.udp = napt.nr_active_udp;
+  stats.icmp = napt.nr_active_icmp;
+  stats.evictions = napt.nr_forced_evictions;
+  return true;
+#else
+  LWIP_UNUSED_ARG(stats);
+  return false;
+#endif
+}
+
+void printNATInfo()
+{
+  Serial.print("NAT: ");
+  Serial.print(natTableEntries());
+  Serial.print(" entries");
+  NatStats stats;
+  if (getNatStats(stats))
+  {
+    Serial.print(", ");
+    Serial.print(stats.tcp);
+    Serial.print(" TCP/");
+    Serial.print(stats.udp);
+    Serial.print(" UDP/");
+    Serial.print(stats.icmp);
+    Serial.print(" ICMP in use, ");
+    Serial.print(stats.evictions);
+    Serial.print(" evicted");
+  }
+  Serial.println();
+  for (const PortForward &fwd : portForwards)
+  {
+    if (fwd.proto == 0)
+      continue;
+    Serial.print("   ");
+    Serial.print(forwardProtoName(fwd.proto));
+    Serial.print(" ");
+    Serial.print(fwd.port);
+    Serial.print(" -> ");
+    Serial.print(PPP_PEER_ADDRESS);
+    Serial.print(":");
+    Serial.print(fwd.toPort);
+    if (!forwardsUp)
+      Serial.println(" (when PPP or SLIP is up)");
+    else
+      Serial.println(forwardsFailed ? " (not applied)" : "");
+  }
+}
+
+#else // No NAPT in this build - stubs only
+
+void syncPortForwards(bool up)
+{
+}
+
+void refreshPortForwards()
+{
+}
+
+bool getNatStats(NatStats &stats)
+{
+  return false;
+}
+
+void printNATInfo()
+{
+}
+
+#endif
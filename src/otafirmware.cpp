@@ -1,108 +1,768 @@
 #include <Arduino.h>
 #include "globals.h"
+#include "boot.h"
+#include "wifi.h"
 
 #ifdef ESP8266
 #include <ESP8266WiFi.h>
-#include <ESP8266WiFiMulti.h>
 #include <ESP8266HTTPClient.h>
-#include <ESP8266httpUpdate.h>
-
-ESP8266WiFiMulti WiFiMulti;
-#define UPDATE_CLASS ESPhttpUpdate
+#include <WiFiUdp.h>
+#include <Updater.h>
+#include <bearssl/bearssl.h>
 #elif defined(ESP32)
 #include <WiFi.h>
-#include <WiFiMulti.h>
 #include <HTTPClient.h>
-#include <HTTPUpdate.h>
-
-WiFiMulti WiFiMulti;
-#define UPDATE_CLASS httpUpdate
+#include <Update.h>
+#include <mbedtls/sha256.h>
+#include "rom/miniz.h"
 #endif
+#include <SD.h>
 
-String getLatestVersion()
+#define FIRMWARE_CHECK_TIMEOUT_MS 3000
+#define FIRMWARE_CHECK_STACK 6144
+
+// Version check states
+#define CHECK_IDLE 0
+#define CHECK_PENDING 1
+#define CHECK_RUNNING 2
+#define CHECK_DONE 3
+#define CHECK_FAILED 4
+
+// The check runs in the background. On ESP32 it is a task of its own and
+// only fills these in; the result is printed from loop() when the modem
+// is idle. The ESP8266 has no tasks, so there it runs from loop() once
+// the modem is idle, bounded by the timeout.
+static volatile byte checkState = CHECK_IDLE;
+static char checkLatest[32];
+static int checkCode = 0;
+static bool checkShown = false;
+
+// Fetches a short text file such as the latest version, returns the
+// HTTP result code
+static int fetchText(const String &url, String &text, uint16_t timeout)
 {
   WiFiClient client;
   HTTPClient http;
-  http.begin(client, hermes_version_url);
+  http.setTimeout(timeout);
+#ifdef ESP32
+  http.setConnectTimeout(timeout);
+#endif
+  http.begin(client, url);
   int httpResponseCode = http.GET();
-  String latestVersion = "unset";
   if (httpResponseCode > 0)
   {
-    latestVersion = http.getString();
-    hermes_version.trim();
-    latestVersion.trim();
+    text = http.getString();
+    text.trim();
   }
-  else
+  http.end();
+  return httpResponseCode;
+}
+
+String getLatestVersion()
+{
+  String latestVersion = "unset";
+  int httpResponseCode = fetchText(hermes_version_url, latestVersion, HTTPCLIENT_DEFAULT_TCP_TIMEOUT);
+  hermes_version.trim();
+  if (httpResponseCode <= 0)
   {
     Serial.println("Error checking for firmware update");
     Serial.print("Code: ");
     Serial.println(httpResponseCode);
   }
-  http.end();
   return latestVersion;
 }
 
-void check_for_firmware_update()
+static void runFirmwareCheck()
 {
-  String latestVersion = getLatestVersion();
-  if (hermes_version != latestVersion)
+  String latestVersion;
+  checkCode = fetchText(hermes_version_url, latestVersion, FIRMWARE_CHECK_TIMEOUT_MS);
+  if (checkCode > 0)
   {
-    Serial.println("");
-    Serial.print("New Hermes firmware version is available: ");
-    Serial.println(latestVersion);
-    Serial.println("Command to update: AT$FW");
+    strlcpy(checkLatest, latestVersion.c_str(), sizeof(checkLatest));
+    checkState = CHECK_DONE;
+  }
+  else
+  {
+    checkState = CHECK_FAILED;
   }
 }
 
-void update_started()
+#ifdef ESP32
+static void firmwareCheckTask(void *)
 {
-  Serial.println("Firmware update process started");
+  runFirmwareCheck();
+  vTaskDelete(NULL);
 }
+#endif
 
-void update_finished()
+static bool modemIdle()
 {
-  firmwareUpdating = false;
-  Serial.println("Firmware update process finished");
-  Serial.println("Rebooting...");
-  Serial.println("");
+  return cmdMode && !callConnected && cmd.length() == 0;
 }
 
-void update_progress(int cur, int total)
+static bool updateAvailable()
 {
-  Serial.printf("Downloading firmware: %d of %d byte(s)...\n", cur, total);
+  String current = hermes_version;
+  current.trim();
+  return checkState == CHECK_DONE && current != checkLatest;
 }
 
-void update_error(int err)
+void startFirmwareCheck()
 {
-  Serial.printf("Firmware update fatal error, code %d\n", err);
+  if (checkState == CHECK_PENDING || checkState == CHECK_RUNNING)
+    return;
+  checkShown = false;
+  checkState = CHECK_PENDING;
+  bootPhaseStart(BOOT_UPDATE);
 }
 
-void handleOTAFirmware()
+void pollFirmwareCheck()
 {
-  if ((WiFiMulti.run() == WL_CONNECTED))
+  switch (checkState)
   {
-    WiFiClient client;
-    UPDATE_CLASS.onStart(update_started);
-    UPDATE_CLASS.onEnd(update_finished);
-    UPDATE_CLASS.onProgress(update_progress);
-    UPDATE_CLASS.onError(update_error);
-    String latestVersion = getLatestVersion();
-    String modifiedVersion = latestVersion;
-    modifiedVersion.replace('.', '_');
-    t_httpUpdate_return ret = UPDATE_CLASS.update(client, "http://protea.rh1.tech/ota/hermes_" + modifiedVersion + ".bin");
-    switch (ret)
-    {
-    case HTTP_UPDATE_FAILED:
-      Serial.printf("HTTP_UPDATE_FAILED, error (%d): %s\n", UPDATE_CLASS.getLastError(), UPDATE_CLASS.getLastErrorString().c_str());
+  case CHECK_PENDING:
+#ifdef ESP32
+    checkState = CHECK_RUNNING;
+    if (xTaskCreate(firmwareCheckTask, "fwcheck", FIRMWARE_CHECK_STACK, NULL, 1, NULL) != pdPASS)
+    {
+      checkCode = 0;
+      checkState = CHECK_FAILED;
+    }
+#else
+    if (modemIdle())
+    {
+      checkState = CHECK_RUNNING;
+      runFirmwareCheck();
+    }
+#endif
+    break;
+
+  case CHECK_DONE:
+  case CHECK_FAILED:
+    bootPhaseEnd(BOOT_UPDATE);
+    if (checkShown || !modemIdle())
       break;
+    checkShown = true;
+    if (updateAvailable())
+    {
+      Serial.println("");
+      Serial.print("New Hermes firmware version is available: ");
+      Serial.println(checkLatest);
+      Serial.println("Command to update: AT$FW");
+    }
+    break;
+  }
+}
+
+void printFirmwareCheck()
+{
+  Serial.print("Firmware check: ");
+  switch (checkState)
+  {
+  case CHECK_IDLE:
+    Serial.println("not run");
+    break;
+  case CHECK_PENDING:
+  case CHECK_RUNNING:
+    Serial.println("running");
+    break;
+  case CHECK_DONE:
+    Serial.print("latest ");
+    Serial.print(checkLatest);
+    Serial.println(updateAvailable() ? ", update with AT$FW" : ", up to date");
+    break;
+  case CHECK_FAILED:
+    Serial.print("failed, code ");
+    Serial.println(checkCode);
+    break;
+  }
+}
+
+
+// ========================= Firmware Update =========================
+
+#define OTA_BASE_URL "http://protea.rh1.tech/ota/hermes_"
+#define OTA_TIMEOUT_MS 10000      // No data for this long drops the connection
+#define OTA_RETRIES 5             // Attempts in a row that get nothing
+#define OTA_RETRY_MS 2000         // First pause before resuming, then doubled
+#define OTA_CHUNK 1024
+#define OTA_PROGRESS_BYTES 65536  // How often progress is printed
+#define SHA256_HEX_LEN 64
+
+// The image goes to the update partition as it arrives, and a SHA-256 of
+// the file as published is kept on the way. Only when that matches the
+// published digest is the new partition made the boot one. A gzip image
+// is written as it is on ESP8266, whose boot loader inflates it; on ESP32
+// it is inflated on the way to flash.
+static uint8_t otaBuffer[OTA_CHUNK];
+static size_t imageTotal = 0;    // Bytes of the file
+static size_t imageWritten = 0;  // Of those, handed to imageWrite()
+static size_t imageReported = 0;
+static bool imageCompressed = false;
+static String imageError;
+
+#ifdef ESP32
+static mbedtls_sha256_context imageSha;
+
+// Gzip (RFC 1952) header fields, skipped before the deflate data
+#define GZ_FHCRC 0x02
+#define GZ_FEXTRA 0x04
+#define GZ_FNAME 0x08
+#define GZ_FCOMMENT 0x10
+
+enum GzipStage
+{
+  GZ_FIXED,
+  GZ_EXTRA_LEN,
+  GZ_EXTRA,
+  GZ_NAME,
+  GZ_COMMENT,
+  GZ_HCRC,
+  GZ_DATA,
+  GZ_END // Deflate data done, the trailer is left to the SHA-256
+};
+
+static GzipStage gzStage = GZ_FIXED;
+static uint8_t gzFlags = 0;
+static uint16_t gzPos = 0;
+static uint16_t gzCount = 0;
+static tinfl_decompressor *inflator = NULL;
+static uint8_t *dictionary = NULL; // Also the output window
+static size_t dictionaryPos = 0;
+#else
+static br_sha256_context imageSha;
+#endif
+
+static String updateErrorString()
+{
+#ifdef ESP32
+  return Update.errorString();
+#else
+  return Update.getErrorString();
+#endif
+}
+
+static void update_progress(size_t cur, size_t total)
+{
+  Serial.printf("Installing firmware: %u of %u byte(s)...\n", (unsigned)cur, (unsigned)total);
+}
+
+// The first 64 hex digits of a digest file, as sha256sum writes it
+static String parseDigest(String text)
+{
+  text.trim();
+  String digest = text.substring(0, SHA256_HEX_LEN);
+  if (digest.length() != SHA256_HEX_LEN)
+    return "";
+  for (size_t i = 0; i < digest.length(); i++)
+  {
+    if (!isxdigit(digest[i]))
+      return "";
+  }
+  if (text.length() > SHA256_HEX_LEN && !isspace(text[SHA256_HEX_LEN]))
+    return "";
+  digest.toLowerCase();
+  return digest;
+}
+
+#ifdef ESP32
+// Moves past the optional header fields the flags say are not there
+static void gzipSkipAbsent()
+{
+  if (gzStage == GZ_EXTRA_LEN && !(gzFlags & GZ_FEXTRA))
+    gzStage = GZ_NAME;
+  if (gzStage == GZ_NAME && !(gzFlags & GZ_FNAME))
+    gzStage = GZ_COMMENT;
+  if (gzStage == GZ_COMMENT && !(gzFlags & GZ_FCOMMENT))
+    gzStage = GZ_HCRC;
+  if (gzStage == GZ_HCRC && !(gzFlags & GZ_FHCRC))
+    gzStage = GZ_DATA;
+  gzPos = 0;
+  if (gzStage == GZ_HCRC)
+    gzCount = 2;
+}
 
-    case HTTP_UPDATE_NO_UPDATES:
-      Serial.println("HTTP_UPDATE_NO_UPDATES");
+// Eats header bytes, returns how many were used
+static size_t gzipHeader(const uint8_t *data, size_t len)
+{
+  size_t i = 0;
+  while (i < len && gzStage < GZ_DATA)
+  {
+    uint8_t b = data[i++];
+    switch (gzStage)
+    {
+    case GZ_FIXED:
+      if (gzPos == 2 && b != 8)
+      {
+        imageError = "Unknown gzip compression method";
+        return 0;
+      }
+      if (gzPos == 3)
+        gzFlags = b;
+      if (++gzPos == 10)
+      {
+        gzStage = GZ_EXTRA_LEN;
+        gzCount = 0;
+        gzipSkipAbsent();
+      }
+      break;
+    case GZ_EXTRA_LEN:
+      gzCount |= b << (8 * gzPos);
+      if (++gzPos == 2)
+      {
+        gzStage = gzCount ? GZ_EXTRA : GZ_NAME;
+        if (gzStage == GZ_NAME)
+          gzipSkipAbsent();
+      }
+      break;
+    case GZ_EXTRA:
+      if (--gzCount == 0)
+      {
+        gzStage = GZ_NAME;
+        gzipSkipAbsent();
+      }
+      break;
+    case GZ_NAME:
+      if (b == 0)
+      {
+        gzStage = GZ_COMMENT;
+        gzipSkipAbsent();
+      }
+      break;
+    case GZ_COMMENT:
+      if (b == 0)
+      {
+        gzStage = GZ_HCRC;
+        gzipSkipAbsent();
+      }
       break;
+    case GZ_HCRC:
+      if (--gzCount == 0)
+        gzStage = GZ_DATA;
+      break;
+    default:
+      break;
+    }
+  }
+  return i;
+}
 
-    case HTTP_UPDATE_OK:
-      Serial.println("HTTP_UPDATE_OK");
+// Inflates into the dictionary window and writes each piece to flash
+static bool inflateToFlash(const uint8_t *data, size_t len)
+{
+  while (gzStage == GZ_DATA)
+  {
+    size_t inLen = len;
+    size_t outLen = TINFL_LZ_DICT_SIZE - dictionaryPos;
+    tinfl_status status = tinfl_decompress(inflator, data, &inLen, dictionary, dictionary + dictionaryPos, &outLen,
+                                           TINFL_FLAG_HAS_MORE_INPUT);
+    data += inLen;
+    len -= inLen;
+    if (outLen > 0 && Update.write(dictionary + dictionaryPos, outLen) != outLen)
+    {
+      imageError = updateErrorString();
+      return false;
+    }
+    dictionaryPos = (dictionaryPos + outLen) & (TINFL_LZ_DICT_SIZE - 1);
+    if (status == TINFL_STATUS_DONE)
+      gzStage = GZ_END;
+    else if (status < TINFL_STATUS_DONE)
+    {
+      imageError = "Corrupt gzip data";
+      return false;
+    }
+    else if (len == 0 && status != TINFL_STATUS_HAS_MORE_OUTPUT)
       break;
+  }
+  return true;
+}
+
+static void freeInflator()
+{
+  delete inflator;
+  delete[] dictionary;
+  inflator = NULL;
+  dictionary = NULL;
+}
+#endif
+
+// Throws away whatever was written, the running firmware stays
+static void imageAbort()
+{
+  if (Update.isRunning())
+  {
+#ifdef ESP32
+    Update.abort();
+#else
+    // The updater has no abort, but an MD5 that cannot match makes end()
+    // drop the image
+    Update.setMD5("00000000000000000000000000000000");
+    Update.end(true);
+#endif
+  }
+#ifdef ESP32
+  freeInflator();
+#endif
+}
+
+static void imageReset(size_t total)
+{
+  imageAbort();
+  imageTotal = total;
+  imageWritten = 0;
+  imageReported = 0;
+  imageCompressed = false;
+  imageError = "";
+#ifdef ESP32
+  mbedtls_sha256_free(&imageSha);
+  mbedtls_sha256_init(&imageSha);
+  mbedtls_sha256_starts(&imageSha, 0);
+  gzStage = GZ_FIXED;
+  gzPos = 0;
+  dictionaryPos = 0;
+#else
+  br_sha256_init(&imageSha);
+#endif
+}
+
+// Starts the update on the first bytes, which tell a gzip image apart
+static bool imageBegin(const uint8_t *data, size_t len)
+{
+  imageCompressed = len >= 2 && data[0] == 0x1F && data[1] == 0x8B;
+#ifdef ESP32
+  if (imageCompressed)
+  {
+    inflator = new (std::nothrow) tinfl_decompressor;
+    dictionary = new (std::nothrow) uint8_t[TINFL_LZ_DICT_SIZE];
+    if (!inflator || !dictionary)
+    {
+      freeInflator();
+      imageError = "Out of memory";
+      return false;
     }
+    tinfl_init(inflator);
+  }
+  // The inflated size is not in the header, so let the partition bound it
+  if (!Update.begin(imageCompressed ? UPDATE_SIZE_UNKNOWN : imageTotal))
+#else
+  WiFiUDP::stopAll();
+  if (!Update.begin(imageTotal))
+#endif
+  {
+    imageError = updateErrorString();
+    return false;
+  }
+  return true;
+}
+
+static bool imageWrite(uint8_t *data, size_t len)
+{
+  if (len == 0)
+    return true;
+  if (imageWritten == 0 && !imageBegin(data, len))
+    return false;
+#ifdef ESP32
+  mbedtls_sha256_update(&imageSha, data, len);
+#else
+  br_sha256_update(&imageSha, data, len);
+#endif
+  imageWritten += len;
+
+#ifdef ESP32
+  if (imageCompressed)
+  {
+    size_t used = gzStage < GZ_DATA ? gzipHeader(data, len) : 0;
+    if (!imageError.isEmpty())
+      return false;
+    if (gzStage == GZ_DATA && !inflateToFlash(data + used, len - used))
+      return false;
+  }
+  else
+#endif
+  if (Update.write(data, len) != len)
+  {
+    imageError = updateErrorString();
+    return false;
+  }
+
+  if (imageWritten - imageReported >= OTA_PROGRESS_BYTES || imageWritten == imageTotal)
+  {
+    update_progress(imageWritten, imageTotal);
+    imageReported = imageWritten;
+  }
+  return true;
+}
+
+// Checks the digest and only then switches to the new firmware
+static bool imageFinish(const String &expected)
+{
+  uint8_t digest[32];
+#ifdef ESP32
+  mbedtls_sha256_finish(&imageSha, digest);
+  mbedtls_sha256_free(&imageSha);
+#else
+  br_sha256_out(&imageSha, digest);
+#endif
+  char hex[SHA256_HEX_LEN + 1];
+  for (int i = 0; i < 32; i++)
+    sprintf(hex + 2 * i, "%02x", digest[i]);
+
+  if (imageWritten != imageTotal)
+  {
+    imageError = "Image is incomplete";
+    return false;
+  }
+#ifdef ESP32
+  if (imageCompressed && gzStage != GZ_END)
+  {
+    imageError = "Gzip data is incomplete";
+    return false;
+  }
+#endif
+  if (expected != hex)
+  {
+    imageError = String("SHA-256 mismatch, got ") + hex;
+    return false;
+  }
+  if (!Update.end(true))
+  {
+    imageError = updateErrorString();
+    return false;
+  }
+#ifdef ESP32
+  freeInflator();
+#endif
+  return true;
+}
+
+static void installImage(const String &expected)
+{
+  if (!imageFinish(expected))
+  {
+    Serial.println("Firmware update failed: " + imageError);
+    imageAbort();
+    sendResult(RES_ERROR);
+    return;
+  }
+  Serial.println("SHA-256 verified");
+  Serial.println("Firmware update process finished");
+  Serial.println("Rebooting...");
+  Serial.println("");
+  Serial.flush();
+  delay(500);
+  ESP.restart();
+}
+
+// Downloads url into the update partition. When the connection drops the
+// download carries on from where it stopped with an HTTP Range request.
+static bool downloadImage(const String &url)
+{
+  size_t done = 0;
+  int attempts = 0;
+  unsigned long pause = OTA_RETRY_MS;
+  while (true)
+  {
+    WiFiClient client;
+    HTTPClient http;
+    http.setTimeout(OTA_TIMEOUT_MS);
+    http.begin(client, url);
+    if (done > 0)
+      http.addHeader("Range", "bytes=" + String(done) + "-");
+    int code = http.GET();
+
+    size_t skip = 0;
+    size_t before = done;
+    bool usable = true;
+    if (done == 0 && code == HTTP_CODE_OK && http.getSize() > 0)
+    {
+      imageReset(http.getSize());
+    }
+    else if (done == 0 && code > 0)
+    {
+      http.end();
+      imageError = code == HTTP_CODE_OK ? String("No Content-Length") : "HTTP error " + String(code);
+      return false;
+    }
+    else if (done > 0 && code == HTTP_CODE_OK)
+    {
+      skip = done; // The server ignored the range, read past what we have
+    }
+    else if (code != HTTP_CODE_PARTIAL_CONTENT)
+    {
+      usable = false;
+    }
+
+    WiFiClient *stream = http.getStreamPtr();
+    unsigned long lastData = millis();
+    while (usable && done < imageTotal && millis() - lastData < OTA_TIMEOUT_MS)
+    {
+      size_t n = stream->available();
+      if (n == 0)
+      {
+        if (!stream->connected())
+          break;
+        delay(1);
+        continue;
+      }
+      int got = stream->read(otaBuffer, min(n, sizeof(otaBuffer)));
+      if (got <= 0)
+        continue;
+      lastData = millis();
+      size_t from = min(skip, (size_t)got);
+      skip -= from;
+      size_t len = min((size_t)got - from, imageTotal - done);
+      if (!imageWrite(otaBuffer + from, len))
+      {
+        http.end();
+        return false;
+      }
+      done += len;
+    }
+    http.end();
+
+    if (done > 0 && done == imageTotal)
+      return true;
+    if (done > before)
+    {
+      attempts = 0;
+      pause = OTA_RETRY_MS;
+    }
+    if (++attempts >= OTA_RETRIES)
+    {
+      imageError = "Download stopped at " + String(done) + " of " + String(imageTotal) + " bytes";
+      return false;
+    }
+    Serial.printf("Connection lost at %u byte(s), resuming in %lu s\n", (unsigned)done, pause / 1000);
+
+    // Let the supervisor bring the link back meanwhile
+    unsigned long waitFrom = millis();
+    while (millis() - waitFrom < pause)
+    {
+      handleWiFiSupervisor();
+      delay(10);
+    }
+    pause *= 2;
+  }
+}
+
+void handleOTAFirmware()
+{
+  firmwareUpdating = false;
+  if (WiFi.status() != WL_CONNECTED) // The Wi-Fi supervisor keeps it so
+  {
+    Serial.println("Not connected to Wi-Fi");
+    sendResult(RES_ERROR);
+    return;
+  }
+  String latestVersion = getLatestVersion();
+  if (latestVersion == "unset")
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  String modifiedVersion = latestVersion;
+  modifiedVersion.replace('.', '_');
+  String url = OTA_BASE_URL + modifiedVersion + ".bin";
+
+  // Each image has its digest beside it. The compressed one is smaller,
+  // so take it when it is there.
+  String text;
+  String digest;
+  if (fetchText(url + ".gz.sha256", text, OTA_TIMEOUT_MS) == HTTP_CODE_OK)
+    digest = parseDigest(text);
+  if (!digest.isEmpty())
+    url += ".gz";
+  else if (fetchText(url + ".sha256", text, OTA_TIMEOUT_MS) == HTTP_CODE_OK)
+    digest = parseDigest(text);
+  if (digest.isEmpty())
+  {
+    Serial.println("No SHA-256 published for " + url + ", not updating");
+    sendResult(RES_ERROR);
+    return;
+  }
+
+  Serial.println("Firmware update process started");
+  Serial.println("Downloading " + url);
+  if (!downloadImage(url))
+  {
+    Serial.println("Firmware update failed: " + imageError);
+    imageAbort();
+    sendResult(RES_ERROR);
+    return;
+  }
+  installImage(digest);
+}
+
+// AT$FWSD=FILE[,SHA256] installs an image from the SD card. Without the
+// digest it is read from FILE.sha256.
+void updateFirmwareFromSD(String args)
+{
+  args.trim();
+  String path = args;
+  String digest;
+  int comma = args.indexOf(',');
+  if (comma >= 0)
+  {
+    path = args.substring(0, comma);
+    digest = parseDigest(args.substring(comma + 1));
+    if (digest.isEmpty())
+    {
+      sendResult(RES_ERROR);
+      return;
+    }
+  }
+  path.trim();
+  if (path.length() == 0)
+  {
+    sendResult(RES_ERROR);
+    return;
+  }
+  if (!path.startsWith("/"))
+    path = "/" + path;
+  if (!requireSDCard())
+    return;
+
+  File file = SD.open(path, FILE_READ);
+  if (!file || file.isDirectory())
+  {
+    Serial.println("File not found: " + path);
+    sendResult(RES_ERROR);
+    return;
+  }
+  if (digest.isEmpty())
+  {
+    File sum = SD.open(path + ".sha256", FILE_READ);
+    if (sum)
+    {
+      digest = parseDigest(sum.readString());
+      sum.close();
+    }
+  }
+  if (digest.isEmpty())
+  {
+    file.close();
+    Serial.println("No SHA-256 for " + path + ". Use AT$FWSD=FILE,SHA256 or put it in " + path + ".sha256");
+    sendResult(RES_ERROR);
+    return;
+  }
+
+  Serial.println("Firmware update process started");
+  imageReset(file.size());
+  bool ok = true;
+  while (ok && file.available())
+  {
+    int got = file.read(otaBuffer, sizeof(otaBuffer));
+    if (got <= 0)
+      break;
+    ok = imageWrite(otaBuffer, got);
+  }
+  file.close();
+  if (!ok)
+  {
+    Serial.println("Firmware update failed: " + imageError);
+    imageAbort();
+    sendResult(RES_ERROR);
+    return;
   }
+  installImage(digest);
 }
@@ -0,0 +1,75 @@
+#include "pager.h"
+
+size_t Pager::write(uint8_t c)
+{
+    if (quit_)
+        return 1;
+    term_.write(c);
+    bytes_++;
+    if (c == '\n' && rows_ > 0 && ++lines_ >= rows_ - 1)
+        more();
+    return 1;
+}
+
+size_t Pager::write(const uint8_t *buf, size_t len)
+{
+    for (size_t i = 0; i < len; i++)
+        write(buf[i]);
+    return len;
+}
+
+void Pager::more()
+{
+    static const char prompt[] = "-- More: Space=page, Enter=line, Q=stop --";
+    term_.print(prompt);
+    while (!term_.available())
+        yield();
+    int c = term_.read();
+    term_.print('\r');
+    for (size_t i = 0; i < sizeof(prompt) - 1; i++)
+        term_.print(' ');
+    term_.print('\r');
+
+    if (c == 'q' || c == 'Q' || c == 0x1B)
+        quit_ = true;
+    else if (c == '\r' || c == '\n')
+        lines_ = rows_ - 2; // One more line, then ask again
+    else
+        lines_ = 0;
+}
+
+String readTerminalLine(Stream &term, size_t maxLen)
+{
+    static bool lastCR = false;
+    String line;
+    while (true)
+    {
+        if (!term.available())
+        {
+            yield();
+            continue;
+        }
+        int c = term.read();
+        if (c == '\n' && lastCR)
+        {
+            lastCR = false; // Second half of CR LF
+            continue;
+        }
+        lastCR = (c == '\r');
+        if (c == '\r' || c == '\n')
+        {
+            term.print("\r\n");
+            return line;
+        }
+        if ((c == 8 || c == 127) && line.length() > 0)
+        {
+            line.remove(line.length() - 1);
+            term.print("\b \b");
+        }
+        else if (c >= 32 && c < 127 && line.length() < maxLen)
+        {
+            line += (char)c;
+            term.write((uint8_t)c);
+        }
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef PAGER_H
+#define PAGER_H
+
+#include <Arduino.h>
+
+// Output filter for the text browsers. Counts lines and stops at the bottom
+// of the screen with a "More" prompt; after Q everything is discarded so
+// the caller can wind down at its own pace. rows == 0 disables paging.
+class Pager : public Print
+{
+public:
+    Pager(Stream &term, uint8_t rows) : term_(term), rows_(rows) {}
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buf, size_t len) override;
+
+    bool quit() const { return quit_; }
+    size_t bytesOut() const { return bytes_; }
+    void resetPage() { lines_ = 0; }
+
+private:
+    Stream &term_;
+    uint8_t rows_;
+    uint8_t lines_ = 0;
+    bool quit_ = false;
+    size_t bytes_ = 0;
+
+    void more();
+};
+
+// Reads one line from the terminal with echo and backspace handling
+String readTerminalLine(Stream &term, size_t maxLen = 80);
+
+#endif
@@ -0,0 +1,124 @@
+#include <Arduino.h>
+#ifdef ESP8266
+#include <ESP8266WiFi.h>
+#else
+#include <WiFi.h>
+#endif
+#include "globals.h"
+#include "wifi.h"
+
+#define PROBE_TIMEOUT_US 2000000 // An answer later than this is not an echo
+#define PROBE_MAX_LEN 4          // Longer writes are pastes, not keystrokes
+
+LatencyStats echoLatency[LATENCY_MODE_COUNT];
+
+static const char *const POWER_SAVE_NAMES[PS_MODE_COUNT] = {"OFF", "MODEM", "AUTO", "LIGHT"};
+static const char *const SLEEP_NAMES[SLEEP_MODE_COUNT] = {"awake", "modem sleep", "light sleep"};
+
+static byte sleepMode = 0xFF; // What the radio was last set to
+static unsigned long wakeUntil = 0;
+static unsigned long probeAt = 0; // micros() of the keystroke, 0 = none
+
+const char *powerSaveName(byte mode)
+{
+  return mode < PS_MODE_COUNT ? POWER_SAVE_NAMES[mode] : "?";
+}
+
+int powerSaveFromName(const String &name)
+{
+  for (int i = 0; i < PS_MODE_COUNT; i++)
+  {
+    if (name.equalsIgnoreCase(POWER_SAVE_NAMES[i]))
+      return i;
+  }
+  return -1;
+}
+
+static byte wantedSleepMode()
+{
+  if (powerSave == PS_OFF)
+    return SLEEP_NONE;
+  if (powerSave == PS_MODEM)
+    return SLEEP_MODEM;
+  if (callConnected || firmwareUpdating || (long)(wakeUntil - millis()) > 0)
+    return SLEEP_NONE;
+  return powerSave == PS_LIGHT ? SLEEP_LIGHT : SLEEP_MODEM;
+}
+
+static void setSleepMode(byte mode)
+{
+#ifdef ESP8266
+  static const WiFiSleepType_t types[SLEEP_MODE_COUNT] = {WIFI_NONE_SLEEP, WIFI_MODEM_SLEEP, WIFI_LIGHT_SLEEP};
+  WiFi.setSleepMode(types[mode]);
+#else
+  // The ESP32 radio has no light sleep of its own; the longer modem
+  // sleep is the closest
+  static const wifi_ps_type_t types[SLEEP_MODE_COUNT] = {WIFI_PS_NONE, WIFI_PS_MIN_MODEM, WIFI_PS_MAX_MODEM};
+  WiFi.setSleep(types[mode]);
+#endif
+}
+
+void handlePowerSave()
+{
+  byte mode = wantedSleepMode();
+  if (mode == sleepMode)
+    return;
+  sleepMode = mode;
+  probeAt = 0; // A probe across the change would count for the wrong mode
+  setSleepMode(mode);
+}
+
+void powerSaveWake()
+{
+  wakeUntil = millis() + PS_RING_AWAKE_MS;
+  handlePowerSave();
+}
+
+void latencySent(size_t len)
+{
+  if (probeAt == 0 && len <= PROBE_MAX_LEN)
+    probeAt = micros() | 1;
+}
+
+void latencyReceived()
+{
+  if (probeAt == 0)
+    return;
+  uint32_t us = micros() - probeAt;
+  probeAt = 0;
+  if (us > PROBE_TIMEOUT_US || sleepMode >= LATENCY_MODE_COUNT)
+    return;
+  LatencyStats &stats = echoLatency[sleepMode];
+  stats.samples++;
+  stats.totalUs += us;
+  if (us > stats.maxUs)
+    stats.maxUs = us;
+}
+
+const char *sleepModeName()
+{
+  return sleepMode < SLEEP_MODE_COUNT ? SLEEP_NAMES[sleepMode] : "unknown";
+}
+
+void printLatency()
+{
+  bool any = false;
+  for (int i = 0; i < LATENCY_MODE_COUNT; i++)
+  {
+    const LatencyStats &stats = echoLatency[i];
+    if (stats.samples == 0)
+      continue;
+    Serial.print(any ? ", " : "Echo round trip: ");
+    any = true;
+    Serial.print(SLEEP_NAMES[i]);
+    Serial.print(" ");
+    Serial.print((float)(stats.totalUs / stats.samples) / 1000, 1);
+    Serial.print(" ms avg/");
+    Serial.print((float)stats.maxUs / 1000, 1);
+    Serial.print(" max (");
+    Serial.print(stats.samples);
+    Serial.print(")");
+  }
+  if (any)
+    Serial.println();
+}
@@ -1,59 +1,246 @@
 #include <Arduino.h>
 #include "globals.h"
+#include "ppp.h"
+#include "dnsproxy.h"
 
-#ifdef ESP8266
+PppStats pppStats = {0, 0, 0, 0, 0, 0};
+
+static const struct
+{
+  byte flag;
+  const char *name;
+} PPP_OPTION_NAMES[] = {
+    {PPP_OPT_VJ, "VJ"},
+    {PPP_OPT_ACCM, "ACCM"},
+    {PPP_OPT_PFC, "PFC"},
+    {PPP_OPT_ACFC, "ACFC"},
+};
+
+String pppOptionsName(byte options)
+{
+  String out = "";
+  for (const auto &option : PPP_OPTION_NAMES)
+  {
+    if (options & option.flag)
+    {
+      if (out.length())
+        out += ",";
+      out += option.name;
+    }
+  }
+  return out.length() ? out : "NONE";
+}
+
+int pppOptionsFromName(const String &names)
+{
+  String list = names;
+  list.trim();
+  list.toUpperCase();
+  if (list == "NONE")
+    return 0;
+  if (list == "ALL")
+    return PPP_OPT_ALL;
+  int options = 0;
+  int start = 0;
+  while (start <= (int)list.length())
+  {
+    int end = list.indexOf(',', start);
+    if (end < 0)
+      end = list.length();
+    String name = list.substring(start, end);
+    name.trim();
+    int flag = 0;
+    for (const auto &option : PPP_OPTION_NAMES)
+    {
+      if (name == option.name)
+        flag = option.flag;
+    }
+    if (flag == 0)
+      return -1;
+    options |= flag;
+    start = end + 1;
+  }
+  return options;
+}
+
+#ifdef PPP_ENABLED
 #include "netif/ppp/ppp.h"
+#ifdef ESP32
+#include <freertos/stream_buffer.h>
+#endif
+
+#define PPP_FLAG 0x7E
+
+// Frames from lwIP wait here for the UART. On ESP32 they are written from
+// the lwIP task, so a stream buffer keeps the two sides apart. On ESP8266
+// lwIP and loop() take turns, and a plain ring will do.
+#ifdef ESP32
+static StreamBufferHandle_t pppTx = NULL;
+#else
+static uint8_t pppTxRing[PPP_TX_RING];
+static size_t pppTxHead = 0; // Bytes ever queued
+static size_t pppTxTail = 0; // Bytes ever sent
+#endif
 
+// Last byte seen each way, so a frame end split across reads counts once
+static uint8_t pppLastIn = PPP_FLAG;
+static uint8_t pppLastOut = PPP_FLAG;
+
+// lwIP's output function for the PPP netif, wrapped to count IP bytes
+static netif_output_fn pppNetifOutput = NULL;
+
+#ifdef ESP32
+// lwIP runs in its own task on ESP32, so the status callback comes from
+// there. It only records the code and loop() reports it in pollPPPStatus().
+static volatile int pppPendingStatus = -1;
+#endif
+
+ip4_addr_t toIp4(IPAddress ip)
+{
+  ip4_addr_t addr;
+  ip4_addr_set_u32(&addr, (uint32_t)ip);
+  return addr;
+}
+
+size_t pppTxSpace()
+{
+#ifdef ESP32
+  return xStreamBufferSpacesAvailable(pppTx);
+#else
+  return PPP_TX_RING - (pppTxHead - pppTxTail);
+#endif
+}
+
+void pppTxPut(const uint8_t *data, size_t len)
+{
+#ifdef ESP32
+  xStreamBufferSend(pppTx, data, len, 0);
+#else
+  size_t pos = pppTxHead % PPP_TX_RING;
+  size_t first = min(len, (size_t)(PPP_TX_RING - pos));
+  memcpy(pppTxRing + pos, data, first);
+  memcpy(pppTxRing, data + first, len - first);
+  pppTxHead += len;
+#endif
+}
+
+static size_t pppTxGet(uint8_t *buf, size_t len)
+{
+#ifdef ESP32
+  return xStreamBufferReceive(pppTx, buf, len, 0);
+#else
+  len = min(len, pppTxHead - pppTxTail);
+  size_t pos = pppTxTail % PPP_TX_RING;
+  size_t first = min(len, (size_t)(PPP_TX_RING - pos));
+  memcpy(buf, pppTxRing + pos, first);
+  memcpy(buf + first, pppTxRing, len - first);
+  pppTxTail += len;
+  return len;
+#endif
+}
+
+// Empties the queue and the counters for a new PPP or SLIP session
+void pppLinkReset()
+{
+  pppStats = {0, 0, 0, 0, 0, 0};
+  pppLastIn = PPP_FLAG;
+  pppLastOut = PPP_FLAG;
+#ifdef ESP32
+  if (pppTx == NULL)
+    pppTx = xStreamBufferCreate(PPP_TX_RING, 1);
+  else
+    xStreamBufferReset(pppTx);
+#else
+  pppTxHead = 0;
+  pppTxTail = 0;
+#endif
+}
+
+// A flag after anything but a flag closes a frame. Data never contains a
+// bare flag, since HDLC escapes it.
+static uint32_t countFrameEnds(const uint8_t *data, size_t len, uint8_t &last)
+{
+  uint32_t frames = 0;
+  for (size_t i = 0; i < len; i++)
+  {
+    if (data[i] == PPP_FLAG && last != PPP_FLAG)
+      frames++;
+    last = data[i];
+  }
+  return frames;
+}
+
+// Called by lwIP with frames for the computer. Only queues them: loop()
+// sends them as the UART has room, so lwIP never waits on the line.
 u32_t ppp_output_cb(ppp_pcb *pcb, unsigned char *data, u32_t len, void *ctx)
 {
   if (cmdMode)
   {
     return 0;
   }
-  else
+  if (pppTxSpace() < len)
   {
-    return Serial.write(data, len);
+    pppStats.txDrops++;
+    return 0;
   }
+  pppTxPut(data, len);
+  pppStats.bytesOut += len;
+  pppStats.framesOut += countFrameEnds(data, len, pppLastOut);
+  return len;
 }
 
-void ppp_status_cb(ppp_pcb *pcb, int err_code, void *ctx)
+static err_t countingNetifOutput(struct netif *netif, struct pbuf *p, const ip4_addr_t *ipaddr)
+{
+  pppStats.ipBytesOut += p->tot_len;
+  return pppNetifOutput(netif, p, ipaddr);
+}
+
+void handlePPPData()
+{
+  static uint8_t buf[PPP_RX_CHUNK];
+
+  // lwIP to the computer, as much as fits in the UART without waiting
+  size_t room = Serial.availableForWrite();
+  while (room > 0)
+  {
+    size_t n = pppTxGet(buf, min(room, sizeof(buf)));
+    if (n == 0)
+      break;
+    Serial.write(buf, n);
+    room -= n;
+  }
+
+  // The computer to lwIP, everything that is waiting in one go
+  size_t avail = Serial.available();
+  if (avail == 0)
+    return;
+  size_t len = Serial.readBytes(buf, min(avail, sizeof(buf)));
+  pppStats.bytesIn += len;
+  trackEscape(buf, len);
+  if (slipActive)
+  {
+    slipInput(buf, len);
+    return;
+  }
+  pppStats.framesIn += countFrameEnds(buf, len, pppLastIn);
+  pppInput(buf, len);
+}
+
+// Reports the outcome of a status change and hangs up on errors
+static void reportPPPStatus(int err_code)
 {
-  struct netif *pppif = ppp_netif(pcb);
-  LWIP_UNUSED_ARG(ctx);
   switch (err_code)
   {
-  case PPPERR_NONE: // No error == connected successfully
-#if DEBUG
-    Serial.println(F("status_cb: Connected"));
-#if PPP_IPV4_SUPPORT
-    Serial.print(F("   our_ipaddr  = "));
-    Serial.println(ipaddr_ntoa(&pppif->ip_addr));
-    Serial.print(F("   his_ipaddr  = "));
-    Serial.println(ipaddr_ntoa(&pppif->gw));
-    Serial.print(F("   netmask     = "));
-    Serial.println(ipaddr_ntoa(&pppif->netmask));
-#if LWIP_DNS
-    const ip_addr_t *ns;
-    ns = dns_getserver(0);
-    Serial.print(F("   dns1        = "));
-    Serial.println(ipaddr_ntoa(ns));
-    ns = dns_getserver(1);
-    Serial.print(F("   dns2        = "));
-    Serial.println(ipaddr_ntoa(ns));
-#endif /* LWIP_DNS */
-#endif /* PPP_IPV4_SUPPORT */
-#if PPP_IPV6_SUPPORT
-    // printf("   our6_ipaddr = %s\n", ip6addr_ntoa(netif_ip6_addr(pppif, 0)));
-#endif /* PPP_IPV6_SUPPORT */
-#endif /* DEBUG */
-#if NAPT_SUPPORTED
-    // Enable NAT-ing this connection (ESP8266 only)
-    ip_napt_enable(pppif->ip_addr.addr, 1);
-#endif
+  case PPPERR_NONE:
+    syncPortForwards(true);
     break;
   case PPPERR_USER: // Clean disconnect
     // sendString(F("PPP: shutdown"));
+#ifdef ESP32
+    if (pppapi_free(ppp) == 0)
+#else
     if (ppp_free(ppp) == 0)
+#endif
     {
       ppp = NULL;
       // sendString(F("PPP: freed"));
@@ -107,16 +294,231 @@ void ppp_status_cb(ppp_pcb *pcb, int err_code, void *ctx)
   }
 }
 
-#else // ESP32 or other platforms - stubs only
+void ppp_status_cb(ppp_pcb *pcb, int err_code, void *ctx)
+{
+  struct netif *pppif = ppp_netif(pcb);
+  LWIP_UNUSED_ARG(ctx);
+  if (err_code == PPPERR_NONE) // No error == connected successfully
+  {
+#if DEBUG
+    Serial.println(F("status_cb: Connected"));
+#if PPP_IPV4_SUPPORT
+    Serial.print(F("   our_ipaddr  = "));
+    Serial.println(ipaddr_ntoa(&pppif->ip_addr));
+    Serial.print(F("   his_ipaddr  = "));
+    Serial.println(ipaddr_ntoa(&pppif->gw));
+    Serial.print(F("   netmask     = "));
+    Serial.println(ipaddr_ntoa(&pppif->netmask));
+#if LWIP_DNS
+    const ip_addr_t *ns;
+    ns = dns_getserver(0);
+    Serial.print(F("   dns1        = "));
+    Serial.println(ipaddr_ntoa(ns));
+    ns = dns_getserver(1);
+    Serial.print(F("   dns2        = "));
+    Serial.println(ipaddr_ntoa(ns));
+#endif /* LWIP_DNS */
+#endif /* PPP_IPV4_SUPPORT */
+#endif /* DEBUG */
+    // NAT the computer's traffic out through Wi-Fi
+    ip_napt_enable(ip4_addr_get_u32(netif_ip4_addr(pppif)), 1);
+  }
+
+#ifdef ESP32
+  pppPendingStatus = err_code;
+#else
+  reportPPPStatus(err_code);
+#endif
+}
+
+// Called from loop(): reports a status change from the lwIP task
+void pollPPPStatus()
+{
+#ifdef ESP32
+  int status = pppPendingStatus;
+  if (status < 0)
+    return;
+  pppPendingStatus = -1;
+  reportPPPStatus(status);
+#endif
+}
+
+// The profile decides what we ask for. What the computer asks for is
+// allowed whatever the profile says, as it costs nothing on our side.
+static void applyPPPProfile()
+{
+  lcp_options *want = &ppp->lcp_wantoptions;
+  want->neg_mru = 1;
+  want->mru = pppMru;
+  want->neg_asyncmap = (pppOptions & PPP_OPT_ACCM) != 0;
+  want->asyncmap = 0;
+  want->neg_pcompression = (pppOptions & PPP_OPT_PFC) != 0;
+  want->neg_accompression = (pppOptions & PPP_OPT_ACFC) != 0;
+  ppp->lcp_allowoptions.neg_asyncmap = 1;
+  ppp->lcp_allowoptions.neg_pcompression = 1;
+  ppp->lcp_allowoptions.neg_accompression = 1;
+#if VJ_SUPPORT
+  ppp->ipcp_wantoptions.neg_vj = (pppOptions & PPP_OPT_VJ) != 0;
+  ppp->ipcp_allowoptions.neg_vj = (pppOptions & PPP_OPT_VJ) != 0;
+#endif
+}
+
+static const char *yesNo(bool on)
+{
+  return on ? "on" : "off";
+}
+
+void printPPPInfo()
+{
+  if (ppp == NULL || ppp->phase != PPP_PHASE_RUNNING)
+    return;
+  const lcp_options &ours = ppp->lcp_gotoptions;
+  const lcp_options &his = ppp->lcp_hisoptions;
+  Serial.print("PPP LCP: MRU ");
+  Serial.print(ours.neg_mru ? ours.mru : PPP_DEFMRU);
+  Serial.print("/");
+  Serial.print(his.neg_mru ? his.mru : PPP_DEFMRU);
+  Serial.print(", ACCM ");
+  Serial.print(ours.neg_asyncmap ? ours.asyncmap : 0xFFFFFFFF, HEX);
+  Serial.print("/");
+  Serial.print(his.neg_asyncmap ? his.asyncmap : 0xFFFFFFFF, HEX);
+  Serial.print(", PFC ");
+  Serial.print(yesNo(ours.neg_pcompression));
+  Serial.print("/");
+  Serial.print(yesNo(his.neg_pcompression));
+  Serial.print(", ACFC ");
+  Serial.print(yesNo(ours.neg_accompression));
+  Serial.print("/");
+  Serial.println(yesNo(his.neg_accompression));
+  Serial.print("PPP IPCP: VJ ");
+#if VJ_SUPPORT
+  Serial.print(yesNo(ppp->ipcp_gotoptions.neg_vj));
+  Serial.print("/");
+  Serial.println(yesNo(ppp->ipcp_hisoptions.neg_vj));
+#else
+  Serial.println("not in this build");
+#endif
+  yield();
+
+  // IP bytes sent against what they took on the line after VJ, field
+  // compression and HDLC escaping
+  if (pppStats.bytesOut > 0)
+  {
+    Serial.print("PPP compression: ");
+    Serial.print(pppStats.ipBytesOut);
+    Serial.print(" IP bytes in ");
+    Serial.print(pppStats.bytesOut);
+    Serial.print(" line bytes (");
+    Serial.print((float)pppStats.ipBytesOut / pppStats.bytesOut, 2);
+    Serial.println(":1)");
+  }
+}
+
+// ATDTPPP: waits for the computer to start PPP, then routes it to Wi-Fi
+void dialPPP()
+{
+  if (ppp)
+  {
+    Serial.println("PPP already active");
+    sendResult(RES_ERROR);
+    return;
+  }
+  if (slipActive)
+  {
+    Serial.println("SLIP already active");
+    sendResult(RES_ERROR);
+    return;
+  }
+  pppLinkReset();
+
+#ifdef ESP32
+  ppp = pppapi_pppos_create(&ppp_netif, ppp_output_cb, ppp_status_cb, NULL);
+#else
+  ppp = pppos_create(&ppp_netif, ppp_output_cb, ppp_status_cb, NULL);
+#endif
+  if (ppp == NULL)
+  {
+    sendString(F("PPP: Unable to allocate resources"));
+    sendResult(RES_ERROR);
+    return;
+  }
+
+  // Offer our own caching resolver first, and the upstream one as a
+  // fallback in case the computer gives up on us
+  bool proxy = dnsProxyBegin();
+  ip4_addr_t dns0 = toIp4(proxy ? WiFi.localIP() : WiFi.dnsIP(0));
+  ip4_addr_t dns1 = toIp4(proxy ? WiFi.dnsIP(0) : WiFi.dnsIP(1));
+  ip4_addr_t ours = toIp4(WiFi.localIP());
+  ip4_addr_t his = toIp4(PPP_PEER_ADDRESS);
+  ppp_set_usepeerdns(ppp, 1);
+  ppp_set_ipcp_dnsaddr(ppp, 0, &dns0);
+  ppp_set_ipcp_dnsaddr(ppp, 1, &dns1);
+
+#if PPP_AUTH_SUPPORT
+  ppp_set_auth(ppp, PPPAUTHTYPE_NONE, "", "");
+  ppp_set_auth_required(ppp, 0);
+#endif
+  ppp_set_ipcp_ouraddr(ppp, &ours);
+  ppp_set_ipcp_hisaddr(ppp, &his);
+  applyPPPProfile();
+  pppNetifOutput = ppp_netif.output;
+  ppp_netif.output = countingNetifOutput;
+  err_t ppp_err;
+#ifdef ESP32
+  ppp_err = pppapi_listen(ppp);
+#else
+  ppp_err = ppp_listen(ppp);
+#endif
+  if (ppp_err == PPPERR_NONE)
+  {
+    sendResult(RES_CONNECT);
+    connectTime = millis();
+    cmdMode = false;
+    callConnected = true;
+    setCarrierDCDPin(callConnected);
+  }
+  else
+  {
+    Serial.println("ppp_listen failed\n");
+    reportPPPStatus(ppp_err);
+    closePPP(1);
+    sendResult(RES_ERROR);
+  }
+}
+
+// Frames typed by the computer
+void pppInput(uint8_t *data, size_t len)
+{
+#ifdef ESP32
+  pppos_input_tcpip(ppp, data, len);
+#else
+  pppos_input(ppp, data, len);
+#endif
+}
+
+void closePPP(uint8_t nocarrier)
+{
+  dnsProxyEnd();
+  syncPortForwards(false);
+#ifdef ESP32
+  pppapi_close(ppp, nocarrier);
+#else
+  ppp_close(ppp, nocarrier);
+#endif
+}
+
+#else // No NAPT in this build - stubs only
+
+void pollPPPStatus()
+{
+}
 
-u32_t ppp_output_cb(void *pcb, unsigned char *data, u32_t len, void *ctx)
+void handlePPPData()
 {
-  return 0;
 }
 
-void ppp_status_cb(void *pcb, int err_code, void *ctx)
+void printPPPInfo()
 {
-  // Stub for ESP32
 }
 
 #endif
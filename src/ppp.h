@@ -0,0 +1,118 @@
+#ifndef PPP_H
+#define PPP_H
+
+#include <Arduino.h>
+
+// While PPP or SLIP is up, the serial line carries nothing but frames. They skip
+// the telnet, charset and XMODEM handling of a call: what the computer
+// sends goes to lwIP in large reads, and what lwIP sends is queued in a
+// ring that loop() drains as the UART has room.
+
+// The address of the computer on the other end of the line
+#define PPP_PEER_ADDRESS IPAddress(192, 168, 240, 2)
+
+#ifdef ESP8266
+#define PPP_RX_CHUNK 512
+#define PPP_TX_RING 2048
+#else
+#define PPP_RX_CHUNK 1024
+#define PPP_TX_RING 4096
+#endif
+
+// PPP profile, the options asked for in LCP and IPCP
+#define PPP_OPT_VJ 0x01   // Van Jacobson TCP/IP header compression
+#define PPP_OPT_ACCM 0x02 // Ask for an empty ACCM, so control bytes are not escaped
+#define PPP_OPT_PFC 0x04  // Protocol field compression
+#define PPP_OPT_ACFC 0x08 // Address and control field compression
+#define PPP_OPT_ALL 0x0F
+#define PPP_OPT_DEFAULT PPP_OPT_ALL
+
+#define PPP_MRU_MIN 128
+#define PPP_MRU_MAX 1500
+
+struct PppStats
+{
+  uint32_t framesIn;
+  uint32_t framesOut;
+  uint32_t bytesIn;
+  uint32_t bytesOut;
+  uint32_t txDrops;    // Output from lwIP dropped because the ring was full
+  uint32_t ipBytesOut; // IP packets sent, before compression and framing
+};
+
+// Options as a list such as "VJ,PFC", or "NONE"
+String pppOptionsName(byte options);
+
+// Returns the options for such a list, or -1 if it has an unknown name
+int pppOptionsFromName(const String &names);
+
+// Prints what LCP and IPCP agreed on, and the compression ratio
+void printPPPInfo();
+
+extern PppStats pppStats;
+
+// Moves data both ways for the running PPP or SLIP session
+void handlePPPData();
+
+// Queue for data to the computer, shared by PPP and SLIP
+size_t pppTxSpace();
+void pppTxPut(const uint8_t *data, size_t len);
+void pppLinkReset();
+
+// NAT table and port forwards, in nat.cpp. The table is sized once at
+// boot on ESP8266; the ESP32 core fixes it at build time.
+#ifdef IP_NAPT_MAX
+#define NAPT_TABLE_DEFAULT IP_NAPT_MAX
+#else
+#define NAPT_TABLE_DEFAULT 512
+#endif
+#define NAPT_TABLE_MIN 32
+#define NAPT_TABLE_MAX 1024
+#define PORT_FORWARD_MAX 6
+#define FORWARD_TCP 6 // IP protocol numbers
+#define FORWARD_UDP 17
+
+// Inbound connections to a port of ours, passed on to the computer
+struct PortForward
+{
+  byte proto;      // FORWARD_TCP or FORWARD_UDP, 0 for an empty slot
+  uint16_t port;   // Port on the Wi-Fi side
+  uint16_t toPort; // Port on the computer
+};
+
+struct NatStats
+{
+  uint16_t tcp; // Entries in use
+  uint16_t udp;
+  uint16_t icmp;
+  uint32_t evictions; // Entries thrown out early because the table was full
+};
+
+extern PortForward portForwards[PORT_FORWARD_MAX];
+
+// "TCP" or "UDP", and back; -1 for anything else
+const char *forwardProtoName(byte proto);
+int forwardProtoFromName(const String &name);
+
+// Both return false if there is no room or no such forward
+bool addPortForward(byte proto, uint16_t port, uint16_t toPort);
+bool removePortForward(byte proto, uint16_t port);
+
+// Puts the forwards into lwIP while PPP or SLIP is up, and takes them out
+void syncPortForwards(bool up);
+void refreshPortForwards(); // After a change to portForwards
+
+// The size of the table in use, which on ESP32 is not naptTableSize
+uint16_t natTableEntries();
+
+// False if this build of lwIP keeps no NAT counters
+bool getNatStats(NatStats &stats);
+void printNATInfo();
+
+// SLIP, in slip.cpp
+extern bool slipActive;
+void dialSLIP(bool compressed);
+void closeSLIP();
+void slipInput(const uint8_t *data, size_t len);
+
+#endif
@@ -1,20 +1,14 @@
 #include <Arduino.h>
 #include "globals.h"
 
-#ifdef ESP32
-  #include <EEPROM.h>
-  #define EEPROM_SIZE 512  // Adjust size as needed
-#elif defined(ESP8266)
-  #include <EEPROM.h>
-#endif
+#include <EEPROM.h>
+
+// Room for a few full PPP frames while loop() is busy elsewhere
+#define SERIAL_RX_BUFFER 1024
 
 void serialSetup()
 {
-  #ifdef ESP32
-    EEPROM.begin(EEPROM_SIZE);
-  #elif defined(ESP8266)
-    EEPROM.begin(512);
-  #endif
+  // setup() has already opened EEPROM with room for every setting
 
   // NOTE: CTS_PIN (15) is shared with SD card CS pin
   // Don't initialize it here to avoid SD card conflicts
@@ -30,6 +24,7 @@ void serialSetup()
   {
     serialspeed = 0;
   }
+  Serial.setRxBufferSize(SERIAL_RX_BUFFER);
   Serial.begin(bauds[serialspeed]);
 }
 
@@ -65,6 +60,7 @@ void setBaudRate(int inSpeed)
   delay(5000);
   Serial.end();
   delay(200);
+  Serial.setRxBufferSize(SERIAL_RX_BUFFER);
   Serial.begin(bauds[foundBaud]);
   serialspeed = foundBaud;
   delay(200);
@@ -9,6 +9,10 @@
   #error "Unsupported platform. Please define ESP32 or ESP8266"
 #endif
 #include "globals.h"
+#include "charset.h"
+#include "ansi.h"
+#include "ppp.h"
+#include "wifi.h"
 #include <EEPROM.h>
 
 String getEEPROM(int startAddress, int len);
@@ -42,6 +46,27 @@ void setEEPROM(String inString, int startAddress, int maxLen)
   }
 }
 
+static IPAddress readIPAddress(int address)
+{
+  return IPAddress(EEPROM.read(address), EEPROM.read(address + 1), EEPROM.read(address + 2), EEPROM.read(address + 3));
+}
+
+static void writeIPAddress(int address, IPAddress ip)
+{
+  for (int i = 0; i < 4; i++)
+  {
+    EEPROM.write(address + i, ip[i]);
+  }
+}
+
+// "DHCP", or the static address, mask, gateway and DNS server as AT$IP takes them
+String ipConfigString(bool isStatic, IPAddress ip, IPAddress mask, IPAddress gateway, IPAddress dns)
+{
+  if (!isStatic)
+    return "DHCP";
+  return ipToString(ip) + "," + ipToString(mask) + "," + ipToString(gateway) + "," + ipToString(dns);
+}
+
 void defaultEEPROM()
 {
   EEPROM.write(VERSION_ADDRESS, VERSIONA);
@@ -49,6 +74,10 @@ void defaultEEPROM()
   setEEPROM("", SSID_ADDRESS, SSID_LEN);
   setEEPROM("", PASS_ADDRESS, PASS_LEN);
   setEEPROM("d", IP_TYPE_ADDRESS, 1);
+  writeIPAddress(STATIC_IP_ADDRESS, IPAddress(0, 0, 0, 0));
+  writeIPAddress(STATIC_GW, IPAddress(0, 0, 0, 0));
+  writeIPAddress(STATIC_DNS, IPAddress(0, 0, 0, 0));
+  writeIPAddress(STATIC_MASK, IPAddress(0, 0, 0, 0));
   EEPROM.write(SERVER_PORT_ADDRESS, highByte(LISTEN_PORT));
   EEPROM.write(SERVER_PORT_ADDRESS + 1, lowByte(LISTEN_PORT));
   EEPROM.write(BAUD_ADDRESS, 0x00);
@@ -59,6 +88,34 @@ void defaultEEPROM()
   EEPROM.write(FLOW_CONTROL_ADDRESS, 0x02);
   EEPROM.write(PIN_POLARITY_ADDRESS, 0x01);
   EEPROM.write(QUIET_MODE_ADDRESS, 0x00);
+  EEPROM.write(TERM_COLS_ADDRESS, 80);
+  EEPROM.write(TERM_ROWS_ADDRESS, 24);
+  EEPROM.write(TERM_CHARSET_ADDRESS, CHARSET_NONE);
+  EEPROM.write(TERM_ANSI_ADDRESS, ANSI_OFF);
+  EEPROM.write(SSH_KEEPALIVE_ADDRESS, 60);
+  EEPROM.write(SSH_RECONNECT_ADDRESS, 0);
+  setEEPROM("vt100", TERM_TYPE_ADDRESS, TERM_TYPE_LEN);
+  EEPROM.write(PPP_OPTIONS_ADDRESS, PPP_OPT_DEFAULT);
+  EEPROM.write(PPP_MRU_ADDRESS, highByte(PPP_MRU_MAX));
+  EEPROM.write(PPP_MRU_ADDRESS + 1, lowByte(PPP_MRU_MAX));
+  EEPROM.write(NAPT_TABLE_ADDRESS, highByte(NAPT_TABLE_DEFAULT));
+  EEPROM.write(NAPT_TABLE_ADDRESS + 1, lowByte(NAPT_TABLE_DEFAULT));
+  for (int i = 0; i < PORT_FORWARD_MAX * 5; i++)
+  {
+    EEPROM.write(PORT_FORWARD_ADDRESS + i, 0);
+  }
+  for (int i = 0; i < 6; i++)
+  {
+    EEPROM.write(WIFI_BSSID_ADDRESS + i, 0);
+  }
+  EEPROM.write(WIFI_CHANNEL_ADDRESS, 0);
+  EEPROM.write(POWER_SAVE_ADDRESS, PS_DEFAULT);
+  for (int i = 0; i < WIFI_EXTRA_NETWORKS; i++)
+  {
+    int address = WIFI_EXTRA_ADDRESS + i * (SSID_LEN + PASS_LEN);
+    setEEPROM("", address, SSID_LEN);
+    setEEPROM("", address + SSID_LEN, PASS_LEN);
+  }
   setEEPROM("theoldnet.com:23", speedDialAddresses[0], 50);
   setEEPROM("bbs.retrocampus.com:23", speedDialAddresses[1], 50);
   setEEPROM("bbs.eotd.com:23", speedDialAddresses[2], 50);
@@ -96,6 +153,71 @@ void readSettings()
   flowControl = EEPROM.read(FLOW_CONTROL_ADDRESS);
   pinPolarity = EEPROM.read(PIN_POLARITY_ADDRESS);
   quietMode = EEPROM.read(QUIET_MODE_ADDRESS);
+  // Profiles saved before these fields existed hold 0x00 or 0xFF here
+  termCols = EEPROM.read(TERM_COLS_ADDRESS);
+  if (termCols < 20 || termCols > 132)
+    termCols = 80;
+  termRows = EEPROM.read(TERM_ROWS_ADDRESS);
+  if (termRows != 0 && (termRows < 8 || termRows > 72))
+    termRows = 24;
+  termCharset = EEPROM.read(TERM_CHARSET_ADDRESS);
+  if (termCharset >= CHARSET_COUNT)
+    termCharset = CHARSET_NONE;
+  termAnsi = EEPROM.read(TERM_ANSI_ADDRESS);
+  if (termAnsi >= ANSI_MODE_COUNT)
+    termAnsi = ANSI_OFF;
+  sshKeepalive = EEPROM.read(SSH_KEEPALIVE_ADDRESS);
+  sshReconnects = EEPROM.read(SSH_RECONNECT_ADDRESS);
+  if (sshReconnects > 10)
+    sshReconnects = 0;
+  sshTermType = getEEPROM(TERM_TYPE_ADDRESS, TERM_TYPE_LEN);
+  if (sshTermType.length() == 0 || (byte)sshTermType[0] == 0xFF)
+    sshTermType = "vt100";
+  pppOptions = EEPROM.read(PPP_OPTIONS_ADDRESS);
+  if (pppOptions & ~PPP_OPT_ALL)
+    pppOptions = PPP_OPT_DEFAULT;
+  pppMru = word(EEPROM.read(PPP_MRU_ADDRESS), EEPROM.read(PPP_MRU_ADDRESS + 1));
+  if (pppMru < PPP_MRU_MIN || pppMru > PPP_MRU_MAX)
+    pppMru = PPP_MRU_MAX;
+  naptTableSize = word(EEPROM.read(NAPT_TABLE_ADDRESS), EEPROM.read(NAPT_TABLE_ADDRESS + 1));
+  if (naptTableSize < NAPT_TABLE_MIN || naptTableSize > NAPT_TABLE_MAX)
+    naptTableSize = NAPT_TABLE_DEFAULT;
+  for (int i = 0; i < PORT_FORWARD_MAX; i++)
+  {
+    int address = PORT_FORWARD_ADDRESS + i * 5;
+    PortForward &fwd = portForwards[i];
+    fwd.proto = EEPROM.read(address);
+    fwd.port = word(EEPROM.read(address + 1), EEPROM.read(address + 2));
+    fwd.toPort = word(EEPROM.read(address + 3), EEPROM.read(address + 4));
+    if ((fwd.proto != FORWARD_TCP && fwd.proto != FORWARD_UDP) || fwd.port == 0 || fwd.toPort == 0)
+      fwd.proto = 0;
+  }
+  for (int i = 0; i < 6; i++)
+  {
+    wifiBssid[i] = EEPROM.read(WIFI_BSSID_ADDRESS + i);
+  }
+  wifiChannel = EEPROM.read(WIFI_CHANNEL_ADDRESS);
+  if (wifiChannel > 14)
+    wifiChannel = 0;
+  for (int i = 0; i < WIFI_EXTRA_NETWORKS; i++)
+  {
+    int address = WIFI_EXTRA_ADDRESS + i * (SSID_LEN + PASS_LEN);
+    wifiExtraSsid[i] = getEEPROM(address, SSID_LEN);
+    wifiExtraPass[i] = getEEPROM(address + SSID_LEN, PASS_LEN);
+    if (wifiExtraSsid[i].length() > 0 && (byte)wifiExtraSsid[i][0] == 0xFF)
+    {
+      wifiExtraSsid[i] = "";
+      wifiExtraPass[i] = "";
+    }
+  }
+  powerSave = EEPROM.read(POWER_SAVE_ADDRESS);
+  if (powerSave >= PS_MODE_COUNT)
+    powerSave = PS_DEFAULT;
+  staticAddress = readIPAddress(STATIC_IP_ADDRESS);
+  staticGateway = readIPAddress(STATIC_GW);
+  staticDns = readIPAddress(STATIC_DNS);
+  staticMask = readIPAddress(STATIC_MASK);
+  staticIp = EEPROM.read(IP_TYPE_ADDRESS) == 's' && (uint32_t)staticAddress != 0 && (uint32_t)staticMask != 0;
   for (int i = 0; i < 10; i++)
   {
     speedDials[i] = getEEPROM(speedDialAddresses[i], 50);
@@ -117,6 +239,40 @@ void writeSettings()
   EEPROM.write(FLOW_CONTROL_ADDRESS, byte(flowControl));
   EEPROM.write(PIN_POLARITY_ADDRESS, byte(pinPolarity));
   EEPROM.write(QUIET_MODE_ADDRESS, byte(quietMode));
+  EEPROM.write(TERM_COLS_ADDRESS, termCols);
+  EEPROM.write(TERM_ROWS_ADDRESS, termRows);
+  EEPROM.write(TERM_CHARSET_ADDRESS, termCharset);
+  EEPROM.write(TERM_ANSI_ADDRESS, termAnsi);
+  EEPROM.write(SSH_KEEPALIVE_ADDRESS, sshKeepalive);
+  EEPROM.write(SSH_RECONNECT_ADDRESS, sshReconnects);
+  setEEPROM(sshTermType, TERM_TYPE_ADDRESS, TERM_TYPE_LEN);
+  EEPROM.write(PPP_OPTIONS_ADDRESS, pppOptions);
+  EEPROM.write(PPP_MRU_ADDRESS, highByte(pppMru));
+  EEPROM.write(PPP_MRU_ADDRESS + 1, lowByte(pppMru));
+  EEPROM.write(NAPT_TABLE_ADDRESS, highByte(naptTableSize));
+  EEPROM.write(NAPT_TABLE_ADDRESS + 1, lowByte(naptTableSize));
+  EEPROM.write(IP_TYPE_ADDRESS, staticIp ? 's' : 'd');
+  writeIPAddress(STATIC_IP_ADDRESS, staticAddress);
+  writeIPAddress(STATIC_GW, staticGateway);
+  writeIPAddress(STATIC_DNS, staticDns);
+  writeIPAddress(STATIC_MASK, staticMask);
+  EEPROM.write(POWER_SAVE_ADDRESS, powerSave);
+  for (int i = 0; i < WIFI_EXTRA_NETWORKS; i++)
+  {
+    int address = WIFI_EXTRA_ADDRESS + i * (SSID_LEN + PASS_LEN);
+    setEEPROM(wifiExtraSsid[i], address, SSID_LEN);
+    setEEPROM(wifiExtraPass[i], address + SSID_LEN, PASS_LEN);
+  }
+  for (int i = 0; i < PORT_FORWARD_MAX; i++)
+  {
+    int address = PORT_FORWARD_ADDRESS + i * 5;
+    const PortForward &fwd = portForwards[i];
+    EEPROM.write(address, fwd.proto);
+    EEPROM.write(address + 1, highByte(fwd.port));
+    EEPROM.write(address + 2, lowByte(fwd.port));
+    EEPROM.write(address + 3, highByte(fwd.toPort));
+    EEPROM.write(address + 4, lowByte(fwd.toPort));
+  }
   for (int i = 0; i < 10; i++)
   {
     setEEPROM(speedDials[i], speedDialAddresses[i], 50);
@@ -180,6 +336,55 @@ void displayStoredSettings()
   Serial.print(autoAnswerStored);
   Serial.print(" ");
   yield();
+  Serial.print("$TW");
+  Serial.print(EEPROM.read(TERM_COLS_ADDRESS));
+  Serial.print(" ");
+  Serial.print("$TH");
+  Serial.print(EEPROM.read(TERM_ROWS_ADDRESS));
+  Serial.print(" ");
+  Serial.print("$CS=");
+  Serial.print(charsetName(EEPROM.read(TERM_CHARSET_ADDRESS)));
+  Serial.print(" ");
+  Serial.print("$AF=");
+  Serial.print(ansiModeName(EEPROM.read(TERM_ANSI_ADDRESS)));
+  Serial.print(" ");
+  Serial.print("$TT=");
+  Serial.print(getEEPROM(TERM_TYPE_ADDRESS, TERM_TYPE_LEN));
+  Serial.print(" ");
+  Serial.print("S40:");
+  Serial.print(EEPROM.read(SSH_KEEPALIVE_ADDRESS));
+  Serial.print(" ");
+  Serial.print("S41:");
+  Serial.print(EEPROM.read(SSH_RECONNECT_ADDRESS));
+  Serial.print(" ");
+  Serial.print("$PPP=");
+  Serial.print(pppOptionsName(EEPROM.read(PPP_OPTIONS_ADDRESS)));
+  Serial.print(" ");
+  Serial.print("$PPPMRU=");
+  Serial.print(word(EEPROM.read(PPP_MRU_ADDRESS), EEPROM.read(PPP_MRU_ADDRESS + 1)));
+  Serial.print(" ");
+  Serial.print("$NAT=");
+  Serial.print(word(EEPROM.read(NAPT_TABLE_ADDRESS), EEPROM.read(NAPT_TABLE_ADDRESS + 1)));
+  Serial.print(" ");
+  Serial.print("$IP=");
+  Serial.print(ipConfigString(EEPROM.read(IP_TYPE_ADDRESS) == 's', readIPAddress(STATIC_IP_ADDRESS),
+                              readIPAddress(STATIC_MASK), readIPAddress(STATIC_GW), readIPAddress(STATIC_DNS)));
+  Serial.print(" ");
+  Serial.print("$PS=");
+  Serial.print(powerSaveName(EEPROM.read(POWER_SAVE_ADDRESS)));
+  Serial.print(" ");
+  for (int i = 0; i < WIFI_EXTRA_NETWORKS; i++)
+  {
+    String name = getEEPROM(WIFI_EXTRA_ADDRESS + i * (SSID_LEN + PASS_LEN), SSID_LEN);
+    if (name.length() == 0 || (byte)name[0] == 0xFF)
+      continue;
+    Serial.print("$WIFI");
+    Serial.print(i + 1);
+    Serial.print("=");
+    Serial.print(name);
+    Serial.print(" ");
+  }
+  yield();
   Serial.println();
   yield();
   Serial.println("Stored Speed Dial:");
@@ -208,13 +413,34 @@ void displayHelp()
   };
   printLine(F("AT Command Summary:"));
   printLine(F("Dial Host:           ATDTHOST:PORT"));
+  printLine(F("Dial TLS (ESP32):    ATDTTLS://HOST:PORT"));
+  printLine(F("SSH (ESP32):         ATSSH [-K] USER@HOST:PORT (-K=device key)"));
+  printLine(F("SSH Key (ESP32):     AT$SSHKEYGEN / AT$SSHKEY?"));
+  printLine(F("SSH Known Hosts:     AT$SSHHOSTS? / AT$SSHFORGET=HOST:PORT"));
+  printLine(F("TLS Pinned Certs:    AT$TLSHOSTS? / AT$TLSFORGET=HOST:PORT"));
+  printLine(F("SSH Terminal Type:   AT$TT=TYPE (default vt100) / AT$TT?"));
+  printLine(F("SSH Keepalive:       ATS40=N (seconds, 0=off) / ATS40?"));
+  printLine(F("SSH Reconnects:      ATS41=N (0-10 attempts) / ATS41?"));
   printLine(F("Speed Dial:          ATDSN (N=0-9)"));
   printLine(F("PPP Session.:        ATDTPPP"));
+  printLine(F("SLIP Session:        ATDTSLIP / ATDTCSLIP (header compression)"));
+  printLine(F("PPP Options:         AT$PPP=VJ,ACCM,PFC,ACFC (or ALL, NONE) / AT$PPP?"));
+  printLine(F("PPP MRU:             AT$PPPMRU=N (128-1500) / AT$PPPMRU?"));
+  printLine(F("NAT Table Size:      AT$NAT=N (32-1024, ESP8266, after AT&W and reboot) / AT$NAT?"));
+  printLine(F("More Networks:       AT$WIFI=N,SSID,PASSWORD (N=1-3) / AT$WIFI=N (remove) / AT$WIFI?"));
+  printLine(F("Wi-Fi Power Save:    AT$PS=OFF|MODEM|AUTO|LIGHT (AUTO=awake in calls, LIGHT untimed) / AT$PS?"));
+  printLine(F("Boot Phase Times:    AT$BOOT"));
+  printLine(F("Static IP:           AT$IP=ADDR,MASK,GATEWAY[,DNS] / AT$IP=DHCP / AT$IP?"));
+  printLine(F("Port Forward:        AT$FWD=TCP|UDP,PORT[,PORT] / AT$FWDDEL=TCP|UDP,PORT / AT$FWD?"));
   printLine(F("Set Speed Dial:      AT&ZN=HOST:PORT (where N is 0-9)"));
   printLine(F("Handle Telnet:       ATNETN (N=0,1)"));
   printLine(F("Network Information: ATI"));
   printLine(F("HTTP GET:            ATGET<URL>"));
-  printLine(F("GOPHER Request:      ATGPH<URL>"));
+  printLine(F("HTTP GET to SD:      ATGETSD<URL>"));
+  printLine(F("HTTP GET via XMODEM: ATGETX<URL> / ATGETY<URL> (YMODEM)"));
+  printLine(F("HTTPS GET (ESP32):   ATGETS<URL>, or https:// in any ATGET"));
+  printLine(F("Web Browser:         ATWEB<URL> (text, numbered links)"));
+  printLine(F("Gopher Browser:      ATGPH<URL> (numbered menus)"));
   printLine(F("Auto Answer:         ATS0=N (N=0,1)"));
   printLine(F("Set BUSY Message:    AT$BM=YOUR BUSY MESSAGE"));
   printLine(F("Load from NVRAM:     ATZ"));
@@ -235,6 +461,15 @@ void displayHelp()
   printLine(F("Enter CMD mode:      +++"));
   printLine(F("Exit CMD mode:       ATO"));
   printLine(F("Update Firmware:     AT$FW"));
+  printLine(F("Firmware From SD:    AT$FWSD=FILE[,SHA256]"));
+  printLine(F("Kermit Receive:      AT$KRECV (to SD card)"));
+  printLine(F("Kermit Send:         AT$KSEND=FILE (from SD card)"));
+  printLine(F("XMODEM-1K Send:      AT$SEND=FILE (from SD card)"));
+  printLine(F("YMODEM Batch Send:   AT$SENDB=FILE1,FILE2,..."));
+  printLine(F("Terminal Width:      AT$TW=N (20-132) / AT$TW?"));
+  printLine(F("Terminal Height:     AT$TH=N (8-72, 0=no paging) / AT$TH?"));
+  printLine(F("Terminal Charset:    AT$CS=NAME (NONE,CP437,KOI8-R,CP1251,PETSCII) / AT$CS?"));
+  printLine(F("ANSI Filter:         AT$AF=MODE (OFF,MONO,DUMB,VT52) / AT$AF?"));
 }
 
 void displayCurrentSettings()
@@ -278,6 +513,52 @@ void displayCurrentSettings()
   Serial.print(F("S0:"));
   Serial.print(autoAnswer);
   Serial.print(F(" "));
+  Serial.print(F("$TW"));
+  Serial.print(termCols);
+  Serial.print(F(" "));
+  Serial.print(F("$TH"));
+  Serial.print(termRows);
+  Serial.print(F(" "));
+  Serial.print(F("$CS="));
+  Serial.print(charsetName(termCharset));
+  Serial.print(F(" "));
+  Serial.print(F("$AF="));
+  Serial.print(ansiModeName(termAnsi));
+  Serial.print(F(" "));
+  Serial.print(F("$TT="));
+  Serial.print(sshTermType);
+  Serial.print(F(" "));
+  Serial.print(F("S40:"));
+  Serial.print(sshKeepalive);
+  Serial.print(F(" "));
+  Serial.print(F("S41:"));
+  Serial.print(sshReconnects);
+  Serial.print(F(" "));
+  Serial.print(F("$PPP="));
+  Serial.print(pppOptionsName(pppOptions));
+  Serial.print(F(" "));
+  Serial.print(F("$PPPMRU="));
+  Serial.print(pppMru);
+  Serial.print(F(" "));
+  Serial.print(F("$NAT="));
+  Serial.print(naptTableSize);
+  Serial.print(F(" "));
+  Serial.print(F("$IP="));
+  Serial.print(ipConfigString(staticIp, staticAddress, staticMask, staticGateway, staticDns));
+  Serial.print(F(" "));
+  Serial.print(F("$PS="));
+  Serial.print(powerSaveName(powerSave));
+  Serial.print(F(" "));
+  for (int i = 0; i < WIFI_EXTRA_NETWORKS; i++)
+  {
+    if (wifiExtraSsid[i].isEmpty())
+      continue;
+    Serial.print(F("$WIFI"));
+    Serial.print(i + 1);
+    Serial.print(F("="));
+    Serial.print(wifiExtraSsid[i]);
+    Serial.print(F(" "));
+  }
   Serial.println();
   yield();
   Serial.println(F("Speed Dial:"));
@@ -0,0 +1,295 @@
+#include <Arduino.h>
+#include "globals.h"
+#include "ppp.h"
+#include "dnsproxy.h"
+
+#ifdef PPP_ENABLED
+#include <lwip/ip.h>
+#include <lwip/pbuf.h>
+#if VJ_SUPPORT
+#include "netif/ppp/vj.h"
+#endif
+#ifdef ESP32
+#include <lwip/netifapi.h>
+#include <lwip/tcpip.h>
+#endif
+
+// SLIP (RFC 1055) with optional CSLIP header compression (RFC 1144) for
+// stacks that have nothing better. The computer is configured by hand:
+// its address is PPP_PEER_ADDRESS and ours is the gateway. Frames share
+// the PPP queue and counters, and traffic is NATed to Wi-Fi the same way.
+
+#define SLIP_END 0xC0
+#define SLIP_ESC 0xDB
+#define SLIP_ESC_END 0xDC
+#define SLIP_ESC_ESC 0xDD
+#define SLIP_MTU 1006
+
+bool slipActive = false;
+static struct netif slip_netif;
+
+// Receive side, only touched from loop()
+static uint8_t slipRxFrame[SLIP_MTU];
+static size_t slipRxLen = 0;
+static bool slipRxEscape = false;
+static bool slipRxOverrun = false;
+
+#if VJ_SUPPORT
+// Compression state for each direction. Sending is on the lwIP task on
+// ESP32 and receiving in loop(), so they are kept apart.
+static struct vjcompress slipVjTx;
+static struct vjcompress slipVjRx;
+static volatile bool slipCompress = false;
+#endif
+
+// Appends the SLIP encoding of len bytes to the queue, in small steps so
+// no frame sized buffer is needed. Returns the bytes queued.
+static size_t slipPut(const uint8_t *data, size_t len)
+{
+  uint8_t chunk[64];
+  size_t n = 0;
+  size_t total = 0;
+  for (size_t i = 0; i < len; i++)
+  {
+    if (n > sizeof(chunk) - 2)
+    {
+      pppTxPut(chunk, n);
+      total += n;
+      n = 0;
+    }
+    if (data[i] == SLIP_END)
+    {
+      chunk[n++] = SLIP_ESC;
+      chunk[n++] = SLIP_ESC_END;
+    }
+    else if (data[i] == SLIP_ESC)
+    {
+      chunk[n++] = SLIP_ESC;
+      chunk[n++] = SLIP_ESC_ESC;
+    }
+    else
+    {
+      chunk[n++] = data[i];
+    }
+  }
+  if (n > 0)
+    pppTxPut(chunk, n);
+  return total + n;
+}
+
+static err_t slipOutput(struct netif *netif, struct pbuf *p, const ip4_addr_t *ipaddr)
+{
+  LWIP_UNUSED_ARG(ipaddr);
+  if (cmdMode)
+    return ERR_OK;
+
+  // Worst case every byte is escaped, plus an END at each side
+  if (pppTxSpace() < 2 * (size_t)p->tot_len + 2)
+  {
+    pppStats.txDrops++;
+    return ERR_OK;
+  }
+  pppStats.ipBytesOut += p->tot_len;
+
+  struct pbuf *frame = p;
+#if VJ_SUPPORT
+  if (slipCompress)
+  {
+    // TCP may still send the pbuf again, so compress a copy of it
+    frame = pbuf_alloc(PBUF_RAW, p->tot_len, PBUF_RAM);
+    if (frame == NULL)
+    {
+      pppStats.txDrops++;
+      return ERR_MEM;
+    }
+    pbuf_copy(frame, p);
+    u8_t type = vj_compress_tcp(&slipVjTx, &frame);
+    ((uint8_t *)frame->payload)[0] |= type;
+  }
+#endif
+
+  uint8_t end = SLIP_END;
+  size_t sent = 2;
+  pppTxPut(&end, 1);
+  for (struct pbuf *q = frame; q != NULL; q = q->next)
+    sent += slipPut((const uint8_t *)q->payload, q->len);
+  pppTxPut(&end, 1);
+  pppStats.bytesOut += sent;
+  pppStats.framesOut++;
+
+  if (frame != p)
+    pbuf_free(frame);
+  return ERR_OK;
+}
+
+static err_t slipNetifInit(struct netif *netif)
+{
+  netif->name[0] = 's';
+  netif->name[1] = 'l';
+  netif->output = slipOutput;
+  netif->mtu = SLIP_MTU;
+  netif->flags = NETIF_FLAG_LINK_UP; // Point to point, no broadcast
+  return ERR_OK;
+}
+
+// Hands a complete frame to lwIP, undoing CSLIP compression first
+static void slipDeliver()
+{
+  struct pbuf *p = pbuf_alloc(PBUF_RAW, slipRxLen, PBUF_POOL);
+  if (p == NULL)
+    return;
+  pbuf_take(p, slipRxFrame, slipRxLen);
+
+#if VJ_SUPPORT
+  uint8_t first = slipRxFrame[0];
+  if (first & 0x80)
+  {
+    // Compressed TCP. Seeing it means the computer speaks CSLIP, so
+    // answer in kind from now on.
+    slipCompress = true;
+    ((uint8_t *)p->payload)[0] &= 0x7F;
+    if (vj_uncompress_tcp(&p, &slipVjRx) < 0)
+    {
+      if (p != NULL)
+        pbuf_free(p);
+      return;
+    }
+  }
+  else if (first >= 0x70)
+  {
+    // Uncompressed TCP that sets up a compression slot
+    slipCompress = true;
+    ((uint8_t *)p->payload)[0] &= 0x4F;
+    if (vj_uncompress_uncomp(p, &slipVjRx) < 0)
+    {
+      pbuf_free(p);
+      return;
+    }
+  }
+#endif
+
+  pppStats.framesIn++;
+  if (slip_netif.input(p, &slip_netif) != ERR_OK)
+    pbuf_free(p);
+}
+
+void slipInput(const uint8_t *data, size_t len)
+{
+  for (size_t i = 0; i < len; i++)
+  {
+    uint8_t c = data[i];
+    if (c == SLIP_END)
+    {
+      if (slipRxLen > 0 && !slipRxOverrun)
+        slipDeliver();
+#if VJ_SUPPORT
+      else if (slipRxOverrun)
+        vj_uncompress_err(&slipVjRx);
+#endif
+      slipRxLen = 0;
+      slipRxEscape = false;
+      slipRxOverrun = false;
+      continue;
+    }
+    if (c == SLIP_ESC)
+    {
+      slipRxEscape = true;
+      continue;
+    }
+    if (slipRxEscape)
+    {
+      slipRxEscape = false;
+      if (c == SLIP_ESC_END)
+        c = SLIP_END;
+      else if (c == SLIP_ESC_ESC)
+        c = SLIP_ESC;
+    }
+    if (slipRxLen < sizeof(slipRxFrame))
+      slipRxFrame[slipRxLen++] = c;
+    else
+      slipRxOverrun = true;
+  }
+}
+
+// ATDTSLIP and ATDTCSLIP. With plain SLIP, compression still starts as
+// soon as the computer sends a compressed packet.
+void dialSLIP(bool compressed)
+{
+  if (ppp || slipActive)
+  {
+    Serial.println(ppp ? "PPP already active" : "SLIP already active");
+    sendResult(RES_ERROR);
+    return;
+  }
+#if !VJ_SUPPORT
+  if (compressed)
+  {
+    Serial.println("CSLIP is not in this build");
+    sendResult(RES_ERROR);
+    return;
+  }
+#else
+  vj_compress_init(&slipVjTx);
+  vj_compress_init(&slipVjRx);
+  slipCompress = compressed;
+#endif
+  pppLinkReset();
+  slipRxLen = 0;
+  slipRxEscape = false;
+  slipRxOverrun = false;
+
+  ip4_addr_t ours = toIp4(WiFi.localIP());
+  ip4_addr_t mask = toIp4(IPAddress(255, 255, 255, 255));
+  ip4_addr_t his = toIp4(PPP_PEER_ADDRESS);
+#ifdef ESP32
+  err_t err = netifapi_netif_add(&slip_netif, &ours, &mask, &his, NULL, slipNetifInit, tcpip_input);
+  if (err == ERR_OK)
+    netifapi_netif_set_up(&slip_netif);
+#else
+  err_t err = netif_add(&slip_netif, &ours, &mask, &his, NULL, slipNetifInit, ip_input) ? ERR_OK : ERR_IF;
+  if (err == ERR_OK)
+    netif_set_up(&slip_netif);
+#endif
+  if (err != ERR_OK)
+  {
+    Serial.println("SLIP: Unable to add the interface");
+    sendResult(RES_ERROR);
+    return;
+  }
+  ip_napt_enable(ip4_addr_get_u32(&ours), 1);
+  slipActive = true;
+  syncPortForwards(true);
+
+  Serial.print(compressed ? "CSLIP" : "SLIP");
+  Serial.print(": your address ");
+  Serial.print(PPP_PEER_ADDRESS);
+  Serial.print(", gateway ");
+  Serial.print(WiFi.localIP());
+  Serial.print(", DNS ");
+  Serial.print(dnsProxyBegin() ? WiFi.localIP() : WiFi.dnsIP(0));
+  Serial.print(", MTU ");
+  Serial.println(SLIP_MTU);
+  sendResult(RES_CONNECT);
+  connectTime = millis();
+  cmdMode = false;
+  callConnected = true;
+  setCarrierDCDPin(callConnected);
+}
+
+void closeSLIP()
+{
+  if (!slipActive)
+    return;
+  slipActive = false;
+  dnsProxyEnd();
+  syncPortForwards(false);
+#ifdef ESP32
+  netifapi_netif_set_down(&slip_netif);
+  netifapi_netif_remove(&slip_netif);
+#else
+  netif_set_down(&slip_netif);
+  netif_remove(&slip_netif);
+#endif
+}
+
+#endif
@@ -1,29 +1,245 @@
 #include <Arduino.h>
 #include <globals.h>
+#include "ssh.h"
+#include "knownhosts.h"
 
 #ifdef ESP32
     #include <WiFi.h>
     #include <WiFiClient.h>
     #include <libssh/libssh.h>
     #include "libssh_esp32.h"
+    #include <freertos/stream_buffer.h>
+    #include <freertos/event_groups.h>
+    #include <freertos/queue.h>
+    #include <Preferences.h>
+    
+    #define SSH_RX_BUF 4096      // Channel to terminal
+    #define SSH_TX_BUF 2048      // Terminal to channel
+    #define SSH_TX_CHUNK 1024    // Largest single channel write
+    #define SSH_COALESCE_MS 5    // How long to wait for more input before a write
+    #define SSH_IDLE_MS 2        // Pump sleep when there is nothing to send
+    #define SSH_EVENT_QUEUE 8
+    #define SSH_EVENT_TEXT 96
+    
+    // The device key and the known host keys live in NVS, the latter in
+    // the format of knownhosts.h
+    #define SSH_PREFS "ssh"
+    #define SSH_PREFS_KEY "id_ed25519"
     
     static ssh_session sshSession = NULL;
     static ssh_channel sshChannel = NULL;
     
+    // A single worker task, created on the first ATSSH, owns the libssh
+    // session. loop() hands it a connect request through sshRequests and
+    // learns what happened from sshEvents, so the modem state and Serial
+    // are only ever touched from loop(). Once the session is up, loop()
+    // only moves bytes between Serial and the two stream buffers.
+    enum SSHEventType : uint8_t
+    {
+        SSH_EVENT_LOG,       // A line of progress to print
+        SSH_EVENT_CONNECTED, // Shell is open, go to connected mode
+        SSH_EVENT_FAILED,    // Connect failed, result holds the code
+        SSH_EVENT_CLOSED     // Session over, hang up once the output is out
+    };
+    
+    struct SSHEvent
+    {
+        SSHEventType type;
+        int8_t result;
+        char text[SSH_EVENT_TEXT];
+    };
+    
+    // Event group bits
+    #define SSH_BIT_IDLE (1 << 0) // Worker is waiting for a request
+    #define SSH_BIT_STOP (1 << 1) // loop() wants the session ended
+    
+    static TaskHandle_t sshTask = NULL;
+    static QueueHandle_t sshRequests = NULL;
+    static QueueHandle_t sshEvents = NULL;
+    static EventGroupHandle_t sshFlags = NULL;
+    static StreamBufferHandle_t sshRx = NULL;
+    static StreamBufferHandle_t sshTx = NULL;
+    static bool sshClosing = false;  // loop() side: CLOSED seen
+    static uint32_t sshStackUsed = 0; // Deepest worker stack use, bytes
+    
     // SSH connection parameters
     struct SSHConnectParams {
         String username;
         String password;
         String host;
         String port;
+        bool useKey;
     };
     
     static SSHConnectParams sshParams;
 #endif
 
-void cleanupSSHSession()
+#ifdef ESP32
+static void beginLibSSH()
+{
+    static bool started = false;
+    if (!started)
+    {
+        libssh_begin();
+        started = true;
+    }
+}
+
+static bool sshStopRequested()
+{
+    return xEventGroupGetBits(sshFlags) & SSH_BIT_STOP;
+}
+
+static void postSSHEvent(SSHEventType type, int result, const String &text)
+{
+    SSHEvent event;
+    event.type = type;
+    event.result = result;
+    strlcpy(event.text, text.c_str(), sizeof(event.text));
+    xQueueSend(sshEvents, &event, portMAX_DELAY);
+}
+
+// Progress from the worker, printed by loop()
+static void sshLog(const String &line)
+{
+    postSSHEvent(SSH_EVENT_LOG, 0, line);
+}
+
+static String loadPrivateKey()
+{
+    Preferences prefs;
+    prefs.begin(SSH_PREFS, true);
+    String key = prefs.getString(SSH_PREFS_KEY, "");
+    prefs.end();
+    return key;
+}
+
+// Checks the server's key against known_hosts. An unknown server is trusted
+// and remembered on first use, a changed key stops the connection.
+static bool verifyHostKey(const String &hostPort)
+{
+    ssh_key serverKey = NULL;
+    if (ssh_get_server_publickey(sshSession, &serverKey) != SSH_OK)
+    {
+        sshLog("Cannot read the host key");
+        return false;
+    }
+    unsigned char *hash = NULL;
+    size_t hashLen = 0;
+    int rc = ssh_get_publickey_hash(serverKey, SSH_PUBLICKEY_HASH_SHA256, &hash, &hashLen);
+    ssh_key_free(serverKey);
+    if (rc != SSH_OK)
+    {
+        sshLog("Cannot hash the host key");
+        return false;
+    }
+    char *fp = ssh_get_fingerprint_hash(SSH_PUBLICKEY_HASH_SHA256, hash, hashLen);
+    ssh_clean_pubkey_hash(&hash);
+    if (fp == NULL)
+        return false;
+    String fingerprint = fp;
+    ssh_string_free_char(fp);
+
+    String hosts = loadKnownHosts(SSH_PREFS);
+    String known = knownHostFingerprint(hosts, hostPort);
+    if (known.length())
+    {
+        if (known == fingerprint)
+            return true;
+        sshLog("");
+        sshLog("WARNING: the host key has changed!");
+        sshLog("Known:  " + known);
+        sshLog("Server: " + fingerprint);
+        sshLog("If the change is expected, run AT$SSHFORGET=" + hostPort);
+        return false;
+    }
+
+    addKnownHost(hosts, hostPort, fingerprint);
+    saveKnownHosts(SSH_PREFS, hosts);
+    sshLog("");
+    sshLog("New host key " + fingerprint + " saved");
+    return true;
+}
+
+// Asks the worker to end the session and waits until it has freed it
+static void stopSSHPump()
 {
+    if (sshTask == NULL)
+        return;
+    xEventGroupSetBits(sshFlags, SSH_BIT_STOP);
+    // Keep taking events meanwhile, the worker may be blocked on a full queue
+    while (!(xEventGroupWaitBits(sshFlags, SSH_BIT_IDLE, pdFALSE, pdTRUE, pdMS_TO_TICKS(50)) & SSH_BIT_IDLE))
+        pollSSHEvents();
+    xEventGroupClearBits(sshFlags, SSH_BIT_STOP);
+}
+
+// Moves data between the channel and the stream buffers until the channel
+// closes or the session is torn down. Returns true when the connection was
+// lost rather than closed by the server.
+static bool runSSHPump()
+{
+    uint8_t buf[SSH_TX_CHUNK];
+    const TickType_t coalesceTicks = pdMS_TO_TICKS(SSH_COALESCE_MS);
+    unsigned long lastTraffic = millis();
+
+    while (!sshStopRequested())
+    {
+        // Keep NAT and firewall state alive on an idle session, and notice
+        // a dead link instead of waiting on it forever
+        if (sshKeepalive > 0 && millis() - lastTraffic > sshKeepalive * 1000UL)
+        {
+            if (ssh_send_keepalive(sshSession) != SSH_OK)
+                return true;
+            lastTraffic = millis();
+        }
+
+        // Channel to terminal, only as much as the terminal side can take
+        size_t space = xStreamBufferSpacesAvailable(sshRx);
+        if (space > 0)
+        {
+            int n = ssh_channel_read_nonblocking(sshChannel, buf, space < sizeof(buf) ? space : sizeof(buf), 0);
+            if (n > 0)
+            {
+                xStreamBufferSend(sshRx, buf, n, 0);
+                lastTraffic = millis();
+            }
+            else if (n < 0)
+            {
+                return !ssh_channel_is_eof(sshChannel);
+            }
+            else if (ssh_channel_is_eof(sshChannel) || ssh_channel_is_closed(sshChannel))
+            {
+                return false;
+            }
+        }
+
+        // Terminal to channel, gathering a paste or a burst of typing into
+        // one packet instead of one per character
+        size_t len = xStreamBufferReceive(sshTx, buf, sizeof(buf), pdMS_TO_TICKS(SSH_IDLE_MS));
+        if (len == 0)
+            continue;
+        TickType_t start = xTaskGetTickCount();
+        while (len < sizeof(buf))
+        {
+            TickType_t waited = xTaskGetTickCount() - start;
+            if (waited >= coalesceTicks)
+                break;
+            size_t more = xStreamBufferReceive(sshTx, buf + len, sizeof(buf) - len, coalesceTicks - waited);
+            if (more == 0)
+                break;
+            len += more;
+        }
+        if (ssh_channel_write(sshChannel, buf, len) == SSH_ERROR)
+            return true;
+        lastTraffic = millis();
+    }
+    return false;
+}
+#endif
+
 #ifdef ESP32
+static void freeSSHSession()
+{
     if (sshChannel != NULL)
     {
         ssh_channel_send_eof(sshChannel);
@@ -38,28 +254,31 @@ void cleanupSSHSession()
         ssh_free(sshSession);
         sshSession = NULL;
     }
-    
+}
+#endif
+
+void cleanupSSHSession()
+{
+#ifdef ESP32
+    stopSSHPump();
+    pollSSHEvents(); // Print what the worker said on the way out
     sshConnected = false;
+    sshConnecting = false;
+    sshClosing = false;
 #endif
 }
 
 #ifdef ESP32
-// SSH connection task with large stack
-void sshConnectTask(void *parameter)
+// Connects, checks the host key, logs in and starts a shell. Returns
+// RES_OK, or the result code to report with the session freed again.
+static int establishSSH(const SSHConnectParams *params)
 {
-    SSHConnectParams *params = (SSHConnectParams *)parameter;
-    
-    // Initialize libssh library
-    libssh_begin();
-    
     // Create new SSH session
     sshSession = ssh_new();
     if (sshSession == NULL)
     {
-        Serial.println("Failed to create SSH session");
-        sendResult(RES_ERROR);
-        vTaskDelete(NULL);
-        return;
+        sshLog("Failed to create SSH session");
+        return RES_ERROR;
     }
     
     // Set SSH options
@@ -73,94 +292,155 @@ void sshConnectTask(void *parameter)
     ssh_options_set(sshSession, SSH_OPTIONS_TIMEOUT, &timeout);
     
     // Connect to server
-    Serial.print("Connecting... ");
     int rc = ssh_connect(sshSession);
     if (rc != SSH_OK)
     {
-        Serial.println("FAILED");
-        Serial.print("Error: ");
-        Serial.println(ssh_get_error(sshSession));
-        cleanupSSHSession();
-        sendResult(RES_NOANSWER);
-        vTaskDelete(NULL);
-        return;
+        sshLog("Connecting... FAILED");
+        sshLog(String("Error: ") + ssh_get_error(sshSession));
+        freeSSHSession();
+        return RES_NOANSWER;
     }
-    Serial.println("OK");
+    sshLog("Connecting... OK");
     
-    // Authenticate with password
-    Serial.print("Authenticating... ");
-    Serial.println();
-    rc = ssh_userauth_password(sshSession, NULL, params->password.c_str());
+    if (!verifyHostKey(params->host + ":" + params->port))
+    {
+        freeSSHSession();
+        return RES_ERROR;
+    }
+    
+    // Authenticate with the device key or the password
+    if (params->useKey)
+    {
+        ssh_key privateKey = NULL;
+        String keyData = loadPrivateKey();
+        rc = ssh_pki_import_privkey_base64(keyData.c_str(), NULL, NULL, NULL, &privateKey);
+        if (rc == SSH_OK)
+        {
+            rc = ssh_userauth_publickey(sshSession, NULL, privateKey);
+            ssh_key_free(privateKey);
+        }
+        else
+        {
+            rc = SSH_AUTH_ERROR;
+        }
+    }
+    else
+    {
+        rc = ssh_userauth_password(sshSession, NULL, params->password.c_str());
+    }
     if (rc != SSH_AUTH_SUCCESS)
     {
-        Serial.println("FAILED");
-        Serial.println("Authentication error (check username/password)");
-        cleanupSSHSession();
-        sendResult(RES_ERROR);
-        vTaskDelete(NULL);
-        return;
+        sshLog("Authenticating... FAILED");
+        sshLog(params->useKey ? "Authentication error (is the key from AT$SSHKEY? in authorized_keys?)"
+                              : "Authentication error (check username/password)");
+        freeSSHSession();
+        return RES_ERROR;
     }
-    Serial.println("OK");
+    sshLog("Authenticating... OK");
     
     // Open a channel
-    Serial.print("Opening shell... ");
     sshChannel = ssh_channel_new(sshSession);
     if (sshChannel == NULL)
     {
-        Serial.println("FAILED");
-        cleanupSSHSession();
-        sendResult(RES_ERROR);
-        vTaskDelete(NULL);
-        return;
+        sshLog("Opening shell... FAILED");
+        freeSSHSession();
+        return RES_ERROR;
     }
     
     rc = ssh_channel_open_session(sshChannel);
     if (rc != SSH_OK)
     {
-        Serial.println("FAILED");
-        Serial.print("Error: ");
-        Serial.println(ssh_get_error(sshSession));
-        cleanupSSHSession();
-        sendResult(RES_ERROR);
-        vTaskDelete(NULL);
-        return;
+        sshLog("Opening shell... FAILED");
+        sshLog(String("Error: ") + ssh_get_error(sshSession));
+        freeSSHSession();
+        return RES_ERROR;
     }
     
-    // Request PTY
-    rc = ssh_channel_request_pty(sshChannel);
+    // Request a PTY of the terminal's type and size
+    rc = ssh_channel_request_pty_size(sshChannel, sshTermType.c_str(), termCols, termRows ? termRows : 24);
     if (rc != SSH_OK)
     {
-        Serial.println("Failed to request PTY");
+        sshLog("Failed to request PTY");
     }
     
     // Request shell
     rc = ssh_channel_request_shell(sshChannel);
     if (rc != SSH_OK)
     {
-        Serial.println("FAILED");
-        Serial.print("Error: ");
-        Serial.println(ssh_get_error(sshSession));
-        cleanupSSHSession();
-        sendResult(RES_ERROR);
-        vTaskDelete(NULL);
-        return;
+        sshLog("Opening shell... FAILED");
+        sshLog(String("Error: ") + ssh_get_error(sshSession));
+        freeSSHSession();
+        return RES_ERROR;
     }
-    Serial.println("OK");
+    sshLog("Opening shell... OK");
     
-    // Mark as connected
-    Serial.println();
-    Serial.println("SSH session established");
-    Serial.println();
-    
-    sshConnected = true;
-    callConnected = true;
-    cmdMode = false;
-    connectTime = millis();
-    Serial.flush();
-    setCarrierDCDPin(callConnected);
+    return RES_OK;
+}
+
+// Runs one session from connect to close: the pump, and reconnects if the
+// link drops and S41 allows it
+static void runSSHSession(const SSHConnectParams *params)
+{
+    int result = establishSSH(params);
+    if (result != RES_OK)
+    {
+        postSSHEvent(SSH_EVENT_FAILED, result, "");
+        return;
+    }
+    postSSHEvent(SSH_EVENT_CONNECTED, 0, "");
     
-    // Task completed, delete itself
-    vTaskDelete(NULL);
+    while (runSSHPump() && !sshStopRequested())
+    {
+        freeSSHSession();
+        sshLog("");
+        sshLog("SSH connection lost");
+        bool reconnected = false;
+        for (int attempt = 1; attempt <= sshReconnects && !sshStopRequested() && !reconnected; attempt++)
+        {
+            vTaskDelay(pdMS_TO_TICKS(1000 * attempt));
+            sshLog("Reconnecting, attempt " + String(attempt));
+            reconnected = establishSSH(params) == RES_OK;
+        }
+        if (!reconnected)
+            break;
+        sshLog("");
+        sshLog("SSH session re-established");
+    }
+    freeSSHSession();
+    postSSHEvent(SSH_EVENT_CLOSED, 0, "");
+}
+
+// The SSH worker, kept for the life of the device. libssh needs a deep
+// stack for the key exchange; the peak is kept for ATI.
+static void sshWorkerTask(void *)
+{
+    beginLibSSH();
+    while (true)
+    {
+        SSHConnectParams *params;
+        xEventGroupSetBits(sshFlags, SSH_BIT_IDLE);
+        xQueueReceive(sshRequests, &params, portMAX_DELAY);
+        xEventGroupClearBits(sshFlags, SSH_BIT_IDLE);
+        runSSHSession(params);
+        sshStackUsed = SSH_TASK_STACK - uxTaskGetStackHighWaterMark(NULL);
+    }
+}
+
+static bool startSSHWorker()
+{
+    if (sshTask != NULL)
+        return true;
+    if (sshRequests == NULL)
+    {
+        sshRequests = xQueueCreate(1, sizeof(SSHConnectParams *));
+        sshEvents = xQueueCreate(SSH_EVENT_QUEUE, sizeof(SSHEvent));
+        sshFlags = xEventGroupCreate();
+        sshRx = xStreamBufferCreate(SSH_RX_BUF, 1);
+        sshTx = xStreamBufferCreate(SSH_TX_BUF, 1);
+    }
+    if (!sshRequests || !sshEvents || !sshFlags || !sshRx || !sshTx)
+        return false;
+    return xTaskCreate(sshWorkerTask, "ssh", SSH_TASK_STACK, NULL, tskIDLE_PRIORITY + 1, &sshTask) == pdPASS;
 }
 #endif
 
@@ -172,7 +452,7 @@ void connectSSH(String cmd)
     sendResult(RES_ERROR);
     return;
 #else
-    if (callConnected)
+    if (callConnected || sshConnecting)
     {
         sendResult(RES_ERROR);
         return;
@@ -192,6 +472,15 @@ void connectSSH(String cmd)
     String fullCmd = cmd.substring(sshPos + 3); // Skip past "SSH"
     fullCmd.trim();
     
+    // ATSSH -K user@host logs in with the device key instead of a password
+    bool useKey = false;
+    if (fullCmd.startsWith("-K") || fullCmd.startsWith("-k"))
+    {
+        useKey = true;
+        fullCmd = fullCmd.substring(2);
+        fullCmd.trim();
+    }
+    
     String username = "";
     String password = "";
     String host = "";
@@ -202,9 +491,9 @@ void connectSSH(String cmd)
     if (atIndex == -1)
     {
         Serial.println();
-        Serial.println("Invalid format. Use: ATSSH username@host:port");
+        Serial.println("Invalid format. Use: ATSSH [-K] username@host:port");
         Serial.println("Example: ATSSH user@example.com:22");
-        Serial.println("Port is optional (default: 22)");
+        Serial.println("Port is optional (default: 22), -K logs in with the device key");
         sendResult(RES_ERROR);
         return;
     }
@@ -236,48 +525,59 @@ void connectSSH(String cmd)
         return;
     }
     
-    // Ask for password
-    Serial.println();
-    Serial.print("Password: ");
-    Serial.flush();
+    if (useKey && loadPrivateKey().length() == 0)
+    {
+        Serial.println();
+        Serial.println("No device key, create one with AT$SSHKEYGEN");
+        sendResult(RES_ERROR);
+        return;
+    }
     
-    // Wait for password input (terminated by carriage return)
-    password = "";
-    unsigned long startTime = millis();
-    while (millis() - startTime < 30000) // 30 second timeout
+    if (!useKey)
     {
-        if (Serial.available())
+        // Ask for password
+        Serial.println();
+        Serial.print("Password: ");
+        Serial.flush();
+    
+        // Wait for password input (terminated by carriage return)
+        password = "";
+        unsigned long startTime = millis();
+        while (millis() - startTime < 30000) // 30 second timeout
         {
-            char c = Serial.read();
-            if (c == '\r' || c == '\n')
+            if (Serial.available())
             {
-                if (password.length() > 0)
+                char c = Serial.read();
+                if (c == '\r' || c == '\n')
                 {
-                    break;
+                    if (password.length() > 0)
+                    {
+                        break;
+                    }
                 }
-            }
-            else if (c == 8 || c == 127) // Backspace or DEL
-            {
-                if (password.length() > 0)
+                else if (c == 8 || c == 127) // Backspace or DEL
                 {
-                    password.remove(password.length() - 1);
+                    if (password.length() > 0)
+                    {
+                        password.remove(password.length() - 1);
+                    }
+                }
+                else if (c >= 32 && c <= 126) // Printable characters
+                {
+                    password += c;
                 }
             }
-            else if (c >= 32 && c <= 126) // Printable characters
-            {
-                password += c;
-            }
+            delay(10);
         }
-        delay(10);
-    }
     
-    Serial.println(); // New line after password entry
+        Serial.println(); // New line after password entry
     
-    if (password.length() == 0)
-    {
-        Serial.println("Password required");
-        sendResult(RES_ERROR);
-        return;
+        if (password.length() == 0)
+        {
+            Serial.println("Password required");
+            sendResult(RES_ERROR);
+            return;
+        }
     }
     
     Serial.println();
@@ -296,62 +596,230 @@ void connectSSH(String cmd)
     sshParams.password = password;
     sshParams.host = host;
     sshParams.port = port;
+    sshParams.useKey = useKey;
     
-    // Create SSH connection task with large stack (51200 bytes)
-    BaseType_t taskCreated = xTaskCreate(
-        sshConnectTask,       // Task function
-        "sshConnect",         // Task name
-        51200,                // Stack size in bytes
-        &sshParams,           // Parameters
-        tskIDLE_PRIORITY + 1, // Priority
-        NULL                  // Task handle (not needed)
-    );
-    
-    if (taskCreated != pdPASS)
+    if (!startSSHWorker())
     {
-        Serial.println("Failed to create SSH connection task");
+        Serial.println("Failed to create SSH task");
         sendResult(RES_ERROR);
         return;
     }
-    
-    // Task will handle the rest and send result
+    xStreamBufferReset(sshRx);
+    xStreamBufferReset(sshTx);
+    sshClosing = false;
+    
+    // The worker reports back through pollSSHEvents(). Until then the
+    // connect counts as a call for dialling and ATH. IDLE is cleared here
+    // so that a hang up straight away still waits for the session.
+    SSHConnectParams *request = &sshParams;
+    sshConnecting = true;
+    xEventGroupClearBits(sshFlags, SSH_BIT_IDLE);
+    xQueueSend(sshRequests, &request, portMAX_DELAY);
+#endif
+}
+
+// Deepest the SSH worker's stack has gone, in bytes, 0 before the first
+// session has ended
+uint32_t sshStackPeak()
+{
+#ifdef ESP32
+    return sshStackUsed;
+#else
+    return 0;
+#endif
+}
+
+// Called from loop(): applies what the SSH worker reported
+void pollSSHEvents()
+{
+#ifdef ESP32
+    if (sshEvents == NULL)
+        return;
+    SSHEvent event;
+    while (xQueueReceive(sshEvents, &event, 0) == pdTRUE)
+    {
+        switch (event.type)
+        {
+        case SSH_EVENT_LOG:
+            Serial.println(event.text);
+            break;
+        case SSH_EVENT_CONNECTED:
+            // A hang up while connecting has already reported NO CARRIER
+            if (sshStopRequested())
+                break;
+            sshConnecting = false;
+            Serial.println();
+            Serial.println("SSH session established");
+            Serial.println();
+            sshConnected = true;
+            callConnected = true;
+            cmdMode = false;
+            connectTime = millis();
+            setCarrierDCDPin(callConnected);
+            break;
+        case SSH_EVENT_FAILED:
+            if (sshStopRequested())
+                break;
+            sshConnecting = false;
+            sendResult(event.result);
+            break;
+        case SSH_EVENT_CLOSED:
+            sshClosing = true;
+            break;
+        }
+    }
 #endif
 }
 
 void handleSSHData()
 {
 #ifdef ESP32
-    if (!sshConnected || sshChannel == NULL)
+    if (!sshConnected || sshRx == NULL)
     {
         return;
     }
     
-    // Read from SSH channel and write to Serial (non-blocking)
-    char buffer[256];
-    int nbytes = ssh_channel_read_nonblocking(sshChannel, buffer, sizeof(buffer), 0);
+    uint8_t buffer[256];
     
-    if (nbytes > 0)
+    // SSH channel to Serial, as much as fits in the UART without waiting.
+    // The rest stays in sshRx and holds the SSH window back.
+    size_t room = Serial.availableForWrite();
+    while (room > 0)
     {
-        Serial.write((uint8_t*)buffer, nbytes);
-        Serial.flush();
+        size_t nbytes = xStreamBufferReceive(sshRx, buffer, min(room, sizeof(buffer)), 0);
+        if (nbytes == 0)
+            break;
+        Serial.write(buffer, nbytes);
+        room -= nbytes;
     }
-    else if (nbytes < 0)
+    
+    if (sshClosing && xStreamBufferIsEmpty(sshRx))
     {
-        // Error reading - channel is likely closed
-        if (ssh_channel_is_eof(sshChannel))
-        {
-            cleanupSSHSession();
-            hangUp();
-            return;
-        }
+        cleanupSSHSession();
+        hangUp();
+        return;
     }
-    // nbytes == 0 means no data available, which is normal
     
-    // Read from Serial and write to SSH channel
-    while (Serial.available())
+    // Serial to SSH channel. What does not fit stays in the UART buffer,
+    // where flow control can hold the terminal back.
+    size_t avail = Serial.available();
+    size_t space = xStreamBufferSpacesAvailable(sshTx);
+    size_t len = avail < space ? avail : space;
+    if (len > sizeof(buffer))
+        len = sizeof(buffer);
+    if (len > 0)
+    {
+        Serial.readBytes(buffer, len);
+        xStreamBufferSend(sshTx, buffer, len, 0);
+    }
+#endif
+}
+
+#ifdef ESP32
+// Prints the device key as an authorized_keys line
+static bool printPublicKey()
+{
+    String keyData = loadPrivateKey();
+    if (keyData.length() == 0)
     {
-        char c = Serial.read();
-        ssh_channel_write(sshChannel, &c, 1);
+        Serial.println("No device key, create one with AT$SSHKEYGEN");
+        return false;
+    }
+    beginLibSSH();
+    ssh_key privateKey = NULL;
+    ssh_key publicKey = NULL;
+    char *b64 = NULL;
+    bool ok = ssh_pki_import_privkey_base64(keyData.c_str(), NULL, NULL, NULL, &privateKey) == SSH_OK &&
+              ssh_pki_export_privkey_to_pubkey(privateKey, &publicKey) == SSH_OK &&
+              ssh_pki_export_pubkey_base64(publicKey, &b64) == SSH_OK;
+    if (ok)
+    {
+        Serial.print(ssh_key_type_to_char(ssh_key_type(publicKey)));
+        Serial.print(" ");
+        Serial.print(b64);
+        Serial.println(" hermes");
+    }
+    else
+    {
+        Serial.println("The stored key cannot be read");
+    }
+    ssh_string_free_char(b64);
+    ssh_key_free(publicKey);
+    ssh_key_free(privateKey);
+    return ok;
+}
+#endif
+
+void sshGenerateKey()
+{
+#ifndef ESP32
+    Serial.println("SSH is only implemented for ESP32 based Protea board");
+    sendResult(RES_ERROR);
+#else
+    beginLibSSH();
+    Serial.println("Generating Ed25519 key...");
+    ssh_key key = NULL;
+    char *b64 = NULL;
+    if (ssh_pki_generate(SSH_KEYTYPE_ED25519, 0, &key) != SSH_OK ||
+        ssh_pki_export_privkey_base64(key, NULL, NULL, NULL, &b64) != SSH_OK)
+    {
+        ssh_key_free(key);
+        Serial.println("Key generation failed");
+        sendResult(RES_ERROR);
+        return;
+    }
+    Preferences prefs;
+    prefs.begin(SSH_PREFS, false);
+    bool saved = prefs.putString(SSH_PREFS_KEY, b64) > 0;
+    prefs.end();
+    ssh_string_free_char(b64);
+    ssh_key_free(key);
+    if (!saved)
+    {
+        Serial.println("Cannot save the key");
+        sendResult(RES_ERROR);
+        return;
+    }
+    Serial.println("Add this line to ~/.ssh/authorized_keys on the server:");
+    printPublicKey();
+    sendResult(RES_OK);
+#endif
+}
+
+void sshShowKey()
+{
+#ifndef ESP32
+    Serial.println("SSH is only implemented for ESP32 based Protea board");
+    sendResult(RES_ERROR);
+#else
+    sendResult(printPublicKey() ? RES_OK : RES_ERROR);
+#endif
+}
+
+void sshListKnownHosts()
+{
+#ifndef ESP32
+    Serial.println("SSH is only implemented for ESP32 based Protea board");
+    sendResult(RES_ERROR);
+#else
+    printKnownHosts(SSH_PREFS);
+    sendResult(RES_OK);
+#endif
+}
+
+void sshForgetHost(String hostPort)
+{
+#ifndef ESP32
+    Serial.println("SSH is only implemented for ESP32 based Protea board");
+    sendResult(RES_ERROR);
+#else
+    String hosts = loadKnownHosts(SSH_PREFS);
+    if (!removeKnownHost(hosts, knownHostKey(hostPort, SSH_KNOWN_HOSTS_PORT)))
+    {
+        sendResult(RES_ERROR);
+        return;
     }
+    saveKnownHosts(SSH_PREFS, hosts);
+    sendResult(RES_OK);
 #endif
 }
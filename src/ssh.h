@@ -0,0 +1,8 @@
+#ifndef SSH_H
+#define SSH_H
+
+// Stack reserved for the SSH worker task, in bytes. libssh needs it deep
+// for the key exchange; ATI shows the peak use against it.
+#define SSH_TASK_STACK 51200
+
+#endif
@@ -9,10 +9,16 @@
 #include <cstring>
 #include "globals.h"
 #include "xmodem.h"
+#include "charset.h"
+#include "ansi.h"
+#include "ppp.h"
+#include "wifi.h"
 
 #define TX_BUF_SIZE 256
+#define RX_BUF_SIZE 256
 
 static uint8_t txBuf[TX_BUF_SIZE];
+static uint8_t rxBuf[RX_BUF_SIZE];
 static char plusCount = 0;
 static unsigned long plusTime = 0;
 
@@ -22,12 +28,55 @@ static bool xmodemInProgress = false;
 static bool waitingForXmodemResponse = false;
 static unsigned long lastCOrNakSent = 0;
 
+// Character set translation and escape filtering, restarted for every call
+static Utf8Decoder rxDecoder;
+static AnsiFilter ansiFilter(Serial);
+static unsigned long charsetSession = 0;
+
+// The remote end of the current call: the TLS session when one was dialled
+static Client &link()
+{
+#ifdef ESP32
+  if (tlsConnected)
+    return tlsClient;
+#endif
+  return tcpClient;
+}
+
+#ifdef ESP32
+void dialTLS(const String &host, uint16_t port)
+{
+  if (!tlsClient.connect(host.c_str(), port))
+  {
+    Serial.println(tlsClient.lastError());
+    sendResult(RES_NOANSWER);
+    callConnected = false;
+    setCarrierDCDPin(callConnected);
+    return;
+  }
+  if (tlsClient.notice().length())
+    Serial.println(tlsClient.notice());
+  Serial.print("TLS handshake ");
+  Serial.print(tlsClient.handshakeMs());
+  Serial.println(tlsClient.resumed() ? " ms (session resumed)" : " ms");
+  tlsConnected = true;
+  sendResult(RES_CONNECT);
+  connectTime = millis();
+  cmdMode = false;
+  Serial.flush();
+  callConnected = true;
+  setCarrierDCDPin(callConnected);
+}
+#endif
+
 void terminalToTcp()
 {
   if (!Serial.available())
     return;
 
-  size_t max_buf_size = telnet ? (TX_BUF_SIZE / 2) : TX_BUF_SIZE;
+  // Leave room for telnet IAC doubling, or for UTF-8 taking up to 3 bytes
+  bool encode = rxDecoder.charset() != CHARSET_NONE;
+  size_t max_buf_size = encode ? (TX_BUF_SIZE / 3) : telnet ? (TX_BUF_SIZE / 2) : TX_BUF_SIZE;
   size_t avail = Serial.available();
   size_t len = (avail < max_buf_size) ? avail : max_buf_size;
 
@@ -58,6 +107,10 @@ void terminalToTcp()
     }
   }
 
+  // Transfers run by the terminal program are binary
+  if (encode && !xmodemInProgress && !waitingForXmodemResponse)
+    len = encodeUtf8(rxDecoder.charset(), txBuf, len);
+
   // Telnet: duplicate each 0xFF (IAC)
   if (telnet)
   {
@@ -71,19 +124,8 @@ void terminalToTcp()
       }
     }
   }
-  #ifdef PPP_ENABLED
-  if (ppp)
-  {
-      pppos_input(ppp, txBuf, len);
-  }
-  else
-  {
-    tcpClient.write(txBuf, len);
-  }
-  #endif
-  #ifndef PPP_ENABLED
-  tcpClient.write(txBuf, len);
-  #endif
+  link().write(txBuf, len);
+  latencySent(len);
 
   yield();
 }
@@ -93,7 +135,7 @@ void handleTelnetControlCode()
 #ifdef DEBUG
   Serial.print("t");
 #endif
-  if (!tcpClient.available())
+  if (!link().available())
   {
 #ifdef DEBUG
     Serial.print("S");
@@ -101,7 +143,7 @@ void handleTelnetControlCode()
     return;
   }
 
-  uint8_t b1 = tcpClient.read();
+  uint8_t b1 = link().read();
   if (b1 == 0xFF)
   {
     Serial.write((uint8_t)0xFF);
@@ -116,7 +158,7 @@ void handleTelnetControlCode()
   Serial.print(b1);
   Serial.print(",");
 #endif
-  if (!tcpClient.available())
+  if (!link().available())
   {
 #ifdef DEBUG
     Serial.print("s");
@@ -124,7 +166,7 @@ void handleTelnetControlCode()
     return;
   }
 
-  uint8_t b2 = tcpClient.read();
+  uint8_t b2 = link().read();
 #ifdef DEBUG
   Serial.print(b2);
   Serial.flush();
@@ -132,15 +174,15 @@ void handleTelnetControlCode()
 
   if (b1 == DO)
   {
-    tcpClient.write((uint8_t)0xFF);
-    tcpClient.write((uint8_t)WONT);
-    tcpClient.write(b2);
+    link().write((uint8_t)0xFF);
+    link().write((uint8_t)WONT);
+    link().write(b2);
   }
   else if (b1 == WILL)
   {
-    tcpClient.write((uint8_t)0xFF);
-    tcpClient.write((uint8_t)DO);
-    tcpClient.write(b2);
+    link().write((uint8_t)0xFF);
+    link().write((uint8_t)DO);
+    link().write(b2);
   }
 
 #ifdef DEBUG
@@ -148,11 +190,37 @@ void handleTelnetControlCode()
 #endif
 }
 
+// Decoded data on its way to the terminal
+static void toTerminal(const uint8_t *buf, size_t len)
+{
+  if (ansiFilter.mode() != ANSI_OFF)
+    ansiFilter.write(buf, len);
+  else
+    Serial.write(buf, len);
+}
+
 void tcpToTerminal()
 {
-  while (tcpClient.available() && txPaused == false)
+  if (link().available() > 0)
+    latencyReceived();
+
+  // Nothing needs to see the bytes one at a time, so move them in blocks
+  while (!telnet && !xmodemInProgress && !waitingForXmodemResponse && txPaused == false)
   {
-    uint8_t rxByte = tcpClient.read();
+    int avail = link().available();
+    if (avail <= 0)
+      break;
+    int len = link().read(rxBuf, avail < RX_BUF_SIZE ? avail : RX_BUF_SIZE);
+    if (len <= 0)
+      break;
+    size_t out = rxDecoder.convert(rxBuf, len, rxBuf);
+    toTerminal(rxBuf, out);
+    yield();
+  }
+
+  while (link().available() && txPaused == false)
+  {
+    uint8_t rxByte = link().read();
 
     // If already in XMODEM transfer, process through XModem
     if (xmodemInProgress)
@@ -182,7 +250,7 @@ void tcpToTerminal()
 
         // Determine mode based on what we sent and block type
         XModemMode mode = (rxByte == XModem::STX) ? XMODEM_1K : XMODEM_CRC;
-        xmodem = new XModem(tcpClient, Serial, mode);
+        xmodem = new XModem(link(), Serial, mode);
         xmodemInProgress = true;
         waitingForXmodemResponse = false;
 
@@ -202,19 +270,38 @@ void tcpToTerminal()
     {
       handleTelnetControlCode();
     }
-    else
+    else if (rxDecoder.convert(&rxByte, 1, &rxByte))
     {
-      Serial.write(rxByte);
+      toTerminal(&rxByte, 1);
     }
 
     yield();
   }
 
+  ansiFilter.flush();
   Serial.flush();
   yield();
   handleFlowControl();
 }
 
+// Counts "+++" for handleEscapeSequence() in data that is not otherwise
+// looked at, such as PPP frames
+void trackEscape(const uint8_t *buf, size_t len)
+{
+  for (size_t i = 0; i < len; ++i)
+  {
+    if (buf[i] == '+')
+    {
+      if (++plusCount == 3)
+        plusTime = millis();
+    }
+    else
+    {
+      plusCount = 0;
+    }
+  }
+}
+
 void handleEscapeSequence()
 {
   if (plusCount >= 3)
@@ -239,6 +326,23 @@ void handleConnectedMode()
   }
 #endif
   
+#ifdef PPP_ENABLED
+  // PPP and SLIP frames go straight between the UART and lwIP
+  if (ppp || slipActive)
+  {
+    handlePPPData();
+    handleEscapeSequence();
+    return;
+  }
+#endif
+
+  if (charsetSession != connectTime)
+  {
+    charsetSession = connectTime;
+    rxDecoder.begin(termCharset);
+    ansiFilter.begin(termAnsi, termRows, termCols);
+  }
+
   terminalToTcp();
   tcpToTerminal();
   handleEscapeSequence();
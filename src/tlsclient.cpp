@@ -0,0 +1,405 @@
+#ifdef ESP32
+#include "tlsclient.h"
+#include "globals.h"
+#include "knownhosts.h"
+
+#include <mbedtls/ssl.h>
+#include <mbedtls/entropy.h>
+#include <mbedtls/ctr_drbg.h>
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/version.h>
+#include <mbedtls/md.h>
+#include <mbedtls/x509_crt.h>
+
+#if MBEDTLS_VERSION_MAJOR >= 3
+#define TLS_HS_STATE(ssl) ((ssl).MBEDTLS_PRIVATE(state))
+#else
+#define TLS_HS_STATE(ssl) ((ssl).state)
+#endif
+
+// Pinned certificates live in NVS in the format of knownhosts.h
+#define TLS_PREFS "tls"
+
+TlsStats tlsStats = {0, 0, 0, 0, false};
+
+struct TlsState
+{
+    mbedtls_ssl_context ssl;
+    mbedtls_ssl_config conf;
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_entropy_context entropy;
+};
+
+namespace
+{
+    struct CachedSession
+    {
+        String key;
+        mbedtls_ssl_session session;
+        bool valid;
+        unsigned long used;
+    };
+
+    CachedSession sessionCache[TLS_SESSION_CACHE];
+
+    CachedSession *findSession(const String &key)
+    {
+        for (int i = 0; i < TLS_SESSION_CACHE; i++)
+        {
+            if (sessionCache[i].valid && sessionCache[i].key == key)
+                return &sessionCache[i];
+        }
+        return nullptr;
+    }
+
+    void dropSession(CachedSession *entry)
+    {
+        if (!entry || !entry->valid)
+            return;
+        mbedtls_ssl_session_free(&entry->session);
+        entry->valid = false;
+    }
+
+    // Reuses the entry for this host or evicts the least recently used one
+    void storeSession(const String &key, mbedtls_ssl_context *ssl)
+    {
+        CachedSession *entry = findSession(key);
+        if (!entry)
+        {
+            entry = &sessionCache[0];
+            for (int i = 0; i < TLS_SESSION_CACHE; i++)
+            {
+                if (!sessionCache[i].valid)
+                {
+                    entry = &sessionCache[i];
+                    break;
+                }
+                if (sessionCache[i].used < entry->used)
+                    entry = &sessionCache[i];
+            }
+        }
+        dropSession(entry);
+        mbedtls_ssl_session_init(&entry->session);
+        if (mbedtls_ssl_get_session(ssl, &entry->session) != 0)
+        {
+            mbedtls_ssl_session_free(&entry->session);
+            return;
+        }
+        entry->key = key;
+        entry->used = millis();
+        entry->valid = true;
+    }
+
+    int bioSend(void *ctx, const unsigned char *buf, size_t len)
+    {
+        WiFiClient *tcp = (WiFiClient *)ctx;
+        if (!tcp->connected())
+            return MBEDTLS_ERR_NET_CONN_RESET;
+        size_t n = tcp->write(buf, len);
+        return n > 0 ? (int)n : MBEDTLS_ERR_SSL_WANT_WRITE;
+    }
+
+    int bioRecv(void *ctx, unsigned char *buf, size_t len)
+    {
+        WiFiClient *tcp = (WiFiClient *)ctx;
+        int avail = tcp->available();
+        if (avail <= 0)
+            return tcp->connected() ? MBEDTLS_ERR_SSL_WANT_READ : MBEDTLS_ERR_NET_CONN_RESET;
+        int n = tcp->read(buf, (size_t)avail < len ? avail : len);
+        return n > 0 ? n : MBEDTLS_ERR_SSL_WANT_READ;
+    }
+}
+
+int TlsClient::connect(IPAddress ip, uint16_t port)
+{
+    return connect(ip.toString().c_str(), port);
+}
+
+int TlsClient::connect(IPAddress ip, uint16_t port, int32_t)
+{
+    return connect(ip, port);
+}
+
+int TlsClient::connect(const char *host, uint16_t port, int32_t)
+{
+    return connect(host, port);
+}
+
+int TlsClient::connect(const char *host, uint16_t port)
+{
+    stop();
+    error_ = "";
+    closed_ = false;
+    rxLen_ = rxPos_ = 0;
+    if (!tcp_.connect(host, port))
+        return fail("Cannot connect to " + String(host));
+    tcp_.setNoDelay(true);
+    if (!handshake(host, port))
+    {
+        stop();
+        return 0;
+    }
+    return 1;
+}
+
+bool TlsClient::handshake(const char *host, uint16_t port)
+{
+    state_ = new TlsState;
+    mbedtls_ssl_init(&state_->ssl);
+    mbedtls_ssl_config_init(&state_->conf);
+    mbedtls_ctr_drbg_init(&state_->drbg);
+    mbedtls_entropy_init(&state_->entropy);
+
+    static const char pers[] = "hermes-tls";
+    int ret = mbedtls_ctr_drbg_seed(&state_->drbg, mbedtls_entropy_func, &state_->entropy,
+                                    (const unsigned char *)pers, sizeof(pers) - 1);
+    if (ret == 0)
+        ret = mbedtls_ssl_config_defaults(&state_->conf, MBEDTLS_SSL_IS_CLIENT,
+                                          MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT);
+    if (ret != 0)
+        return fail("TLS setup failed", ret);
+    mbedtls_ssl_conf_authmode(&state_->conf, MBEDTLS_SSL_VERIFY_NONE);
+    mbedtls_ssl_conf_rng(&state_->conf, mbedtls_ctr_drbg_random, &state_->drbg);
+#ifdef MBEDTLS_SSL_SESSION_TICKETS
+    mbedtls_ssl_conf_session_tickets(&state_->conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+    ret = mbedtls_ssl_setup(&state_->ssl, &state_->conf);
+    if (ret == 0)
+        ret = mbedtls_ssl_set_hostname(&state_->ssl, host);
+    if (ret != 0)
+        return fail("TLS setup failed", ret);
+    mbedtls_ssl_set_bio(&state_->ssl, &tcp_, bioSend, bioRecv, NULL);
+
+    notice_ = "";
+    String key = String(host) + ":" + String(port);
+    CachedSession *cached = findSession(key);
+    if (cached && mbedtls_ssl_set_session(&state_->ssl, &cached->session) != 0)
+        dropSession(cached);
+
+    // Step through the handshake so a resumption can be told apart from a
+    // full handshake: only the full one reaches the server certificate.
+    bool sawCertificate = false;
+    unsigned long start = millis();
+    while (TLS_HS_STATE(state_->ssl) != MBEDTLS_SSL_HANDSHAKE_OVER)
+    {
+        ret = mbedtls_ssl_handshake_step(&state_->ssl);
+        if (TLS_HS_STATE(state_->ssl) == MBEDTLS_SSL_SERVER_CERTIFICATE)
+            sawCertificate = true;
+        if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE)
+        {
+            if (millis() - start > TLS_TIMEOUT)
+                return fail("TLS handshake timeout");
+            delay(1);
+            continue;
+        }
+        if (ret != 0)
+        {
+            dropSession(findSession(key));
+            return fail("TLS handshake failed", ret);
+        }
+    }
+    handshakeMs_ = millis() - start;
+    resumed_ = cached && !sawCertificate;
+
+    // A resumed session was pinned when it was first negotiated
+    if (!resumed_ && !verifyPin(key))
+    {
+        dropSession(findSession(key));
+        return false;
+    }
+
+    tlsStats.handshakes++;
+    if (resumed_)
+        tlsStats.resumed++;
+    tlsStats.lastMs = handshakeMs_;
+    tlsStats.lastResumed = resumed_;
+
+    // Store after every handshake, since a server may issue a fresh ticket
+    // on resumption too
+    storeSession(key, &state_->ssl);
+    return true;
+}
+
+// Checks the server certificate against the pinned one. An unknown server
+// is trusted and remembered on first use, a changed certificate is refused.
+bool TlsClient::verifyPin(const String &hostPort)
+{
+    const mbedtls_x509_crt *cert = mbedtls_ssl_get_peer_cert(&state_->ssl);
+    if (!cert)
+        return fail("Cannot read the server certificate");
+    unsigned char hash[32];
+    if (mbedtls_md(mbedtls_md_info_from_type(MBEDTLS_MD_SHA256), cert->raw.p, cert->raw.len, hash) != 0)
+        return fail("Cannot hash the server certificate");
+    char hex[sizeof(hash) * 2 + 1];
+    for (size_t i = 0; i < sizeof(hash); i++)
+        snprintf(hex + i * 2, 3, "%02x", hash[i]);
+    String fingerprint = String("SHA256:") + hex;
+
+    String hosts = loadKnownHosts(TLS_PREFS);
+    String known = knownHostFingerprint(hosts, hostPort);
+    if (known.length())
+    {
+        if (known == fingerprint)
+            return true;
+        return fail("WARNING: the server certificate has changed!\r\n"
+                    "Known:  " + known + "\r\n"
+                    "Server: " + fingerprint + "\r\n"
+                    "If the change is expected, run AT$TLSFORGET=" + hostPort);
+    }
+
+    addKnownHost(hosts, hostPort, fingerprint);
+    saveKnownHosts(TLS_PREFS, hosts);
+    notice_ = "New certificate " + fingerprint + " saved for " + hostPort;
+    return true;
+}
+
+int TlsClient::fail(const String &msg, int ret)
+{
+    error_ = msg;
+    if (ret != 0)
+    {
+        char code[16];
+        snprintf(code, sizeof(code), " (-0x%04X)", -ret);
+        error_ += code;
+    }
+    tlsStats.failures++;
+    return 0;
+}
+
+// Decrypts the next chunk of application data into the receive buffer
+bool TlsClient::fill()
+{
+    if (rxPos_ < rxLen_)
+        return true;
+    if (!state_ || closed_)
+        return false;
+    rxPos_ = rxLen_ = 0;
+    int ret = mbedtls_ssl_read(&state_->ssl, rx_, sizeof(rx_));
+    if (ret > 0)
+    {
+        rxLen_ = ret;
+        return true;
+    }
+#ifdef MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET
+    if (ret == MBEDTLS_ERR_SSL_RECEIVED_NEW_SESSION_TICKET)
+        return false;
+#endif
+    if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE)
+        closed_ = true;
+    return false;
+}
+
+int TlsClient::available()
+{
+    if (!fill())
+        return 0;
+    return (rxLen_ - rxPos_) + mbedtls_ssl_get_bytes_avail(&state_->ssl);
+}
+
+int TlsClient::read()
+{
+    if (!fill())
+        return -1;
+    return rx_[rxPos_++];
+}
+
+int TlsClient::read(uint8_t *buf, size_t size)
+{
+    size_t n = 0;
+    while (n < size && fill())
+    {
+        size_t chunk = rxLen_ - rxPos_;
+        if (chunk > size - n)
+            chunk = size - n;
+        memcpy(buf + n, rx_ + rxPos_, chunk);
+        rxPos_ += chunk;
+        n += chunk;
+    }
+    return n > 0 ? (int)n : -1;
+}
+
+int TlsClient::peek()
+{
+    if (!fill())
+        return -1;
+    return rx_[rxPos_];
+}
+
+size_t TlsClient::write(uint8_t b)
+{
+    return write(&b, 1);
+}
+
+size_t TlsClient::write(const uint8_t *buf, size_t size)
+{
+    if (!state_ || closed_)
+        return 0;
+    size_t sent = 0;
+    unsigned long start = millis();
+    while (sent < size)
+    {
+        int ret = mbedtls_ssl_write(&state_->ssl, buf + sent, size - sent);
+        if (ret > 0)
+        {
+            sent += ret;
+            continue;
+        }
+        if ((ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) ||
+            millis() - start > TLS_TIMEOUT)
+        {
+            closed_ = true;
+            break;
+        }
+        delay(1);
+    }
+    return sent;
+}
+
+uint8_t TlsClient::connected()
+{
+    if (!state_)
+        return 0;
+    if (rxPos_ < rxLen_ || mbedtls_ssl_get_bytes_avail(&state_->ssl) > 0)
+        return 1;
+    return !closed_ && tcp_.connected();
+}
+
+void TlsClient::stop()
+{
+    if (state_)
+    {
+        if (!closed_ && tcp_.connected())
+            mbedtls_ssl_close_notify(&state_->ssl);
+        mbedtls_ssl_free(&state_->ssl);
+        mbedtls_ssl_config_free(&state_->conf);
+        mbedtls_ctr_drbg_free(&state_->drbg);
+        mbedtls_entropy_free(&state_->entropy);
+        delete state_;
+        state_ = nullptr;
+    }
+    tcp_.stop();
+    rxLen_ = rxPos_ = 0;
+}
+
+void tlsListKnownHosts()
+{
+    printKnownHosts(TLS_PREFS);
+    sendResult(RES_OK);
+}
+
+void tlsForgetHost(String hostPort)
+{
+    hostPort = knownHostKey(hostPort, TLS_KNOWN_HOSTS_PORT);
+    String hosts = loadKnownHosts(TLS_PREFS);
+    if (!removeKnownHost(hosts, hostPort))
+    {
+        sendResult(RES_ERROR);
+        return;
+    }
+    saveKnownHosts(TLS_PREFS, hosts);
+    // A cached session would otherwise skip the certificate next time
+    dropSession(findSession(hostPort));
+    sendResult(RES_OK);
+}
+
+#endif
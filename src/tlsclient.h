@@ -0,0 +1,87 @@
+#ifndef TLSCLIENT_H
+#define TLSCLIENT_H
+
+#ifdef ESP32
+#include <Arduino.h>
+#include <Client.h>
+#include <WiFi.h>
+
+// TLS over a WiFiClient using mbedtls directly, so negotiated sessions
+// (session IDs and tickets) can be kept per host:port and offered again on
+// the next connect. A resumed handshake skips the certificate exchange and
+// key agreement. The peers are hobbyist BBSes and download hosts that mostly
+// present self-signed certificates, so there is no CA check. Instead the
+// SHA-256 of the server certificate is pinned per host:port on first use,
+// like SSH known_hosts, and a changed certificate stops the connection.
+
+#define TLS_SESSION_CACHE 4
+#define TLS_RX_BUF 512
+#define TLS_TIMEOUT 15000
+
+struct TlsStats
+{
+    uint32_t handshakes;
+    uint32_t resumed;
+    uint32_t failures;
+    uint32_t lastMs;
+    bool lastResumed;
+};
+
+extern TlsStats tlsStats;
+
+struct TlsState;
+
+class TlsClient : public Client
+{
+public:
+    TlsClient() {}
+    ~TlsClient() { stop(); }
+
+    int connect(IPAddress ip, uint16_t port) override;
+    int connect(const char *host, uint16_t port) override;
+    int connect(IPAddress ip, uint16_t port, int32_t timeout);
+    int connect(const char *host, uint16_t port, int32_t timeout);
+    size_t write(uint8_t b) override;
+    size_t write(const uint8_t *buf, size_t size) override;
+    int available() override;
+    int read() override;
+    int read(uint8_t *buf, size_t size) override;
+    int peek() override;
+    void flush() override {}
+    void stop() override;
+    uint8_t connected() override;
+    operator bool() override { return connected(); }
+
+    void setNoDelay(bool nodelay) { tcp_.setNoDelay(nodelay); }
+    IPAddress remoteIP() { return tcp_.remoteIP(); }
+
+    unsigned long handshakeMs() const { return handshakeMs_; }
+    bool resumed() const { return resumed_; }
+    const String &lastError() const { return error_; }
+    // Set when the certificate was seen for the first time and pinned
+    const String &notice() const { return notice_; }
+
+private:
+    WiFiClient tcp_;
+    TlsState *state_ = nullptr;
+    uint8_t rx_[TLS_RX_BUF];
+    size_t rxLen_ = 0;
+    size_t rxPos_ = 0;
+    bool closed_ = false;
+    unsigned long handshakeMs_ = 0;
+    bool resumed_ = false;
+    String error_;
+    String notice_;
+
+    bool handshake(const char *host, uint16_t port);
+    bool verifyPin(const String &hostPort);
+    bool fill();
+    int fail(const String &msg, int ret = 0);
+};
+
+// AT$TLSHOSTS? and AT$TLSFORGET=
+void tlsListKnownHosts();
+void tlsForgetHost(String hostPort);
+
+#endif
+#endif
@@ -0,0 +1,349 @@
+#include <Arduino.h>
+#include "globals.h"
+#include "kermit.h"
+#include "xmodem.h"
+
+#include <SD.h>
+
+#ifdef ESP8266
+#define STREAM_BUF_SIZE 512
+#else
+#define STREAM_BUF_SIZE 2048
+#endif
+
+// File transfers between the SD card and the computer on the serial line.
+// The serial port is the data link while a transfer runs, so nothing else
+// may be printed until it completes.
+
+class FileSource : public XModemSource
+{
+public:
+    explicit FileSource(File &file) : file_(file) {}
+    int read(uint8_t *buf, size_t len) override
+    {
+        int n = file_.read(buf, len);
+        return n > 0 ? n : -1;
+    }
+
+private:
+    File &file_;
+};
+
+bool requireSDCard()
+{
+    if (isSDCardAvailable())
+        return true;
+    Serial.println();
+    Serial.println("\x1b[37;41m SD card not initialized \x1b[0m");
+    Serial.println("Run AT$SDINIT first");
+    sendResult(RES_ERROR);
+    return false;
+}
+
+void printTransferSummary(const String &verb, const String &name, size_t bytes, unsigned long ms)
+{
+    if (ms == 0)
+        ms = 1;
+    Serial.println();
+    Serial.print(verb);
+    Serial.print(" ");
+    Serial.print(name);
+    Serial.print(": ");
+    Serial.print(bytes);
+    Serial.print(" bytes in ");
+    Serial.print(ms / 1000.0, 1);
+    Serial.print(" s (");
+    Serial.print((unsigned long)((uint64_t)bytes * 1000 / ms));
+    Serial.println(" cps)");
+}
+
+// Rewrites one status line in place: bytes so far, percentage when the total
+// is known, and throughput.
+void printTransferProgress(size_t done, int32_t total, unsigned long ms)
+{
+    if (ms == 0)
+        ms = 1;
+    unsigned long bps = (unsigned long)((uint64_t)done * 1000 / ms);
+    Serial.print("\r");
+    Serial.print(done);
+    if (total > 0)
+    {
+        Serial.print(" of ");
+        Serial.print(total);
+        Serial.print(" bytes (");
+        Serial.print((unsigned long)((uint64_t)done * 100 / total));
+        Serial.print("%)");
+    }
+    else
+    {
+        Serial.print(" bytes");
+    }
+    Serial.print(", ");
+    Serial.print(bps / 1024.0, 1);
+    Serial.print(" KB/s   ");
+}
+
+// Any key typed on the terminal abandons a download
+static bool abortRequested()
+{
+    if (!Serial.available())
+        return false;
+    while (Serial.available())
+        Serial.read();
+    Serial.println();
+    Serial.println("Aborted");
+    return true;
+}
+
+// Saves everything src produces to /name on the SD card with a progress
+// line. Any key aborts. On failure the partial file is removed.
+bool receiveStreamToSD(XModemSource &src, const String &name, int32_t length)
+{
+    String path = "/" + name;
+    if (SD.exists(path))
+        SD.remove(path);
+    File file = SD.open(path, FILE_WRITE);
+    if (!file)
+    {
+        Serial.println("Cannot create " + path);
+        return false;
+    }
+
+    Serial.println("Saving to " + path + " (any key aborts)");
+    uint8_t *buf = new uint8_t[STREAM_BUF_SIZE];
+    size_t done = 0;
+    bool ok = true;
+    unsigned long start = millis();
+    unsigned long lastProgress = 0;
+    int n;
+    while ((n = src.read(buf, STREAM_BUF_SIZE)) >= 0)
+    {
+        if (abortRequested())
+        {
+            ok = false;
+            break;
+        }
+        if (n == 0)
+        {
+            yield();
+            continue;
+        }
+        if (file.write(buf, n) != (size_t)n)
+        {
+            Serial.println();
+            Serial.println("SD card write error");
+            ok = false;
+            break;
+        }
+        done += n;
+        if (millis() - lastProgress >= 500)
+        {
+            lastProgress = millis();
+            printTransferProgress(done, length, lastProgress - start);
+        }
+    }
+    delete[] buf;
+    file.close();
+    printTransferProgress(done, length, millis() - start);
+
+    if (ok && length >= 0 && done < (size_t)length)
+    {
+        Serial.println();
+        Serial.println("Connection closed early");
+        ok = false;
+    }
+    if (!ok)
+    {
+        SD.remove(path);
+        return false;
+    }
+    printTransferSummary("Saved", path, done, millis() - start);
+    return true;
+}
+
+// Sends what src produces to the computer as one XMODEM-1K file, or as a
+// single file YMODEM batch
+bool sendStreamToHost(XModemSource &src, const String &name, int32_t length, bool batch)
+{
+    Serial.print(batch ? "YMODEM" : "XMODEM-1K");
+    Serial.print(" send of ");
+    Serial.print(name);
+    if (length >= 0)
+    {
+        Serial.print(" (");
+        Serial.print(length);
+        Serial.print(" bytes)");
+    }
+    Serial.println(". Start receive on your computer now.");
+    Serial.flush();
+
+    XModemSender sender(Serial, batch);
+    unsigned long start = millis();
+    bool ok = sender.sendFile(src, name, length) && sender.endBatch();
+    unsigned long elapsed = millis() - start;
+
+    delay(500); // Let the host leave its transfer screen
+    if (!ok)
+    {
+        Serial.println();
+        Serial.print("Transfer failed: ");
+        Serial.println(sender.lastError());
+        return false;
+    }
+    printTransferSummary("Sent", name, sender.bytesSent(), elapsed);
+    return true;
+}
+
+void kermitReceiveToSD()
+{
+    if (!requireSDCard())
+        return;
+    Serial.println("Kermit receive to SD card. Start SEND on your computer now.");
+    Serial.flush();
+
+    Kermit kermit(Serial);
+    unsigned long start = millis();
+    bool ok = kermit.receive("/");
+    unsigned long elapsed = millis() - start;
+
+    delay(500); // Let the host Kermit return to its terminal
+    if (ok)
+    {
+        printTransferSummary("Received", kermit.fileName(), kermit.bytesTransferred(), elapsed);
+        Serial.print("Window ");
+        Serial.print(kermit.windowSize());
+        Serial.print(", packet length ");
+        Serial.println(kermit.packetLength());
+    }
+    else
+    {
+        Serial.println();
+        Serial.print("Kermit receive failed: ");
+        Serial.println(kermit.lastError());
+    }
+    sendResult(ok ? RES_OK : RES_ERROR);
+}
+
+void kermitSendFromSD(String path)
+{
+    path.trim();
+    if (path.length() == 0)
+    {
+        sendResult(RES_ERROR);
+        return;
+    }
+    if (!path.startsWith("/"))
+        path = "/" + path;
+    if (!requireSDCard())
+        return;
+    if (!SD.exists(path))
+    {
+        Serial.println("File not found: " + path);
+        sendResult(RES_ERROR);
+        return;
+    }
+    Serial.println("Kermit send of " + path + ". Start RECEIVE on your computer now.");
+    Serial.flush();
+
+    Kermit kermit(Serial);
+    unsigned long start = millis();
+    bool ok = kermit.send(path);
+    unsigned long elapsed = millis() - start;
+
+    delay(500);
+    if (ok)
+    {
+        printTransferSummary("Sent", kermit.fileName(), kermit.bytesTransferred(), elapsed);
+        Serial.print("Window ");
+        Serial.print(kermit.windowSize());
+        Serial.print(", packet length ");
+        Serial.print(kermit.packetLength());
+        Serial.print(", resent ");
+        Serial.println(kermit.packetsResent());
+    }
+    else
+    {
+        Serial.println();
+        Serial.print("Kermit send failed: ");
+        Serial.println(kermit.lastError());
+    }
+    sendResult(ok ? RES_OK : RES_ERROR);
+}
+
+// AT$SEND=FILE sends one file with XMODEM-1K, AT$SENDB=FILE1,FILE2,... sends
+// a YMODEM batch. Names may be separated by commas or spaces.
+void xmodemSendFromSD(String args, bool batch)
+{
+    String paths[8];
+    int count = 0;
+    args.replace(',', ' ');
+    args.trim();
+    while (args.length() > 0 && count < 8)
+    {
+        int sp = args.indexOf(' ');
+        String p = (sp < 0) ? args : args.substring(0, sp);
+        args = (sp < 0) ? "" : args.substring(sp + 1);
+        args.trim();
+        if (!p.startsWith("/"))
+            p = "/" + p;
+        paths[count++] = p;
+    }
+    if (count == 0 || (!batch && count > 1))
+    {
+        sendResult(RES_ERROR);
+        return;
+    }
+    if (!requireSDCard())
+        return;
+    for (int i = 0; i < count; i++)
+    {
+        if (!SD.exists(paths[i]))
+        {
+            Serial.println("File not found: " + paths[i]);
+            sendResult(RES_ERROR);
+            return;
+        }
+    }
+
+    Serial.print(batch ? "YMODEM batch send of " : "XMODEM-1K send of ");
+    Serial.print(count);
+    Serial.println(" file(s). Start receive on your computer now.");
+    Serial.flush();
+
+    XModemSender sender(Serial, batch);
+    unsigned long start = millis();
+    bool ok = true;
+    String names;
+    for (int i = 0; i < count && ok; i++)
+    {
+        File file = SD.open(paths[i], FILE_READ);
+        if (!file)
+        {
+            ok = false;
+            break;
+        }
+        String name = paths[i].substring(paths[i].lastIndexOf('/') + 1);
+        FileSource source(file);
+        ok = sender.sendFile(source, name, file.size());
+        file.close();
+        names += (i ? ", " : "") + name;
+    }
+    if (ok)
+        ok = sender.endBatch();
+    unsigned long elapsed = millis() - start;
+
+    delay(500); // Let the host leave its transfer screen
+    if (ok)
+    {
+        printTransferSummary("Sent", names, sender.bytesSent(), elapsed);
+        if (sender.blocksResent())
+            Serial.println("Blocks resent: " + String(sender.blocksResent()));
+    }
+    else
+    {
+        Serial.println();
+        Serial.print("Transfer failed: ");
+        Serial.println(sender.lastError());
+    }
+    sendResult(ok ? RES_OK : RES_ERROR);
+}
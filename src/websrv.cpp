@@ -2,6 +2,8 @@
 #include <ArduinoJson.h>
 #include "globals.h"
 #include "websrv.h"
+#include "ppp.h"
+#include "wifi.h"
 
 #ifdef ESP32
 #include <WebServer.h>
@@ -25,6 +27,10 @@ ESP8266WebServer webServer(80);
 
 void handleLoadEEPROM();
 void handleSaveEEPROM();
+void handleGetNat();
+void handleSaveNat();
+void handleAddForward();
+void handleRemoveForward();
 
 void handleWebServer()
 {
@@ -43,6 +49,10 @@ void webserverSetup()
   webServer.on("/api/commands/factory", handleFactoryDefaults);
   webServer.on("/api/commands/eeprom/load", handleLoadEEPROM);
   webServer.on("/api/commands/eeprom/save", handleSaveEEPROM);
+  webServer.on("/api/get/nat", handleGetNat);
+  webServer.on("/api/save/nat", handleSaveNat);
+  webServer.on("/api/commands/forward/add", handleAddForward);
+  webServer.on("/api/commands/forward/remove", handleRemoveForward);
   webServer.begin();
 }
 
@@ -55,7 +65,7 @@ void handleUpdateSettings()
     return;
   }
   String body = webServer.arg("plain");
-  StaticJsonDocument<256> doc;
+  StaticJsonDocument<1024> doc; // Room for the static address fields next to the strings
   DeserializationError error = deserializeJson(doc, body);
   if (error)
   {
@@ -68,6 +78,19 @@ void handleUpdateSettings()
   int s_serialSpeed = doc["serialSpeed"];
   int s_tcpServerPort = doc["tcpServerPort"];
   const char *s_busyMsg = doc["busyMsg"];
+  // Optional, for the static address: "d" for DHCP or "s" with the addresses
+  const char *s_ipType = doc["ipType"] | "";
+  IPAddress s_ip, s_mask, s_gateway, s_dns;
+  bool s_static = strcmp(s_ipType, "s") == 0;
+  if (s_static && (!s_ip.fromString(doc["staticIp"] | "") || !s_mask.fromString(doc["staticMask"] | "") ||
+                   !s_gateway.fromString(doc["staticGateway"] | "") || (uint32_t)s_ip == 0 || (uint32_t)s_mask == 0))
+  {
+    webServer.sendHeader("Access-Control-Allow-Origin", "*");
+    webServer.send(400, "application/json", "{\"error\":\"Invalid static IP address\"}");
+    return;
+  }
+  if (s_static && !s_dns.fromString(doc["staticDns"] | ""))
+    s_dns = s_gateway;
   const size_t baudCount = sizeof(bauds) / sizeof(bauds[0]);
   if (s_serialSpeed < 0 || static_cast<size_t>(s_serialSpeed) >= baudCount)
   {
@@ -81,11 +104,25 @@ void handleUpdateSettings()
     webServer.send(400, "application/json", "{\"error\":\"Invalid data\"}");
     return;
   }
+  if (ssid != s_ssid)
+    wifiChannel = 0; // The cached access point belongs to the old network
   ssid = String(s_ssid);
   password = String(s_password);
   serialspeed = static_cast<byte>(s_serialSpeed);
   tcpServerPort = s_tcpServerPort;
   busyMsg = String(s_busyMsg);
+  if (s_static)
+  {
+    staticIp = true;
+    staticAddress = s_ip;
+    staticMask = s_mask;
+    staticGateway = s_gateway;
+    staticDns = s_dns;
+  }
+  else if (strcmp(s_ipType, "d") == 0)
+  {
+    staticIp = false;
+  }
   Serial.println("Received new settings from web interface.");
   Serial.print("SSID: ");
   Serial.println(ssid);
@@ -96,6 +133,8 @@ void handleUpdateSettings()
   Serial.println(tcpServerPort);
   Serial.print("BUSY Message: ");
   Serial.println(busyMsg);
+  Serial.print("IP: ");
+  Serial.println(ipConfigString(staticIp, staticAddress, staticMask, staticGateway, staticDns));
   webServer.sendHeader("Access-Control-Allow-Origin", "*");
   webServer.send(200, "application/json", "{\"status\":\"success\"}");
 }
@@ -121,7 +160,7 @@ void handleFactoryDefaults()
 void handleGetSettings()
 {
   String json;
-  json.reserve(180);
+  json.reserve(300);
   json += "{";
   json += "\"echo\":\"" + String(echo) + "\",";
   json += "\"autoAnswer\":\"" + String(autoAnswer) + "\",";
@@ -134,7 +173,12 @@ void handleGetSettings()
   json += "\"verboseResults\":\"" + String(verboseResults) + "\",";
   json += "\"flowControl\":\"" + String(flowControl) + "\",";
   json += "\"pinPolarity\":\"" + String(pinPolarity) + "\",";
-  json += "\"quietMode\":\"" + String(quietMode) + "\"";
+  json += "\"quietMode\":\"" + String(quietMode) + "\",";
+  json += "\"ipType\":\"" + String(staticIp ? "s" : "d") + "\",";
+  json += "\"staticIp\":\"" + ipToString(staticAddress) + "\",";
+  json += "\"staticMask\":\"" + ipToString(staticMask) + "\",";
+  json += "\"staticGateway\":\"" + ipToString(staticGateway) + "\",";
+  json += "\"staticDns\":\"" + ipToString(staticDns) + "\"";
   json += "}";
   webServer.sendHeader("Access-Control-Allow-Origin", "*");
   webServer.send(200, "application/json", json);
@@ -148,7 +192,7 @@ void handleGetSpeedDials()
 void handleGetStatus()
 {
   String json;
-  json.reserve(220);
+  json.reserve(320);
   json += "{";
   json += "\"wifiStatus\":\"" + getWifiStatus() + "\",";
   json += "\"ssid\":\"" + WiFi.SSID() + "\",";
@@ -159,12 +203,138 @@ void handleGetStatus()
   json += "\"tcpServerPort\":\"" + String(tcpServerPort) + "\",";
   json += "\"callStatus\":\"" + getCallStatus() + "\",";
   json += "\"callLength\":\"" + getCallLength() + "\",";
-  json += "\"baud\":\"" + String(bauds[serialspeed]) + "\"";
+  json += "\"baud\":\"" + String(bauds[serialspeed]) + "\",";
+  json += "\"wifiSupervisor\":\"" + String(wifiSupervisorState()) + "\",";
+  json += "\"wifiReconnects\":\"" + String(wifiStats.reconnects) + "\",";
+  json += "\"wifiRoams\":\"" + String(wifiStats.roams) + "\",";
+  json += "\"wifiFailures\":\"" + String(wifiStats.failures) + "\",";
+  json += "\"wifiDownMs\":\"" + String(wifiStats.downMs) + "\",";
+  json += "\"wifiLastOutageMs\":\"" + String(wifiStats.lastOutageMs) + "\"";
   json += "}";
   webServer.sendHeader("Access-Control-Allow-Origin", "*");
   webServer.send(200, "application/json", json);
 }
 
+void handleGetNat()
+{
+  NatStats stats;
+  bool counted = getNatStats(stats);
+  String json;
+  json.reserve(300);
+  json += "{";
+  json += "\"tableSize\":\"" + String(natTableEntries()) + "\",";
+  if (counted)
+  {
+    json += "\"tcp\":\"" + String(stats.tcp) + "\",";
+    json += "\"udp\":\"" + String(stats.udp) + "\",";
+    json += "\"icmp\":\"" + String(stats.icmp) + "\",";
+    json += "\"evictions\":\"" + String(stats.evictions) + "\",";
+  }
+  json += "\"forwardTo\":\"" + ipToString(PPP_PEER_ADDRESS) + "\",";
+  json += "\"forwards\":[";
+  bool first = true;
+  for (const PortForward &fwd : portForwards)
+  {
+    if (fwd.proto == 0)
+      continue;
+    if (!first)
+      json += ",";
+    first = false;
+    json += "{\"proto\":\"" + String(forwardProtoName(fwd.proto)) + "\",";
+    json += "\"port\":\"" + String(fwd.port) + "\",";
+    json += "\"toPort\":\"" + String(fwd.toPort) + "\"}";
+  }
+  json += "]}";
+  webServer.sendHeader("Access-Control-Allow-Origin", "*");
+  webServer.send(200, "application/json", json);
+}
+
+// Reads the JSON body of a request, or answers 400 and returns false
+static bool readJsonBody(StaticJsonDocument<256> &doc)
+{
+  if (webServer.hasArg("plain") == false)
+  {
+    webServer.sendHeader("Access-Control-Allow-Origin", "*");
+    webServer.send(400, "application/json", "{\"error\":\"Body not received\"}");
+    return false;
+  }
+  if (deserializeJson(doc, webServer.arg("plain")))
+  {
+    webServer.sendHeader("Access-Control-Allow-Origin", "*");
+    webServer.send(400, "application/json", "{\"error\":\"Invalid JSON\"}");
+    return false;
+  }
+  return true;
+}
+
+static void sendInvalidData()
+{
+  webServer.sendHeader("Access-Control-Allow-Origin", "*");
+  webServer.send(400, "application/json", "{\"error\":\"Invalid data\"}");
+}
+
+static void sendSuccess()
+{
+  webServer.sendHeader("Access-Control-Allow-Origin", "*");
+  webServer.send(200, "application/json", "{\"status\":\"success\"}");
+}
+
+// {"tableSize":N}, used from the next boot once saved (ESP8266 only)
+void handleSaveNat()
+{
+  StaticJsonDocument<256> doc;
+  if (!readJsonBody(doc))
+    return;
+  int entries = doc["tableSize"];
+#ifdef ESP32
+  entries = 0; // Fixed by the core
+#endif
+  if (entries < NAPT_TABLE_MIN || entries > NAPT_TABLE_MAX)
+  {
+    sendInvalidData();
+    return;
+  }
+  naptTableSize = entries;
+  sendSuccess();
+}
+
+// {"proto":"TCP","port":2323,"toPort":23}, toPort defaults to port
+void handleAddForward()
+{
+  StaticJsonDocument<256> doc;
+  if (!readJsonBody(doc))
+    return;
+  const char *proto = doc["proto"];
+  long port = doc["port"];
+  long toPort = doc["toPort"] | port;
+  int kind = proto ? forwardProtoFromName(String(proto)) : -1;
+  if (kind < 0 || port < 1 || port > 65535 || toPort < 1 || toPort > 65535 || !addPortForward(kind, port, toPort))
+  {
+    sendInvalidData();
+    return;
+  }
+  refreshPortForwards();
+  sendSuccess();
+}
+
+// {"proto":"TCP","port":2323}
+void handleRemoveForward()
+{
+  StaticJsonDocument<256> doc;
+  if (!readJsonBody(doc))
+    return;
+  const char *proto = doc["proto"];
+  long port = doc["port"];
+  int kind = proto ? forwardProtoFromName(String(proto)) : -1;
+  if (kind < 0 || port < 1 || port > 65535 || !removePortForward(kind, port))
+  {
+    sendInvalidData();
+    return;
+  }
+  refreshPortForwards();
+  sendSuccess();
+}
+
 String getWifiStatus()
 {
   switch (WiFi.status())
@@ -203,6 +373,8 @@ String getCallStatus()
   if (callConnected)
   {
     #ifdef PPP_ENABLED
+    if (slipActive)
+      return "CONNECTED TO SLIP";
     return "CONNECTED TO " + String(ppp ? "PPP" : ipToString(tcpClient.remoteIP()));
     #endif
     #ifndef PPP_ENABLED
@@ -19,7 +19,7 @@ const char MAIN_page[] PROGMEM = R"=====(
         <title>Hermes Web Server</title>
     </head>
     <body>
-        <script>var bundle;!function(){var o={107:function(o){var e=function(o){var t=document.createElement("template");return e=t.content?function(o){return t.innerHTML=o,t.content}:function(o){return t.innerHTML=o,t},e(o)};o.exports=function(o){return e(o).firstChild}},306:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Ccircle cx=%2712%27 cy=%2712%27 r=%2710%27%3E%3C/circle%3E%3Cpolyline points=%2712 6 12 12 16 14%27%3E%3C/polyline%3E%3C/svg%3E"},343:function(o,e){var t,r,i;!function(){"use strict";r=[],void 0===(i="function"==typeof(t=function(){function o(o){return!isNaN(parseFloat(o))&&isFinite(o)}function e(o){return o.charAt(0).toUpperCase()+o.substring(1)}function t(o){return function(){return this[o]}}var r=["isConstructor","isEval","isNative","isToplevel"],i=["columnNumber","lineNumber"],n=["fileName","functionName","source"],a=["args"],c=["evalOrigin"],s=r.concat(i,n,a,c);function l(o){if(o)for(var t=0;t<s.length;t++)void 0!==o[s[t]]&&this["set"+e(s[t])](o[s[t]])}l.prototype={getArgs:function(){return this.args},setArgs:function(o){if("[object Array]"!==Object.prototype.toString.call(o))throw new TypeError("Args must be an Array");this.args=o},getEvalOrigin:function(){return this.evalOrigin},setEvalOrigin:function(o){if(o instanceof l)this.evalOrigin=o;else{if(!(o instanceof Object))throw new TypeError("Eval Origin must be an Object or StackFrame");this.evalOrigin=new l(o)}},toString:function(){var o=this.getFileName()||"",e=this.getLineNumber()||"",t=this.getColumnNumber()||"",r=this.getFunctionName()||"";return this.getIsEval()?o?"[eval] ("+o+":"+e+":"+t+")":"[eval]:"+e+":"+t:r?r+" ("+o+":"+e+":"+t+")":o+":"+e+":"+t}},l.fromString=function(o){var e=o.indexOf("("),t=o.lastIndexOf(")"),r=o.substring(0,e),i=o.substring(e+1,t).split(","),n=o.substring(t+1);if(0===n.indexOf("@"))var a=/@(.+?)(?::(\d+))?(?::(\d+))?$/.exec(n,""),c=a[1],s=a[2],p=a[3];return new l({functionName:r,args:i||void 0,fileName:c,lineNumber:s||void 0,columnNumber:p||void 0})};for(var p=0;p<r.length;p++)l.prototype["get"+e(r[p])]=t(r[p]),l.prototype["set"+e(r[p])]=function(o){return function(e){this[o]=Boolean(e)}}(r[p]);for(var d=0;d<i.length;d++)l.prototype["get"+e(i[d])]=t(i[d]),l.prototype["set"+e(i[d])]=function(e){return function(t){if(!o(t))throw new TypeError(e+" must be a Number");this[e]=Number(t)}}(i[d]);for(var u=0;u<n.length;u++)l.prototype["get"+e(n[u])]=t(n[u]),l.prototype["set"+e(n[u])]=function(o){return function(e){this[o]=String(e)}}(n[u]);return l})?t.apply(e,r):t)||(o.exports=i)}()},540:function(o){"use strict";o.exports=function(o){var e=document.createElement("style");return o.setAttributes(e,o.attributes),o.insert(e,o.options),e}},586:function(){window.Marko={Component:function(){}}},590:function(o){function e(){this.___lookup=Object.create(null)}e.prototype.___nextKey=function(o){var e=this.___lookup;return e[o]?o+"_"+e[o]++:(e[o]=1,o)},o.exports=e},851:function(o,e,t){o.exports=t(3774)},862:function(o,e,t){"use strict";var r=t(4263),i="undefined"!=typeof process&&"production",n=!i||"dev"===i||"development"===i,a="undefined"!=typeof process&&Boolean(process.env.SHOW_MODULE_COMPLAINS),c="undefined"!=typeof process&&Boolean(process.env.SHOW_NESTED_COMPLAINS),s="undefined"!=typeof console&&console.warn&&console,l="undefined"!=typeof process&&process.cwd&&process.cwd()+"/"||"",p="undefined"!=typeof process&&"win32"===process.platform?"\r\n":"\n",d=[].slice,u="[ignore]",b={};function m(){var o,e,t,i,n,s,f=arguments;if(!m.silence){"object"==typeof f[f.length-1]?(o=f[f.length-1],f=d.call(f,0,-1)):o={},s=o.level||2,n=o.heading||(2==s?"WARNING!!":"NOTICE"),i=o.headingColor||(2==s?m.colors.warning:m.colors.notice),t=null==o.locationIndex?1:o.locationIndex,!1===o.location&&(t=0),e=o.location||function(o){var e="",t=o+2;try{var i=r.parse(new Error).map(function(o){return o.fileName+":"+o.lineNumber+":"+o.columnNumber});if(!c)for(var n=i.length-1;n>t;n--)if(b[i[n]])return u;e=i[t]}catch(o){}return e}(t);var v=m.getModuleName(e);if(!v||a){if(e){if(b[e]||e===u)return;b[e]=!0}g=h(n,i);for(var _=0;_<f.length;_++)g+=p+h(f[_],m.colors.message);!1!==o.location&&e&&(g+=p+h("  at "+e.replace(l,""),m.colors.location)),m.log(p+g+p)}else if(!b[v]){var g=h("NOTICE",m.colors.notice);g+=p+h("The module ["+v+"] is using deprecated features.",m.colors.message),g+=p+h("Run with process.env.SHOW_MODULE_COMPLAINS=1 to see all warnings.",m.colors.message),m.log(p+g+p),b[v]=!0}}}function h(o,e){return e&&m.color?e+o+"[0m":o}function f(){}(m=n?m:f).method=n?function(o,e){var t=o[e],r=d.call(arguments,2);o[e]=function(){return m.apply(null,r),t.apply(this,arguments)}}:f,m.fn=n?function(o){var e=d.call(arguments,1);return function(){return m.apply(null,e),o.apply(this,arguments)}}:function(o){return o},m.log=function(o,e){var t=h(o,e);m.stream?m.stream.write(t+p):s&&s.warn(t)},m.stream="undefined"!=typeof process&&process.stderr,m.silence=!1,m.color=m.stream&&m.stream.isTTY,m.colors={warning:"[31;1m",notice:"[33;1m",message:!1,location:"[90m"},m.getModuleName=function(o){for(var e=o.replace(l,"").split(/\/|\\/g),t=e.length-1;t>=0;t--)if("node_modules"===e[t]){var r=e[t+1];return"@"===r[0]?r+"/"+e[t+2]:r}},o.exports?o.exports=m:window.complain=m},1031:function(o,e,t){var r=t(9508),i=t(9451);function n(o,e){this.___VNode(-1,e),this.___nodeValue=o}n.prototype={___nodeType:8,___actualize:function(o){var e=this.___nodeValue;return(o.ownerDocument||o).createComment(e)},___cloneNode:function(){return new n(this.___nodeValue)}},i(n,r),o.exports=n},1113:function(o){"use strict";o.exports=function(o,e){if(e.styleSheet)e.styleSheet.cssText=o;else{for(;e.firstChild;)e.removeChild(e.firstChild);e.appendChild(document.createTextNode(o))}}},1145:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%2842, 123, 111%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cpolyline points=%2720 6 9 17 4 12%27%3E%3C/polyline%3E%3C/svg%3E"},1197:function(o,e,t){"use strict";var r=t(8820),i=r.___componentLookup,n=r.___destroyNodeRecursive,a=r.___addComponentRootToKeyedElements,c=r.___normalizeComponentKey,s=t(5785),l=t(8899),p=t(590),d=t(6222).___VElement,u=t(7041),b=t(3448),m=t(6125),h=d.___virtualize,f=d.___morphAttrs,v=s.___keyByDOMNode,_=s.___componentByDOMNode,g=s.___vElementByDOMNode,y=s.___detachedByDOMNode,w=b.___insertBefore,k=b.___insertAfter,x=b.___nextSibling,C=b.___firstChild,N=b.___removeChild,E=u.___createFragmentNode,L=u.___beginFragmentNode;function S(o){return"@"!==o[0]}function M(o,e){return o.___nodeName===e.___nodeName}function z(o,e){return o.toLowerCase()===e.toLowerCase()}o.exports=function(o,e,t,r){var s,d=!1,u=Object.create(null);function b(o,e,i,n,a,c){var s=o.___actualize(t,n.namespaceURI);w(s,i,n),1!==o.___nodeType&&12!==o.___nodeType||(e&&(v.set(s,e),(S(e)?c:a).___keyedElements[e]=s),m(o.___nodeName)||U(s,o,c),function(o,e){1===o.nodeType&&l.___handleNodeAttach(o,e)}(s,r))}function D(o,e,t,r,i,n,s){var l=r.___rootNode=w(E(),e,t);_.set(l,r),i&&n&&(i=c(i,s.id),a(n.___keyedElements,i,l,r.id),v.set(l,i)),j(r,o)}function j(o,e){U(o.___rootNode,e,o)}r&&(s=r.___globalContext,d=s.___isHydrate);var O=[];function T(o,e,t){1===o.nodeType||12===o.nodeType?(O.push(o),y.set(o,t||!0)):(n(o),N(o))}function I(o){o.destroy()}function U(o,e,t){var r,n,l,m,f,O,P,$,B,R=C(o),V=e.___firstChild;o:for(;V;){f=V.___nextSibling,l=V.___nodeType,r=V.___key,R&&10===R.nodeType&&(R=x(R));var F,H=V.___ownerComponent||t;if(2!==l)if(r){$=void 0,n=void 0;var Y=r;if(S(r)?(H!==t&&(r+=":"+H.id),F=t):F=H,r=(u[F.id]||(u[F.id]=new p)).___nextKey(r),R&&(n=v.get(R),$=g.get(R),m=x(R)),n===r)V.___preserve||([[bundle]]&l===$.___nodeType&&(1!==l||M(V,$))?1===l?A(R,$,V,t):U(R,V,t):(T(R,0,H),b(V,r,R,o,H,t)));else if(void 0===(O=F.___keyedElements[r])||O===R){if(d&&R){if(1===R.nodeType&&(V.___preserve||z(R.nodeName,V.___nodeName||""))){($=h(R)).___nodeName=V.___nodeName,v.set(R,r),F.___keyedElements[r]=R,V.___preserve?g.set(R,$):A(R,$,V,t),V=f,R=m;continue}if(12===V.___nodeType&&8===R.nodeType&&R.nodeValue=="F#"+Y){for(var q,W=R.nextSibling,Q=0;;){if(8===W.nodeType)if("F/"===(q=W.nodeValue)){if(0===Q)break;Q--}else 0===q.indexOf("F#")&&Q++;W=W.nextSibling}var G=E(R,W.nextSibling,o);v.set(G,r),g.set(G,V),F.___keyedElements[r]=G,N(R),N(W),V.___preserve||U(G,V,t),V=f,R=G.nextSibling;continue}}b(V,r,R,o,H,t),m=R}else void 0!==y.get(O)&&y.set(O,void 0),V.___preserve?(w(O,R,o),m=R):($=g.get(O))&&l===$.___nodeType&&(1!==l||M($,V))?(m===O?f&&f.___key===n?(m=R,w(O,R,o)):(m=x(m),R&&T(R,0,H)):(k(O,R,o),R&&T(R,0,H)),1===l?A(O,$,V,t):U(O,V,t)):(b(V,r,R,o,H,t),T(O,0,H));V=f,R=m}else{for(;R;)if(m=x(R),B=_.get(R))R=m,s.___renderedComponentsById[B.id]||I(B);else{var K=R.nodeType,J=void 0;if(K===l)if(1===K){if(void 0===($=g.get(R))){if(!d){R=m;continue}z(($=h(R)).___nodeName,V.___nodeName)&&($.___nodeName=V.___nodeName)}else(n=$.___key)&&(J=!1);!0===(J=!1!==J&&!0===M($,V))&&A(R,$,V,t)}else if(3===K||8===K){J=!0;var Z=V.___nodeValue,X=R.nodeValue;X!==Z&&(d&&f&&3===K&&3===f.___nodeType&&X.startsWith(Z)&&X.slice(Z.length).startsWith(f.___nodeValue)?m=R.splitText(Z.length):R.nodeValue=Z)}if(!0===J){V=f,R=m;continue o}T(R,0,H),R=m}b(V,r,R,o,H,t),V=f,R=m}else{var oo=V.___component;if(void 0===(P=i[oo.id]))if(d){var eo=L(R,o);oo.___rootNode=eo,_.set(eo,oo),H&&r&&(r=c(r,t.id),a(H.___keyedElements,r,eo,oo.id),v.set(eo,r)),j(oo,V),R=x(eo)}else D(V,R,o,oo,r,H,t);else{if(P.___rootNode!==R){if(R&&(B=_.get(R))&&void 0===s.___renderedComponentsById[B.id]){R=x(B.___rootNode),I(B);continue}w(P.___rootNode,R,o)}else R=R&&x(R);V.___preserve||j(oo,V)}V=f}}if(o.___finishFragment)o.___finishFragment(R);else for(var to=12===o.nodeType?o.endNode:null;R&&R!==to;)m=x(R),(B=_.get(R))?(R=m,s.___renderedComponentsById[B.id]||I(B)):($=g.get(R),T(R,0,F=!(n=v.get(o))||S(n)?t:[[bundle]]&$.___ownerComponent),R=m)}function A(o,e,t,r){var i=t.___nodeName,n=t.___constId;g.set(o,t),void 0!==n&&e.___constId===n||(f(o,e,t),t.___preserveBody||(m(i)?t.___textContent!==e.___textContent&&("textarea"===i?o.value=t.___textContent:o.textContent=t.___textContent):U(o,t,r)))}U(o,e,e.___component),O.forEach(function(o){var e=y.get(o);if(void 0!==e){y.set(o,void 0);var t=_.get(o);t?t.destroy():o.parentNode&&(n(o,!0!==e&&e),0!=l.___handleNodeDetach(o)&&N(o))}})}},1601:function(o){"use strict";o.exports=function(o){return o[1]}},1677:function(o,e,t){o.exports=t(9871)},2191:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28149.5, 74, 80%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Ccircle cx=%2712%27 cy=%2712%27 r=%2710%27%3E%3C/circle%3E%3Cline x1=%2712%27 y1=%278%27 x2=%2712%27 y2=%2712%27%3E%3C/line%3E%3Cline x1=%2712%27 y1=%2716%27 x2=%2712.01%27 y2=%2716%27%3E%3C/line%3E%3C/svg%3E"},2261:function(o,e,t){var r=t(9451),i=t(9508);function n(o,e,t,r){this.___VNode(null,t),this.___key=e,this.___component=o,this.___preserve=r}n.prototype={___nodeType:2},r(n,i),o.exports=n},2263:function(o,e,t){var r=t(9451),i=t(9508);function n(o,e){this.___VNode(-1,e),this.___nodeValue=o}n.prototype={___Text:!0,___nodeType:3,___actualize:function(o){return(o.ownerDocument||o).createTextNode(this.___nodeValue)},___cloneNode:function(){return new n(this.___nodeValue)}},r(n,i),o.exports=n},2266:function(o,e,t){var r=t(8820).___nextComponentIdProvider;o.exports=function(o){this.___renderedComponentsById={},this.___rerenderComponent=void 0,this.___nextComponentId=r(o)}},2628:function(o){var e;o.exports="function"==typeof queueMicrotask?queueMicrotask:(e=Promise.resolve(),function(o){e.then(o)})},2821:function(o,e,t){var r=t(8798);function i(o){this.___component=o,this.___raw={},this.___dirty=!1,this.___old=null,this.___changes=null,this.___forced=null,Object.seal(this)}i.prototype={___reset:function(){this.___dirty=!1,this.___old=null,this.___changes=null,this.___forced=null},___replace:function(o){var e,t=this.___raw;for(e in t)e in o||this.___set(e,void 0,!1,!1);for(e in o)this.___set(e,o[e],!0,!1)},___set:function(o,e,t,i){var n,a,c=this.___raw;if(t&&(n=o,a=this.constructor.prototype,n in a||Object.defineProperty(a,n,{get:function(){return this.___raw[n]},set:function(o){this.___set(n,o,!1)}})),i)(this.___forced||(this.___forced={}))[o]=!0;else if(c[o]===e)return;this.___dirty||(this.___dirty=!0,this.___old=c,this.___raw=c=r({},c),this.___changes={},this.___component.___queueUpdate()),this.___changes[o]=e,void 0===e?delete c[o]:c[o]=e},toJSON:function(){return this.___raw}},o.exports=i},2933:function(o){"use strict";o.exports=function o(e){switch(typeof e){case"string":return e||void 0;case"object":var t="",r="";if(Array.isArray(e))for(var i=0,n=e.length;i<n;i++){var a=o(e[i]);a&&(t+=r+a,r=" ")}else for(var c in e)e[c]&&(t+=r+c,r=" ");return t||void 0}}},3084:function(o,e,t){"use strict";var r=t(862),i=t(2933),n=t(9836),a=t(107);o.exports=function(o){if("string"==typeof o)return r("Passing a string as a dynamic attribute value is deprecated - More details: https://github.com/marko-js/marko/wiki/Deprecation:-String-as-dynamic-attribute-value"),function(o){if(""===o)return{};for(var e,t=a("<a "+o+">").attributes,r={},i=t.length,n=0;n<i;n++)r[(e=t[n]).name]=e.value;return r}(o);if(o){var e={};for(var t in o){var c=o[t];"renderBody"!==t&&("class"===t?c=i(c):"style"===t&&(c=n(c)),e[t]=c)}return e}return o}},3448:function(o,e){function t(o,e,t){return o.insertInto?o.insertInto(t,e):t.insertBefore(o,e&&e.startNode||e)}e.___insertBefore=t,e.___insertAfter=function(o,e,r){return t(o,e&&e.nextSibling,r)},e.___nextSibling=function(o){var e=o.nextSibling,t=e&&e.fragment;return t?e===t.startNode?t:null:e},e.___firstChild=function(o){var e=o.firstChild;return e&&e.fragment||e},e.___removeChild=function(o){o.remove?o.remove():o.parentNode.removeChild(o)}},3503:function(o,e,t){var r=[],i=""+Math.random();window.addEventListener("message",function(o){if(o.data===i){var e=r;r=[];for(var t=0;t<e.length;t++)e[t]()}}),e.x=function(o){1===r.push(o)&&window.postMessage(i,"*")},t(2628)},3587:function(o,e,t){"use strict";var r,i=t(862),n=t(6764),a=t(9307),c=t(9451),s=t(8820),l=s.___componentLookup,p=s.___destroyNodeRecursive,d=t(5703),u=t(8229),b=t(3738),m=t(1197),h=t(4515).___getComponentsContext,f=t(5785),v=t(8899),_=t(5793),g=f.___componentByDOMNode,y=f.___ssrKeyedElementsByComponentId,w="__subtree_context__",k=Object.prototype.hasOwnProperty,x=Array.prototype.slice,C={addDestroyListener:!1},N=n.prototype.emit;function E(o){o()}function L(o){for(var e;o&&(e=o.firstChild);)o=e.fragment;return e}function S(o,e){return e?o+"_"+e:o}function M(o){n.call(this),this.id=o,this.___state=null,this.___rootNode=null,this.___subscriptions=null,this.___domEventListenerHandles=null,this.___bubblingDomEvents=null,this.___customEvents=null,this.___scope=null,this.___renderInput=null,this.___input=void 0,this.___mounted=!1,this.___global=void 0,this.___destroyed=!1,this.___updateQueued=!1,this.___dirty=!1,this.___settingInput=!1,this.___host=void 0;var e=y[o];e?(this.___keyedElements=e,delete y[o]):this.___keyedElements={}}M.prototype=r={___isComponent:!0,subscribeTo:function(o){if(!o)throw TypeError();var e=this.___subscriptions||(this.___subscriptions=new a),t=o.___isComponent?undefined:C;return e.subscribeTo(o,t)},emit:function(o){var e,t=this.___customEvents;if(t&&(e=t[o])){var r=e[0],i=e[1],n=e[2];!function(o,e,t,r){t.push(o),r&&(t=r.concat(t));var i=l[o.___scope],n="function"==typeof e?e:i[e];if(!n)throw Error("Method not found: "+e);n.apply(i,t)}(this,r,x.call(arguments,1),n),i&&delete t[o]}return N.apply(this,arguments)},getElId:function(o,e){return o?function(o,e,t){return o.id+"-"+S(e,t)}(this,o,e):this.id},getEl:function(o,e){if(o){var t=S(o,e),r=this.___keyedElements["@"+t];return r&&12===r.nodeType?(i("Accessing the elements of a child component using 'component.getEl' is deprecated."),L(r)):r}return this.el},getEls:function(o){o+="[]";for(var e,t=[],r=0;e=this.getEl(o,r);)t.push(e),r++;return t},getComponent:function(o,e){var t=this.___keyedElements["@"+S(o,e)];return/\[\]$/.test(o)&&(i("A repeated key[] was passed to getComponent. Use a non-repeating key if there is only one of these components."),t=t&&t[Object.keys(t)[0]]),t&&g.get(t)},getComponents:function(o){var e=this.___keyedElements["@"+o+"[]"];return e?Object.keys(e).map(function(o){return g.get(e[o])}).filter(Boolean):[]},destroy:function(){if(!this.___destroyed){var o=this.___rootNode;this.___destroyShallow(),o.nodes.forEach(function(o){p(o),!1!==v.___handleNodeDetach(o)&&o.parentNode.removeChild(o)}),o.detached=!0,delete l[this.id],this.___keyedElements={}}},___destroyShallow:function(){if(!this.___destroyed){this.___emitDestroy(),this.___destroyed=!0,g.set(this.___rootNode,void 0),this.___rootNode=null,this.___removeDOMEventListeners();var o=this.___subscriptions;o&&(o.removeAllListeners(),this.___subscriptions=null)}},isDestroyed:function(){return this.___destroyed},get state(){return this.___state},set state(o){var e=this.___state;(e||o)&&(e||(e=this.___state=new this.___State(this)),e.___replace(o||{}),e.___dirty&&this.___queueUpdate(),o||(this.___state=null))},setState:function(o,e){var t=this.___state;if(t||(t=this.___state=new this.___State(this)),"object"==typeof o){var r=o;for(var i in r)k.call(r,i)&&t.___set(i,r[i],!0)}else t.___set(o,e,!0)},setStateDirty:function(o,e){var t=this.___state;1==arguments.length&&(e=t[o]),t.___set(o,e,!0,!0)},replaceState:function(o){this.___state.___replace(o)},get input(){return this.___input},set input(o){this.___settingInput?this.___input=o:this.___setInput(o)},___setInput:function(o,e,t){var r;e=e||this.onInput;var i=this.___input;return this.___input=void 0,this.___context=t&&t[w]||this.___context,e&&(this.___settingInput=!0,r=e.call(this,o||{},t),this.___settingInput=!1),o=this.___renderInput=r||o,(this.___dirty=function(o,e,t){if(e!=t){if(null==e||null==t)return!0;var r=Object.keys(e),i=Object.keys(t),n=r.length;if(n!==i.length)return!0;for(var a=n;a--;){var c=r[a];if(!(c in t)||e[c]!==t[c])return!0}}return!1}(0,i,o))&&this.___queueUpdate(),void 0===this.___input&&(this.___input=o,o&&o.$global&&(this.___global=o.$global)),o},forceUpdate:function(){this.___dirty=!0,this.___queueUpdate()},___queueUpdate:function(){this.___updateQueued||(this.___updateQueued=!0,_.___queueComponentUpdate(this))},update:function(){if(!0!==this.___destroyed&&!1!==this.___isDirty){var o=this.___input,e=this.___state;!1===this.___dirty&&null!==e&&!0===e.___dirty&&function(o,e,t){var r,i;for(var n in e)if(k.call(e,n)){if(!(r=o["update_"+n]))return;(i||(i=[])).push([n,r])}return i&&(i.forEach(function(i){var n=i[0];r=i[1];var a=e[n],c=t[n];r.call(o,a,c)}),o.___emitUpdate(),o.___reset()),!0}(this,e.___changes,e.___old)&&(e.___dirty=!1),!0===this.___isDirty&&!1!==this.shouldUpdate(o,e)&&this.___scheduleRerender(),this.___reset()}},get ___isDirty(){return!0===this.___dirty||null!==this.___state&&!0===this.___state.___dirty},___reset:function(){this.___dirty=!1,this.___updateQueued=!1,this.___renderInput=null;var o=this.___state;o&&o.___reset()},shouldUpdate:function(){return!0},___scheduleRerender:function(){var o=this;if(!o.___renderer)throw TypeError();var e=this.___renderInput||this.___input;_.___batchUpdate(function(){o.___rerender(e,!1).afterInsert(o.___host)}),this.___reset()},___rerender:function(o,e){var t=this.___host,r=this.___global,i=this.___rootNode,n=this.___renderer,a=(n.createOut||d)(r);a.sync(),a.___host=this.___host,a[w]=this.___context;var c=h(a),s=c.___globalContext;s.___rerenderComponent=this,s.___isHydrate=e,n(o,a);var l=new b(a),p=a.___getOutput().___firstChild;return m(i,p,t,c),l},___detach:function(){var o=this.___rootNode;return o.remove(),o},___removeDOMEventListeners:function(){var o=this.___domEventListenerHandles;o&&(o.forEach(E),this.___domEventListenerHandles=null)},get ___rawState(){var o=this.___state;return o&&o.___raw},___setCustomEvents:function(o,e){var t=this.___customEvents={};this.___scope=e,o.forEach(function(o){var e=o[0],r=o[1],i=o[2],n=o[3];r&&(t[e]=[r,i,n])})},get el(){return L(this.___rootNode)},get els(){return i('The "this.els" attribute is deprecated. Please use "this.getEls(key)" instead.'),(this.___rootNode?this.___rootNode.nodes:[]).filter(function(o){return 1===o.nodeType})},___emit:N,___emitCreate(o,e){this.onCreate&&this.onCreate(o,e),this.___emit("create",o,e)},___emitRender(o){this.onRender&&this.onRender(o),this.___emit("render",o)},___emitUpdate(){this.onUpdate&&this.onUpdate(),this.___emit("update")},___emitMount(){this.onMount&&this.onMount(),this.___emit("mount")},___emitDestroy(){this.onDestroy&&this.onDestroy(),this.___emit("destroy")}},r.elId=r.getElId,r.___update=r.update,r.___destroy=r.destroy,u(r,function(o){return o.___detach()},function(o){return o}),c(M,n),o.exports=M},3684:function(o){"use strict";o.exports=function(o,e,t,r,i,n){t.c(r,i,n),(o._||(o._=o.render||o.renderer||o))(e,t),t.___assignedComponentDef=null}},3738:function(o,e,t){var r=t(8229),i=t(862);function n(o){for(var e=o;e.parentNode;)e=e.parentNode;return e}function a(o){this.out=this.___out=o,this.___components=void 0}o.exports=a;var c=a.prototype={getComponent:function(){return this.getComponents()[0]},getComponents:function(o){if(void 0===this.___components)throw Error("Not added to DOM");var e=function(o){var e=o.___components;if(!e)throw Error("No component");return e}(this),t=[];return e.forEach(function(e){var r=e.___component;o&&!o(r)||t.push(r)}),t},afterInsert:function(o){var e=this.___out.___components;return this.___components=e?e.___initComponents(o):null,this},getNode:function(o){return this.___out.___getNode(o)},getOutput:function(){return this.___out.___getOutput()},toString:function(){return this.___out.toString()},document:"object"==typeof document&&document};Object.defineProperty(c,"html",{get:function(){return i('The "html" property is deprecated. Please use "toString" instead.'),this.toString()}}),Object.defineProperty(c,"context",{get:function(){return i('The "context" property is deprecated. Please use "out" instead.'),this.___out}}),r(c,function(o,e){return o.getNode(n(e))},function(o,e){return o.afterInsert(n(e))})},3757:function(o,e,t){var r=t(7785),i=t(9008),n=t(9684),a=t(9871),c=t(8820),s=c.___componentLookup,l=t(4515),p=l.___getComponentsContext,d=!0===c.___isServer;function u(o,e){return"#"===o[0]?o.substring(1):e.id+"-"+e.___nextKey(o)}function b(o){o.isSync()||o.global.$wa||(o.on("beginAsync",m),o.on("beginDetachedAsync",h),o.global.$wa=!0)}function m(o){var e=o.parentOut,t=o.out,r=e.___components;void 0!==r&&(t.___components=new l(t,r)),t.c(e.___assignedComponentDef,e.___assignedKey,e.___assignedCustomEvents)}function h(o){var e=o.out;m(o),e.on("beginAsync",m),e.on("beginDetachedAsync",h)}function f(o,e,t){var c=t&&t.onInput,l=e.t,m=!0===e.s,h=!0===e.i,f=t&&m;if(!e.d)throw new Error("Component was compiled in a different NODE_ENV than the Marko runtime is using.");return function(e,v){b(v);var _,g,y,w=p(v),k=w.___globalContext,x=k.___rerenderComponent,C=void 0!==x,N=w.___componentDef,E=v.___assignedComponentDef,L=E&&E.id,S=v.___assignedKey;if(x?(_=x.id,g=!0,k.___rerenderComponent=null):N?(y=v.___assignedCustomEvents,_=null!=S?u(S.toString(),N):N.___nextComponentId()):_=k.___nextComponentId(),d)e=(x=a.___createComponent(t,_,e,v,l,y,L)).___updatedInput;else{if(!x){if(C&&(x=s[_])&&x.___type!==l&&(x.destroy(),x=void 0),x)g=!0;else if(g=!1,x=a.___createComponent(l,_),!0===f){f=!1;var M="function"==typeof t?t.prototype:t;r(M,x.constructor.prototype)}if(x.___updateQueued=!0,y&&x.___setCustomEvents(y,L),!1===g&&x.___emitCreate(e,v),e=x.___setInput(e,c,v),!0===g&&(!1===x.___isDirty||!1===x.shouldUpdate(e,x.___state)))return v.___preserveComponent(x),k.___renderedComponentsById[_]=!0,void x.___reset()}x.___global=v.global,x.___emitRender(v)}var z=i(w,x,S,E,m,h);z.___isExisting=g,o(e,v,z,x,x.___rawState,v.global),n(v,z),w.___componentDef=N}}o.exports=f,f.___resolveComponentKey=u,f.___trackAsyncComponents=b},3774:function(o,e){var t=window;e.NOOP=t.$W10NOOP=t.$W10NOOP||function(){}},4263:function(o,e,t){var r,i,n;!function(){"use strict";i=[t(343)],void 0===(n="function"==typeof(r=function(o){var e=/(^|@)\S+:\d+/,t=/^\s*at .*(\S+:\d+|\(native\))/m,r=/^(eval@)?(\[native code])?$/;return{parse:function(o){if(void 0!==o.stacktrace||void 0!==o["opera#sourceloc"])return this.parseOpera(o);if(o.stack&&o.stack.match(t))return this.parseV8OrIE(o);if(o.stack)return this.parseFFOrSafari(o);throw new Error("Cannot parse given Error object")},extractLocation:function(o){if(-1===o.indexOf(":"))return[o];var e=/(.+?)(?::(\d+))?(?::(\d+))?$/.exec(o.replace(/[()]/g,""));return[e[1],e[2]||void 0,e[3]||void 0]},parseV8OrIE:function(e){return e.stack.split("\n").filter(function(o){return!!o.match(t)},this).map(function(e){e.indexOf("(eval ")>-1&&(e=e.replace(/eval code/g,"eval").replace(/(\(eval at [^()]*)|(,.*$)/g,""));var t=e.replace(/^\s+/,"").replace(/\(eval code/g,"(").replace(/^.*?\s+/,""),r=t.match(/ (\(.+\)$)/);t=r?t.replace(r[0],""):t;var i=this.extractLocation(r?r[1]:t),n=r&&t||void 0,a=["eval","<anonymous>"].indexOf(i[0])>-1?void 0:i[0];return new o({functionName:n,fileName:a,lineNumber:i[1],columnNumber:i[2],source:e})},this)},parseFFOrSafari:function(e){return e.stack.split("\n").filter(function(o){return!o.match(r)},this).map(function(e){if(e.indexOf(" > eval")>-1&&(e=e.replace(/ line (\d+)(?: > eval line \d+)* > eval:\d+:\d+/g,":$1")),-1===e.indexOf("@")&&-1===e.indexOf(":"))return new o({functionName:e});var t=/((.*".+"[^@]*)?[^@]*)(?:@)/,r=e.match(t),i=r&&r[1]?r[1]:void 0,n=this.extractLocation(e.replace(t,""));return new o({functionName:i,fileName:n[0],lineNumber:n[1],columnNumber:n[2],source:e})},this)},parseOpera:function(o){return!o.stacktrace||o.message.indexOf("\n")>-1&&o.message.split("\n").length>o.stacktrace.split("\n").length?this.parseOpera9(o):o.stack?this.parseOpera11(o):this.parseOpera10(o)},parseOpera9:function(e){for(var t=/Line (\d+).*script (?:in )?(\S+)/i,r=e.message.split("\n"),i=[],n=2,a=r.length;n<a;n+=2){var c=t.exec(r[n]);c&&i.push(new o({fileName:c[2],lineNumber:c[1],source:r[n]}))}return i},parseOpera10:function(e){for(var t=/Line (\d+).*script (?:in )?(\S+)(?:: In function (\S+))?$/i,r=e.stacktrace.split("\n"),i=[],n=0,a=r.length;n<a;n+=2){var c=t.exec(r[n]);c&&i.push(new o({functionName:c[3]||void 0,fileName:c[2],lineNumber:c[1],source:r[n]}))}return i},parseOpera11:function(t){return t.stack.split("\n").filter(function(o){return!!o.match(e)&&!o.match(/^Error created at/)},this).map(function(e){var t,r=e.split("@"),i=this.extractLocation(r.pop()),n=r.shift()||"",a=n.replace(/<anonymous function(: (\w+))?>/,"$2").replace(/\([^)]*\)/g,"")||void 0;n.match(/\(([^)]*)\)/)&&(t=n.replace(/^[^(]+\(([^)]*)\)$/,"$1"));var c=void 0===t||"[arguments not available]"===t?void 0:t.split(",");return new o({functionName:a,args:c,fileName:i[0],lineNumber:i[1],columnNumber:i[2],source:e})},this)}}})?r.apply(e,i):r)||(o.exports=n)}()},4417:function(o){"use strict";o.exports=function(o,e){return e||(e={}),o?(o=String(o.__esModule?o.default:o),/^['"].*['"]$/.test(o)&&(o=o.slice(1,-1)),e.hash&&(o+=e.hash),/["'() \t\n]|(%20)/.test(o)||e.needQuotes?'"'.concat(o.replace(/"/g,'\\"').replace(/\n/g,"\\n"),'"'):o):o}},4515:function(o,e,t){"use strict";var r=t(2266);function i(o,e){var t,i,n;e?(t=e.___globalContext,i=e.___componentDef,(n=e.___nestedContexts)||(n=e.___nestedContexts=[]),n.push(this)):void 0===(t=o.global.___components)&&(o.global.___components=t=new r(o));this.___globalContext=t,this.___components=[],this.___out=o,this.___componentDef=i,this.___nestedContexts=void 0,this.___isPreserved=e&&e.___isPreserved}i.prototype={___initComponents:function(o){var e=this.___components;return i.___initClientRendered(e,o),this.___out.emit("___componentsInitialized"),this.___out.global.___components=void 0,e}},o.exports=e=i,e.___getComponentsContext=function(o){return o.___components||(o.___components=new i(o))}},4585:function(o,e){"use strict";var t=Object.create(null),r=Object.create(null);function i(o,e){return e.toUpperCase()}e.___camelToDashCase=function(o){var e=t[o];return e||(e=t[o]=o.replace(/([A-Z])/g,"-$1").toLowerCase())!==o&&(r[e]=o),e},e.___dashToCamelCase=function(o){var e=r[o];return e||(e=r[o]=o.replace(/-([a-z])/g,i))!==o&&(t[e]=o),e}},5007:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28200.25, 79.25, 72.25%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Ccircle cx=%2712%27 cy=%2712%27 r=%2710%27%3E%3C/circle%3E%3Cline x1=%2712%27 y1=%278%27 x2=%2712%27 y2=%2712%27%3E%3C/line%3E%3Cline x1=%2712%27 y1=%2716%27 x2=%2712.01%27 y2=%2716%27%3E%3C/line%3E%3C/svg%3E"},5056:function(o,e,t){"use strict";o.exports=function(o){var e=t.nc;e&&o.setAttribute("nonce",e)}},5072:function(o){"use strict";var e=[];function t(o){for(var t=-1,r=0;r<e.length;r++)if(e[r].identifier===o){t=r;break}return t}function r(o,r){for(var n={},a=[],c=0;c<o.length;c++){var s=o[c],l=r.base?s[0]+r.base:s[0],p=n[l]||0,d="".concat(l," ").concat(p);n[l]=p+1;var u=t(d),b={css:s[1],media:s[2],sourceMap:s[3],supports:s[4],layer:s[5]};if(-1!==u)e[u].references++,e[u].updater(b);else{var m=i(b,r);r.byIndex=c,e.splice(c,0,{identifier:d,updater:m,references:1})}a.push(d)}return a}function i(o,e){var t=e.domAPI(e);t.update(o);return function(e){if(e){if(e.css===o.css&&e.media===o.media&&e.sourceMap===o.sourceMap&&e.supports===o.supports&&e.layer===o.layer)return;t.update(o=e)}else t.remove()}}o.exports=function(o,i){var n=r(o=o||[],i=i||{});return function(o){o=o||[];for(var a=0;a<n.length;a++){var c=t(n[a]);e[c].references--}for(var s=r(o,i),l=0;l<n.length;l++){var p=t(n[l]);0===e[p].references&&(e[p].updater(),e.splice(p,1))}n=s}}},5328:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%271.5%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Ccircle cx=%2711%27 cy=%2711%27 r=%278%27%3E%3C/circle%3E%3Cline x1=%2721%27 y1=%2721%27 x2=%2716.65%27 y2=%2716.65%27%3E%3C/line%3E%3C/svg%3E"},5703:function(o){var e;function t(o){return e(o)}t.___setCreateOut=function(o){e=o},o.exports=t},5785:function(o){o.exports={___vPropsByDOMNode:new WeakMap,___vElementByDOMNode:new WeakMap,___componentByDOMNode:new WeakMap,___detachedByDOMNode:new WeakMap,___keyByDOMNode:new WeakMap,___ssrKeyedElementsByComponentId:{}}},5793:function(o,e,t){"use strict";var r=!1,i=[],n=[],a=t(3503).x;function c(){if(n.length)try{s(n)}finally{r=!1}}function s(o){for(var e=0;e<o.length;e++){o[e].___update()}o.length=0}e.___queueComponentUpdate=function(o){var e=i.length;e?i[e-1].push(o):(r||(r=!0,a(c)),n.push(o))},e.___batchUpdate=function(o){var e=[];i.push(e);try{o()}finally{try{s(e)}finally{i.length--}}}},5998:function(o,e,t){"use strict";var r=t(9451),i=t(3587),n=t(2821);o.exports=function(o,e){if(o.___isComponent)return o;var t,a=function(){},c=typeof o;if("function"==c)t=o.prototype;else{if("object"!=c)throw TypeError();t=o}function s(o){i.call(this,o)}function l(o){n.call(this,o)}return a.prototype=t,t.___isComponent||r(a,i),t=s.prototype=a.prototype,s.___isComponent=!0,r(l,n),t.___State=l,t.___renderer=e,s}},6032:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Crect x=%273%27 y=%274%27 width=%2718%27 height=%2718%27 rx=%272%27 ry=%272%27%3E%3C/rect%3E%3Cline x1=%2716%27 y1=%272%27 x2=%2716%27 y2=%276%27%3E%3C/line%3E%3Cline x1=%278%27 y1=%272%27 x2=%278%27 y2=%276%27%3E%3C/line%3E%3Cline x1=%273%27 y1=%2710%27 x2=%2721%27 y2=%2710%27%3E%3C/line%3E%3C/svg%3E"},6125:function(o){o.exports=function(o){switch(o){case"textarea":case"script":case"style":return!0}return!1}},6222:function(o,e,t){var r=t(107),i=t(1031),n=t(2261),a=t(7469),c=t(8338),s=t(9460),l=t(9508),p=t(2263),d=/[&<]/;function u(o,e,t){for(var r=o.firstChild;r;)e.___appendChild(b(r,t)),r=r.nextSibling}function b(o,e){switch(o.nodeType){case 1:return c.___virtualize(o,u,e);case 3:return new p(o.nodeValue,e);case 8:return new i(o.nodeValue,e);case 11:var t=new a;return u(o,t,e),t}}function m(o,e){if(!d.test(o))return new p(o,e);for(var t,i=new a,n=r(o);n;)(t=b(n,e))&&i.___appendChild(t),n=n.nextSibling;return i}var h=l.prototype;h.t=function(o){var e,t=typeof o;return"string"!==t&&(null==o?o="":"object"===t&&o.toHTML&&(e=m(o.toHTML()))),this.___appendChild(e||new p(o.toString())),this.___finishChild()},h.___appendDocumentFragment=function(){return this.___appendChild(new a)},e.___VComment=i,e.___VDocumentFragment=a,e.___VElement=c,e.___VText=p,e.___VComponent=n,e.___VFragment=s,e.___virtualize=b,e.___virtualizeHTML=m},6314:function(o){"use strict";o.exports=function(o){var e=[];return e.toString=function(){return this.map(function(e){var t="",r=void 0!==e[5];return e[4]&&(t+="@supports (".concat(e[4],") {")),e[2]&&(t+="@media ".concat(e[2]," {")),r&&(t+="@layer".concat(e[5].length>0?" ".concat(e[5]):""," {")),t+=o(e),r&&(t+="}"),e[2]&&(t+="}"),e[4]&&(t+="}"),t}).join("")},e.i=function(o,t,r,i,n){"string"==typeof o&&(o=[[null,o,void 0]]);var a={};if(r)for(var c=0;c<this.length;c++){var s=this[c][0];null!=s&&(a[s]=!0)}for(var l=0;l<o.length;l++){var p=[].concat(o[l]);r&&a[p[0]]||(void 0!==n&&(void 0===p[5]||(p[1]="@layer".concat(p[5].length>0?" ".concat(p[5]):""," {").concat(p[1],"}")),p[5]=n),t&&(p[2]?(p[1]="@media ".concat(p[2]," {").concat(p[1],"}"),p[2]=t):p[2]=t),i&&(p[4]?(p[1]="@supports (".concat(p[4],") {").concat(p[1],"}"),p[4]=i):p[4]="".concat(i)),e.push(p))}},e}},6624:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28255, 255, 255%29%27 stroke-width=%274%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cpolyline points=%2720 6 9 17 4 12%27%3E%3C/polyline%3E%3C/svg%3E"},6764:function(o){var e=Array.prototype.slice;function t(o){return"function"==typeof o}function r(o){if(!t(o))throw TypeError("Invalid listener")}function i(o,t,r){switch(r.length){case 1:t.call(o);break;case 2:t.call(o,r[1]);break;case 3:t.call(o,r[1],r[2]);break;default:t.apply(o,e.call(r,1))}}function n(o,e,i,n){r(i);var a=o.$e||(o.$e={}),c=a[e];return c?t(c)?a[e]=n?[i,c]:[c,i]:n?c.unshift(i):c.push(i):a[e]=i,o}function a(){this.$e=this.$e||{}}a.EventEmitter=a,a.prototype={$e:null,emit:function(o){var r=arguments,n=this.$e;if(n){var a=n&&n[o];if(!a){if("error"===o){var c=r[1];if(!(c instanceof Error)){var s=c;(c=new Error("Error: "+s)).context=s}throw c}return!1}if(t(a))i(this,a,r);else for(var l=0,p=(a=e.call(a)).length;l<p;l++){i(this,a[l],r)}return!0}},on:function(o,e){return n(this,o,e,!1)},prependListener:function(o,e){return n(this,o,e,!0)},once:function(o,e){return r(e),this.on(o,function t(){this.removeListener(o,t),e&&(e.apply(this,arguments),e=null)}),this},removeListener:function(o,e){r(e);var i,n=this.$e;if(n&&(i=n[o]))if(t(i))i===e&&delete n[o];else for(var a=i.length-1;a>=0;a--)i[a]===e&&i.splice(a,1);return this},removeAllListeners:function(o){var e=this.$e;e&&delete e[o]},listenerCount:function(o){var e=this.$e,r=e&&e[o];return r?t(r)?1:r.length:0}},o.exports=a},6961:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28255, 255, 255%29%27 stroke-width=%274%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cline x1=%275%27 y1=%2712%27 x2=%2719%27 y2=%2712%27%3E%3C/line%3E%3C/svg%3E"},6968:function(o,e,t){"use strict";var r=t(862),i=t(8798),n=t(8820),a=t(8288).a,c=n.___attachBubblingEvent,s=t(8899).___addDelegatedEventHandler,l=t(590),p={};function d(o,e,t){this.___componentsContext=t,this.___component=o,this.id=e,this.___domEvents=void 0,this.___isExisting=!1,this.___renderBoundary=!1,this.___flags=0,this.___nextIdIndex=0,this.___keySequence=null}d.prototype={___nextKey:function(o){return(this.___keySequence||(this.___keySequence=new l)).___nextKey(o)},elId:function(o){var e=this.id;return null==o?e:("string"!=typeof o&&(r("Using non strings as keys is deprecated."),o=String(o)),0===o.indexOf("#")&&(e="#"+e,o=o.substring(1)),e+"-"+o)},___nextComponentId:function(){return this.id+"-c"+this.___nextIdIndex++},d:function(o,e,t,r){return s(o),c(this,e,t,r)},get ___type(){return this.___component.___type}},d.prototype.nk=d.prototype.___nextKey,d.___deserialize=function(o,e,t,r){var n=o[0],c=e[o[1]],s=o[2]||null,l=o[3]||p,d=l.s,u=l.w||p,b=l.f,m=4&b,h=2&b?a:l.r,f=c&&r.___createComponent(c,n,m);if(f.___updateQueued=!0,f.___global=t,m?(f.widgetConfig=u,f.___widgetBody=h):h&&((s||(s={})).renderBody=h),m||!(1&b)||8&b){if(d){var v=l.u;v&&v.forEach(function(o){d[o]=void 0}),f.state=d}!m&&u&&i(f,u)}else f.onCreate&&f.onCreate(s,{global:t}),f.onInput&&(s=f.onInput(s,{global:t})||s);f.___input=s,l.b&&(f.___bubblingDomEvents=l.b);var _=l.p,g=l.e;return g&&f.___setCustomEvents(g,_),{id:n,___component:f,___domEvents:l.d,___flags:l.f||0}},o.exports=d},7041:function(o,e,t){var r=t(3448).___insertBefore,i={nodeType:12,get firstChild(){var o=this.startNode.nextSibling;return o===this.endNode?void 0:o},get lastChild(){var o=this.endNode.previousSibling;return o===this.startNode?void 0:o},get parentNode(){var o=this.startNode.parentNode;return o===this.detachedContainer?void 0:o},get namespaceURI(){return this.startNode.parentNode.namespaceURI},get nextSibling(){return this.endNode.nextSibling},get nodes(){if(this.___markersRemovedError)throw this.___markersRemovedError("Cannot get fragment nodes.");for(var o=[],e=this.startNode;e!==this.endNode;)o.push(e),e=e.nextSibling;return o.push(e),o},insertBefore:function(o,e){var t=null==e?this.endNode:e;return r(o,t,this.startNode.parentNode)},insertInto:function(o,e){return this.nodes.forEach(function(t){r(t,e,o)},this),this},remove:function(){this.nodes.forEach(function(o){this.detachedContainer.appendChild(o)},this)}};function n(o,e,t){var n=Object.create(i),a=o&&o.ownerDocument===o.parentNode;n.startNode=a?document.createComment(""):document.createTextNode(""),n.endNode=a?document.createComment(""):document.createTextNode(""),n.startNode.fragment=n,n.endNode.fragment=n;var c=n.detachedContainer=document.createDocumentFragment();return t=t||o&&o.parentNode||c,r(n.startNode,o,t),r(n.endNode,e,t),n}e.___createFragmentNode=n,e.___beginFragmentNode=function(o,e){var t=n(o,null,e);return t.___finishFragment=function(i){t.___finishFragment=null,r(t.endNode,i,e||o.parentNode)},t}},7098:function(o,e,t){o.exports=t(8053)},7167:function(o,e,t){"use strict";var r=t(1601),i=t.n(r),n=t(6314),a=t.n(n),c=t(4417),s=t.n(c),l=new URL(t(6624),t.b),p=new URL(t(6961),t.b),d=new URL(t(9927),t.b),u=new URL(t(6032),t.b),b=new URL(t(306),t.b),m=new URL(t(5328),t.b),h=new URL(t(9589),t.b),f=new URL(t(8103),t.b),v=new URL(t(7616),t.b),_=new URL(t(5007),t.b),g=new URL(t(1145),t.b),y=new URL(t(2191),t.b),w=a()(i()),k=s()(l),x=s()(p),C=s()(d),N=s()(u),E=s()(b),L=s()(m),S=s()(h),M=s()(f),z=s()(v),D=s()(_),j=s()(g),O=s()(y);w.push([o.id,'/*!\n * Pico CSS ✨ v2.1.1 (https://picocss.com)\n * Copyright 2019-2025 - Licensed under MIT\n */\n@-webkit-keyframes modal-overlay{0%{backdrop-filter:none;background-color:transparent}}@keyframes modal-overlay{0%{backdrop-filter:none;background-color:transparent}}@-webkit-keyframes modal{0%{-webkit-transform:translateY(-100%);transform:translateY(-100%);opacity:0}}@keyframes modal{0%{-webkit-transform:translateY(-100%);transform:translateY(-100%);opacity:0}}@-webkit-keyframes progress-indeterminate{0%{background-position:200%0}to{background-position:-200%0}}@keyframes progress-indeterminate{0%{background-position:200%0}to{background-position:-200%0}}@-webkit-keyframes tooltip-slide{to{-webkit-transform:var(--pico-tooltip-slide-to);transform:var(--pico-tooltip-slide-to);opacity:1}}@keyframes tooltip-slide{to{-webkit-transform:var(--pico-tooltip-slide-to);transform:var(--pico-tooltip-slide-to);opacity:1}}@-webkit-keyframes tooltip-caret-slide{50%{opacity:0}to{-webkit-transform:var(--pico-tooltip-caret-slide-to);transform:var(--pico-tooltip-caret-slide-to);opacity:1}}@keyframes tooltip-caret-slide{50%{opacity:0}to{-webkit-transform:var(--pico-tooltip-caret-slide-to);transform:var(--pico-tooltip-caret-slide-to);opacity:1}}@-webkit-keyframes h-spin{to{-webkit-transform:rotate(360deg);transform:rotate(360deg)}}@keyframes h-spin{to{-webkit-transform:rotate(360deg);transform:rotate(360deg)}}:host,:root{--pico-font-family-emoji:"Apple Color Emoji", "Segoe UI Emoji", "Segoe UI Symbol", "Noto Color Emoji";--pico-font-family-sans-serif:system-ui, -apple-system, Segoe UI, Roboto, Ubuntu, Cantarell, Noto Sans, sans-serif, "Segoe UI", Roboto, Oxygen, Ubuntu, Cantarell, Helvetica, Arial, "Helvetica Neue", sans-serif, var(--pico-font-family-emoji);--pico-font-family-monospace:ui-monospace, SFMono-Regular, "SF Mono", Menlo, Consolas, "Liberation Mono", monospace, var(--pico-font-family-emoji);--pico-font-family:var(--pico-font-family-sans-serif);--pico-line-height:1.5;--pico-font-weight:400;--pico-font-size:100%;--pico-text-underline-offset:0.1rem;--pico-border-radius:0.25rem;--pico-border-width:0.0625rem;--pico-outline-width:0.125rem;--pico-transition:0.2s ease-in-out;--pico-spacing:1rem;--pico-typography-spacing-vertical:1rem;--pico-block-spacing-vertical:var(--pico-spacing);--pico-block-spacing-horizontal:var(--pico-spacing);--pico-grid-column-gap:var(--pico-spacing);--pico-grid-row-gap:var(--pico-spacing);--pico-form-element-spacing-vertical:0.75rem;--pico-form-element-spacing-horizontal:1rem;--pico-group-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-group-box-shadow-focus-with-button:0 0 0 var(--pico-outline-width) var(--pico-primary-focus);--pico-group-box-shadow-focus-with-input:0 0 0 0.0625rem var(--pico-form-element-border-color);--pico-modal-overlay-backdrop-filter:blur(0.375rem);--pico-nav-element-spacing-vertical:1rem;--pico-nav-element-spacing-horizontal:0.5rem;--pico-nav-link-spacing-vertical:0.5rem;--pico-nav-link-spacing-horizontal:0.5rem;--pico-nav-breadcrumb-divider:">";--pico-icon-checkbox:url('+k+");--pico-icon-minus:url("+x+");--pico-icon-chevron:url("+C+");--pico-icon-date:url("+N+");--pico-icon-time:url("+E+");--pico-icon-search:url("+L+");--pico-icon-close:url("+S+");--pico-icon-loading:url("+M+")}@media (min-width:576px){:host,:root{--pico-font-size:106.25%}}@media (min-width:768px){:host,:root{--pico-font-size:112.5%}}@media (min-width:1024px){:host,:root{--pico-font-size:118.75%}}@media (min-width:1280px){:host,:root{--pico-font-size:125%}}@media (min-width:1536px){:host,:root{--pico-font-size:131.25%}}a,a.contrast,a.secondary{--pico-text-decoration:underline}small{--pico-font-size:0.875em}h1,h2,h3,h4,h5,h6{--pico-font-weight:700}h1{--pico-font-size:2rem;--pico-line-height:1.125;--pico-typography-spacing-top:3rem}h2{--pico-font-size:1.75rem;--pico-line-height:1.15;--pico-typography-spacing-top:2.625rem}h3{--pico-font-size:1.5rem;--pico-line-height:1.175;--pico-typography-spacing-top:2.25rem}h4{--pico-font-size:1.25rem;--pico-line-height:1.2;--pico-typography-spacing-top:1.874rem}h5{--pico-font-size:1.125rem;--pico-line-height:1.225;--pico-typography-spacing-top:1.6875rem}h6{--pico-font-size:1rem;--pico-line-height:1.25;--pico-typography-spacing-top:1.5rem}tfoot td,tfoot th,thead td,thead th{--pico-font-weight:600;--pico-border-width:0.1875rem}code,kbd,pre,samp{--pico-font-family:var(--pico-font-family-monospace)}kbd{--pico-font-weight:bolder}:where(select,textarea),input:not([type=submit]):not([type=button]):not([type=reset]):not([type=checkbox]):not([type=radio]):not([type=file]){--pico-outline-width:0.0625rem}[type=search]{--pico-border-radius:5rem}[type=checkbox],[type=radio]{--pico-border-width:0.125rem}[type=checkbox][role=switch]{--pico-border-width:0.1875rem}details.dropdown summary:not([role=button]){--pico-outline-width:0.0625rem}nav details.dropdown summary:focus-visible{--pico-outline-width:0.125rem}[role=search]{--pico-border-radius:5rem}[role=group]:has(button.secondary:focus,[type=submit].secondary:focus,[type=button].secondary:focus,[role=button].secondary:focus),[role=search]:has(button.secondary:focus,[type=submit].secondary:focus,[type=button].secondary:focus,[role=button].secondary:focus){--pico-group-box-shadow-focus-with-button:0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[role=group]:has(button.contrast:focus,[type=submit].contrast:focus,[type=button].contrast:focus,[role=button].contrast:focus),[role=search]:has(button.contrast:focus,[type=submit].contrast:focus,[type=button].contrast:focus,[role=button].contrast:focus){--pico-group-box-shadow-focus-with-button:0 0 0 var(--pico-outline-width) var(--pico-contrast-focus)}[role=group] [role=button],[role=group] [type=button],[role=group] [type=submit],[role=group] button,[role=search] [role=button],[role=search] [type=button],[role=search] [type=submit],[role=search] button{--pico-form-element-spacing-horizontal:2rem}[aria-busy=true][role=button]:not(input):not(select):not(textarea):not(.outline)::before,[aria-busy=true][type=button]:not(input):not(select):not(textarea):not(.outline)::before,[aria-busy=true][type=reset]:not(input):not(select):not(textarea):not(.outline)::before,[aria-busy=true][type=submit]:not(input):not(select):not(textarea):not(.outline)::before,button[aria-busy=true]:not(input):not(select):not(textarea):not(.does-not-exist):not(.outline)::before,details summary[role=button]:not(.outline)::after{-webkit-filter:brightness(0) invert(1);filter:brightness(0) invert(1)}[aria-busy=true]:not(input):not(select):not(textarea):is(button,[type=submit],[type=button],[type=reset],[role=button]):not(.outline)::before{-webkit-filter:brightness(0) invert(1);filter:brightness(0) invert(1)}:host(:not([data-theme=dark])),:root:not([data-theme=dark]),[data-theme=light]{--csstools-color-scheme--light:initial;color-scheme:light;--pico-background-color:#fff;--pico-color:#373c44;--pico-text-selection-color:rgba(2, 154, 232, 0.25);--pico-muted-color:#646b79;--pico-muted-border-color:rgb(231, 234, 239.5);--pico-primary:#0172ad;--pico-primary-background:#0172ad;--pico-primary-border:var(--pico-primary-background);--pico-primary-underline:rgba(1, 114, 173, 0.5);--pico-primary-hover:#015887;--pico-primary-hover-background:#02659a;--pico-primary-hover-border:var(--pico-primary-hover-background);--pico-primary-hover-underline:var(--pico-primary-hover);--pico-primary-focus:rgba(2, 154, 232, 0.5);--pico-primary-inverse:#fff;--pico-secondary:#5d6b89;--pico-secondary-background:#525f7a;--pico-secondary-border:var(--pico-secondary-background);--pico-secondary-underline:rgba(93, 107, 137, 0.5);--pico-secondary-hover:#48536b;--pico-secondary-hover-background:#48536b;--pico-secondary-hover-border:var(--pico-secondary-hover-background);--pico-secondary-hover-underline:var(--pico-secondary-hover);--pico-secondary-focus:rgba(93, 107, 137, 0.25);--pico-secondary-inverse:#fff;--pico-contrast:#181c25;--pico-contrast-background:#181c25;--pico-contrast-border:var(--pico-contrast-background);--pico-contrast-underline:rgba(24, 28, 37, 0.5);--pico-contrast-hover:#000;--pico-contrast-hover-background:#000;--pico-contrast-hover-border:var(--pico-contrast-hover-background);--pico-contrast-hover-underline:var(--pico-secondary-hover);--pico-contrast-focus:rgba(93, 107, 137, 0.25);--pico-contrast-inverse:#fff;--pico-box-shadow:0.0145rem 0.029rem 0.174rem rgba(129, 145, 181, 0.01698), 0.0335rem 0.067rem 0.402rem rgba(129, 145, 181, 0.024), 0.0625rem 0.125rem 0.75rem rgba(129, 145, 181, 0.03), 0.1125rem 0.225rem 1.35rem rgba(129, 145, 181, 0.036), 0.2085rem 0.417rem 2.502rem rgba(129, 145, 181, 0.04302), 0.5rem 1rem 6rem rgba(129, 145, 181, 0.06), 0 0 0 0.0625rem rgba(129, 145, 181, 0.015);--pico-h1-color:#2d3138;--pico-h2-color:#373c44;--pico-h3-color:#424751;--pico-h4-color:#4d535e;--pico-h5-color:#5c6370;--pico-h6-color:#646b79;--pico-mark-background-color:rgb(252.5, 230.5, 191.5);--pico-mark-color:#0f1114;--pico-ins-color:rgb(28.5, 105.5, 84);--pico-del-color:rgb(136, 56.5, 53);--pico-blockquote-border-color:var(--pico-muted-border-color);--pico-blockquote-footer-color:var(--pico-muted-color);--pico-button-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-button-hover-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-table-border-color:var(--pico-muted-border-color);--pico-table-row-stripped-background-color:rgba(111, 120, 135, 0.0375);--pico-code-background-color:rgb(243, 244.5, 246.75);--pico-code-color:#646b79;--pico-code-kbd-background-color:var(--pico-color);--pico-code-kbd-color:var(--pico-background-color);--pico-form-element-background-color:rgb(251, 251.5, 252.25);--pico-form-element-selected-background-color:#dfe3eb;--pico-form-element-border-color:#cfd5e2;--pico-form-element-color:#23262c;--pico-form-element-placeholder-color:var(--pico-muted-color);--pico-form-element-active-background-color:#fff;--pico-form-element-active-border-color:var(--pico-primary-border);--pico-form-element-focus-color:var(--pico-primary-border);--pico-form-element-disabled-opacity:0.5;--pico-form-element-invalid-border-color:rgb(183.5, 105.5, 106.5);--pico-form-element-invalid-active-border-color:rgb(200.25, 79.25, 72.25);--pico-form-element-invalid-focus-color:var(--pico-form-element-invalid-active-border-color);--pico-form-element-valid-border-color:rgb(76, 154.5, 137.5);--pico-form-element-valid-active-border-color:rgb(39, 152.75, 118.75);--pico-form-element-valid-focus-color:var(--pico-form-element-valid-active-border-color);--pico-switch-background-color:#bfc7d9;--pico-switch-checked-background-color:var(--pico-primary-background);--pico-switch-color:#fff;--pico-switch-thumb-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-range-border-color:#dfe3eb;--pico-range-active-border-color:#bfc7d9;--pico-range-thumb-border-color:var(--pico-background-color);--pico-range-thumb-color:var(--pico-secondary-background);--pico-range-thumb-active-color:var(--pico-primary-background);--pico-accordion-border-color:var(--pico-muted-border-color);--pico-accordion-active-summary-color:var(--pico-primary-hover);--pico-accordion-close-summary-color:var(--pico-color);--pico-accordion-open-summary-color:var(--pico-muted-color);--pico-card-background-color:var(--pico-background-color);--pico-card-border-color:var(--pico-muted-border-color);--pico-card-box-shadow:var(--pico-box-shadow);--pico-card-sectioning-background-color:rgb(251, 251.5, 252.25);--pico-dropdown-background-color:#fff;--pico-dropdown-border-color:#eff1f4;--pico-dropdown-box-shadow:var(--pico-box-shadow);--pico-dropdown-color:var(--pico-color);--pico-dropdown-hover-background-color:#eff1f4;--pico-loading-spinner-opacity:0.5;--pico-modal-overlay-background-color:rgba(232, 234, 237, 0.75);--pico-progress-background-color:#dfe3eb;--pico-progress-color:var(--pico-primary-background);--pico-tooltip-background-color:var(--pico-contrast-background);--pico-tooltip-color:var(--pico-contrast-inverse);--pico-icon-valid:url("+z+");--pico-icon-invalid:url("+D+")}:root:not([data-theme=dark]) input[type=button],:root:not([data-theme=dark]) input[type=checkbox],:root:not([data-theme=dark]) input[type=file],:root:not([data-theme=dark]) input[type=radio],:root:not([data-theme=dark]) input[type=reset],:root:not([data-theme=dark]) input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme=dark])) input[type=button],:host(:not([data-theme=dark])) input[type=checkbox],:host(:not([data-theme=dark])) input[type=file],:host(:not([data-theme=dark])) input[type=radio],:host(:not([data-theme=dark])) input[type=reset],:host(:not([data-theme=dark])) input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}[data-theme=light] input[type=button],[data-theme=light] input[type=checkbox],[data-theme=light] input[type=file],[data-theme=light] input[type=radio],[data-theme=light] input[type=reset],[data-theme=light] input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme=dark])) input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]),:root:not([data-theme=dark]) input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]),[data-theme=light] input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]){--pico-form-element-focus-color:var(--pico-primary-focus)}@media only screen and (prefers-color-scheme:dark){:host(:not([data-theme])),:root:not([data-theme]){--csstools-color-scheme--light: ;color-scheme:dark;--pico-background-color:rgb(19, 22.5, 30.5);--pico-color:#c2c7d0;--pico-text-selection-color:rgba(1, 170, 255, 0.1875);--pico-muted-color:#7b8495;--pico-muted-border-color:#202632;--pico-primary:#01aaff;--pico-primary-background:#0172ad;--pico-primary-border:var(--pico-primary-background);--pico-primary-underline:rgba(1, 170, 255, 0.5);--pico-primary-hover:#79c0ff;--pico-primary-hover-background:#017fc0;--pico-primary-hover-border:var(--pico-primary-hover-background);--pico-primary-hover-underline:var(--pico-primary-hover);--pico-primary-focus:rgba(1, 170, 255, 0.375);--pico-primary-inverse:#fff;--pico-secondary:#969eaf;--pico-secondary-background:#525f7a;--pico-secondary-border:var(--pico-secondary-background);--pico-secondary-underline:rgba(150, 158, 175, 0.5);--pico-secondary-hover:#b3b9c5;--pico-secondary-hover-background:#5d6b89;--pico-secondary-hover-border:var(--pico-secondary-hover-background);--pico-secondary-hover-underline:var(--pico-secondary-hover);--pico-secondary-focus:rgba(144, 158, 190, 0.25);--pico-secondary-inverse:#fff;--pico-contrast:#dfe3eb;--pico-contrast-background:#eff1f4;--pico-contrast-border:var(--pico-contrast-background);--pico-contrast-underline:rgba(223, 227, 235, 0.5);--pico-contrast-hover:#fff;--pico-contrast-hover-background:#fff;--pico-contrast-hover-border:var(--pico-contrast-hover-background);--pico-contrast-hover-underline:var(--pico-contrast-hover);--pico-contrast-focus:rgba(207, 213, 226, 0.25);--pico-contrast-inverse:#000;--pico-box-shadow:0.0145rem 0.029rem 0.174rem rgba(7, 8.5, 12, 0.01698), 0.0335rem 0.067rem 0.402rem rgba(7, 8.5, 12, 0.024), 0.0625rem 0.125rem 0.75rem rgba(7, 8.5, 12, 0.03), 0.1125rem 0.225rem 1.35rem rgba(7, 8.5, 12, 0.036), 0.2085rem 0.417rem 2.502rem rgba(7, 8.5, 12, 0.04302), 0.5rem 1rem 6rem rgba(7, 8.5, 12, 0.06), 0 0 0 0.0625rem rgba(7, 8.5, 12, 0.015);--pico-h1-color:#f0f1f3;--pico-h2-color:#e0e3e7;--pico-h3-color:#c2c7d0;--pico-h4-color:#b3b9c5;--pico-h5-color:#a4acba;--pico-h6-color:#8891a4;--pico-mark-background-color:#014063;--pico-mark-color:#fff;--pico-ins-color:#62af9a;--pico-del-color:rgb(205.5, 126, 123);--pico-blockquote-border-color:var(--pico-muted-border-color);--pico-blockquote-footer-color:var(--pico-muted-color);--pico-button-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-button-hover-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-table-border-color:var(--pico-muted-border-color);--pico-table-row-stripped-background-color:rgba(111, 120, 135, 0.0375);--pico-code-background-color:rgb(26, 30.5, 40.25);--pico-code-color:#8891a4;--pico-code-kbd-background-color:var(--pico-color);--pico-code-kbd-color:var(--pico-background-color);--pico-form-element-background-color:rgb(28, 33, 43.5);--pico-form-element-selected-background-color:#2a3140;--pico-form-element-border-color:#2a3140;--pico-form-element-color:#e0e3e7;--pico-form-element-placeholder-color:#8891a4;--pico-form-element-active-background-color:rgb(26, 30.5, 40.25);--pico-form-element-active-border-color:var(--pico-primary-border);--pico-form-element-focus-color:var(--pico-primary-border);--pico-form-element-disabled-opacity:0.5;--pico-form-element-invalid-border-color:rgb(149.5, 74, 80);--pico-form-element-invalid-active-border-color:rgb(183.25, 63.5, 59);--pico-form-element-invalid-focus-color:var(--pico-form-element-invalid-active-border-color);--pico-form-element-valid-border-color:#2a7b6f;--pico-form-element-valid-active-border-color:rgb(22, 137, 105.5);--pico-form-element-valid-focus-color:var(--pico-form-element-valid-active-border-color);--pico-switch-background-color:#333c4e;--pico-switch-checked-background-color:var(--pico-primary-background);--pico-switch-color:#fff;--pico-switch-thumb-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-range-border-color:#202632;--pico-range-active-border-color:#2a3140;--pico-range-thumb-border-color:var(--pico-background-color);--pico-range-thumb-color:var(--pico-secondary-background);--pico-range-thumb-active-color:var(--pico-primary-background);--pico-accordion-border-color:var(--pico-muted-border-color);--pico-accordion-active-summary-color:var(--pico-primary-hover);--pico-accordion-close-summary-color:var(--pico-color);--pico-accordion-open-summary-color:var(--pico-muted-color);--pico-card-background-color:#181c25;--pico-card-border-color:var(--pico-card-background-color);--pico-card-box-shadow:var(--pico-box-shadow);--pico-card-sectioning-background-color:rgb(26, 30.5, 40.25);--pico-dropdown-background-color:#181c25;--pico-dropdown-border-color:#202632;--pico-dropdown-box-shadow:var(--pico-box-shadow);--pico-dropdown-color:var(--pico-color);--pico-dropdown-hover-background-color:#202632;--pico-loading-spinner-opacity:0.5;--pico-modal-overlay-background-color:rgba(7.5, 8.5, 10, 0.75);--pico-progress-background-color:#202632;--pico-progress-color:var(--pico-primary-background);--pico-tooltip-background-color:var(--pico-contrast-background);--pico-tooltip-color:var(--pico-contrast-inverse);--pico-icon-valid:url("+j+");--pico-icon-invalid:url("+O+")}:root:not([data-theme]) input[type=button],:root:not([data-theme]) input[type=checkbox],:root:not([data-theme]) input[type=file],:root:not([data-theme]) input[type=radio],:root:not([data-theme]) input[type=reset],:root:not([data-theme]) input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme])) input[type=button],:host(:not([data-theme])) input[type=checkbox],:host(:not([data-theme])) input[type=file],:host(:not([data-theme])) input[type=radio],:host(:not([data-theme])) input[type=reset],:host(:not([data-theme])) input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme])) input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]),:root:not([data-theme]) input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]){--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme])) details summary[role=button].contrast:not(.outline)::after,:root:not([data-theme]) details summary[role=button].contrast:not(.outline)::after{-webkit-filter:brightness(0);filter:brightness(0)}:root:not([data-theme]) .contrast[aria-busy=true][role=button]:not(input):not(select):not(textarea):not(.outline)::before,:root:not([data-theme]) .contrast[aria-busy=true][type=button]:not(input):not(select):not(textarea):not(.outline)::before,:root:not([data-theme]) .contrast[aria-busy=true][type=reset]:not(input):not(select):not(textarea):not(.outline)::before,:root:not([data-theme]) .contrast[aria-busy=true][type=submit]:not(input):not(select):not(textarea):not(.outline)::before,:root:not([data-theme]) button.contrast[aria-busy=true]:not(input):not(select):not(textarea):not(.does-not-exist):not(.outline)::before{-webkit-filter:brightness(0);filter:brightness(0)}:host(:not([data-theme])) .contrast[aria-busy=true][role=button]:not(input):not(select):not(textarea):not(.outline)::before,:host(:not([data-theme])) .contrast[aria-busy=true][type=button]:not(input):not(select):not(textarea):not(.outline)::before,:host(:not([data-theme])) .contrast[aria-busy=true][type=reset]:not(input):not(select):not(textarea):not(.outline)::before,:host(:not([data-theme])) .contrast[aria-busy=true][type=submit]:not(input):not(select):not(textarea):not(.outline)::before,:host(:not([data-theme])) button.contrast[aria-busy=true]:not(input):not(select):not(textarea):not(.does-not-exist):not(.outline)::before{-webkit-filter:brightness(0);filter:brightness(0)}:host(:not([data-theme])) [aria-busy=true]:not(input):not(select):not(textarea).contrast:is(button,[type=submit],[type=button],[type=reset],[role=button]):not(.outline)::before,:root:not([data-theme]) [aria-busy=true]:not(input):not(select):not(textarea).contrast:is(button,[type=submit],[type=button],[type=reset],[role=button]):not(.outline)::before{-webkit-filter:brightness(0);filter:brightness(0)}}[data-theme=dark]{--csstools-color-scheme--light: ;color-scheme:dark;--pico-background-color:rgb(19, 22.5, 30.5);--pico-color:#c2c7d0;--pico-text-selection-color:rgba(1, 170, 255, 0.1875);--pico-muted-color:#7b8495;--pico-muted-border-color:#202632;--pico-primary:#01aaff;--pico-primary-background:#0172ad;--pico-primary-border:var(--pico-primary-background);--pico-primary-underline:rgba(1, 170, 255, 0.5);--pico-primary-hover:#79c0ff;--pico-primary-hover-background:#017fc0;--pico-primary-hover-border:var(--pico-primary-hover-background);--pico-primary-hover-underline:var(--pico-primary-hover);--pico-primary-focus:rgba(1, 170, 255, 0.375);--pico-primary-inverse:#fff;--pico-secondary:#969eaf;--pico-secondary-background:#525f7a;--pico-secondary-border:var(--pico-secondary-background);--pico-secondary-underline:rgba(150, 158, 175, 0.5);--pico-secondary-hover:#b3b9c5;--pico-secondary-hover-background:#5d6b89;--pico-secondary-hover-border:var(--pico-secondary-hover-background);--pico-secondary-hover-underline:var(--pico-secondary-hover);--pico-secondary-focus:rgba(144, 158, 190, 0.25);--pico-secondary-inverse:#fff;--pico-contrast:#dfe3eb;--pico-contrast-background:#eff1f4;--pico-contrast-border:var(--pico-contrast-background);--pico-contrast-underline:rgba(223, 227, 235, 0.5);--pico-contrast-hover:#fff;--pico-contrast-hover-background:#fff;--pico-contrast-hover-border:var(--pico-contrast-hover-background);--pico-contrast-hover-underline:var(--pico-contrast-hover);--pico-contrast-focus:rgba(207, 213, 226, 0.25);--pico-contrast-inverse:#000;--pico-box-shadow:0.0145rem 0.029rem 0.174rem rgba(7, 8.5, 12, 0.01698), 0.0335rem 0.067rem 0.402rem rgba(7, 8.5, 12, 0.024), 0.0625rem 0.125rem 0.75rem rgba(7, 8.5, 12, 0.03), 0.1125rem 0.225rem 1.35rem rgba(7, 8.5, 12, 0.036), 0.2085rem 0.417rem 2.502rem rgba(7, 8.5, 12, 0.04302), 0.5rem 1rem 6rem rgba(7, 8.5, 12, 0.06), 0 0 0 0.0625rem rgba(7, 8.5, 12, 0.015);--pico-h1-color:#f0f1f3;--pico-h2-color:#e0e3e7;--pico-h3-color:#c2c7d0;--pico-h4-color:#b3b9c5;--pico-h5-color:#a4acba;--pico-h6-color:#8891a4;--pico-mark-background-color:#014063;--pico-mark-color:#fff;--pico-ins-color:#62af9a;--pico-del-color:rgb(205.5, 126, 123);--pico-blockquote-border-color:var(--pico-muted-border-color);--pico-blockquote-footer-color:var(--pico-muted-color);--pico-button-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-button-hover-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-table-border-color:var(--pico-muted-border-color);--pico-table-row-stripped-background-color:rgba(111, 120, 135, 0.0375);--pico-code-background-color:rgb(26, 30.5, 40.25);--pico-code-color:#8891a4;--pico-code-kbd-background-color:var(--pico-color);--pico-code-kbd-color:var(--pico-background-color);--pico-form-element-background-color:rgb(28, 33, 43.5);--pico-form-element-selected-background-color:#2a3140;--pico-form-element-border-color:#2a3140;--pico-form-element-color:#e0e3e7;--pico-form-element-placeholder-color:#8891a4;--pico-form-element-active-background-color:rgb(26, 30.5, 40.25);--pico-form-element-active-border-color:var(--pico-primary-border);--pico-form-element-focus-color:var(--pico-primary-border);--pico-form-element-disabled-opacity:0.5;--pico-form-element-invalid-border-color:rgb(149.5, 74, 80);--pico-form-element-invalid-active-border-color:rgb(183.25, 63.5, 59);--pico-form-element-invalid-focus-color:var(--pico-form-element-invalid-active-border-color);--pico-form-element-valid-border-color:#2a7b6f;--pico-form-element-valid-active-border-color:rgb(22, 137, 105.5);--pico-form-element-valid-focus-color:var(--pico-form-element-valid-active-border-color);--pico-switch-background-color:#333c4e;--pico-switch-checked-background-color:var(--pico-primary-background);--pico-switch-color:#fff;--pico-switch-thumb-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-range-border-color:#202632;--pico-range-active-border-color:#2a3140;--pico-range-thumb-border-color:var(--pico-background-color);--pico-range-thumb-color:var(--pico-secondary-background);--pico-range-thumb-active-color:var(--pico-primary-background);--pico-accordion-border-color:var(--pico-muted-border-color);--pico-accordion-active-summary-color:var(--pico-primary-hover);--pico-accordion-close-summary-color:var(--pico-color);--pico-accordion-open-summary-color:var(--pico-muted-color);--pico-card-background-color:#181c25;--pico-card-border-color:var(--pico-card-background-color);--pico-card-box-shadow:var(--pico-box-shadow);--pico-card-sectioning-background-color:rgb(26, 30.5, 40.25);--pico-dropdown-background-color:#181c25;--pico-dropdown-border-color:#202632;--pico-dropdown-box-shadow:var(--pico-box-shadow);--pico-dropdown-color:var(--pico-color);--pico-dropdown-hover-background-color:#202632;--pico-loading-spinner-opacity:0.5;--pico-modal-overlay-background-color:rgba(7.5, 8.5, 10, 0.75);--pico-progress-background-color:#202632;--pico-progress-color:var(--pico-primary-background);--pico-tooltip-background-color:var(--pico-contrast-background);--pico-tooltip-color:var(--pico-contrast-inverse);--pico-icon-valid:url("+j+");--pico-icon-invalid:url("+O+')}[data-theme=dark] input[type=button],[data-theme=dark] input[type=checkbox],[data-theme=dark] input[type=file],[data-theme=dark] input[type=radio],[data-theme=dark] input[type=reset],[data-theme=dark] input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}[data-theme=dark] input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]){--pico-form-element-focus-color:var(--pico-primary-focus)}[data-theme=dark] .contrast[aria-busy=true][role=button]:not(input):not(select):not(textarea):not(.outline)::before,[data-theme=dark] .contrast[aria-busy=true][type=button]:not(input):not(select):not(textarea):not(.outline)::before,[data-theme=dark] .contrast[aria-busy=true][type=reset]:not(input):not(select):not(textarea):not(.outline)::before,[data-theme=dark] .contrast[aria-busy=true][type=submit]:not(input):not(select):not(textarea):not(.outline)::before,[data-theme=dark] button.contrast[aria-busy=true]:not(input):not(select):not(textarea):not(.does-not-exist):not(.outline)::before,[data-theme=dark] details summary[role=button].contrast:not(.outline)::after{-webkit-filter:brightness(0);filter:brightness(0)}[data-theme=dark] [aria-busy=true]:not(input):not(select):not(textarea).contrast:is(button,[type=submit],[type=button],[type=reset],[role=button]):not(.outline)::before{-webkit-filter:brightness(0);filter:brightness(0)}[type=checkbox],[type=radio],[type=range],progress{accent-color:var(--pico-primary)}*,::after,::before{-webkit-box-sizing:border-box;box-sizing:border-box;background-repeat:no-repeat}::after,::before{text-decoration:inherit;vertical-align:inherit}:where(:host),:where(:root){-webkit-tap-highlight-color:transparent;-webkit-text-size-adjust:100%;-moz-text-size-adjust:100%;-ms-text-size-adjust:100%;text-size-adjust:100%;background-color:var(--pico-background-color);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);font-size:95%;font-size:var(--pico-font-size);line-height:1.5;line-height:var(--pico-line-height);font-family:system-ui,-apple-system,Segoe UI,Roboto,Ubuntu,Cantarell,Noto Sans,sans-serif,"Segoe UI",Roboto,Oxygen,Ubuntu,Cantarell,Helvetica,Arial,"Helvetica Neue",sans-serif,"Apple Color Emoji","Segoe UI Emoji","Segoe UI Symbol","Noto Color Emoji";font-family:var(--pico-font-family);text-underline-offset:.1rem;text-underline-offset:var(--pico-text-underline-offset);text-rendering:optimizeLegibility;word-wrap:break-word;overflow-wrap:break-word;-moz-tab-size:4;-o-tab-size:4;tab-size:4}body{width:100%;margin:0}main{display:block}body>footer,body>header,body>main{padding-top:1rem;padding-bottom:1rem;padding-top:var(--pico-block-spacing-vertical);padding-bottom:var(--pico-block-spacing-vertical)}section{margin-bottom:1rem;margin-bottom:var(--pico-block-spacing-vertical)}.container,.container-fluid{width:100%;margin-right:auto;margin-left:auto;padding-right:1rem;padding-right:var(--pico-spacing);padding-left:1rem;padding-left:var(--pico-spacing)}@media (min-width:576px){.container{max-width:510px;padding-right:0;padding-left:0}}@media (min-width:768px){.container{max-width:700px}}@media (min-width:1024px){.container{max-width:950px}}@media (min-width:1280px){.container{max-width:1200px}}@media (min-width:1536px){.container{max-width:1450px}}.grid{grid-column-gap:1rem;grid-column-gap:var(--pico-grid-column-gap);grid-row-gap:1rem;grid-row-gap:var(--pico-grid-row-gap);display:grid;grid-template-columns:1fr}@media (min-width:768px){.grid{grid-template-columns:repeat(auto-fit,minmax(0,1fr))}}.grid>*{min-width:0}.overflow-auto{overflow:auto}b,strong{font-weight:bolder}sub,sup{position:relative;font-size:.75em;line-height:0;vertical-align:baseline}sub{bottom:-.25em}sup{top:-.5em}address,dl,ol,table,ul{margin-bottom:1rem;margin-bottom:var(--pico-typography-spacing-vertical);font-style:normal}address,blockquote,dl,h1,h2,h3,h4,h5,h6,ol,p,table,ul{margin-top:0;color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight)}blockquote,p,pre{font-style:normal}pre{margin-top:0}h1,h2,h3,h4,h5,h6{margin-bottom:1rem;margin-bottom:var(--pico-typography-spacing-vertical);font-size:95%;font-size:var(--pico-font-size);line-height:1.5;line-height:var(--pico-line-height);font-family:system-ui,-apple-system,Segoe UI,Roboto,Ubuntu,Cantarell,Noto Sans,sans-serif,"Segoe UI",Roboto,Oxygen,Ubuntu,Cantarell,Helvetica,Arial,"Helvetica Neue",sans-serif,"Apple Color Emoji","Segoe UI Emoji","Segoe UI Symbol","Noto Color Emoji";font-family:var(--pico-font-family)}h1{--pico-color:var(--pico-h1-color)}h2{--pico-color:var(--pico-h2-color)}h3{--pico-color:var(--pico-h3-color)}h4{--pico-color:var(--pico-h4-color)}h5{--pico-color:var(--pico-h5-color)}h6{--pico-color:var(--pico-h6-color)}:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h1,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h2,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h3,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h4,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h5,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h6{margin-top:var(--pico-typography-spacing-top)}:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~:is(h1,h2,h3,h4,h5,h6){margin-top:var(--pico-typography-spacing-top)}hgroup,p{margin-bottom:1rem;margin-bottom:var(--pico-typography-spacing-vertical)}hgroup>*{margin-top:0;margin-bottom:0}hgroup>:not(:first-child):last-child{--pico-color:var(--pico-muted-color);--pico-font-weight:unset;font-size:1rem}:where(ol,ul) li{margin-bottom:calc(1rem*.25);margin-bottom:calc(var(--pico-typography-spacing-vertical)*.25)}:where(dl,ol,ul) :where(dl,ol,ul){margin:0;margin-top:calc(1rem*.25);margin-top:calc(var(--pico-typography-spacing-vertical)*.25)}ul li{list-style:square}mark{padding:.125rem .25rem;background-color:var(--pico-mark-background-color);color:var(--pico-mark-color);vertical-align:baseline}blockquote{display:block;margin:1rem 0;margin:var(--pico-typography-spacing-vertical)0;padding:1rem;padding:var(--pico-spacing);border-right:none;border-left:.25rem solid var(--pico-blockquote-border-color);-webkit-border-start:.25rem solid var(--pico-blockquote-border-color);border-inline-start:.25rem solid var(--pico-blockquote-border-color);-webkit-border-end:none;border-inline-end:none}blockquote footer{margin-top:calc(1rem*.5);margin-top:calc(var(--pico-typography-spacing-vertical)*.5);color:var(--pico-blockquote-footer-color)}abbr[title],ins{-webkit-text-decoration:none;text-decoration:none}abbr[title]{border-bottom:1px dotted;cursor:help}ins{color:var(--pico-ins-color)}del{color:var(--pico-del-color)}::-moz-selection{background-color:var(--pico-text-selection-color)}::selection{background-color:var(--pico-text-selection-color)}:where(a:not([role=button])),[role=link]{--pico-color:var(--pico-primary);--pico-background-color:transparent;--pico-underline:var(--pico-primary-underline);outline:0;background-color:transparent;background-color:var(--pico-background-color);color:var(--pico-color);-webkit-text-decoration:var(--pico-text-decoration);text-decoration:var(--pico-text-decoration);text-decoration-color:var(--pico-underline);text-underline-offset:.125em;-webkit-transition:background-color .2s ease-in-out,color .2s ease-in-out,-webkit-text-decoration .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,color .2s ease-in-out,text-decoration .2s ease-in-out,box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),color var(--pico-transition),-webkit-text-decoration var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),color var(--pico-transition),text-decoration var(--pico-transition),box-shadow var(--pico-transition);transition:background-color .2s ease-in-out,color .2s ease-in-out,text-decoration .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-text-decoration .2s ease-in-out;transition:background-color var(--pico-transition),color var(--pico-transition),text-decoration var(--pico-transition),box-shadow var(--pico-transition),-webkit-text-decoration var(--pico-transition)}:where(a:not([role=button])):active:not(.does-not-exist),:where(a:not([role=button])):hover:not(.does-not-exist),[aria-current]:where(a:not([role=button])):not([aria-current=false]){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}:where(a:not([role=button])):focus:not(.does-not-exist){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}[role=link]:active:not(.does-not-exist){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}[role=link]:focus:not(.does-not-exist),[role=link]:hover:not(.does-not-exist),[role=link][aria-current]:not([aria-current=false]){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}:where(a:not([role=button])):is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[role=link]:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}:where(a:not([role=button])):focus-visible,[role=link]:focus-visible{-webkit-box-shadow:0 0 0 .125rem var(--pico-primary-focus);box-shadow:0 0 0 .125rem var(--pico-primary-focus);-webkit-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-primary-focus);box-shadow:0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}:where(a:not([role=button])).secondary,[role=link].secondary{--pico-color:var(--pico-secondary);--pico-underline:var(--pico-secondary-underline)}.secondary:where(a:not([role=button])):active:not(.does-not-exist),.secondary:where(a:not([role=button])):hover:not(.does-not-exist),.secondary[aria-current]:where(a:not([role=button])):not([aria-current=false]){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}.secondary:where(a:not([role=button])):focus:not(.does-not-exist){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}.secondary[role=link]:active:not(.does-not-exist){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}.secondary[role=link]:focus:not(.does-not-exist),.secondary[role=link]:hover:not(.does-not-exist),.secondary[role=link][aria-current]:not([aria-current=false]){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}:where(a:not([role=button])).secondary:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[role=link].secondary:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}:where(a:not([role=button])).contrast,[role=link].contrast{--pico-color:var(--pico-contrast);--pico-underline:var(--pico-contrast-underline)}.contrast:where(a:not([role=button])):active:not(.does-not-exist),.contrast:where(a:not([role=button])):hover:not(.does-not-exist),.contrast[aria-current]:where(a:not([role=button])):not([aria-current=false]){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}.contrast:where(a:not([role=button])):focus:not(.does-not-exist){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}.contrast[role=link]:active:not(.does-not-exist){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}.contrast[role=link]:focus:not(.does-not-exist),.contrast[role=link]:hover:not(.does-not-exist),.contrast[role=link][aria-current]:not([aria-current=false]){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}:where(a:not([role=button])).contrast:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[role=link].contrast:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}a[role=button],audio,canvas,video{display:inline-block}button{margin:0;overflow:visible;font-family:inherit;text-transform:none}[type=button],[type=reset],[type=submit],button{-webkit-appearance:button}[type=file]::-webkit-file-upload-button{--pico-background-color:var(--pico-primary-background);--pico-border-color:var(--pico-primary-border);--pico-color:var(--pico-primary-inverse);--pico-box-shadow:var(--pico-button-box-shadow, 0 0 0 rgba(0, 0, 0, 0));padding:.75rem 1rem;padding:var(--pico-form-element-spacing-vertical) var(--pico-form-element-spacing-horizontal);border:.0625rem solid #0172ad;border:var(--pico-border-width) solid var(--pico-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);outline:0;background-color:#0172ad;background-color:var(--pico-background-color);-webkit-box-shadow:0 0 0 transparent;box-shadow:0 0 0 transparent;-webkit-box-shadow:var(--pico-box-shadow);box-shadow:var(--pico-box-shadow);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);font-size:1rem;line-height:1.5;line-height:var(--pico-line-height);text-align:center;-webkit-text-decoration:none;text-decoration:none;-webkit-user-select:none;-moz-user-select:none;user-select:none;-webkit-transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}[role=button],[type=button],[type=file]::file-selector-button,[type=reset],[type=submit],button{--pico-background-color:var(--pico-primary-background);--pico-border-color:var(--pico-primary-border);--pico-color:var(--pico-primary-inverse);--pico-box-shadow:var(--pico-button-box-shadow, 0 0 0 rgba(0, 0, 0, 0));padding:.75rem 1rem;padding:var(--pico-form-element-spacing-vertical) var(--pico-form-element-spacing-horizontal);border:.0625rem solid #0172ad;border:var(--pico-border-width) solid var(--pico-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);outline:0;background-color:#0172ad;background-color:var(--pico-background-color);-webkit-box-shadow:0 0 0 transparent;box-shadow:0 0 0 transparent;-webkit-box-shadow:var(--pico-box-shadow);box-shadow:var(--pico-box-shadow);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);font-size:1rem;line-height:1.5;line-height:var(--pico-line-height);text-align:center;-webkit-text-decoration:none;text-decoration:none;cursor:pointer;-webkit-user-select:none;-moz-user-select:none;-ms-user-select:none;user-select:none;-webkit-transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}[role=button]:active,[type=button]:active,[type=reset]:active,[type=submit]:active,button:active{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::file-selector-button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button:hover{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::file-selector-button:hover{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button:active{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::file-selector-button:active{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button:focus{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::file-selector-button:focus{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[role=button]:focus,[role=button]:hover,[role=button][aria-current]:not([aria-current=false]),[type=button]:focus,[type=button]:hover,[type=button][aria-current]:not([aria-current=false]),[type=reset]:focus,[type=reset]:hover,[type=reset][aria-current]:not([aria-current=false]),[type=submit]:focus,[type=submit]:hover,[type=submit][aria-current]:not([aria-current=false]),button:focus,button:hover,button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button:is(:hover,:active,:focus),[type=file]::-webkit-file-upload-button:is([aria-current]:not([aria-current=false])){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[role=button]:is(:hover,:active,:focus),[role=button]:is([aria-current]:not([aria-current=false])),[type=button]:is(:hover,:active,:focus),[type=button]:is([aria-current]:not([aria-current=false])),[type=file]::file-selector-button:is(:hover,:active,:focus),[type=file]::file-selector-button:is([aria-current]:not([aria-current=false])),[type=reset]:is(:hover,:active,:focus),[type=reset]:is([aria-current]:not([aria-current=false])),[type=submit]:is(:hover,:active,:focus),[type=submit]:is([aria-current]:not([aria-current=false])),button:is(:hover,:active,:focus),button:is([aria-current]:not([aria-current=false])){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[type=file]::file-selector-button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[type=file]::-webkit-file-upload-button:focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[role=button]:focus,[role=button][aria-current]:not([aria-current=false]):focus,[type=button]:focus,[type=button][aria-current]:not([aria-current=false]):focus,[type=file]::file-selector-button:focus,[type=reset]:focus,[type=reset][aria-current]:not([aria-current=false]):focus,[type=submit]:focus,[type=submit][aria-current]:not([aria-current=false]):focus,button:focus,button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[type=file]::-webkit-file-upload-button:focus,[type=file]::-webkit-file-upload-button:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[role=button]:focus,[role=button]:is([aria-current]:not([aria-current=false])):focus,[type=button]:focus,[type=button]:is([aria-current]:not([aria-current=false])):focus,[type=file]::file-selector-button:focus,[type=file]::file-selector-button:is([aria-current]:not([aria-current=false])):focus,[type=reset]:focus,[type=reset]:is([aria-current]:not([aria-current=false])):focus,[type=submit]:focus,[type=submit]:is([aria-current]:not([aria-current=false])):focus,button:focus,button:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[type=button],[type=reset],[type=submit]{margin-bottom:1rem;margin-bottom:var(--pico-spacing)}.secondary[role=button],.secondary[type=button],.secondary[type=submit],[type=file]::file-selector-button,[type=reset],button.secondary:not(.does-not-exist){--pico-background-color:var(--pico-secondary-background);--pico-border-color:var(--pico-secondary-border);--pico-color:var(--pico-secondary-inverse);cursor:pointer}[type=file]::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-background);--pico-border-color:var(--pico-secondary-border);--pico-color:var(--pico-secondary-inverse);cursor:pointer}:is(button,[type=submit],[type=button],[role=button]).secondary,[type=file]::file-selector-button,[type=reset]{--pico-background-color:var(--pico-secondary-background);--pico-border-color:var(--pico-secondary-border);--pico-color:var(--pico-secondary-inverse);cursor:pointer}.secondary[role=button]:active:not(.does-not-exist),.secondary[type=button]:active:not(.does-not-exist),.secondary[type=submit]:active:not(.does-not-exist),[type=reset]:active:not(.does-not-exist),button.secondary:not(.does-not-exist):active:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::file-selector-button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button:hover:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::file-selector-button:hover:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button:active:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::file-selector-button:active:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button:focus:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::file-selector-button:focus:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}.secondary[role=button]:focus:not(.does-not-exist),.secondary[role=button]:hover:not(.does-not-exist),.secondary[role=button][aria-current]:not([aria-current=false]),.secondary[type=button]:focus:not(.does-not-exist),.secondary[type=button]:hover:not(.does-not-exist),.secondary[type=button][aria-current]:not([aria-current=false]),.secondary[type=submit]:focus:not(.does-not-exist),.secondary[type=submit]:hover:not(.does-not-exist),.secondary[type=submit][aria-current]:not([aria-current=false]),[type=reset]:focus:not(.does-not-exist),[type=reset]:hover:not(.does-not-exist),[type=reset][aria-current]:not([aria-current=false]),button.secondary:not(.does-not-exist):focus:not(.does-not-exist),button.secondary:not(.does-not-exist):hover:not(.does-not-exist),button.secondary[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}:is(button,[type=submit],[type=button],[role=button]).secondary:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[type=file]::file-selector-button:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[type=reset]:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=file]::file-selector-button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=file]::-webkit-file-upload-button:focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}.secondary[role=button]:focus,.secondary[role=button][aria-current]:not([aria-current=false]):focus,.secondary[type=button]:focus,.secondary[type=button][aria-current]:not([aria-current=false]):focus,.secondary[type=submit]:focus,.secondary[type=submit][aria-current]:not([aria-current=false]):focus,[type=file]::file-selector-button:focus,[type=reset]:focus,[type=reset][aria-current]:not([aria-current=false]):focus,button.secondary:not(.does-not-exist):focus,button.secondary[aria-current]:not(.does-not-exist):not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=file]::-webkit-file-upload-button:focus,[type=file]::-webkit-file-upload-button:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}:is(button,[type=submit],[type=button],[role=button]).secondary:focus,:is(button,[type=submit],[type=button],[role=button]).secondary:is([aria-current]:not([aria-current=false])):focus,[type=file]::file-selector-button:focus,[type=file]::file-selector-button:is([aria-current]:not([aria-current=false])):focus,[type=reset]:focus,[type=reset]:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}.contrast[role=button],.contrast[type=button],.contrast[type=submit],button.contrast:not(.does-not-exist){--pico-background-color:var(--pico-contrast-background);--pico-border-color:var(--pico-contrast-border);--pico-color:var(--pico-contrast-inverse)}:is(button,[type=submit],[type=button],[role=button]).contrast{--pico-background-color:var(--pico-contrast-background);--pico-border-color:var(--pico-contrast-border);--pico-color:var(--pico-contrast-inverse)}.contrast[role=button]:active:not(.does-not-exist),.contrast[type=button]:active:not(.does-not-exist),.contrast[type=submit]:active:not(.does-not-exist),button.contrast:not(.does-not-exist):active:not(.does-not-exist){--pico-background-color:var(--pico-contrast-hover-background);--pico-border-color:var(--pico-contrast-hover-border);--pico-color:var(--pico-contrast-inverse)}.contrast[role=button]:focus:not(.does-not-exist),.contrast[role=button]:hover:not(.does-not-exist),.contrast[role=button][aria-current]:not([aria-current=false]),.contrast[type=button]:focus:not(.does-not-exist),.contrast[type=button]:hover:not(.does-not-exist),.contrast[type=button][aria-current]:not([aria-current=false]),.contrast[type=submit]:focus:not(.does-not-exist),.contrast[type=submit]:hover:not(.does-not-exist),.contrast[type=submit][aria-current]:not([aria-current=false]),button.contrast:not(.does-not-exist):focus:not(.does-not-exist),button.contrast:not(.does-not-exist):hover:not(.does-not-exist),button.contrast[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-background-color:var(--pico-contrast-hover-background);--pico-border-color:var(--pico-contrast-hover-border);--pico-color:var(--pico-contrast-inverse)}:is(button,[type=submit],[type=button],[role=button]).contrast:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-background-color:var(--pico-contrast-hover-background);--pico-border-color:var(--pico-contrast-hover-border);--pico-color:var(--pico-contrast-inverse)}.contrast[role=button]:focus,.contrast[role=button][aria-current]:not([aria-current=false]):focus,.contrast[type=button]:focus,.contrast[type=button][aria-current]:not([aria-current=false]):focus,.contrast[type=submit]:focus,.contrast[type=submit][aria-current]:not([aria-current=false]):focus,button.contrast:not(.does-not-exist):focus,button.contrast[aria-current]:not(.does-not-exist):not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-contrast-focus)}:is(button,[type=submit],[type=button],[role=button]).contrast:focus,:is(button,[type=submit],[type=button],[role=button]).contrast:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-contrast-focus)}.outline[role=button],.outline[type=button],.outline[type=submit],[type=reset].outline,button.outline:not(.does-not-exist){--pico-background-color:transparent;--pico-color:var(--pico-primary);--pico-border-color:var(--pico-primary)}:is(button,[type=submit],[type=button],[role=button]).outline,[type=reset].outline{--pico-background-color:transparent;--pico-color:var(--pico-primary);--pico-border-color:var(--pico-primary)}.outline[role=button]:active:not(.does-not-exist),.outline[type=button]:active:not(.does-not-exist),.outline[type=reset]:active:not(.does-not-exist),.outline[type=submit]:active:not(.does-not-exist),button.outline:not(.does-not-exist):active:not(.does-not-exist){--pico-background-color:transparent;--pico-color:var(--pico-primary-hover);--pico-border-color:var(--pico-primary-hover)}.outline[role=button]:focus:not(.does-not-exist),.outline[role=button]:hover:not(.does-not-exist),.outline[role=button][aria-current]:not([aria-current=false]),.outline[type=button]:focus:not(.does-not-exist),.outline[type=button]:hover:not(.does-not-exist),.outline[type=button][aria-current]:not([aria-current=false]),.outline[type=reset]:focus:not(.does-not-exist),.outline[type=reset]:hover:not(.does-not-exist),.outline[type=reset][aria-current]:not([aria-current=false]),.outline[type=submit]:focus:not(.does-not-exist),.outline[type=submit]:hover:not(.does-not-exist),.outline[type=submit][aria-current]:not([aria-current=false]),button.outline:not(.does-not-exist):focus:not(.does-not-exist),button.outline:not(.does-not-exist):hover:not(.does-not-exist),button.outline[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-background-color:transparent;--pico-color:var(--pico-primary-hover);--pico-border-color:var(--pico-primary-hover)}:is(button,[type=submit],[type=button],[role=button]).outline:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[type=reset].outline:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-background-color:transparent;--pico-color:var(--pico-primary-hover);--pico-border-color:var(--pico-primary-hover)}.outline.secondary[role=button],.outline.secondary[type=button],.outline.secondary[type=submit],[type=reset].outline,button.outline.secondary:not(.does-not-exist){--pico-color:var(--pico-secondary);--pico-border-color:var(--pico-secondary)}:is(button,[type=submit],[type=button],[role=button]).outline.secondary,[type=reset].outline{--pico-color:var(--pico-secondary);--pico-border-color:var(--pico-secondary)}.outline.secondary[role=button]:active:not(.does-not-exist),.outline.secondary[type=button]:active:not(.does-not-exist),.outline.secondary[type=submit]:active:not(.does-not-exist),.outline[type=reset]:active:not(.does-not-exist),button.outline.secondary:not(.does-not-exist):active:not(.does-not-exist){--pico-color:var(--pico-secondary-hover);--pico-border-color:var(--pico-secondary-hover)}.outline.secondary[role=button]:focus:not(.does-not-exist),.outline.secondary[role=button]:hover:not(.does-not-exist),.outline.secondary[role=button][aria-current]:not([aria-current=false]),.outline.secondary[type=button]:focus:not(.does-not-exist),.outline.secondary[type=button]:hover:not(.does-not-exist),.outline.secondary[type=button][aria-current]:not([aria-current=false]),.outline.secondary[type=submit]:focus:not(.does-not-exist),.outline.secondary[type=submit]:hover:not(.does-not-exist),.outline.secondary[type=submit][aria-current]:not([aria-current=false]),.outline[type=reset]:focus:not(.does-not-exist),.outline[type=reset]:hover:not(.does-not-exist),.outline[type=reset][aria-current]:not([aria-current=false]),button.outline.secondary:not(.does-not-exist):focus:not(.does-not-exist),button.outline.secondary:not(.does-not-exist):hover:not(.does-not-exist),button.outline.secondary[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-color:var(--pico-secondary-hover);--pico-border-color:var(--pico-secondary-hover)}:is(button,[type=submit],[type=button],[role=button]).outline.secondary:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[type=reset].outline:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-secondary-hover);--pico-border-color:var(--pico-secondary-hover)}.outline.contrast[role=button],.outline.contrast[type=button],.outline.contrast[type=submit],button.outline.contrast:not(.does-not-exist){--pico-color:var(--pico-contrast);--pico-border-color:var(--pico-contrast)}:is(button,[type=submit],[type=button],[role=button]).outline.contrast{--pico-color:var(--pico-contrast);--pico-border-color:var(--pico-contrast)}.outline.contrast[role=button]:active:not(.does-not-exist),.outline.contrast[type=button]:active:not(.does-not-exist),.outline.contrast[type=submit]:active:not(.does-not-exist),button.outline.contrast:not(.does-not-exist):active:not(.does-not-exist){--pico-color:var(--pico-contrast-hover);--pico-border-color:var(--pico-contrast-hover)}.outline.contrast[role=button]:focus:not(.does-not-exist),.outline.contrast[role=button]:hover:not(.does-not-exist),.outline.contrast[role=button][aria-current]:not([aria-current=false]),.outline.contrast[type=button]:focus:not(.does-not-exist),.outline.contrast[type=button]:hover:not(.does-not-exist),.outline.contrast[type=button][aria-current]:not([aria-current=false]),.outline.contrast[type=submit]:focus:not(.does-not-exist),.outline.contrast[type=submit]:hover:not(.does-not-exist),.outline.contrast[type=submit][aria-current]:not([aria-current=false]),button.outline.contrast:not(.does-not-exist):focus:not(.does-not-exist),button.outline.contrast:not(.does-not-exist):hover:not(.does-not-exist),button.outline.contrast[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-color:var(--pico-contrast-hover);--pico-border-color:var(--pico-contrast-hover)}:is(button,[type=submit],[type=button],[role=button]).outline.contrast:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-contrast-hover);--pico-border-color:var(--pico-contrast-hover)}:where(fieldset[disabled]) button:not(.does-not-exist){opacity:.5;pointer-events:none}:where(button,[type=submit],[type=reset],[type=button],[role=button])[disabled],:where(fieldset[disabled]) [role=button],:where(fieldset[disabled]) [type=button],:where(fieldset[disabled]) [type=reset],:where(fieldset[disabled]) [type=submit]{opacity:.5;pointer-events:none}:where(button,[type=submit],[type=reset],[type=button],[role=button])[disabled],:where(fieldset[disabled]) :is(button,[type=submit],[type=button],[type=reset],[role=button]){opacity:.5;pointer-events:none}:where(table){width:100%;border-collapse:collapse;border-spacing:0;text-indent:0}td,th{padding:calc(1rem/2) 1rem;padding:calc(var(--pico-spacing)/2) var(--pico-spacing);border-bottom:.0625rem solid var(--pico-table-border-color);border-bottom:var(--pico-border-width) solid var(--pico-table-border-color);background-color:var(--pico-background-color);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);text-align:left;text-align:start}tfoot td,tfoot th{border-top:.0625rem solid var(--pico-table-border-color);border-top:var(--pico-border-width) solid var(--pico-table-border-color);border-bottom:0}table.striped tbody tr:nth-child(odd) td,table.striped tbody tr:nth-child(odd) th{background-color:var(--pico-table-row-stripped-background-color)}:where(audio,canvas,iframe,img,svg,video){vertical-align:middle}audio:not([controls]){display:none;height:0}:where(iframe){border-style:none}img{max-width:100%;height:auto;border-style:none}:where(svg:not([fill])){fill:currentColor}svg:not(:host),svg:not(:root){overflow:hidden}code,kbd,pre,samp{font-size:.875em;font-family:system-ui,-apple-system,Segoe UI,Roboto,Ubuntu,Cantarell,Noto Sans,sans-serif,"Segoe UI",Roboto,Oxygen,Ubuntu,Cantarell,Helvetica,Arial,"Helvetica Neue",sans-serif,"Apple Color Emoji","Segoe UI Emoji","Segoe UI Symbol","Noto Color Emoji";font-family:var(--pico-font-family)}pre code,pre samp{font-size:inherit;font-family:inherit}pre{-ms-overflow-style:scrollbar;overflow:auto}code,kbd,pre,samp{border-radius:.25rem;border-radius:var(--pico-border-radius);background:var(--pico-code-background-color);color:var(--pico-code-color);font-weight:400;font-weight:var(--pico-font-weight);line-height:initial}kbd{background-color:var(--pico-code-kbd-background-color);color:var(--pico-code-kbd-color);vertical-align:baseline}code,kbd,samp{display:inline-block;padding:.375rem}figure,pre{display:block}pre{margin-bottom:1rem;margin-bottom:var(--pico-spacing);overflow-x:auto}input,optgroup,pre>code,pre>samp,select,textarea{line-height:1.5;line-height:var(--pico-line-height)}pre>code,pre>samp{display:block;padding:1rem;padding:var(--pico-spacing);background:0 0}figure{margin:0;padding:0}figure figcaption{padding:calc(1rem*.5)0;padding:calc(var(--pico-spacing)*.5)0;color:var(--pico-muted-color)}hr,legend{color:inherit}hr{height:0;margin:1rem 0;margin:var(--pico-typography-spacing-vertical)0;border:0;border-top:1px solid var(--pico-muted-border-color)}[hidden],template{display:none!important}input,optgroup,select,textarea{margin:0;font-size:1rem;font-family:inherit;letter-spacing:inherit}input{overflow:visible}select{text-transform:none}legend{max-width:100%;white-space:normal}textarea{overflow:auto}[type=checkbox],[type=radio],legend{padding:0}::-webkit-inner-spin-button,::-webkit-outer-spin-button{height:auto}[type=search]{-webkit-appearance:textfield;outline-offset:-2px}[type=search]::-webkit-search-decoration{-webkit-appearance:none}::-webkit-file-upload-button{-webkit-appearance:button;font:inherit}::-moz-focus-inner{padding:0;border-style:none}:-moz-focusring{outline:0}:-moz-ui-invalid{box-shadow:none}::-ms-expand{display:none}[type=file]{padding:0}[type=range]{padding:0;border-width:0}input:not([type=checkbox]):not([type=radio]):not([type=range]){height:calc(1rem*1.5 + .75rem*2 + .0625rem*2);height:calc(1rem*var(--pico-line-height) + var(--pico-form-element-spacing-vertical)*2 + var(--pico-border-width)*2)}fieldset{width:100%;margin:0;margin-bottom:1rem;margin-bottom:var(--pico-spacing);padding:0;border:0}fieldset legend,label{display:block;margin-bottom:calc(1rem*.375);margin-bottom:calc(var(--pico-spacing)*.375);color:var(--pico-color);font-weight:400;font-weight:var(--pico-form-label-font-weight, var(--pico-font-weight))}fieldset legend{margin-bottom:calc(1rem*.5);margin-bottom:calc(var(--pico-spacing)*.5)}button[type=submit],input:not([type=checkbox]):not([type=radio]),select,textarea{width:100%}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),select,textarea{-webkit-appearance:none;-moz-appearance:none;appearance:none;padding:.75rem 1rem;padding:var(--pico-form-element-spacing-vertical) var(--pico-form-element-spacing-horizontal)}input,select,textarea{--pico-background-color:var(--pico-form-element-background-color);--pico-border-color:var(--pico-form-element-border-color);--pico-color:var(--pico-form-element-color);--pico-box-shadow:none;border:.0625rem solid var(--pico-border-color);border:var(--pico-border-width) solid var(--pico-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);outline:0;background-color:var(--pico-background-color);-webkit-box-shadow:none;box-shadow:none;-webkit-box-shadow:var(--pico-box-shadow);box-shadow:var(--pico-box-shadow);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);-webkit-transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}input:not([type=submit]):not([type=button]):not([type=reset]):not([type=checkbox]):not([type=radio]):not([readonly]):active{--pico-background-color:var(--pico-form-element-active-background-color)}:where(select,textarea):not([readonly]):active{--pico-background-color:var(--pico-form-element-active-background-color)}:where(select,textarea):not([readonly]):focus{--pico-background-color:var(--pico-form-element-active-background-color)}input:not([type=submit]):not([type=button]):not([type=reset]):not([type=checkbox]):not([type=radio]):not([readonly]):focus{--pico-background-color:var(--pico-form-element-active-background-color)}:where(select,textarea):not([readonly]):is(:active,:focus),input:not([type=submit]):not([type=button]):not([type=reset]):not([type=checkbox]):not([type=radio]):not([readonly]):is(:active,:focus){--pico-background-color:var(--pico-form-element-active-background-color)}input:not([type=submit]):not([type=button]):not([type=reset]):not([role=switch]):not([readonly]):active{--pico-border-color:var(--pico-form-element-active-border-color)}:where(select,textarea):not([readonly]):active{--pico-border-color:var(--pico-form-element-active-border-color)}:where(select,textarea):not([readonly]):focus{--pico-border-color:var(--pico-form-element-active-border-color)}input:not([type=submit]):not([type=button]):not([type=reset]):not([role=switch]):not([readonly]):focus{--pico-border-color:var(--pico-form-element-active-border-color)}:where(select,textarea):not([readonly]):is(:active,:focus),input:not([type=submit]):not([type=button]):not([type=reset]):not([role=switch]):not([readonly]):is(:active,:focus){--pico-border-color:var(--pico-form-element-active-border-color)}:where(select,textarea):not([readonly]):focus,input:not([type=submit]):not([type=button]):not([type=reset]):not([type=range]):not([type=file]):not([readonly]):focus{--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-focus-color)}:where(fieldset[disabled]) input:not([type=submit]):not([type=button]):not([type=reset]),:where(fieldset[disabled]) select:not(.does-not-exist):not(.does-not-exist):not(.does-not-exist),:where(fieldset[disabled]) textarea:not(.does-not-exist):not(.does-not-exist):not(.does-not-exist){opacity:var(--pico-form-element-disabled-opacity);pointer-events:none}input:not([type=submit]):not([type=button]):not([type=reset])[disabled],label[aria-disabled=true],select[disabled],textarea[disabled]{opacity:var(--pico-form-element-disabled-opacity);pointer-events:none}:where(fieldset[disabled]) :is(input:not([type=submit]):not([type=button]):not([type=reset]),select,textarea),input:not([type=submit]):not([type=button]):not([type=reset])[disabled],label[aria-disabled=true],select[disabled],textarea[disabled]{opacity:var(--pico-form-element-disabled-opacity);pointer-events:none}label[aria-disabled=true] input[disabled]{opacity:1}:where(input,select,textarea):not([type=checkbox]):not([type=radio]):not([type=date]):not([type=datetime-local]):not([type=month]):not([type=time]):not([type=week]):not([type=range])[aria-invalid]{padding-right:calc(1rem + 1.5rem)!important;padding-right:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem)!important;padding-left:1rem;padding-left:var(--pico-form-element-spacing-horizontal);-webkit-padding-start:1rem!important;padding-inline-start:1rem!important;-webkit-padding-start:var(--pico-form-element-spacing-horizontal)!important;padding-inline-start:var(--pico-form-element-spacing-horizontal)!important;-webkit-padding-end:calc(1rem + 1.5rem)!important;padding-inline-end:calc(1rem + 1.5rem)!important;-webkit-padding-end:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem)!important;padding-inline-end:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem)!important;background-position:center right .75rem;background-size:1rem auto;background-repeat:no-repeat}:where(input,select,textarea):not([type=checkbox]):not([type=radio]):not([type=date]):not([type=datetime-local]):not([type=month]):not([type=time]):not([type=week]):not([type=range])[aria-invalid=false]:not(select){background-image:var(--pico-icon-valid)}:where(input,select,textarea):not([type=checkbox]):not([type=radio]):not([type=date]):not([type=datetime-local]):not([type=month]):not([type=time]):not([type=week]):not([type=range])[aria-invalid=true]:not(select){background-image:var(--pico-icon-invalid)}:where(input,select,textarea)[aria-invalid=false]{--pico-border-color:var(--pico-form-element-valid-border-color)}[aria-invalid=false]:where(input,select,textarea):active{--pico-border-color:var(--pico-form-element-valid-active-border-color)!important}[aria-invalid=false]:where(input,select,textarea):focus{--pico-border-color:var(--pico-form-element-valid-active-border-color)!important}:where(input,select,textarea)[aria-invalid=false]:is(:active,:focus){--pico-border-color:var(--pico-form-element-valid-active-border-color)!important}[aria-invalid=false]:where(input,select,textarea):active:not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-valid-focus-color)!important}[aria-invalid=false]:where(input,select,textarea):focus:not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-valid-focus-color)!important}:where(input,select,textarea)[aria-invalid=false]:is(:active,:focus):not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-valid-focus-color)!important}:where(input,select,textarea)[aria-invalid=true]{--pico-border-color:var(--pico-form-element-invalid-border-color)}[aria-invalid=true]:where(input,select,textarea):active{--pico-border-color:var(--pico-form-element-invalid-active-border-color)!important}[aria-invalid=true]:where(input,select,textarea):focus{--pico-border-color:var(--pico-form-element-invalid-active-border-color)!important}:where(input,select,textarea)[aria-invalid=true]:is(:active,:focus){--pico-border-color:var(--pico-form-element-invalid-active-border-color)!important}[aria-invalid=true]:where(input,select,textarea):active:not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-invalid-focus-color)!important}[aria-invalid=true]:where(input,select,textarea):focus:not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-invalid-focus-color)!important}:where(input,select,textarea)[aria-invalid=true]:is(:active,:focus):not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-invalid-focus-color)!important}[dir=rtl] [aria-invalid=false]:where(input,select,textarea):not([type=checkbox]):not([type=radio]),[dir=rtl] [aria-invalid=true]:where(input,select,textarea):not([type=checkbox]):not([type=radio]),[dir=rtl] [aria-invalid]:where(input,select,textarea):not([type=checkbox]):not([type=radio]){background-position:center left .75rem}[dir=rtl] :where(input,select,textarea):not([type=checkbox]):not([type=radio]):is([aria-invalid],[aria-invalid=true],[aria-invalid=false]){background-position:center left .75rem}input::-webkit-input-placeholder,textarea::-webkit-input-placeholder{color:var(--pico-form-element-placeholder-color);opacity:1}input::-webkit-input-placeholder,input::placeholder,select:invalid,textarea::-webkit-input-placeholder,textarea::placeholder{color:var(--pico-form-element-placeholder-color);opacity:1}input:not([type=checkbox]):not([type=radio]),select,textarea{margin-bottom:1rem;margin-bottom:var(--pico-spacing)}select::-ms-expand{border:0;background-color:transparent}select:not([multiple]):not([size]){padding-right:calc(1rem + 1.5rem);padding-right:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem);padding-left:1rem;padding-left:var(--pico-form-element-spacing-horizontal);-webkit-padding-start:1rem;padding-inline-start:1rem;-webkit-padding-start:var(--pico-form-element-spacing-horizontal);padding-inline-start:var(--pico-form-element-spacing-horizontal);-webkit-padding-end:calc(1rem + 1.5rem);padding-inline-end:calc(1rem + 1.5rem);-webkit-padding-end:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem);padding-inline-end:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem);background-image:url('+C+");background-image:var(--pico-icon-chevron);background-position:center right .75rem;background-size:1rem auto;background-repeat:no-repeat}select[multiple] option:checked{background:var(--pico-form-element-selected-background-color);color:var(--pico-form-element-color)}[dir=rtl] select:not([multiple]):not([size]){background-position:center left .75rem}textarea{display:block;resize:vertical}textarea[aria-invalid]{--pico-icon-height:calc(1rem * var(--pico-line-height) + var(--pico-form-element-spacing-vertical) * 2 + var(--pico-border-width) * 2);background-position:top right .75rem!important;background-size:1rem calc(1rem*1.5 + .75rem*2 + .0625rem*2)!important;background-size:1rem var(--pico-icon-height)!important}:where(input,select,textarea,fieldset,.grid)+small{display:block;width:100%;margin-top:calc(1rem*-.75);margin-top:calc(var(--pico-spacing)*-.75);margin-bottom:1rem;margin-bottom:var(--pico-spacing);color:var(--pico-muted-color)}:where(input,select,textarea,fieldset,.grid)[aria-invalid=false]+small{color:var(--pico-ins-color)}:where(input,select,textarea,fieldset,.grid)[aria-invalid=true]+small{color:var(--pico-del-color)}label>:where(input,select,textarea){margin-top:calc(1rem*.25);margin-top:calc(var(--pico-spacing)*.25)}label:has([type=checkbox],[type=radio]){width:-moz-fit-content;width:-webkit-fit-content;width:fit-content;cursor:pointer}[type=checkbox],[type=radio]{-webkit-appearance:none;-moz-appearance:none;appearance:none;width:1.25em;height:1.25em;margin-top:-.125em;margin-right:.5em;border-width:.0625rem;border-width:var(--pico-border-width);vertical-align:middle;cursor:pointer}[type=checkbox]::-ms-check,[type=radio]::-ms-check{display:none}[type=checkbox]:checked,[type=checkbox]:checked:active,[type=checkbox]:checked:focus{background-image:url("+k+")}[type=checkbox]:checked,[type=checkbox]:checked:active,[type=checkbox]:checked:focus,[type=radio]:checked,[type=radio]:checked:active,[type=radio]:checked:focus{--pico-background-color:var(--pico-primary-background);--pico-border-color:var(--pico-primary-border);background-image:var(--pico-icon-checkbox);background-position:center;background-size:.75em auto;background-repeat:no-repeat}[type=checkbox]~label,[type=radio]~label{display:inline-block;margin-bottom:0;cursor:pointer}[type=checkbox]~label:not(:last-of-type),[type=radio]~label:not(:last-of-type){margin-right:1em}[type=checkbox]:indeterminate{--pico-background-color:var(--pico-primary-background);--pico-border-color:var(--pico-primary-border);background-image:url("+x+');background-image:var(--pico-icon-minus);background-position:center;background-size:.75em auto;background-repeat:no-repeat}[type=radio]{border-radius:50%}[type=radio]:checked,[type=radio]:checked:active,[type=radio]:checked:focus{--pico-background-color:var(--pico-primary-inverse);border-width:.35em;background-image:none}[type=checkbox][role=switch]{--pico-background-color:var(--pico-switch-background-color);--pico-color:var(--pico-switch-color);width:2.25em;height:1.25em;border:.0625rem solid var(--pico-border-color);border:var(--pico-border-width) solid var(--pico-border-color);border-radius:1.25em;background-color:var(--pico-background-color);line-height:1.25em}[type=checkbox][role=switch]:not([aria-invalid]){--pico-border-color:var(--pico-switch-background-color)}[type=checkbox][role=switch]:before{display:block;aspect-ratio:1;height:100%;border-radius:50%;background-color:var(--pico-color);-webkit-box-shadow:var(--pico-switch-thumb-box-shadow);box-shadow:var(--pico-switch-thumb-box-shadow);content:"";-webkit-transition:margin .1s ease-in-out;transition:margin .1s ease-in-out}[type=checkbox][role=switch]:focus{--pico-background-color:var(--pico-switch-background-color);--pico-border-color:var(--pico-switch-background-color)}[type=checkbox][role=switch]:checked{--pico-background-color:var(--pico-switch-checked-background-color);--pico-border-color:var(--pico-switch-checked-background-color);background-image:none}[type=checkbox][role=switch]:checked::before{margin-left:1em}[type=checkbox][role=switch][disabled]{--pico-background-color:var(--pico-border-color)}[type=checkbox][aria-invalid=false]:checked,[type=checkbox][aria-invalid=false]:checked:active,[type=checkbox][aria-invalid=false]:checked:focus,[type=checkbox][role=switch][aria-invalid=false]:checked,[type=checkbox][role=switch][aria-invalid=false]:checked:active,[type=checkbox][role=switch][aria-invalid=false]:checked:focus{--pico-background-color:var(--pico-form-element-valid-border-color)}[type=checkbox]:checked:active[aria-invalid=true],[type=checkbox]:checked:focus[aria-invalid=true],[type=checkbox]:checked[aria-invalid=true],[type=checkbox][role=switch]:checked:active[aria-invalid=true],[type=checkbox][role=switch]:checked:focus[aria-invalid=true],[type=checkbox][role=switch]:checked[aria-invalid=true]{--pico-background-color:var(--pico-form-element-invalid-border-color)}[type=checkbox][aria-invalid=false]:checked,[type=checkbox][aria-invalid=false]:checked:active,[type=checkbox][aria-invalid=false]:checked:focus,[type=checkbox][role=switch][aria-invalid=false]:checked,[type=checkbox][role=switch][aria-invalid=false]:checked:active,[type=checkbox][role=switch][aria-invalid=false]:checked:focus,[type=radio][aria-invalid=false]:checked,[type=radio][aria-invalid=false]:checked:active,[type=radio][aria-invalid=false]:checked:focus{--pico-border-color:var(--pico-form-element-valid-border-color)}[type=checkbox]:checked:active[aria-invalid=true],[type=checkbox]:checked:focus[aria-invalid=true],[type=checkbox]:checked[aria-invalid=true],[type=checkbox][role=switch]:checked:active[aria-invalid=true],[type=checkbox][role=switch]:checked:focus[aria-invalid=true],[type=checkbox][role=switch]:checked[aria-invalid=true],[type=radio]:checked:active[aria-invalid=true],[type=radio]:checked:focus[aria-invalid=true],[type=radio]:checked[aria-invalid=true]{--pico-border-color:var(--pico-form-element-invalid-border-color)}[type=color]::-webkit-color-swatch-wrapper{padding:0}[type=color]::-moz-focus-inner{padding:0}[type=color]::-webkit-color-swatch{border:0;border-radius:calc(.25rem*.5);border-radius:calc(var(--pico-border-radius)*.5)}[type=color]::-moz-color-swatch{border:0;border-radius:calc(.25rem*.5);border-radius:calc(var(--pico-border-radius)*.5)}input[type=date]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),input[type=datetime-local]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),input[type=month]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),input[type=time]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),input[type=week]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]){--pico-icon-position:0.75rem;--pico-icon-width:1rem;padding-right:calc(1rem + .75rem);padding-right:calc(var(--pico-icon-width) + var(--pico-icon-position));background-image:url('+N+");background-image:var(--pico-icon-date);background-position:center right .75rem;background-position:center right var(--pico-icon-position);background-size:1rem auto;background-size:var(--pico-icon-width) auto;background-repeat:no-repeat}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]):is([type=date],[type=datetime-local],[type=month],[type=time],[type=week]){--pico-icon-position:0.75rem;--pico-icon-width:1rem;padding-right:calc(1rem + .75rem);padding-right:calc(var(--pico-icon-width) + var(--pico-icon-position));background-image:url("+N+");background-image:var(--pico-icon-date);background-position:center right .75rem;background-position:center right var(--pico-icon-position);background-size:1rem auto;background-size:var(--pico-icon-width) auto;background-repeat:no-repeat}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=time]{background-image:url("+E+");background-image:var(--pico-icon-time)}[type=date]::-webkit-calendar-picker-indicator,[type=datetime-local]::-webkit-calendar-picker-indicator,[type=month]::-webkit-calendar-picker-indicator,[type=time]::-webkit-calendar-picker-indicator,[type=week]::-webkit-calendar-picker-indicator{width:var(--pico-icon-width);margin-right:calc(var(--pico-icon-width)*-1);margin-left:var(--pico-icon-position);opacity:0}@-moz-document url-prefix(){[type=date],[type=datetime-local],[type=month],[type=time],[type=week]{padding-right:1rem!important;padding-right:var(--pico-form-element-spacing-horizontal)!important;background-image:none!important}}[dir=rtl] [type=date],[dir=rtl] [type=datetime-local],[dir=rtl] [type=month],[dir=rtl] [type=time],[dir=rtl] [type=week]{text-align:right}[dir=rtl] :is([type=date],[type=datetime-local],[type=month],[type=time],[type=week]){text-align:right}[type=file]{--pico-color:var(--pico-muted-color);margin-left:calc(.125rem*-1);margin-left:calc(var(--pico-outline-width)*-1);padding:calc(.75rem*.5)0;padding:calc(var(--pico-form-element-spacing-vertical)*.5)0;padding-left:.125rem;padding-left:var(--pico-outline-width);border:0;border-radius:0;background:0 0}[type=file]::-webkit-file-upload-button{margin-right:calc(1rem/2);margin-right:calc(var(--pico-spacing)/2);padding:calc(.75rem*.5) 1rem;padding:calc(var(--pico-form-element-spacing-vertical)*.5) var(--pico-form-element-spacing-horizontal)}[type=file]::file-selector-button{margin-right:calc(1rem/2);margin-right:calc(var(--pico-spacing)/2);padding:calc(.75rem*.5) 1rem;padding:calc(var(--pico-form-element-spacing-vertical)*.5) var(--pico-form-element-spacing-horizontal)}[type=file]:hover::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:hover::file-selector-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:active::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:active::file-selector-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:focus::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:focus::file-selector-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:is(:hover,:active,:focus)::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:is(:hover,:active,:focus)::file-selector-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:focus::-webkit-file-upload-button{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=file]:focus::file-selector-button{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=range]{-webkit-appearance:none;-moz-appearance:none;appearance:none;width:100%;height:1.25rem;background:0 0}[type=range]::-webkit-slider-runnable-track{width:100%;height:.375rem;border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-range-border-color);-webkit-transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),box-shadow var(--pico-transition);-webkit-transition:background-color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}[type=range]::-moz-range-track{width:100%;height:.375rem;border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-range-border-color);-moz-transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;-moz-transition:background-color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),box-shadow var(--pico-transition)}[type=range]::-ms-track{width:100%;height:.375rem;border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-range-border-color);-ms-transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;-ms-transition:background-color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),box-shadow var(--pico-transition)}[type=range]::-webkit-slider-thumb{-webkit-appearance:none;width:1.25rem;height:1.25rem;margin-top:-.4375rem;border:2px solid var(--pico-range-thumb-border-color);border-radius:50%;background-color:var(--pico-range-thumb-color);cursor:pointer;-webkit-transition:background-color .2s ease-in-out,transform .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),transform var(--pico-transition);-webkit-transition:background-color .2s ease-in-out,-webkit-transform .2s ease-in-out;transition:background-color .2s ease-in-out,transform .2s ease-in-out;transition:background-color .2s ease-in-out,transform .2s ease-in-out,-webkit-transform .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),-webkit-transform var(--pico-transition);transition:background-color var(--pico-transition),transform var(--pico-transition);transition:background-color var(--pico-transition),transform var(--pico-transition),-webkit-transform var(--pico-transition)}[type=range]::-moz-range-thumb{-webkit-appearance:none;width:1.25rem;height:1.25rem;margin-top:-.4375rem;border:2px solid var(--pico-range-thumb-border-color);border-radius:50%;background-color:var(--pico-range-thumb-color);cursor:pointer;-moz-transition:background-color .2s ease-in-out,transform .2s ease-in-out;transition:background-color .2s ease-in-out,transform .2s ease-in-out;-moz-transition:background-color var(--pico-transition),transform var(--pico-transition);transition:background-color var(--pico-transition),transform var(--pico-transition)}[type=range]::-ms-thumb{-webkit-appearance:none;width:1.25rem;height:1.25rem;margin-top:-.4375rem;border:2px solid var(--pico-range-thumb-border-color);border-radius:50%;background-color:var(--pico-range-thumb-color);cursor:pointer;-ms-transition:background-color .2s ease-in-out,transform .2s ease-in-out;transition:background-color .2s ease-in-out,transform .2s ease-in-out;-ms-transition:background-color var(--pico-transition),transform var(--pico-transition);transition:background-color var(--pico-transition),transform var(--pico-transition)}[type=range]:active,[type=range]:focus-within{--pico-range-border-color:var(--pico-range-active-border-color);--pico-range-thumb-color:var(--pico-range-thumb-active-color)}[type=range]:active::-webkit-slider-thumb{-webkit-transform:scale(1.25);transform:scale(1.25)}[type=range]:active::-moz-range-thumb{transform:scale(1.25)}[type=range]:active::-ms-thumb{transform:scale(1.25)}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search]{padding-left:calc(1rem + 1.75rem);padding-left:calc(var(--pico-form-element-spacing-horizontal) + 1.75rem);background-image:url("+L+");background-image:var(--pico-icon-search);background-position:center left calc(1rem + .125rem);background-position:center left calc(var(--pico-form-element-spacing-horizontal) + .125rem);background-size:1rem auto;background-repeat:no-repeat}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search][aria-invalid]{padding-left:calc(1rem + 1.75rem)!important;padding-left:calc(var(--pico-form-element-spacing-horizontal) + 1.75rem)!important;background-position:center left 1.125rem,center right .75rem}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search][aria-invalid=false]{background-image:var(--pico-icon-search),var(--pico-icon-valid)}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search][aria-invalid=true]{background-image:var(--pico-icon-search),var(--pico-icon-invalid)}[dir=rtl] :where(input):not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search]{background-position:center right 1.125rem}[dir=rtl] :where(input):not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search][aria-invalid]{background-position:center right 1.125rem,center left .75rem}details{display:block;margin-bottom:1rem;margin-bottom:var(--pico-spacing)}details summary{line-height:1rem;list-style-type:none;cursor:pointer;-webkit-transition:color .2s ease-in-out;transition:color .2s ease-in-out;-webkit-transition:color var(--pico-transition);transition:color var(--pico-transition)}details summary:not([role]){color:var(--pico-accordion-close-summary-color)}details summary::-webkit-details-marker{display:none}details summary::marker{display:none}details summary::-moz-list-bullet{list-style-type:none}details summary::after{display:block;width:1rem;height:1rem;margin-left:calc(1rem*.5);margin-left:calc(var(--pico-spacing, 1rem)*.5);float:right;-webkit-transform:rotate(-90deg);transform:rotate(-90deg);background-image:url("+C+');background-image:var(--pico-icon-chevron);background-position:right center;background-size:1rem auto;background-repeat:no-repeat;content:"";-webkit-transition:-webkit-transform .2s ease-in-out;transition:transform .2s ease-in-out;transition:transform .2s ease-in-out,-webkit-transform .2s ease-in-out;-webkit-transition:-webkit-transform var(--pico-transition);transition:transform var(--pico-transition);transition:transform var(--pico-transition),-webkit-transform var(--pico-transition)}details summary:focus{outline:0}details summary:focus:not([role]){color:var(--pico-accordion-active-summary-color)}details summary:focus-visible:not([role]){outline:.125rem solid var(--pico-primary-focus);outline:var(--pico-outline-width) solid var(--pico-primary-focus);outline-offset:calc(1rem*.5);outline-offset:calc(var(--pico-spacing, 1rem)*.5);color:var(--pico-primary)}details summary[role=button]{width:100%;text-align:left}details summary[role=button]::after{height:calc(1rem*1.5);height:calc(1rem*var(--pico-line-height, 1.5))}details[open]>summary{margin-bottom:1rem;margin-bottom:var(--pico-spacing)}details[open]>summary:not([role]):not(:focus){color:var(--pico-accordion-open-summary-color)}details[open]>summary::after{-webkit-transform:rotate(0);transform:rotate(0)}[dir=rtl] details summary,dialog>article>footer{text-align:right}[dir=rtl] details summary::after{float:left;background-position:left center}article{padding:1rem;padding:var(--pico-block-spacing-vertical) var(--pico-block-spacing-horizontal);border-radius:.25rem;border-radius:var(--pico-border-radius);background:var(--pico-card-background-color);-webkit-box-shadow:var(--pico-card-box-shadow);box-shadow:var(--pico-card-box-shadow)}article>footer,article>header{margin-right:calc(1rem*-1);margin-right:calc(var(--pico-block-spacing-horizontal)*-1);margin-left:calc(1rem*-1);margin-left:calc(var(--pico-block-spacing-horizontal)*-1);padding:calc(1rem*.66) 1rem;padding:calc(var(--pico-block-spacing-vertical)*.66) var(--pico-block-spacing-horizontal);background-color:var(--pico-card-sectioning-background-color)}article,article>header{margin-bottom:1rem;margin-bottom:var(--pico-block-spacing-vertical)}article>header{margin-top:calc(1rem*-1);margin-top:calc(var(--pico-block-spacing-vertical)*-1);border-bottom:.0625rem solid var(--pico-card-border-color);border-bottom:var(--pico-border-width) solid var(--pico-card-border-color);border-top-right-radius:.25rem;border-top-right-radius:var(--pico-border-radius);border-top-left-radius:.25rem;border-top-left-radius:var(--pico-border-radius)}article>footer{margin-top:1rem;margin-top:var(--pico-block-spacing-vertical);margin-bottom:calc(1rem*-1);margin-bottom:calc(var(--pico-block-spacing-vertical)*-1);border-top:.0625rem solid var(--pico-card-border-color);border-top:var(--pico-border-width) solid var(--pico-card-border-color);border-bottom-right-radius:.25rem;border-bottom-right-radius:var(--pico-border-radius);border-bottom-left-radius:.25rem;border-bottom-left-radius:var(--pico-border-radius)}details.dropdown{position:relative;border-bottom:none}details.dropdown>a::after,details.dropdown>button::after,details.dropdown>summary::after{display:block;width:1rem;height:calc(1rem*1.5);height:calc(1rem*var(--pico-line-height, 1.5));margin-left:.25rem;float:right;-webkit-transform:rotate(0deg) translateX(.2rem);transform:rotate(0deg) translateX(.2rem);background-image:url('+C+');background-image:var(--pico-icon-chevron);background-position:right center;background-size:1rem auto;background-repeat:no-repeat;content:""}nav details.dropdown{margin-bottom:0;display:inline;margin:calc(1rem*-1)0;margin:calc(var(--pico-nav-element-spacing-vertical)*-1)0}details.dropdown>summary:not([role]){height:calc(1rem*1.5 + .75rem*2 + .0625rem*2);height:calc(1rem*var(--pico-line-height) + var(--pico-form-element-spacing-vertical)*2 + var(--pico-border-width)*2);padding:.75rem 1rem;padding:var(--pico-form-element-spacing-vertical) var(--pico-form-element-spacing-horizontal);border:.0625rem solid var(--pico-form-element-border-color);border:var(--pico-border-width) solid var(--pico-form-element-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-form-element-background-color);color:var(--pico-form-element-placeholder-color);line-height:inherit;cursor:pointer;-webkit-user-select:none;-moz-user-select:none;-ms-user-select:none;user-select:none;-webkit-transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}details.dropdown>summary:not([role]):active,details.dropdown>summary:not([role]):focus{border-color:var(--pico-form-element-active-border-color);background-color:var(--pico-form-element-active-background-color)}details.dropdown>summary:not([role]):focus{-webkit-box-shadow:0 0 0 .125rem var(--pico-form-element-focus-color);box-shadow:0 0 0 .125rem var(--pico-form-element-focus-color);-webkit-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-focus-color);box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-focus-color)}details.dropdown>summary:not([role]):focus-visible{outline:0}details.dropdown>summary:not([role])[aria-invalid=false]{--pico-form-element-border-color:var(--pico-form-element-valid-border-color);--pico-form-element-active-border-color:var(--pico-form-element-valid-focus-color);--pico-form-element-focus-color:var(--pico-form-element-valid-focus-color)}details.dropdown>summary:not([role])[aria-invalid=true]{--pico-form-element-border-color:var(--pico-form-element-invalid-border-color);--pico-form-element-active-border-color:var(--pico-form-element-invalid-focus-color);--pico-form-element-focus-color:var(--pico-form-element-invalid-focus-color)}nav details.dropdown>summary::after{-webkit-transform:rotate(0deg) translateX(0);transform:rotate(0deg) translateX(0)}nav details.dropdown>summary:not([role]){height:calc(1rem*1.5 + .5rem*2);height:calc(1rem*var(--pico-line-height) + var(--pico-nav-link-spacing-vertical)*2);padding:calc(.5rem - .0625rem*2) .5rem;padding:calc(var(--pico-nav-link-spacing-vertical) - var(--pico-border-width)*2) var(--pico-nav-link-spacing-horizontal)}nav details.dropdown>summary:not([role]):focus-visible{-webkit-box-shadow:0 0 0 .125rem var(--pico-primary-focus);box-shadow:0 0 0 .125rem var(--pico-primary-focus);-webkit-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-primary-focus);box-shadow:0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}details.dropdown>summary+ul{display:-webkit-box;display:-ms-flexbox;display:flex;z-index:99;position:absolute;left:0;-webkit-box-orient:vertical;-webkit-box-direction:normal;-ms-flex-direction:column;flex-direction:column;width:100%;min-width:-moz-fit-content;min-width:-webkit-fit-content;min-width:fit-content;margin:0;margin-top:.125rem;margin-top:var(--pico-outline-width);padding:0;border:.0625rem solid var(--pico-dropdown-border-color);border:var(--pico-border-width) solid var(--pico-dropdown-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-dropdown-background-color);-webkit-box-shadow:var(--pico-dropdown-box-shadow);box-shadow:var(--pico-dropdown-box-shadow);color:var(--pico-dropdown-color);white-space:nowrap;opacity:0;-webkit-transition:opacity .2s ease-in-out,-webkit-transform 0s ease-in-out 1s;transition:opacity .2s ease-in-out,transform 0s ease-in-out 1s;transition:opacity .2s ease-in-out,transform 0s ease-in-out 1s,-webkit-transform 0s ease-in-out 1s;-webkit-transition:opacity var(--pico-transition),-webkit-transform 0s ease-in-out 1s;transition:opacity var(--pico-transition),transform 0s ease-in-out 1s;transition:opacity var(--pico-transition),transform 0s ease-in-out 1s,-webkit-transform 0s ease-in-out 1s}details.dropdown>summary+ul[dir=rtl]{right:0;left:auto}details.dropdown>summary+ul li{width:100%;margin-bottom:0;padding:calc(.75rem*.5) 1rem;padding:calc(var(--pico-form-element-spacing-vertical)*.5) var(--pico-form-element-spacing-horizontal);list-style:none}details.dropdown>summary+ul li:first-of-type{margin-top:calc(.75rem*.5);margin-top:calc(var(--pico-form-element-spacing-vertical)*.5)}details.dropdown>summary+ul li:last-of-type{margin-bottom:calc(.75rem*.5);margin-bottom:calc(var(--pico-form-element-spacing-vertical)*.5)}details.dropdown>summary+ul li a{display:block;margin:calc(var(--pico-form-element-spacing-vertical)*-.5) calc(var(--pico-form-element-spacing-horizontal)*-1);padding:calc(.75rem*.5) 1rem;padding:calc(var(--pico-form-element-spacing-vertical)*.5) var(--pico-form-element-spacing-horizontal);overflow:hidden;border-radius:0;color:var(--pico-dropdown-color);-webkit-text-decoration:none;text-decoration:none;text-overflow:ellipsis}details.dropdown>summary+ul li a:active,details.dropdown>summary+ul li a:focus,details.dropdown>summary+ul li a:focus-visible,details.dropdown>summary+ul li a:hover,details.dropdown>summary+ul li a[aria-current]:not([aria-current=false]){background-color:var(--pico-dropdown-hover-background-color)}details.dropdown>summary+ul li label{width:100%}details.dropdown>summary+ul li:has(label):hover{background-color:var(--pico-dropdown-hover-background-color)}details.dropdown[open]>summary,dialog>article>header>*{margin-bottom:0}details.dropdown[open]>summary+ul{-webkit-transform:scaleY(1);transform:scaleY(1);opacity:1;-webkit-transition:opacity .2s ease-in-out,-webkit-transform 0s ease-in-out 0s;transition:opacity .2s ease-in-out,transform 0s ease-in-out 0s;transition:opacity .2s ease-in-out,transform 0s ease-in-out 0s,-webkit-transform 0s ease-in-out 0s;-webkit-transition:opacity var(--pico-transition),-webkit-transform 0s ease-in-out 0s;transition:opacity var(--pico-transition),transform 0s ease-in-out 0s;transition:opacity var(--pico-transition),transform 0s ease-in-out 0s,-webkit-transform 0s ease-in-out 0s}details.dropdown[open]>summary::before{display:block;z-index:1;position:fixed;width:100vw;height:100vh;top:0;right:0;bottom:0;left:0;background:0 0;content:"";cursor:default}label>details.dropdown{margin-top:calc(1rem*.25);margin-top:calc(var(--pico-spacing)*.25)}[role=group],[role=search]{display:-webkit-inline-box;display:-ms-inline-flexbox;display:inline-flex;position:relative;width:100%;margin-bottom:1rem;margin-bottom:var(--pico-spacing);border-radius:.25rem;border-radius:var(--pico-border-radius);-webkit-box-shadow:0 0 0 transparent;box-shadow:0 0 0 transparent;-webkit-box-shadow:var(--pico-group-box-shadow, 0 0 0 rgba(0, 0, 0, 0));box-shadow:var(--pico-group-box-shadow, 0 0 0 rgba(0, 0, 0, 0));vertical-align:middle;-webkit-transition:-webkit-box-shadow .2s ease-in-out;transition:box-shadow .2s ease-in-out;transition:box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:-webkit-box-shadow var(--pico-transition);transition:box-shadow var(--pico-transition);transition:box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}[role=group] input:not([type=checkbox]):not([type=radio]),[role=group] select,[role=group]>*,[role=search] input:not([type=checkbox]):not([type=radio]),[role=search] select,[role=search]>*{position:relative;-webkit-box-flex:1;-ms-flex:1 1 auto;flex:1 1 auto;margin-bottom:0}[role=group] input:not([type=checkbox]):not([type=radio]):not(:first-child),[role=group] select:not(:first-child),[role=group]>:not(:first-child),[role=search] input:not([type=checkbox]):not([type=radio]):not(:first-child),[role=search] select:not(:first-child),[role=search]>:not(:first-child){margin-left:0;border-top-left-radius:0;border-bottom-left-radius:0}[role=group] input:not([type=checkbox]):not([type=radio]):not(:last-child),[role=group] select:not(:last-child),[role=group]>:not(:last-child),[role=search] input:not([type=checkbox]):not([type=radio]):not(:last-child),[role=search] select:not(:last-child),[role=search]>:not(:last-child){border-top-right-radius:0;border-bottom-right-radius:0}[role=group] input:not([type=checkbox]):not([type=radio]):focus,[role=group] select:focus,[role=group]>:focus,[role=search] input:not([type=checkbox]):not([type=radio]):focus,[role=search] select:focus,[role=search]>:focus{z-index:2}[role=group] [role=button]:not(:first-child),[role=group] [type=button]:not(:first-child),[role=group] [type=reset]:not(:first-child),[role=group] [type=submit]:not(:first-child),[role=group] button:not(:first-child),[role=group] input:not([type=checkbox]):not([type=radio]):not(:first-child),[role=group] select:not(:first-child),[role=search] [role=button]:not(:first-child),[role=search] [type=button]:not(:first-child),[role=search] [type=reset]:not(:first-child),[role=search] [type=submit]:not(:first-child),[role=search] button:not(:first-child),[role=search] input:not([type=checkbox]):not([type=radio]):not(:first-child),[role=search] select:not(:first-child){margin-left:calc(.0625rem*-1);margin-left:calc(var(--pico-border-width)*-1)}[role=group] [role=button],[role=group] [type=button],[role=group] [type=reset],[role=group] [type=submit],[role=group] button,[role=search] [role=button],[role=search] [type=button],[role=search] [type=reset],[role=search] [type=submit],[role=search] button{width:auto}@supports selector(:has(*)){[role=group]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus),[role=search]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus){--pico-group-box-shadow:var(--pico-group-box-shadow-focus-with-button)}[role=group]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus) input:not([type=checkbox]):not([type=radio]),[role=group]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus) select,[role=search]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus) input:not([type=checkbox]):not([type=radio]),[role=search]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus) select{border-color:transparent}[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus),[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus){--pico-group-box-shadow:var(--pico-group-box-shadow-focus-with-input)}[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [role=button],[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [type=button],[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [type=submit],[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus) button,[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [role=button],[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [type=button],[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [type=submit],[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus) button{--pico-button-box-shadow:0 0 0 var(--pico-border-width) var(--pico-primary-border);--pico-button-hover-box-shadow:0 0 0 var(--pico-border-width) var(--pico-primary-hover-border)}[role=group] [role=button]:focus,[role=group] [type=button]:focus,[role=group] [type=reset]:focus,[role=group] [type=submit]:focus,[role=group] button:focus,[role=search] [role=button]:focus,[role=search] [type=button]:focus,[role=search] [type=reset]:focus,[role=search] [type=submit]:focus,[role=search] button:focus{-webkit-box-shadow:none;box-shadow:none}}[role=search]>:first-child{border-top-left-radius:5rem;border-bottom-left-radius:5rem}[role=search]>:last-child{border-top-right-radius:5rem;border-bottom-right-radius:5rem}[aria-busy=true]:not(input):not(select):not(textarea):not(html):not(form){white-space:nowrap}[aria-busy=true]:not(input):not(select):not(textarea):not(html):not(form)::before{display:inline-block;width:1em;height:1em;background-image:url('+M+');background-image:var(--pico-icon-loading);background-size:1em auto;background-repeat:no-repeat;content:"";vertical-align:-.125em}[aria-busy=true]:not(input):not(select):not(textarea):not(html):not(form):not(:empty)::before{margin-right:calc(1rem*.5);margin-right:calc(var(--pico-spacing)*.5)}[aria-busy=true]:not(input):not(select):not(textarea):not(html):not(form):empty{text-align:center}[role=button][aria-busy=true],[type=button][aria-busy=true],[type=reset][aria-busy=true],[type=submit][aria-busy=true],a[aria-busy=true],button[aria-busy=true]{pointer-events:none}:host,:root{--pico-scrollbar-width:0px}dialog{display:-webkit-box;display:-ms-flexbox;display:flex;z-index:999;position:fixed;top:0;right:0;bottom:0;left:0;-webkit-box-align:center;-ms-flex-align:center;align-items:center;-webkit-box-pack:center;-ms-flex-pack:center;justify-content:center;width:inherit;min-width:100%;height:inherit;min-height:100%;padding:0;border:0;backdrop-filter:blur(.375rem);backdrop-filter:var(--pico-modal-overlay-backdrop-filter);background-color:var(--pico-modal-overlay-background-color);color:var(--pico-color)}dialog>article{width:100%;max-height:calc(100vh - 1rem*2);max-height:calc(100vh - var(--pico-spacing)*2);margin:1rem;margin:var(--pico-spacing);overflow:auto}@media (min-width:576px){dialog>article{max-width:510px}}@media (min-width:768px){dialog>article{max-width:700px}}dialog>article>header .close,dialog>article>header a[rel=prev],dialog>article>header button[rel=prev]{margin:0;margin-left:1rem;margin-left:var(--pico-spacing);padding:0;float:right}dialog>article>header .close,dialog>article>header :is(a,button)[rel=prev]{margin:0;margin-left:1rem;margin-left:var(--pico-spacing);padding:0;float:right}dialog>article>footer [role=button],dialog>article>footer button{margin-bottom:0}dialog>article>footer [role=button]:not(:first-of-type),dialog>article>footer button:not(:first-of-type){margin-left:calc(1rem*.5);margin-left:calc(var(--pico-spacing)*.5)}dialog>article .close,dialog>article a[rel=prev],dialog>article button[rel=prev]{display:block;width:1rem;height:1rem;margin-top:calc(1rem*-1);margin-top:calc(var(--pico-spacing)*-1);margin-bottom:1rem;margin-bottom:var(--pico-spacing);margin-left:auto;border:0;background-image:url('+S+");background-image:var(--pico-icon-close);background-position:center;background-size:auto 1rem;background-repeat:no-repeat;background-color:transparent;opacity:.5;-webkit-transition:opacity .2s ease-in-out;transition:opacity .2s ease-in-out;-webkit-transition:opacity var(--pico-transition);transition:opacity var(--pico-transition)}dialog>article .close,dialog>article :is(a,button)[rel=prev]{display:block;width:1rem;height:1rem;margin-top:calc(1rem*-1);margin-top:calc(var(--pico-spacing)*-1);margin-bottom:1rem;margin-bottom:var(--pico-spacing);margin-left:auto;border:0;background-image:url("+S+');background-image:var(--pico-icon-close);background-position:center;background-size:auto 1rem;background-repeat:no-repeat;background-color:transparent;opacity:.5;-webkit-transition:opacity .2s ease-in-out;transition:opacity .2s ease-in-out;-webkit-transition:opacity var(--pico-transition);transition:opacity var(--pico-transition)}dialog>article .close:active:not(.does-not-exist),dialog>article a[rel=prev]:active:not(.does-not-exist),dialog>article button[rel=prev]:active:not(.does-not-exist){opacity:1}dialog>article .close:focus:not(.does-not-exist),dialog>article .close:hover:not(.does-not-exist),dialog>article .close[aria-current]:not([aria-current=false]),dialog>article a[rel=prev]:focus:not(.does-not-exist),dialog>article a[rel=prev]:hover:not(.does-not-exist),dialog>article a[rel=prev][aria-current]:not([aria-current=false]),dialog>article button[rel=prev]:focus:not(.does-not-exist),dialog>article button[rel=prev]:hover:not(.does-not-exist),dialog>article button[rel=prev][aria-current]:not([aria-current=false]){opacity:1}dialog>article .close:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),dialog>article :is(a,button)[rel=prev]:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){opacity:1}dialog:not([open]),dialog[open=false]{display:none}.modal-is-open{padding-right:0;padding-right:var(--pico-scrollbar-width, 0px);overflow:hidden;pointer-events:none;-ms-touch-action:none;touch-action:none}.modal-is-open dialog{pointer-events:auto;-ms-touch-action:auto;touch-action:auto}:where(.modal-is-opening,.modal-is-closing) dialog,:where(.modal-is-opening,.modal-is-closing) dialog>article{-webkit-animation-timing-function:ease-in-out;animation-timing-function:ease-in-out;-webkit-animation-fill-mode:both;animation-fill-mode:both;-webkit-animation-duration:.8s;animation-duration:.8s;-webkit-animation-name:modal-overlay;animation-name:modal-overlay}:where(.modal-is-opening,.modal-is-closing) dialog>article{-webkit-animation-duration:.2s;animation-duration:.2s;-webkit-animation-delay:.2s;animation-delay:.2s;-webkit-animation-name:modal;animation-name:modal}.modal-is-closing dialog,.modal-is-closing dialog>article{-webkit-animation-delay:0s;animation-delay:0s;animation-direction:reverse}:where(nav li)::before{float:left;content:"​"}nav,nav ul{display:-webkit-box;display:-ms-flexbox;display:flex}nav{-webkit-box-pack:justify;-ms-flex-pack:justify;justify-content:space-between;overflow:visible}nav ol,nav ul{-webkit-box-align:center;-ms-flex-align:center;align-items:center;margin-bottom:0;padding:0;list-style:none}nav ol:first-of-type,nav ul:first-of-type{margin-left:calc(.5rem*-1);margin-left:calc(var(--pico-nav-element-spacing-horizontal)*-1)}nav ol:last-of-type,nav ul:last-of-type{margin-right:calc(.5rem*-1);margin-right:calc(var(--pico-nav-element-spacing-horizontal)*-1)}nav li{display:inline-block;margin:0;padding:1rem .5rem;padding:var(--pico-nav-element-spacing-vertical) var(--pico-nav-element-spacing-horizontal)}nav li :where(a,[role=link]){display:inline-block;margin:calc(var(--pico-nav-link-spacing-vertical)*-1) calc(var(--pico-nav-link-spacing-horizontal)*-1);padding:.5rem;padding:var(--pico-nav-link-spacing-vertical) var(--pico-nav-link-spacing-horizontal);border-radius:.25rem;border-radius:var(--pico-border-radius)}nav li :where(a,[role=link]):not(:hover){-webkit-text-decoration:none;text-decoration:none}nav li [role=button],nav li [type=button],nav li button,nav li input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),nav li select{height:auto;margin-right:inherit;margin-bottom:0;margin-left:inherit;padding:calc(.5rem - .0625rem*2) .5rem;padding:calc(var(--pico-nav-link-spacing-vertical) - var(--pico-border-width)*2) var(--pico-nav-link-spacing-horizontal)}nav[aria-label=breadcrumb]{-webkit-box-align:center;-ms-flex-align:center;align-items:center;-webkit-box-pack:start;-ms-flex-pack:start;justify-content:start}nav[aria-label=breadcrumb] ul li:not(:first-child){margin-left:.5rem;margin-left:var(--pico-nav-link-spacing-horizontal)}nav[aria-label=breadcrumb] ul li a{margin:calc(.5rem*-1)0;margin:calc(var(--pico-nav-link-spacing-vertical)*-1)0;margin-left:calc(.5rem*-1);margin-left:calc(var(--pico-nav-link-spacing-horizontal)*-1)}nav[aria-label=breadcrumb] ul li:not(:last-child)::after{display:inline-block;position:absolute;width:calc(.5rem*4);width:calc(var(--pico-nav-link-spacing-horizontal)*4);margin:0 calc(.5rem*-1);margin:0 calc(var(--pico-nav-link-spacing-horizontal)*-1);content:">";content:var(--pico-nav-breadcrumb-divider);color:var(--pico-muted-color);text-align:center;-webkit-text-decoration:none;text-decoration:none;white-space:nowrap}nav[aria-label=breadcrumb] a[aria-current]:not([aria-current=false]){background-color:transparent;color:inherit;-webkit-text-decoration:none;text-decoration:none;pointer-events:none}aside li,aside li a,aside nav,aside ol,aside ul{display:block}aside li{padding:calc(1rem*.5) .5rem;padding:calc(var(--pico-nav-element-spacing-vertical)*.5) var(--pico-nav-element-spacing-horizontal)}aside li [role=button]{margin:inherit}[dir=rtl] nav[aria-label=breadcrumb] ul li:not(:last-child) ::after{content:"\\\\"}progress{vertical-align:baseline;-webkit-appearance:none;-moz-appearance:none;display:inline-block;appearance:none;width:100%;height:.5rem;margin-bottom:calc(1rem*.5);margin-bottom:calc(var(--pico-spacing)*.5);overflow:hidden;border:0;border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-progress-background-color);color:var(--pico-progress-color)}progress::-webkit-progress-bar{border-radius:.25rem;border-radius:var(--pico-border-radius);background:0 0}progress[value]::-webkit-progress-value{background-color:var(--pico-progress-color);-webkit-transition:width .2s ease-in-out;transition:width .2s ease-in-out;-webkit-transition:width var(--pico-transition);transition:width var(--pico-transition)}progress::-moz-progress-bar{background-color:var(--pico-progress-color)}@media (prefers-reduced-motion:no-preference){progress:indeterminate{background:var(--pico-progress-background-color) -webkit-gradient(linear,left top,right top,color-stop(30%,var(--pico-progress-color)),color-stop(30%,var(--pico-progress-background-color))) top left/150% 150%no-repeat;background:var(--pico-progress-background-color) linear-gradient(to right,var(--pico-progress-color) 30%,var(--pico-progress-background-color) 30%) top left/150% 150%no-repeat;-webkit-animation:progress-indeterminate 1s linear infinite;animation:progress-indeterminate 1s linear infinite}progress:indeterminate[value]::-webkit-progress-value{background-color:transparent}progress:indeterminate::-moz-progress-bar{background-color:transparent}[dir=rtl] progress:indeterminate{animation-direction:reverse}}[data-tooltip]{position:relative}[data-tooltip]:not(a):not(button):not(input):not([role=button]){border-bottom:1px dotted;-webkit-text-decoration:none;text-decoration:none;cursor:help}[data-tooltip][data-placement=top]::before{display:block;z-index:99;position:absolute;bottom:100%;left:50%;padding:.25rem .5rem;overflow:hidden;-webkit-transform:translate(-50%,-.25rem);transform:translate(-50%,-.25rem);border-radius:.25rem;border-radius:var(--pico-border-radius);background:var(--pico-tooltip-background-color);content:attr(data-tooltip);color:var(--pico-tooltip-color);font-style:normal;font-weight:400;font-weight:var(--pico-font-weight);font-size:.875rem;-webkit-text-decoration:none;text-decoration:none;text-overflow:ellipsis;white-space:nowrap;opacity:0;pointer-events:none}[data-tooltip]::before{color:var(--pico-tooltip-color)}[data-tooltip]::after,[data-tooltip]::before,[data-tooltip][data-placement=top]::after{display:block;z-index:99;position:absolute;bottom:100%;left:50%;padding:.25rem .5rem;overflow:hidden;-webkit-transform:translate(-50%,-.25rem);transform:translate(-50%,-.25rem);border-radius:.25rem;border-radius:var(--pico-border-radius);background:var(--pico-tooltip-background-color);content:attr(data-tooltip);font-style:normal;font-weight:400;font-weight:var(--pico-font-weight);font-size:.875rem;-webkit-text-decoration:none;text-decoration:none;text-overflow:ellipsis;white-space:nowrap;opacity:0;pointer-events:none}[data-tooltip]::after,[data-tooltip][data-placement=top]::after{padding:0;-webkit-transform:translate(-50%,0);transform:translate(-50%,0);border-top:.3rem solid;border-right:.3rem solid transparent;border-left:.3rem solid transparent;border-radius:0;background-color:transparent;content:"";color:var(--pico-tooltip-background-color)}[data-tooltip][data-placement=bottom]::after,[data-tooltip][data-placement=bottom]::before{top:100%;bottom:auto;-webkit-transform:translate(-50%,.25rem);transform:translate(-50%,.25rem)}[data-tooltip][data-placement=bottom]:after{-webkit-transform:translate(-50%,-.3rem);transform:translate(-50%,-.3rem);border:.3rem solid transparent;border-bottom:.3rem solid}[data-tooltip][data-placement=left]::after,[data-tooltip][data-placement=left]::before{top:50%;right:100%;bottom:auto;left:auto;-webkit-transform:translate(-.25rem,-50%);transform:translate(-.25rem,-50%)}[data-tooltip][data-placement=left]:after{-webkit-transform:translate(.3rem,-50%);transform:translate(.3rem,-50%);border:.3rem solid transparent;border-left:.3rem solid}[data-tooltip][data-placement=right]::after,[data-tooltip][data-placement=right]::before{top:50%;right:auto;bottom:auto;left:100%;-webkit-transform:translate(.25rem,-50%);transform:translate(.25rem,-50%)}[data-tooltip][data-placement=right]:after{-webkit-transform:translate(-.3rem,-50%);transform:translate(-.3rem,-50%);border:.3rem solid transparent;border-right:.3rem solid}[data-tooltip]:focus::after,[data-tooltip]:focus::before,[data-tooltip]:hover::after,[data-tooltip]:hover::before{opacity:1}@media (hover:hover) and (pointer:fine){[data-tooltip]:focus::before{-webkit-transform:translate(-50%,.75rem);transform:translate(-50%,.75rem);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip]:focus::after,[data-tooltip]:focus::before{--pico-tooltip-slide-to:translate(-50%, -0.25rem);-webkit-animation-duration:.2s;animation-duration:.2s;-webkit-animation-fill-mode:forwards;animation-fill-mode:forwards;opacity:0}[data-tooltip]:hover::before{-webkit-transform:translate(-50%,.75rem);transform:translate(-50%,.75rem);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip]:hover::after,[data-tooltip]:hover::before{--pico-tooltip-slide-to:translate(-50%, -0.25rem);-webkit-animation-duration:.2s;animation-duration:.2s;-webkit-animation-fill-mode:forwards;animation-fill-mode:forwards;opacity:0}[data-tooltip]:focus::after,[data-tooltip]:hover::after{--pico-tooltip-caret-slide-to:translate(-50%, 0rem);-webkit-transform:translate(-50%,-.25rem);transform:translate(-50%,-.25rem);-webkit-animation-name:tooltip-caret-slide;animation-name:tooltip-caret-slide}[data-tooltip][data-placement=bottom]:focus::before{--pico-tooltip-slide-to:translate(-50%, 0.25rem);-webkit-transform:translate(-50%,-.75rem);transform:translate(-50%,-.75rem);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=bottom]:focus::after{--pico-tooltip-slide-to:translate(-50%, 0.25rem)}[data-tooltip][data-placement=bottom]:hover::before{--pico-tooltip-slide-to:translate(-50%, 0.25rem);-webkit-transform:translate(-50%,-.75rem);transform:translate(-50%,-.75rem);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=bottom]:hover::after{--pico-tooltip-slide-to:translate(-50%, 0.25rem)}[data-tooltip][data-placement=bottom]:focus::after,[data-tooltip][data-placement=bottom]:hover::after{--pico-tooltip-caret-slide-to:translate(-50%, -0.3rem);-webkit-transform:translate(-50%,-.5rem);transform:translate(-50%,-.5rem);-webkit-animation-name:tooltip-caret-slide;animation-name:tooltip-caret-slide}[data-tooltip][data-placement=left]:focus::before{--pico-tooltip-slide-to:translate(-0.25rem, -50%);-webkit-transform:translate(.75rem,-50%);transform:translate(.75rem,-50%);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=left]:focus::after{--pico-tooltip-slide-to:translate(-0.25rem, -50%)}[data-tooltip][data-placement=left]:hover::before{--pico-tooltip-slide-to:translate(-0.25rem, -50%);-webkit-transform:translate(.75rem,-50%);transform:translate(.75rem,-50%);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=left]:hover::after{--pico-tooltip-slide-to:translate(-0.25rem, -50%)}[data-tooltip][data-placement=left]:focus::after,[data-tooltip][data-placement=left]:hover::after{--pico-tooltip-caret-slide-to:translate(0.3rem, -50%);-webkit-transform:translate(.05rem,-50%);transform:translate(.05rem,-50%);-webkit-animation-name:tooltip-caret-slide;animation-name:tooltip-caret-slide}[data-tooltip][data-placement=right]:focus::before{--pico-tooltip-slide-to:translate(0.25rem, -50%);-webkit-transform:translate(-.75rem,-50%);transform:translate(-.75rem,-50%);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=right]:focus::after{--pico-tooltip-slide-to:translate(0.25rem, -50%)}[data-tooltip][data-placement=right]:hover::before{--pico-tooltip-slide-to:translate(0.25rem, -50%);-webkit-transform:translate(-.75rem,-50%);transform:translate(-.75rem,-50%);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=right]:hover::after{--pico-tooltip-slide-to:translate(0.25rem, -50%)}[data-tooltip][data-placement=right]:focus::after,[data-tooltip][data-placement=right]:hover::after{--pico-tooltip-caret-slide-to:translate(-0.3rem, -50%);-webkit-transform:translate(-.05rem,-50%);transform:translate(-.05rem,-50%);-webkit-animation-name:tooltip-caret-slide;animation-name:tooltip-caret-slide}}[aria-controls]{cursor:pointer}[aria-disabled=true],[disabled]{cursor:not-allowed}[aria-hidden=false][hidden]{display:initial}[aria-hidden=false][hidden]:not(:focus){clip:rect(0,0,0,0);position:absolute}[tabindex],a,area,button,input,label,select,summary,textarea{-ms-touch-action:manipulation}[dir=rtl]{direction:rtl}@media (prefers-reduced-motion:reduce){:not([aria-busy=true]),:not([aria-busy=true])::after,:not([aria-busy=true])::before{background-attachment:initial!important;-webkit-animation-duration:1ms!important;animation-duration:1ms!important;-webkit-animation-delay:-1ms!important;animation-delay:-1ms!important;-webkit-animation-iteration-count:1!important;animation-iteration-count:1!important;scroll-behavior:auto!important;-webkit-transition-delay:0s!important;transition-delay:0s!important;-webkit-transition-duration:0s!important;transition-duration:0s!important}}:root{--pico-font-size:95%}.h-logo{width:200px}.h-table{margin-bottom:0}.h-error{background-color:#f06c41;color:#fff;font-weight:700}.h-table>tbody>tr>th:first-child{font-weight:700;width:1%;white-space:nowrap;padding-right:.5rem}.mt-2{margin-top:.5rem}.mb-2{margin-bottom:.5rem!important}.h-btns>*{margin:.2rem}.h-btns>:first-child{margin-left:0}.h-btns>:last-child{margin-right:0}.alert{margin-bottom:var(--spacing);padding:1rem;border-radius:var(--border-radius);color:var(--color);background-color:var(--background-color);border:1px solid var(--background-color)}.alert-danger{--background-color:#ffebee;--color:#b71c1c}.alert-warning{--background-color:#fff8e1;--color:rgb(204, 88.8, 0)}.alert-success{--background-color:#e8f5e9;--color:#1b5e20}.overlay{position:fixed;top:0;right:0;bottom:0;left:0;width:100vw;height:100vh;background:rgba(0,0,0,.4);backdrop-filter:blur(2px);display:-webkit-box;display:-ms-flexbox;display:flex;-webkit-box-align:center;-ms-flex-align:center;align-items:center;-webkit-box-pack:center;-ms-flex-pack:center;justify-content:center;z-index:9999}.overlay.hidden{display:none}.loader{width:3rem;height:3rem;border:.35rem solid rgba(255,255,255,.35);border-top-color:#fff;border-radius:50%;-webkit-animation:h-spin .8s linear infinite;animation:h-spin .8s linear infinite}.alert.notification{position:fixed;top:1rem;left:50%;-webkit-transform:translateX(-50%);transform:translateX(-50%);max-width:500px;width:calc(100% - 2rem);margin:0;z-index:10000;-webkit-box-shadow:0 4px 12px rgba(0,0,0,.15);box-shadow:0 4px 12px rgba(0,0,0,.15)}',""]),e.A=w},7331:function(o,e,t){"use strict";function r(o){return(e=t(o)).default||e;var e}r.e=function(){return!1},o.exports=r},7469:function(o,e,t){var r=t(8798),i=t(9451),n=t(9508);function a(o){r(this,o),this.___parentNode=null,this.___nextSiblingInternal=null}function c(o){this.___VNode(null),this.___out=o}c.prototype={___nodeType:11,___DocumentFragment:!0,___cloneNode:function(){return new a(this)},___actualize:function(o){return(o.ownerDocument||o).createDocumentFragment()}},i(c,n),a.prototype=c.prototype,o.exports=c},7521:function(o,e,t){var r=t(6764),i=t(3738),n=t(3084),a=t(1197),c=t(6222),s=c.___VElement,l=c.___VComment,p=c.___VDocumentFragment,d=c.___VText,u=c.___VComponent,b=c.___VFragment,m=c.___virtualizeHTML,h="update",f="finish";function v(o){this.___events=new r,this.___tree=o,this.___finished=!1}function _(o,e,t){var r;e||(e=new p),r=t?t.___state:new v(e),this.___remaining=1,this.___lastCount=0,this.___last=null,this.___parentOut=t,this.data={},this.___state=r,this.___parent=e,this.global=o||{},this.___stack=[e],this.___sync=!1,this.___vnode=void 0,this.___components=null,this.___assignedComponentDef=null,this.___assignedKey=null,this.___assignedCustomEvents=null}var g=_.prototype={___isOut:!0,___host:"object"==typeof document&&document,bc:function(o,e,t){var r=new u(o,e,t);return this.___beginNode(r,0,!0)},___preserveComponent:function(o,e,t){var r=new u(o,e,t,!0);this.___beginNode(r,0)},___beginNode:function(o,e,t){return this.___parent.___appendChild(o),!0===t&&(this.___stack.push(o),this.___parent=o),0===e?this:o},element:function(o,e,t,r,i,n,a){var c=new s(o,e,t,r,i,n,a);return this.___beginNode(c,i)},___elementDynamic:function(o,e,t,r,i){return this.element(o,n(e),t,r.___component,0,0,i)},n:function(o,e){var t=o.___cloneNode();return this.node(t),t.___ownerComponent=e,this},node:function(o){return this.___parent.___appendChild(o),this},text:function(o,e){var t=typeof o;if("string"!=t){if(null==o)return;if("object"===t&&o.toHTML)return this.h(o.toHTML(),e);o=o.toString()}return this.___parent.___appendChild(new d(o,e)),this},comment:function(o,e){return this.node(new l(o,e))},html:function(o,e){if(null!=o){var t=m(o,e);this.node(t)}return this},beginElement:function(o,e,t,r,i,n,a){var c=new s(o,e,t,r,i,n,a);return this.___beginNode(c,i,!0),this},___beginElementDynamic:function(o,e,t,r,i){return this.beginElement(o,n(e),t,r.___component,0,0,i)},bf:function(o,e,t){var r=new b(o,e,t);return this.___beginNode(r,null,!0),this},ef:function(){this.endElement()},endElement:function(){var o=this.___stack;o.pop(),this.___parent=o[o.length-1]},end:function(){this.___parent=void 0;var o=--this.___remaining,e=this.___parentOut;return 0===o?e?e.___handleChildDone():this.___doFinish():o-this.___lastCount===0&&this.___emitLast(),this},___handleChildDone:function(){var o=--this.___remaining;if(0===o){var e=this.___parentOut;e?e.___handleChildDone():this.___doFinish()}else o-this.___lastCount===0&&this.___emitLast()},___doFinish:function(){var o=this.___state;o.___finished=!0,o.___events.emit(f,this.___getResult())},___emitLast:function(){var o=this._last,e=0;!function t(){if(e!==o.length){var r=o[e++];r(t),r.length||t()}}()},error:function(o){try{this.emit("error",o)}finally{this.end()}return this},beginAsync:function(o){if(this.___sync)throw Error("Tried to render async while in sync mode. Note: Client side await is not currently supported in re-renders (Issue: #942).");var e=this.___state;o&&o.last&&this.___lastCount++,this.___remaining++;var t=this.___parent.___appendDocumentFragment(),r=new _(this.global,t,this);return e.___events.emit("beginAsync",{out:r,parentOut:this}),r},createOut:function(){return new _(this.global)},flush:function(){var o=this.___state.___events;o.listenerCount(h)&&o.emit(h,new i(this))},___getOutput:function(){return this.___state.___tree},___getResult:function(){return this.___result||(this.___result=new i(this))},on:function(o,e){var t=this.___state;return o===f&&t.___finished?e(this.___getResult()):"last"===o?this.onLast(e):t.___events.on(o,e),this},once:function(o,e){var t=this.___state;return o===f&&t.___finished?e(this.___getResult()):"last"===o?this.onLast(e):t.___events.once(o,e),this},emit:function(o,e){var t=this.___state.___events;switch(arguments.length){case 1:t.emit(o);break;case 2:t.emit(o,e);break;default:t.emit.apply(t,arguments)}return this},removeListener:function(){var o=this.___state.___events;return o.removeListener.apply(o,arguments),this},sync:function(){this.___sync=!0},isSync:function(){return this.___sync},onLast:function(o){var e=this._last;return void 0===e?this._last=[o]:e.push(o),this},___getNode:function(o){var e=this.___vnode;if(!e){var t=this.___getOutput();o||(o=this.___host),this.___vnode=e=t.___actualize(o,null),a(e,t,o,this.___components)}return e},toString:function(o){for(var e=this.___getNode(o),t="",r=e.firstChild;r;){var i=r.nextSibling;if(1!=r.nodeType){var n=e.ownerDocument.createElement("div");n.appendChild(r.cloneNode()),t+=n.innerHTML}else t+=r.outerHTML;r=i}return t},then:function(o,e){var t=this,r=new Promise(function(o,e){t.on("error",e).on(f,function(e){o(e)})});return Promise.resolve(r).then(o,e)},catch:function(o){return this.then(void 0,o)},isVDOM:!0,c:function(o,e,t){this.___assignedComponentDef=o,this.___assignedKey=e,this.___assignedCustomEvents=t}};g.e=g.element,g.be=g.beginElement,g.ee=g.___endElement=g.endElement,g.t=g.text,g.h=g.w=g.write=g.html,o.exports=_},7616:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%2876, 154.5, 137.5%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cpolyline points=%2720 6 9 17 4 12%27%3E%3C/polyline%3E%3C/svg%3E"},7639:function(o){var e=[];o.exports=function(o){return o||e}},7659:function(o){"use strict";var e={};o.exports=function(o,t){var r=function(o){if(void 0===e[o]){var t=document.querySelector(o);if(window.HTMLIFrameElement&&t instanceof window.HTMLIFrameElement)try{t=t.contentDocument.head}catch(o){t=null}e[o]=t}return e[o]}(o);if(!r)throw new Error("Couldn't find a style target. This probably means that the value for the 'insert' parameter is invalid.");r.appendChild(t)}},7785:function(o){o.exports=function(o,e){Object.getOwnPropertyNames(o).forEach(function(t){var r=Object.getOwnPropertyDescriptor(o,t);Object.defineProperty(e,t,r)})}},7825:function(o){"use strict";o.exports=function(o){if("undefined"==typeof document)return{update:function(){},remove:function(){}};var e=o.insertStyleElement(o);return{update:function(t){!function(o,e,t){var r="";t.supports&&(r+="@supports (".concat(t.supports,") {")),t.media&&(r+="@media ".concat(t.media," {"));var i=void 0!==t.layer;i&&(r+="@layer".concat(t.layer.length>0?" ".concat(t.layer):""," {")),r+=t.css,i&&(r+="}"),t.media&&(r+="}"),t.supports&&(r+="}");var n=t.sourceMap;n&&"undefined"!=typeof btoa&&(r+="\n/*# sourceMappingURL=data:application/json;base64,".concat(btoa(unescape(encodeURIComponent(JSON.stringify(n))))," */")),e.styleTagTransform(r,o,e.options)}(e,o,t)},remove:function(){!function(o){if(null===o.parentNode)return!1;o.parentNode.removeChild(o)}(e)}}}},8053:function(o,e,t){var r=t(3774),i=Array.isArray;function n(o,e,t){for(var r=o,i=0;i<t;i++)r=r[e[i]];return r}function a(o){if("Date"===o.type)return new Date(o.value);if("URL"===o.type)return new URL(o.value);if("URLSearchParams"===o.type)return new URLSearchParams(o.value);if("NOOP"===o.type)return r.NOOP;throw new Error("Bad type")}o.exports=function(o){if(!o)return o;var e=o.$;if(e){var t,r=o.o;if(e&&(t=e.length))for(var c=0;c<t;c++){var s,l=e[c],p=l.r;s=i(p)?n(r,p,p.length):a(p);var d=l.l,u=d.length-1;if(-1===u){r=o.o=s;break}n(r,d,u)[d[u]]=s}return e.length=0,null==r?null:r}return o}},8103:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg fill=%27none%27 height=%2724%27 width=%2724%27 viewBox=%270 0 24 24%27 xmlns=%27http://www.w3.org/2000/svg%27 %3E%3Cstyle%3E g %7B animation: rotate 2s linear infinite; transform-origin: center center; %7D circle %7B stroke-dasharray: 75,100; stroke-dashoffset: -5; animation: dash 1.5s ease-in-out infinite; stroke-linecap: round; %7D @keyframes rotate %7B 0%25 %7B transform: rotate%280deg%29; %7D 100%25 %7B transform: rotate%28360deg%29; %7D %7D @keyframes dash %7B 0%25 %7B stroke-dasharray: 1,100; stroke-dashoffset: 0; %7D 50%25 %7B stroke-dasharray: 44.5,100; stroke-dashoffset: -17.5; %7D 100%25 %7B stroke-dasharray: 44.5,100; stroke-dashoffset: -62; %7D %7D %3C/style%3E%3Cg%3E%3Ccircle cx=%2712%27 cy=%2712%27 r=%2710%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%274%27 /%3E%3C/g%3E%3C/svg%3E"},8170:function(o,e,t){"use strict";function r(o){this.path=this.___typeName=o}t(586),e.t=function(o){return new r(o)};var i=t(7521);t(5703).___setCreateOut(r.prototype.createOut=function(o,e,t){return new i(o,e,t)}),t(8831)(r.prototype)},8229:function(o,e,t){var r=t(8798),i=t(8820),n=i.___destroyComponentForNode,a=i.___destroyNodeRecursive,c=t(3448),s=c.___insertBefore,l=c.___insertAfter,p=c.___removeChild;function d(o){if("string"==typeof o){var e=o;if(!(o=document.getElementById(e)))throw Error("Not found: "+e)}return o}function u(o){a(o),n(o)}o.exports=function(o,e,t){r(o,{appendTo:function(o){o=d(o);var r=e(this,o);return s(r,null,o),t(this,o)},prependTo:function(o){o=d(o);var r=e(this,o);return s(r,o.firstChild||null,o),t(this,o)},replace:function(o){o=d(o);var r=e(this,o);return u(o),s(r,o,o.parentNode),p(o),t(this,o)},replaceChildrenOf:function(o){o=d(o);for(var r=e(this,o),i=o.firstChild;i;){var n=i.nextSibling;u(i),i=n}return o.innerHTML="",s(r,null,o),t(this,o)},insertBefore:function(o){o=d(o);var r=e(this,o);return s(r,o,o.parentNode),t(this,o)},insertAfter:function(o){o=d(o);var r=e(this,o);return l(r,o,o.parentNode),t(this,o)}})}},8288:function(o,e,t){var r=t(851).NOOP;e.a=r},8338:function(o,e,t){var r=t(862),i=t(9451),n=t(8820),a=t(5785).___vElementByDOMNode,c=t(9508),s=t(6125),l="xlink:href",p=/^xmlns(:|$)/,d=Object.prototype.hasOwnProperty,u="http://www.w3.org/1999/xlink",b="http://www.w3.org/1999/xhtml",m={svg:"http://www.w3.org/2000/svg",math:"http://www.w3.org/1998/Math/MathML"},h="href",f=Object.freeze(Object.create(null)),v={option:{selected:function(o,e){o.selected=void 0!==e}},input:{value:function(o,e){o.value=void 0===e?"":e},checked:function(o,e){o.checked=void 0!==e}}};function _(o){if(!0===o)return"";if(null!=o&&!1!==o){switch(typeof o){case"string":return o;case"object":switch(o.toString){case Object.prototype.toString:case Array.prototype.toString:return r("Relying on JSON.stringify for attribute values is deprecated, in future versions of Marko these will be cast to strings instead."),JSON.stringify(o);case RegExp.prototype.toString:return o.source}}return o+""}}function g(o,e){for(var t in e)d.call(e,t)&&(o[t]=e[t])}function y(o){this.___firstChildInternal=o.___firstChildInternal,this.___parentNode=null,this.___nextSiblingInternal=null,this.___key=o.___key,this.___attributes=o.___attributes,this.___properties=o.___properties,this.___nodeName=o.___nodeName,this.___flags=o.___flags,this.___textContent=o.___textContent,this.___constId=o.___constId}function w(o,e,t,r,i,n,a){var c;this.___VNode(i,r),a&&(c=a.i),this.___key=t,this.___flags=n||0,this.___attributes=e||f,this.___properties=a||f,this.___nodeName=o,this.___textContent="",this.___constId=c,this.___preserve=!1,this.___preserveBody=!1}w.prototype={___nodeType:1,___cloneNode:function(){return new y(this)},e:function(o,e,t,r,i,n,a){var c=this.___appendChild(new w(o,e,t,r,i,n,a));return 0===i?this.___finishChild():c},n:function(o,e){return(o=o.___cloneNode()).___ownerComponent=e,this.___appendChild(o),this.___finishChild()},___actualize:function(o,e){var t=this.___nodeName,r=this.___attributes,i=m[t]||e||b,n=this.___flags,c=(o.ownerDocument||o).createElementNS(i,t);if(2&n)g(c,r);else{for(var p in r){var d=_(r[p]);void 0!==d&&(p==l?c.setAttributeNS(u,h,d):c.setAttribute(p,d))}s(t)&&(c.textContent=this.___textContent)}return a.set(c,this),c}},i(w,c),y.prototype=w.prototype,w.___virtualize=function(o,e,t){var r=o.attributes,i=r.length,a=null,c=null;if(i){a={};for(var d=0;d<i;d++){var m=r[d],h=m.name;p.test(h)||("data-marko"===h?c=n.___getMarkoPropsFromEl(o):m.namespaceURI===u?a[l]=m.value:a[h]=m.value)}}var f=o.nodeName;o.namespaceURI===b&&(f=f.toLowerCase());var v=new w(f,a,null,t,0,0,c);return s(f)?v.___textContent=o.textContent:e&&e(o,v,t),v},w.___morphAttrs=function(o,e,t){var r=e.___flags,i=t.___flags,n=t.___attributes;if(2&i)return g(o,n);var a,c=t.___properties,s=e.___attributes;if(s!==n){var p;if(1&i&&1&r)return s.class!==(p=n.class)&&(p?o.className=p:o.removeAttribute("class")),s.id!==(p=n.id)&&(p?o.id=p:o.removeAttribute("id")),void(s.style!==(p=n.style)&&(p?o.style.cssText=p:o.removeAttribute("style")));var d,b=c&&c.pa||f,m=v[t.___nodeName]||f;for(a in n)b[a]||(p=_(n[a]),(d=m[a])?d(o,p):_(s[a])!==p&&(a===l?void 0===p?o.removeAttributeNS(u,h):o.setAttributeNS(u,h,p):void 0===p?o.removeAttribute(a):o.setAttribute(a,p)));if(null===t.___key||4&r)for(a in s)a in n||((d=m[a])?d(o,void 0):a===l?o.removeAttributeNS(l,h):o.removeAttribute(a))}},o.exports=w},8798:function(o){o.exports=function(o,e){if(o||(o={}),e)for(var t in e)e.hasOwnProperty(t)&&(o[t]=e[t]);return o}},8820:function(o,e,t){var r=t(5785),i=r.___componentByDOMNode,n=r.___keyByDOMNode,a=r.___vElementByDOMNode,c=r.___vPropsByDOMNode,s=window.$MUID||(window.$MUID={i:0}),l=s.i++,p={},d={};function u(o){var e=i.get(o.fragment||o);e&&(e.___destroyShallow(),delete p[e.id])}function b(){return"c"+s.i++}e.___runtimeId=l,e.___componentLookup=p,e.___getComponentForEl=function(o,e){for(var t,r,n="string"==typeof o?((e?e.ownerDocument:e)||document).getElementById(o):o;n;){if(n.fragment?n.fragment.endNode===n?n=n.fragment.startNode:(n=n.fragment,t=i.get(n)):(r=a.get(n))&&(t=r.___ownerComponent),t)return t;n=n.previousSibling||n.parentNode}},e.___destroyComponentForNode=u,e.___destroyNodeRecursive=function o(e,t){if(u(e),1===e.nodeType||12===e.nodeType){var r;t&&(r=n.get(e))&&e===t.___keyedElements[r]&&(i.get(e)&&/\[\]$/.test(r)?delete t.___keyedElements[r][i.get(e).id]:delete t.___keyedElements[r]);for(var a=e.firstChild;a&&a!==e.endNode;)o(a,t),a=a.nextSibling}},e.___nextComponentIdProvider=function(){return b},e.___attachBubblingEvent=function(o,e,t,r){if(e){var i=o.id;return r?[e,i,t,r]:[e,i,t]}},e.___getMarkoPropsFromEl=function(o){var e,t=a.get(o);return t?e=t.___properties:(e=c.get(o))||(e=o.getAttribute("data-marko"),c.set(o,e=e?JSON.parse(e):d)),e},e.___addComponentRootToKeyedElements=function(o,e,t,r){/\[\]$/.test(e)?(o[e]=o[e]||{})[r]=t:o[e]=t},e.___normalizeComponentKey=function(o,e){return"#"===o[0]&&(o=o.replace("#"+e+"-","")),o}},8831:function(o,e,t){"use strict";var r=t(8798),i=t(3503).x,n=t(5703);function a(o,e,t,r){try{o(e,t),r&&t.end()}catch(o){var n=t.end;t.end=function(){},i(function(){t.end=n,t.error(o)})}return t}o.exports=function(o,e){var t=e&&(e.renderer||e.render||e),i=o.createOut||e.createOut||n;return r(o,{_:t,createOut:i,renderToString:function(o,e){var r=o||{},n=t||this._,c=r.$global,s=i(c);return s.global.template=this,c&&(r.$global=void 0),e?(s.on("finish",function(){e(null,s.toString(),s)}).once("error",e),a(n,r,s,!0)):(s.sync(),n(r,s),s.toString())},renderSync:function(o){var e=o||{},r=t||this._,n=e.$global,a=i(n);return a.sync(),a.global.template=this,n&&(e.$global=void 0),r(e,a),a.___getResult()},mount:function(o,e,t){const r=this.renderSync(o);switch(t){case"afterbegin":r.prependTo(e);break;case"afterend":r.insertAfter(e);break;case"beforebegin":r.insertBefore(e);break;default:r.appendTo(e)}const i=r.getComponent();return{update(o){i.input=o,i.update()},destroy(){i.destroy()}}},render:function(o,e){var n,c,s,l,p=t||this._,d=this.___shouldBuffer,u=!0;return o?(s=o,(l=o.$global)&&(s.$global=void 0)):s={},e&&e.___isOut?(c=e,u=!1,r(e.global,l)):"function"==typeof e?(c=i(l),n=e):c=i(l,e,void 0,d),n&&c.on("finish",function(){n(null,c.___getResult(),c)}).once("error",n),(l=c.global).template=l.template||this,a(p,s,c,u)}})}},8899:function(o,e,t){var r=t(8820),i=r.___runtimeId,n=r.___componentLookup,a=r.___getMarkoPropsFromEl,c="$MDE"+i,s={};function l(o,e){var t=a(o)[e];return"string"==typeof t&&((t=t.split(" "))[2]&&(t[2]="true"===t[2]),4==t.length&&(t[3]=parseInt(t[3],10))),t}function p(o,e,t,r){var i=t[0],c=t[1],s=t[2],l=t[3];s&&delete a(o)[e];var p=n[c];if(p){var d="function"==typeof i?i:p[i];if(!d)throw Error("Method not found: "+i);null!=l&&"number"==typeof l&&(l=p.___bubblingDomEvents[l]),l?d.apply(p,l.concat(r,o)):d.call(p,r,o)}}function d(){}e.___handleNodeAttach=d,e.___handleNodeDetach=d,e.___delegateEvent=p,e.___getEventFromEl=l,e.___addDelegatedEventHandler=function(o){s[o]||(s[o]=!0)},e.___init=function(o){Object.keys(s).forEach(function(e){!function(o,e){var t=e[c]=e[c]||{};t[o]||(e.body||e).addEventListener(o,t[o]=function(e){var t=e.target;if(t){t=t.correspondingUseElement||(3===t.nodeType?t.parentNode:t);var r,i="on"+o;if(e.bubbles){var n=!1,a=e.stopPropagation;e.stopPropagation=function(){a.call(e),n=!0};do{if((r=l(t,i))&&(p(t,i,r,e),n))break}while((t=t.parentNode)&&t.getAttribute)}else(r=l(t,i))&&p(t,i,r,e)}},!0)}(e,o)})}},9008:function(o,e,t){var r=t(6968);o.exports=function(o,e,t,i){var n=e.id,a=o.___componentDef=new r(e,n,o);return o.___globalContext.___renderedComponentsById[n]=!0,o.___components.push(a),o.___out.bc(e,t,i&&i.___component),a}},9307:function(o,e){var t="destroy";function r(o){return!o.once}function i(o){this.$__target=o,this.$__listeners=[],this.$__subscribeTo=null}function n(o){this.$__target=o}function a(){this.$__subscribeToList=[]}i.prototype={$__remove:function(o,e){var t=this.$__target,r=this.$__listeners;this.$__listeners=r.filter(function(r){var i=r[0],n=r[1],a=r[2];if(e){if(a&&o(i,a))return t.removeListener(i,a),!1}else if(o(i,n))return t.removeListener(i,a||n),!1;return!0});var i=this.$__subscribeTo;if(!this.$__listeners.length&&i){var n=this,a=i.$__subscribeToList;i.$__subscribeToList=a.filter(function(o){return o!==n})}},on:function(o,e){return this.$__target.on(o,e),this.$__listeners.push([o,e]),this},once:function(o,e){var t=this,r=function(){t.$__remove(function(o,e){return r===e},!0),e.apply(this,arguments)};return this.$__target.once(o,r),this.$__listeners.push([o,e,r]),this},removeListener:function(o,e){return"function"==typeof o&&(e=o,o=null),e&&o?this.$__remove(function(t,r){return o===t&&e===r}):e?this.$__remove(function(o,t){return e===t}):o&&this.removeAllListeners(o),this},removeAllListeners:function(o){var e=this.$__listeners,t=this.$__target;if(o)this.$__remove(function(e,t){return o===e});else{for(var r=e.length-1;r>=0;r--){var i=e[r];t.removeListener(i[0],i[1])}this.$__listeners.length=0}return this}},n.prototype={on:function(o,e){return this.$__target.addEventListener(o,e),this},once:function(o,e){var t=this,r=function(){t.$__target.removeEventListener(o,r),e()};return this.$__target.addEventListener(o,r),this},removeListener:function(o,e){return this.$__target.removeEventListener(o,e),this}},a.prototype={subscribeTo:function(o,e){for(var a,c,s=!e||!1!==e.addDestroyListener,l=this.$__subscribeToList,p=0,d=l.length;p<d;p++){var u=l[p];if(u.$__target===o){a=u;break}}return a||(r(o)&&(c=new n(o)),a=new i(c||o),s&&!c&&a.once(t,function(){a.removeAllListeners();for(var e=l.length-1;e>=0;e--)if(l[e].$__target===o){l.splice(e,1);break}}),a.$__subscribeTo=this,l.push(a)),a},removeAllListeners:function(o,e){var t,r=this.$__subscribeToList;if(o)for(t=r.length-1;t>=0;t--){var i=r[t];if(i.$__target===o){i.removeAllListeners(e),i.$__listeners.length||r.splice(t,1);break}}else{for(t=r.length-1;t>=0;t--)r[t].removeAllListeners();r.length=0}}},(e=o.exports=a).wrap=function(o){var e,a;return r(o)&&(e=new n(o)),a=new i(e||o),e||o.once(t,function(){a.$__listeners.length=0}),a},e.createTracker=function(){return new a}},9451:function(o,e,t){var r=t(7785);function i(o,e,t){var i=o.prototype,n=o.prototype=Object.create(e.prototype,{constructor:{value:o,writable:!0,configurable:!0}});return i&&!1!==t&&r(i,n),o.$super=e,o.prototype=n,o}o.exports=i,i._inherit=i},9460:function(o,e,t){var r=t(9451),i=t(5785),n=i.___keyByDOMNode,a=i.___vElementByDOMNode,c=t(7041).___createFragmentNode,s=t(9508);function l(o,e,t){this.___VNode(null,e),this.___key=o,this.___preserve=t}l.prototype={___nodeType:12,___actualize:function(){var o=c();return n.set(o,this.___key),a.set(o,this),o}},r(l,s),o.exports=l},9508:function(o,e,t){var r=t(6125);function i(){}i.prototype={___VNode:function(o,e){this.___finalChildCount=o,this.___childCount=0,this.___firstChildInternal=null,this.___lastChild=null,this.___parentNode=null,this.___nextSiblingInternal=null,this.___ownerComponent=e},get ___firstChild(){var o=this.___firstChildInternal;return o&&o.___DocumentFragment?o.___firstChild||o.___nextSibling:o},get ___nextSibling(){var o=this.___nextSiblingInternal;if(o){if(o.___DocumentFragment)return o.___firstChild||o.___nextSibling}else{var e=this.___parentNode;if(e&&e.___DocumentFragment)return e.___nextSibling}return o},___appendChild:function(o){if(this.___childCount++,r(this.___nodeName)){if(!o.___Text)throw TypeError();this.___textContent+=o.___nodeValue}else{var e=this.___lastChild;o.___parentNode=this,e?e.___nextSiblingInternal=o:this.___firstChildInternal=o,this.___lastChild=o}return o},___finishChild:function(){return this.___childCount===this.___finalChildCount&&this.___parentNode?this.___parentNode.___finishChild():this}},o.exports=i},9589:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%273%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cline x1=%2718%27 y1=%276%27 x2=%276%27 y2=%2718%27%3E%3C/line%3E%3Cline x1=%276%27 y1=%276%27 x2=%2718%27 y2=%2718%27%3E%3C/line%3E%3C/svg%3E"},9684:function(o){"use strict";o.exports=function(o){o.ee()}},9836:function(o,e,t){"use strict";var r=t(4585);o.exports=function o(e){if(e){var t=typeof e;if("string"!==t){var i="",n="";if(Array.isArray(e))for(var a=0,c=e.length;a<c;a++){var s=o(e[a]);s&&(i+=n+s,n=";")}else if("object"===t)for(var l in e){var p=e[l];null!=p&&!1!==p&&("number"==typeof p&&p&&(p+="px"),i+=n+r.___camelToDashCase(l)+":"+p,n=";")}return i||void 0}return e}}},9871:function(o,e,t){var r=t(862),i=t(3503).x,n=t(7098),a=t(5998),c=t(8899),s=t(7041).___createFragmentNode,l=t(6968),p=t(5785),d=t(8820),u=t(7331),b=d.___componentLookup,m=d.___addComponentRootToKeyedElements,h=p.___keyByDOMNode,f=p.___ssrKeyedElementsByComponentId,v=p.___componentByDOMNode,_={},g={},y=window;y.Marko={Component:function(){}};var w,k,x={},C={},N={};function E(o,t){var i=N[o];if(i)return i;i=function(o,t){var i=C[o];if(!i){if((i=x[o])?i=i():t?i=e.___legacy.load(o):(i=u(o),r("Looks like you used `require:` in your browser.json to load a component.  This requires that Marko has knowledge of how lasso generates paths and will be removed in a future version.  `marko-dependencies:/path/to/template.marko` should be used instead.")),!i)throw Error("Component not found: "+o);C[o]=i}return i}(o,t),(i=i.Component||i).___isComponent||(i=a(i,i.renderer)),i.prototype.___type=o;var n=/\/([^/]+?)(?:\/index|\/template|)(?:\.marko|\.component(?:-browser)?|)$/.exec(o),c=n?n[1]:"AnonymousComponent";c=(c=(c=c.replace(/-(.)/g,function(o){return o[1].toUpperCase()})).replace(/\$\d+\.\d+\.\d+$/,"").replace(/^[^a-z$_]/i,"_[[bundle]]").replace(/[^0-9a-z$_]+/gi,"_"))[0].toUpperCase()+c.slice(1);var s=i;return(i={[c]:function(o,e){s.call(this,o,e)}}[c]).prototype=s.prototype,N[o]=i,i}function L(o,e,t){var r,i,n,a,l,p=e.length;for(t=t||[],o=o.firstChild;o;){if(l=o.nextSibling,8===o.nodeType){var u=o.nodeValue;if(u.slice(0,p)===e){var v=u[p];if("^"===v||"#"===v)t.push(o);else if("/"===v){var g,y=o,w=t.pop();if(g=w.parentNode===y.parentNode?s(w.nextSibling,y):s(y.parentNode.firstChild,y),r=w.nodeValue.substring(p+1),"^"===(v=w.nodeValue[p])){var k=r.split(/ /g),x=k[2];i=k[1],r=k[0],a=(n=b[i])?n.___keyedElements:f[i]||(f[i]={}),m(a,x,g,r)}_[r]=g,w.parentNode.removeChild(w),y.parentNode.removeChild(y)}}}else if(1===o.nodeType){var C=o.getAttribute("data-marko-key"),N=d.___getMarkoPropsFromEl(o);if(C){var E=C.indexOf(" ");i=C.substring(E+1),C=C.substring(0,E),a=(n=b[i])?n.___keyedElements:f[i]||(f[i]={}),h.set(o,C),a[C]=o}N&&Object.keys(N).forEach(function(o){"on"===o.slice(0,2)&&c.___addDelegatedEventHandler(o.slice(2))}),L(o,e,t)}o=l}}function S(o,e,t,r,i,n,a){var c=function(o,e,t,r){var i=r;return t&&(i=function(t){r(t),o.removeEventListener(e,i)}),o.addEventListener(e,i,!1),function(){o.removeEventListener(e,i)}}(e,t,i,function(t){var i=[t,e];n&&(i=n.concat(i)),function(o,e,t){var r=o[e];if(!r)throw Error("Method not found: "+e);r.apply(o,t)}(o,r,i)});a.push(c)}function M(o,e){var t=o.___component;if(t&&t.___isComponent){t.___reset(),t.___host=e,o.___isExisting&&t.___removeDOMEventListeners();var r=o.___domEvents;if(r){var i=[];r.forEach(function(o){var e=o[0],r=o[1],n=t.___keyedElements[o[2]],a=o[3],c=o[4];S(t,n,e,r,a,c,i)}),i.length&&(t.___domEventListenerHandles=i)}t.___mounted?t.___emitUpdate():(t.___mounted=!0,t.___emitMount())}}function z(o,t,r,i){var n=l.___deserialize(o,t.___types,t.___globals,e),a=D(n,r);return a||(w?w.push(n):(w=[n],document.addEventListener("DOMContentLoaded",function(){L(r,i),w.map(function(o){return D(o,r)}).reverse().forEach(O),w.length=0}))),a}function D(o,e){var t,r=o.id,i=o.___component,n=_[r];if(n)return delete _[r],i.___rootNode=n,v.set(n,i),1&o.___flags?(i.___host=e,t=i.___rerender(i.___input,!0),j(o),function(){t.afterInsert(e)}):(j(o),function(){M(o,e)})}function j(o){var e=o.___component;e&&(b[e.id]=e)}function O(o){o&&o()}e.r=function(o,e){var t;return k&&(t=k[o]),x[o]=e,delete C[o],delete N[o],t&&(delete k[o],i(function(){t.forEach(function(o){z(o[0],o[1],o[2],o[3])()})})),o},e.___createComponent=function(o,e,t){return new(E(o,t))(e)},e.___getComponentClass=E,e.___initServerRendered=y.$initComponents=function o(e,t){var i,a=typeof e,s="$";if("object"!==a){s+="string"===a?(i=e)+"_C":(i="M")+"C",(e=y[s])&&void 0!==e.i&&e.i!==d.___runtimeId&&console.warn("Multiple instances of Marko have attached to the same runtime id. This could mean that more than one copy of Marko is loaded on the page, or that the script containing Marko has executed more than once.");var l=y[s]={r:i,concat:o};return l.i=d.___runtimeId,e&&e.forEach&&e.forEach(function(o){l.concat(o)}),l}var p=this.concat===o;e=n(e),p?(i=this.r,t=document):(i=e.r||"M",t||(t=document),r("Passing serialized data to `require('marko/components).init` is deprecated. Instead set '$global.runtimeId' and provide the 'runtimeId' option to your Marko bundler plugin.")),t!==document&&r("Passing a document other than the current document to `require('marko/components).init` is deprecated.");var b=e.p||"s",m=g[b],h=e.l;return m?h&&delete g[b]:(m={},h||(g[b]=m)),L(t,i),c.___init(t),m.___globals||(m.___globals=Object.assign({renderId:b,runtimeId:i,componentIdPrefix:b},e.g)),e.t&&(m.___types=m.___types?m.___types.concat(e.t):e.t),(e.w||[]).map(function(o){var e=m.___types[o[1]];return x[e]||u.e(e)?z(o,m,t,i):function(o,e,t,r,i){k||(k={}),(k[e]=k[e]||[]).push([o,t,r,i])}(o,e,m,t,i)}).reverse().forEach(O),this},t(4515).___initClientRendered=function(o,e){e||(e=document),c.___init(e);var t,r=o.length;for(t=r;t--;)j(o[t]);for(t=r;t--;)M(o[t],e)}},9927:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cpolyline points=%276 9 12 15 18 9%27%3E%3C/polyline%3E%3C/svg%3E"}},e={};function t(r){var i=e[r];if(void 0!==i)return i.exports;var n=e[r]={id:r,exports:{}};return o[r].call(n.exports,n,n.exports,t),n.exports}t.m=o,t.n=function(o){var e=o&&o.__esModule?function(){return o.default}:function(){return o};return t.d(e,{a:e}),e},t.d=function(o,e){for(var r in e)t.o(e,r)&&!t.o(o,r)&&Object.defineProperty(o,r,{enumerable:!0,get:e[r]})},t.o=function(o,e){return Object.prototype.hasOwnProperty.call(o,e)},t.b=document&&document.baseURI||self.location.href,t.nc=void 0;!function(){"use strict";var o=t(8170),e=t(5072),r=t.n(e),i=t(7825),n=t.n(i),a=t(7659),c=t.n(a),s=t(5056),l=t.n(s),p=t(540),d=t.n(p),u=t(1113),b=t.n(u),m=t(7167),h={};h.styleTagTransform=b(),h.setAttributes=l(),h.insert=c().bind(null,"head"),h.domAPI=n(),h.insertStyleElement=d();r()(m.A,h),m.A&&m.A.locals&&m.A.locals;var f=t(7639),v=t.n(f);function _(o,e,t,r,i,n,a){try{var c=o[n](a),s=c.value}catch(o){return void t(o)}c.done?e(s):Promise.resolve(s).then(r,i)}function g(o){return function(){var e=this,t=arguments;return new Promise(function(r,i){var n=o.apply(e,t);function a(o){_(n,r,i,a,c,"next",o)}function c(o){_(n,r,i,a,c,"throw",o)}a(void 0)})}}function y(o){return y="function"==typeof Symbol&&"symbol"==typeof Symbol.iterator?function(o){return typeof o}:function(o){return o&&"function"==typeof Symbol&&o.constructor===Symbol&&o!==Symbol.prototype?"symbol":typeof o},y(o)}function w(o){var e=function(o,e){if("object"!=y(o)||!o)return o;var t=o[Symbol.toPrimitive];if(void 0!==t){var r=t.call(o,e||"default");if("object"!=y(r))return r;throw new TypeError("@@toPrimitive must return a primitive value.")}return("string"===e?String:Number)(o)}(o,"string");return"symbol"==y(e)?e:e+""}function k(o,e,t){return(e=w(e))in o?Object.defineProperty(o,e,{value:t,enumerable:!0,configurable:!0,writable:!0}):o[e]=t,o}function x(o,e){var t=Object.keys(o);if(Object.getOwnPropertySymbols){var r=Object.getOwnPropertySymbols(o);e&&(r=r.filter(function(e){return Object.getOwnPropertyDescriptor(o,e).enumerable})),t.push.apply(t,r)}return t}function C(o){for(var e=1;e<arguments.length;e++){var t=null!=arguments[e]?arguments[e]:{};e%2?x(Object(t),!0).forEach(function(e){k(o,e,t[e])}):Object.getOwnPropertyDescriptors?Object.defineProperties(o,Object.getOwnPropertyDescriptors(t)):x(Object(t)).forEach(function(e){Object.defineProperty(o,e,Object.getOwnPropertyDescriptor(t,e))})}return o}var N=t(3757),E=t.n(N),L=t(1677),S=t(5998),M=t.n(S);const z="src/hs-main/index.marko",D=(0,o.t)(z);var j=D;(0,L.r)(z,()=>D);const O=class{onCreate(){this.state={ready:!1,error:!1,status:{},settings:{},settingsDialogError:!1,loading:!1,confirmationData:!1},this.bauds=[9600,300,1200,2400,4800,19200,38400,57600,115200],this.baseURL="/"}fetchWithTimeout(o,e={},t=1e4){const r=new AbortController,i=setTimeout(()=>r.abort(),t);return fetch(o,C(C({},e),{},{signal:r.signal})).finally(()=>clearTimeout(i))}loadStatusAndSettings(){var o=this;return g(function*(){const e=yield o.fetchWithTimeout(`${o.baseURL}api/get/status`);if(!e.ok)throw new Error(`HTTP error, status: ${e.status}`);const t=yield e.json();o.setState("status",t);const r=yield o.fetchWithTimeout(`${o.baseURL}api/get/settings`);if(!r.ok)throw new Error(`HTTP error, status: ${r.status}`);const i=yield r.json();o.setState("settings",i)})()}showNotification(o,e="alert-success"){this._notifCounter||(this._notifCounter=0);const t="notification-"+ ++this._notifCounter,r=document.createElement("div");r.id=t,r.className=`alert notification ${e}`,r.textContent=o,r.style.transition="top 180ms ease, opacity 180ms ease",r.style.opacity="0",document.body.appendChild(r),requestAnimationFrame(()=>{this._reflowNotifications(),r.style.opacity="1"});setTimeout(()=>{r.style.opacity="0";const o=e=>{"opacity"===e.propertyName&&(r.removeEventListener("transitionend",o),r.parentNode&&(r.parentNode.removeChild(r),requestAnimationFrame(()=>this._reflowNotifications())))};r.addEventListener("transitionend",o)},2e3)}_reflowNotifications(){const o=Array.from(document.querySelectorAll(".alert.notification"));if(!o.length)return;if(null==this._notifBaseTop){const e=getComputedStyle(o[0]);this._notifBaseTop=parseFloat(e.top)||16}let e=this._notifBaseTop;o.forEach(o=>{o.style.top=e+"px",e+=o.offsetHeight+8})}onMount(){var o=this;return g(function*(){try{yield o.loadStatusAndSettings()}catch(e){const t="AbortError"===e.name?"Request timed out (10s)":`Could not retrieve data: ${e.message}`;o.setState("error",t)}o.setState("ready",!0)})()}onCommandButtonClick(o){var e=this;return g(function*(){if(!o.target.closest("[data-id]"))return;o.preventDefault();const{id:t}=o.target.closest("[data-id]").dataset;switch(t){case"settings":const o=document.getElementById("settingsDialog");o&&!o.hasAttribute("open")&&o.setAttribute("open","");const{ssid:t="",password:r="",serialSpeed:i="",tcpServerPort:n="",busyMsg:a=""}=e.state.settings||{},c={s_ssid:t,s_password:r,s_serialSpeed:i,s_tcpServerPort:n,s_busyMsg:a};let s=null;for(const[o,e]of Object.entries(c)){const t=document.getElementById(o);t&&(t.value=null!=e?e:"",s||(s=t))}s&&s.focus();break;case"reboot":e.setState("confirmationData",{message:"Are you sure you want to reboot the ESP Modem?",action:"reboot"});break;case"hangup":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/ath`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Hang up successful"),e.loadStatusAndSettings()}catch(o){e.showNotification("Could not hang up","alert-danger")}finally{e.setState("loading",!1)}break;case"update":e.setState("confirmationData",{message:"Are you sure you want to update your ESP firmware?",action:"update"});break;case"factory":e.setState("confirmationData",{message:"Are you sure you want to reset your ESP to factory defaults? All settings will be lost.",action:"factory"});break;case"eepsave":e.setState("confirmationData",{message:"Are you sure you want to save your current settings to EEPROM?",action:"eepsave"});break;case"eepload":e.setState("confirmationData",{message:"Are you sure you want to load settings to EEPROM? Your current settings will be lost.",action:"eepload"})}})()}onSettingsDialogCancel(){const o=document.getElementById("settingsDialog");o&&o.hasAttribute("open")&&o.removeAttribute("open")}onSettingsDialogSave(o){var e=this;o.preventDefault();const t=document.getElementById("settingsDialog");t&&t.querySelectorAll("input, select").forEach(o=>o.setAttribute("aria-invalid","false"));const r=o=>document.getElementById(o),i={ssid:r("s_ssid").value.trim(),password:r("s_password").value,serialSpeed:parseInt(r("s_serialSpeed").value,10),tcpServerPort:Number(r("s_tcpServerPort").value),busyMsg:r("s_busyMsg").value.trim()};if(!i.ssid)return void r("s_ssid").setAttribute("aria-invalid","true");if(!i.password)return void r("s_password").setAttribute("aria-invalid","true");if(!Number.isInteger(i.tcpServerPort)||i.tcpServerPort<1||i.tcpServerPort>65535)return void r("s_tcpServerPort").setAttribute("aria-invalid","true");if(!i.busyMsg)return void r("s_busyMsg").setAttribute("aria-invalid","true");const n=new URLSearchParams;Object.entries(i).forEach(([o,e])=>n.append(o,e)),this.setState("loading",!0),this.setState("settingsDialogError",!1),g(function*(){try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/save/settings`,{method:"POST",mode:"cors",headers:{Accept:"application/json"},body:JSON.stringify(i)});if(!o.ok)throw new Error(`HTTP error ${o.status}`);yield e.loadStatusAndSettings(),e.onSettingsDialogCancel(),e.showNotification("Settings updated")}catch(o){e.setState("settingsDialogError",o.message||"Unknown error")}finally{e.setState("loading",!1)}})()}onConfirmationDialogCancel(){this.setState("confirmationData",!1)}onConfirmationDialogConfirm(o){var e=this;return g(function*(){if(!o.target.closest("[data-id]"))return;o.preventDefault(),e.onConfirmationDialogCancel();const{id:t}=o.target.closest("[data-id]").dataset;switch(t){case"reboot":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/reboot`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Device is rebooting")}catch(o){e.showNotification("Could not restart","alert-danger")}finally{e.setState("loading",!1)}break;case"update":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/update`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Device is updating")}catch(o){e.showNotification("Could not update","alert-danger")}finally{e.setState("loading",!1)}break;case"eepsave":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/eeprom/save`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Settings are saved")}catch(o){e.showNotification("Could not save settings","alert-danger")}finally{e.setState("loading",!1)}break;case"eepload":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/eeprom/load`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Settings are loaded")}catch(o){e.showNotification("Could not load settings","alert-danger")}finally{e.setState("loading",!1)}}})()}};D._=E()(function(o,e,t,r,i,n){e.be("main",{class:"container"},"0",r,null,1),e.be("a",{href:"/"},"1",r,null,0),e.e("img",{src:"data:image/svg+xml;base64,PD94bWwgdmVyc2lvbj0iMS4wIiBlbmNvZGluZz0iVVRGLTgiPz48c3ZnIGlkPSJhIiB4bWxucz0iaHR0cDovL3d3dy53My5vcmcvMjAwMC9zdmciIHZpZXdCb3g9IjAgMCA0MzUuNSA2MS41Ij48ZGVmcz48c3R5bGU+LmJ7ZmlsbDojMzkzRTQ2O30uY3tpc29sYXRpb246aXNvbGF0ZTt9PC9zdHlsZT48L2RlZnM+PGcgY2xhc3M9ImMiPjxnIGNsYXNzPSJjIj48cGF0aCBjbGFzcz0iYiIgZD0iTTIsNy41aDUyLjVjMi4yLDAsNC4xNy40LDUuOSwxLjIsMS43My44LDMuMiwxLjg2LDQuNCwzLjE3LDEuMiwxLjMyLDIuMTIsMi44MSwyLjc1LDQuNDcuNjMsMS42Ny45NSwzLjM4Ljk1LDUuMTVzLS4zMiwzLjQ0LS45NSw1LjEyYy0uNjMsMS42OC0xLjU1LDMuMTgtMi43NSw0LjUtMS4yLDEuMzItMi42NywyLjM4LTQuNCwzLjE3LTEuNzMuOC0zLjcsMS4yLTUuOSwxLjJIMTcuOHY3SDJWNy41Wk0xNy44LDE5LjV2NGgzMi43YzEuNDcsMCwyLjItLjY3LDIuMi0ycy0uNzMtMi0yLjItMkgxNy44WiIvPjxwYXRoIGNsYXNzPSJiIiBkPSJNNzMsNy41aDUyLjVjMi4yLDAsNC4xNy40LDUuOSwxLjIsMS43My44LDMuMiwxLjg2LDQuNCwzLjE3LDEuMiwxLjMyLDIuMTIsMi44MSwyLjc1LDQuNDcuNjMsMS42Ny45NSwzLjM4Ljk1LDUuMTUsMCwxLjUtLjI0LDIuOTgtLjczLDQuNDUtLjQ4LDEuNDctMS4xOCwyLjgyLTIuMSw0LjA1LS45MiwxLjIzLTIuMDMsMi4zLTMuMzUsMy4yLTEuMzIuOS0yLjgxLDEuNTUtNC40OCwxLjk1bDEwLjY1LDcuMzVoLTIwLjRsLTEwLjE1LTdoLTIwLjE1djdoLTE1LjhWNy41Wk04OC44LDE5LjV2NGgzMi43YzEuNDcsMCwyLjItLjY3LDIuMi0ycy0uNzMtMi0yLjItMmgtMzIuN1oiLz48cGF0aCBjbGFzcz0iYiIgZD0iTTE5OCw3YzIuNCwwLDQuNjcuNDgsNi44LDEuNDUsMi4xMy45NywzLjk5LDIuMjcsNS41OCwzLjkyLDEuNTgsMS42NSwyLjgzLDMuNTcsMy43NSw1Ljc1LjkyLDIuMTgsMS4zOCw0LjQ3LDEuMzgsNi44OHMtLjQ2LDQuNjktMS4zOCw2Ljg4Yy0uOTIsMi4xOC0yLjE3LDQuMS0zLjc1LDUuNzUtMS41OCwxLjY1LTMuNDQsMi45Ni01LjU4LDMuOTItMi4xMy45Ny00LjQsMS40NS02LjgsMS40NWgtMzYuNWMtMi40LDAtNC42Ny0uNDgtNi44LTEuNDUtMi4xMy0uOTctMy45OS0yLjI3LTUuNTgtMy45Mi0xLjU4LTEuNjUtMi44My0zLjU3LTMuNzUtNS43NS0uOTItMi4xOC0xLjM4LTQuNDctMS4zOC02Ljg4cy40Ni00LjY5LDEuMzgtNi44OGMuOTItMi4xOCwyLjE3LTQuMSwzLjc1LTUuNzUsMS41OC0xLjY1LDMuNDQtMi45Niw1LjU4LTMuOTIsMi4xMy0uOTcsNC40LTEuNDUsNi44LTEuNDVoMzYuNVpNMTk0Ljc1LDIwaC0zMGMtMS40LDAtMi41OC40OC0zLjU1LDEuNDUtLjk3Ljk3LTEuNDUsMi4xNS0xLjQ1LDMuNTVzLjQ4LDIuNTgsMS40NSwzLjU1Yy45Ny45NywyLjE1LDEuNDUsMy41NSwxLjQ1aDMwYzEuNCwwLDIuNTgtLjQ4LDMuNTUtMS40NS45Ny0uOTcsMS40NS0yLjE1LDEuNDUtMy41NXMtLjQ4LTIuNTgtMS40NS0zLjU1LTIuMTUtMS40NS0zLjU1LTEuNDVaIi8+PHBhdGggY2xhc3M9ImIiIGQ9Ik0yNDQuOCwxOS41aC0yNS4zVjcuNWg2Ni41djEyaC0yNS40djIzaC0xNS44di0yM1oiLz48cGF0aCBjbGFzcz0iYiIgZD0iTTI5Miw3LjVoNjV2OWgtNDkuMnY0aDQ5LjJ2OWgtNDkuMnY0aDQ5LjJ2OWgtNjVWNy41WiIvPjxwYXRoIGNsYXNzPSJiIiBkPSJNNDM1LjUsNDIuNWgtMTcuOGwtNC4wNS01aC0zMC44bC00LjA1LDVoLTE3LjhsMjguMzUtMzVoMTcuOGwyOC4zNSwzNVpNNDA1LjU1LDI3LjVsLTcuMy05LTcuMyw5aDE0LjZaIi8+PC9nPjwvZz48L3N2Zz4=",alt:"Protea",class:"h-logo mt-2"},"2",r,0,0),e.ee(),i.ready&&!i.error&&(e.be("p",{class:"mt-2"},"3",r,null,1),e.t("Hermes, ESP8266-based Serial WiFi Modem is up and running.",r),e.ee(),e.be("h3",null,"4",r,null,0),e.t("Status",r),e.ee(),e.be("article",null,"5",r,null,0),e.be("table",{class:"h-table striped"},"6",r,null,1),e.be("tbody",null,"7",r,null,0),e.be("tr",null,"8",r,null,0),e.be("th",{scope:"row"},"9",r,null,0),e.t("SSID",r),e.ee(),e.be("td",null,"10",r,null,0),e.t(i.status.ssid,r),e.ee(),e.ee(),e.be("tr",null,"11",r,null,0),e.be("th",{scope:"row"},"12",r,null,0),e.t("IP Address",r),e.ee(),e.be("td",null,"13",r,null,0),e.t(i.status.ip,r),e.ee(),e.ee(),e.be("tr",null,"14",r,null,0),e.be("th",{scope:"row"},"15",r,null,0),e.t("MAC Address",r),e.ee(),e.be("td",null,"16",r,null,0),e.t(i.status.mac,r),e.ee(),e.ee(),e.be("tr",null,"17",r,null,0),e.be("th",{scope:"row"},"18",r,null,0),e.t("Gateway",r),e.ee(),e.be("td",null,"19",r,null,0),e.t(i.status.gateway,r),e.ee(),e.ee(),e.be("tr",null,"20",r,null,0),e.be("th",{scope:"row"},"21",r,null,0),e.t("Subnet Mask",r),e.ee(),e.be("td",null,"22",r,null,0),e.t(i.status.subnet,r),e.ee(),e.ee(),e.be("tr",null,"23",r,null,0),e.be("th",{scope:"row"},"24",r,null,0),e.t("Call Status",r),e.ee(),e.be("td",null,"25",r,null,0),e.t(i.status.callStatus,r),e.ee(),e.ee(),e.be("tr",null,"26",r,null,0),e.be("th",{scope:"row"},"27",r,null,0),e.t("Call Length",r),e.ee(),e.be("td",null,"28",r,null,0),e.t(i.status.callLength,r),e.ee(),e.ee(),e.be("tr",null,"29",r,null,0),e.be("th",{scope:"row"},"30",r,null,0),e.t("Baud Rate",r),e.ee(),e.be("td",null,"31",r,null,0),e.t(i.status.baud,r),e.ee(),e.ee(),e.be("tr",null,"32",r,null,0),e.be("th",{scope:"row"},"33",r,null,0),e.t("Server Port",r),e.ee(),e.be("td",null,"34",r,null,0),e.t(i.status.tcpServerPort,r),e.ee(),e.ee(),e.ee(),e.ee(),e.ee(),e.be("h3",null,"35",r,null,0),e.t("Settings",r),e.ee(),e.be("article",null,"36",r,null,0),e.be("table",{class:"h-table striped"},"37",r,null,1),e.be("tbody",null,"38",r,null,0),e.be("tr",null,"39",r,null,0),e.be("th",{scope:"row"},"40",r,null,0),e.t("Echo",r),e.ee(),e.be("td",null,"41",r,null,0),e.t("1"===i.settings.echo?"Yes":"No",r),e.ee(),e.ee(),e.be("tr",null,"42",r,null,0),e.be("th",{scope:"row"},"43",r,null,0),e.t("Auto Answer",r),e.ee(),e.be("td",null,"44",r,null,0),e.t("1"===i.settings.autoAnswer?"Yes":"No",r),e.ee(),e.ee(),e.be("tr",null,"45",r,null,0),e.be("th",{scope:"row"},"46",r,null,0),e.t("Baud Rate",r),e.ee(),e.be("td",null,"47",r,null,0),e.t(r.bauds[parseInt(i.settings.serialSpeed,10)],r),e.ee(),e.ee(),e.be("tr",null,"48",r,null,0),e.be("th",{scope:"row"},"49",r,null,0),e.t("SSID",r),e.ee(),e.be("td",null,"50",r,null,0),e.t(i.settings.ssid,r),e.ee(),e.ee(),e.be("tr",null,"51",r,null,0),e.be("th",{scope:"row"},"52",r,null,0),e.t("BUSY Message",r),e.ee(),e.be("td",null,"53",r,null,0),e.t(i.settings.busyMsg,r),e.ee(),e.ee(),e.be("tr",null,"54",r,null,0),e.be("th",{scope:"row"},"55",r,null,0),e.t("Server Port",r),e.ee(),e.be("td",null,"56",r,null,0),e.t(i.status.tcpServerPort,r),e.ee(),e.ee(),e.be("tr",null,"57",r,null,0),e.be("th",{scope:"row"},"58",r,null,0),e.t("Telnet Mode",r),e.ee(),e.be("td",null,"59",r,null,0),e.t("1"===i.settings.telnet?"Yes":"No",r),e.ee(),e.ee(),e.be("tr",null,"60",r,null,0),e.be("th",{scope:"row"},"61",r,null,0),e.t("Verbose Results",r),e.ee(),e.be("td",null,"62",r,null,0),e.t("1"===i.settings.verboseResults?"Yes":"No",r),e.ee(),e.ee(),e.be("tr",null,"63",r,null,0),e.be("th",{scope:"row"},"64",r,null,0),e.t("Quiet Mode",r),e.ee(),e.be("td",null,"65",r,null,0),e.t("1"===i.settings.quietMode?"Yes":"No",r),e.ee(),e.ee(),e.ee(),e.ee(),e.ee(),e.be("h3",null,"66",r,null,0),e.t("Commands",r),e.ee(),e.be("article",null,"67",r,null,0),e.be("p",null,"68",r,null,0),e.be("mark",null,"69",r,null,0),e.t("Note",r),e.ee(),e.t(" ",r),e.t(" ",r),e.t(" ",r),e.be("b",null,"70",r,null,0),e.t("Update",r),e.ee(),e.t(" ",r),e.t(",",r),e.t(" ",r),e.be("b",null,"71",r,null,0),e.t("Reboot",r),e.ee(),e.t(" ",r),e.t("and",r),e.t(" ",r),e.be("b",null,"72",r,null,0),e.t("Factory Reset",r),e.ee(),e.t(" ",r),e.t("will disconnect the web server. You will need to reconnect before you will be able to use this page again.",r),e.ee(),e.be("div",{class:"mt-2 h-btns"},"73",r,null,1,{onclick:t.d("click","onCommandButtonClick",!1)}),e.be("button",{"data-id":"settings"},"74",r,null,0),e.t("Settings",r),e.ee(),e.be("button",{"data-id":"hangup"},"75",r,null,0),e.t("Hang Up",r),e.ee(),e.be("button",{"data-id":"update"},"76",r,null,0),e.t("Update",r),e.ee(),e.be("button",{"data-id":"reboot"},"77",r,null,0),e.t("Reboot",r),e.ee(),e.be("button",{"data-id":"factory",class:"contrast"},"78",r,null,0),e.t("Factory Reset",r),e.ee(),e.ee(),e.be("p",{class:"mt-2"},"79",r,null,1),e.t("Until saved to EEPROM, your current changes to the settings are temporary.",r),e.ee(),e.be("div",{class:"mt-2 h-btns"},"80",r,null,1,{onclick:t.d("click","onCommandButtonClick",!1)}),e.be("button",{"data-id":"eepsave",class:"contrast"},"81",r,null,0),e.t("EEPROM Save",r),e.ee(),e.t(" ",r),e.be("button",{"data-id":"eepload"},"82",r,null,0),e.t("EEPROM Load",r),e.ee(),e.ee(),e.ee()),i.ready||i.error||e.e("progress",{class:"mt-2"},"83",r,0,1),i.error&&(e.be("article",{class:"h-error mt-2"},"84",r,null,1),e.t(i.error,r),e.ee()),e.be("p",{class:"mt-2"},"85",r,null,1),e.be("small",null,"86",r,null,0),e.t("© 2025",r),e.t(" ",r),e.be("a",{href:"https://rh1.tech",target:"_blank"},"87",r,null,0),e.t("Mikhail Matveev",r),e.ee(),e.t(" ",r),e.t(". Licensed under",r),e.t(" ",r),e.be("a",{href:"https://www.gnu.org/licenses/gpl-3.0.html",target:"_blank"},"88",r,null,0),e.t("GPLv3 license",r),e.ee(),e.t(" ",r),e.t(".",r),e.ee(),e.ee(),e.t(" ",r),e.ee(),e.be("dialog",{id:"settingsDialog"},"89",r,null,1),e.be("article",null,"90",r,null,0),e.be("h3",null,"91",r,null,0),e.t("Settings",r),e.ee(),i.settingsDialogError&&(e.be("article",{class:"alert alert-danger mb-2"},"92",r,null,1),e.t(i.settingsDialogError,r),e.ee()),e.be("form",null,"93",r,null,0),e.be("fieldset",null,"94",r,null,0),e.be("label",null,"95",r,null,0),e.t("SSID",r),e.t(" ",r),e.e("input",{name:"ssid",placeholder:"Your Wi-Fi Network Name",id:"s_ssid"},"96",r,0,0),e.ee(),e.be("label",null,"97",r,null,0),e.t("Password",r),e.t(" ",r),e.e("input",{type:"password",name:"password",placeholder:"Wi-Fi Password",id:"s_password"},"98",r,0,0),e.ee(),e.be("div",{class:"grid"},"99",r,null,1),e.be("label",null,"100",r,null,0),e.t("Baud Rate",r),e.t(" ",r),e.be("select",{name:"serialSpeed",id:"s_serialSpeed"},"101",r,null,0);{let o=0;for(const t of v()(r.bauds)){let i=o++;const n=`[${i}]`;e.be("option",{value:i},"102"+n,r,null,0),e.t(t,r),e.ee()}}e.ee(),e.ee(),e.be("label",null,"103",r,null,0),e.t("Server Port",r),e.t(" ",r),e.e("input",{type:"number",name:"serverPort",placeholder:"23",id:"s_tcpServerPort"},"104",r,0,0),e.ee(),e.ee(),e.be("label",null,"105",r,null,0),e.t("BUSY Message",r),e.t(" ",r),e.e("input",{name:"busyMsg",placeholder:"Your BUSY Message",id:"s_busyMsg"},"106",r,0,0),e.ee(),e.ee(),e.ee(),e.be("footer",null,"107",r,null,0),e.be("button",{class:"secondary"},"108",r,null,1,{onclick:t.d("click","onSettingsDialogCancel",!1)}),e.t("Cancel",r),e.ee(),e.be("button",null,"109",r,null,0,{onclick:t.d("click","onSettingsDialogSave",!1)}),e.t("Save",r),e.ee(),e.ee(),e.ee(),e.ee(),i.confirmationData&&(e.be("dialog",{open:""},"110",r,null,0),e.be("article",null,"111",r,null,0),e.be("h3",null,"112",r,null,0),e.t("Confirmation",r),e.ee(),e.be("p",null,"113",r,null,0),e.t(i.confirmationData.message,r),e.ee(),e.be("footer",null,"114",r,null,0),e.be("button",{class:"secondary"},"115",r,null,1,{onclick:t.d("click","onConfirmationDialogCancel",!1)}),e.t("Cancel",r),e.ee(),e.be("button",{"data-id":i.confirmationData.action},"116",r,null,0,{onclick:t.d("click","onConfirmationDialogConfirm",!1)}),e.t("Confirm",r),e.ee(),e.ee(),e.ee(),e.ee()),i.loading&&(e.be("div",{id:"loadingOverlay",class:"overlay"},"117",r,null,1),e.e("div",{class:"loader"},"118",r,0,1),e.ee())},{t:z,d:!0},O),D.Component=M()(O,D._);var T=t(3684),I=t.n(T);const U="src/entrypoint.marko",A=(0,o.t)(U);var P=A;(0,L.r)(U,()=>A);const $={};A._=E()(function(o,e,t,r,i,n){I()(j,{},e,t,"0")},{t:U,i:!0,d:!0},$),A.Component=M()($,A._);P.renderSync({}).appendTo(document.body)}(),bundle={}}();</script>
+        <script>var bundle;!function(){var o={107:function(o){var e=function(o){var t=document.createElement("template");return e=t.content?function(o){return t.innerHTML=o,t.content}:function(o){return t.innerHTML=o,t},e(o)};o.exports=function(o){return e(o).firstChild}},306:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Ccircle cx=%2712%27 cy=%2712%27 r=%2710%27%3E%3C/circle%3E%3Cpolyline points=%2712 6 12 12 16 14%27%3E%3C/polyline%3E%3C/svg%3E"},343:function(o,e){var t,r,i;!function(){"use strict";r=[],void 0===(i="function"==typeof(t=function(){function o(o){return!isNaN(parseFloat(o))&&isFinite(o)}function e(o){return o.charAt(0).toUpperCase()+o.substring(1)}function t(o){return function(){return this[o]}}var r=["isConstructor","isEval","isNative","isToplevel"],i=["columnNumber","lineNumber"],n=["fileName","functionName","source"],a=["args"],c=["evalOrigin"],s=r.concat(i,n,a,c);function l(o){if(o)for(var t=0;t<s.length;t++)void 0!==o[s[t]]&&this["set"+e(s[t])](o[s[t]])}l.prototype={getArgs:function(){return this.args},setArgs:function(o){if("[object Array]"!==Object.prototype.toString.call(o))throw new TypeError("Args must be an Array");this.args=o},getEvalOrigin:function(){return this.evalOrigin},setEvalOrigin:function(o){if(o instanceof l)this.evalOrigin=o;else{if(!(o instanceof Object))throw new TypeError("Eval Origin must be an Object or StackFrame");this.evalOrigin=new l(o)}},toString:function(){var o=this.getFileName()||"",e=this.getLineNumber()||"",t=this.getColumnNumber()||"",r=this.getFunctionName()||"";return this.getIsEval()?o?"[eval] ("+o+":"+e+":"+t+")":"[eval]:"+e+":"+t:r?r+" ("+o+":"+e+":"+t+")":o+":"+e+":"+t}},l.fromString=function(o){var e=o.indexOf("("),t=o.lastIndexOf(")"),r=o.substring(0,e),i=o.substring(e+1,t).split(","),n=o.substring(t+1);if(0===n.indexOf("@"))var a=/@(.+?)(?::(\d+))?(?::(\d+))?$/.exec(n,""),c=a[1],s=a[2],p=a[3];return new l({functionName:r,args:i||void 0,fileName:c,lineNumber:s||void 0,columnNumber:p||void 0})};for(var p=0;p<r.length;p++)l.prototype["get"+e(r[p])]=t(r[p]),l.prototype["set"+e(r[p])]=function(o){return function(e){this[o]=Boolean(e)}}(r[p]);for(var d=0;d<i.length;d++)l.prototype["get"+e(i[d])]=t(i[d]),l.prototype["set"+e(i[d])]=function(e){return function(t){if(!o(t))throw new TypeError(e+" must be a Number");this[e]=Number(t)}}(i[d]);for(var u=0;u<n.length;u++)l.prototype["get"+e(n[u])]=t(n[u]),l.prototype["set"+e(n[u])]=function(o){return function(e){this[o]=String(e)}}(n[u]);return l})?t.apply(e,r):t)||(o.exports=i)}()},540:function(o){"use strict";o.exports=function(o){var e=document.createElement("style");return o.setAttributes(e,o.attributes),o.insert(e,o.options),e}},586:function(){window.Marko={Component:function(){}}},590:function(o){function e(){this.___lookup=Object.create(null)}e.prototype.___nextKey=function(o){var e=this.___lookup;return e[o]?o+"_"+e[o]++:(e[o]=1,o)},o.exports=e},851:function(o,e,t){o.exports=t(3774)},862:function(o,e,t){"use strict";var r=t(4263),i="undefined"!=typeof process&&"production",n=!i||"dev"===i||"development"===i,a="undefined"!=typeof process&&Boolean(process.env.SHOW_MODULE_COMPLAINS),c="undefined"!=typeof process&&Boolean(process.env.SHOW_NESTED_COMPLAINS),s="undefined"!=typeof console&&console.warn&&console,l="undefined"!=typeof process&&process.cwd&&process.cwd()+"/"||"",p="undefined"!=typeof process&&"win32"===process.platform?"\r\n":"\n",d=[].slice,u="[ignore]",b={};function m(){var o,e,t,i,n,s,f=arguments;if(!m.silence){"object"==typeof f[f.length-1]?(o=f[f.length-1],f=d.call(f,0,-1)):o={},s=o.level||2,n=o.heading||(2==s?"WARNING!!":"NOTICE"),i=o.headingColor||(2==s?m.colors.warning:m.colors.notice),t=null==o.locationIndex?1:o.locationIndex,!1===o.location&&(t=0),e=o.location||function(o){var e="",t=o+2;try{var i=r.parse(new Error).map(function(o){return o.fileName+":"+o.lineNumber+":"+o.columnNumber});if(!c)for(var n=i.length-1;n>t;n--)if(b[i[n]])return u;e=i[t]}catch(o){}return e}(t);var v=m.getModuleName(e);if(!v||a){if(e){if(b[e]||e===u)return;b[e]=!0}g=h(n,i);for(var _=0;_<f.length;_++)g+=p+h(f[_],m.colors.message);!1!==o.location&&e&&(g+=p+h("  at "+e.replace(l,""),m.colors.location)),m.log(p+g+p)}else if(!b[v]){var g=h("NOTICE",m.colors.notice);g+=p+h("The module ["+v+"] is using deprecated features.",m.colors.message),g+=p+h("Run with process.env.SHOW_MODULE_COMPLAINS=1 to see all warnings.",m.colors.message),m.log(p+g+p),b[v]=!0}}}function h(o,e){return e&&m.color?e+o+"[0m":o}function f(){}(m=n?m:f).method=n?function(o,e){var t=o[e],r=d.call(arguments,2);o[e]=function(){return m.apply(null,r),t.apply(this,arguments)}}:f,m.fn=n?function(o){var e=d.call(arguments,1);return function(){return m.apply(null,e),o.apply(this,arguments)}}:function(o){return o},m.log=function(o,e){var t=h(o,e);m.stream?m.stream.write(t+p):s&&s.warn(t)},m.stream="undefined"!=typeof process&&process.stderr,m.silence=!1,m.color=m.stream&&m.stream.isTTY,m.colors={warning:"[31;1m",notice:"[33;1m",message:!1,location:"[90m"},m.getModuleName=function(o){for(var e=o.replace(l,"").split(/\/|\\/g),t=e.length-1;t>=0;t--)if("node_modules"===e[t]){var r=e[t+1];return"@"===r[0]?r+"/"+e[t+2]:r}},o.exports?o.exports=m:window.complain=m},1031:function(o,e,t){var r=t(9508),i=t(9451);function n(o,e){this.___VNode(-1,e),this.___nodeValue=o}n.prototype={___nodeType:8,___actualize:function(o){var e=this.___nodeValue;return(o.ownerDocument||o).createComment(e)},___cloneNode:function(){return new n(this.___nodeValue)}},i(n,r),o.exports=n},1113:function(o){"use strict";o.exports=function(o,e){if(e.styleSheet)e.styleSheet.cssText=o;else{for(;e.firstChild;)e.removeChild(e.firstChild);e.appendChild(document.createTextNode(o))}}},1145:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%2842, 123, 111%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cpolyline points=%2720 6 9 17 4 12%27%3E%3C/polyline%3E%3C/svg%3E"},1197:function(o,e,t){"use strict";var r=t(8820),i=r.___componentLookup,n=r.___destroyNodeRecursive,a=r.___addComponentRootToKeyedElements,c=r.___normalizeComponentKey,s=t(5785),l=t(8899),p=t(590),d=t(6222).___VElement,u=t(7041),b=t(3448),m=t(6125),h=d.___virtualize,f=d.___morphAttrs,v=s.___keyByDOMNode,_=s.___componentByDOMNode,g=s.___vElementByDOMNode,y=s.___detachedByDOMNode,w=b.___insertBefore,k=b.___insertAfter,x=b.___nextSibling,C=b.___firstChild,N=b.___removeChild,E=u.___createFragmentNode,L=u.___beginFragmentNode;function S(o){return"@"!==o[0]}function M(o,e){return o.___nodeName===e.___nodeName}function z(o,e){return o.toLowerCase()===e.toLowerCase()}o.exports=function(o,e,t,r){var s,d=!1,u=Object.create(null);function b(o,e,i,n,a,c){var s=o.___actualize(t,n.namespaceURI);w(s,i,n),1!==o.___nodeType&&12!==o.___nodeType||(e&&(v.set(s,e),(S(e)?c:a).___keyedElements[e]=s),m(o.___nodeName)||U(s,o,c),function(o,e){1===o.nodeType&&l.___handleNodeAttach(o,e)}(s,r))}function D(o,e,t,r,i,n,s){var l=r.___rootNode=w(E(),e,t);_.set(l,r),i&&n&&(i=c(i,s.id),a(n.___keyedElements,i,l,r.id),v.set(l,i)),j(r,o)}function j(o,e){U(o.___rootNode,e,o)}r&&(s=r.___globalContext,d=s.___isHydrate);var O=[];function T(o,e,t){1===o.nodeType||12===o.nodeType?(O.push(o),y.set(o,t||!0)):(n(o),N(o))}function I(o){o.destroy()}function U(o,e,t){var r,n,l,m,f,O,P,$,B,R=C(o),V=e.___firstChild;o:for(;V;){f=V.___nextSibling,l=V.___nodeType,r=V.___key,R&&10===R.nodeType&&(R=x(R));var F,H=V.___ownerComponent||t;if(2!==l)if(r){$=void 0,n=void 0;var Y=r;if(S(r)?(H!==t&&(r+=":"+H.id),F=t):F=H,r=(u[F.id]||(u[F.id]=new p)).___nextKey(r),R&&(n=v.get(R),$=g.get(R),m=x(R)),n===r)V.___preserve||([[bundle]]&l===$.___nodeType&&(1!==l||M(V,$))?1===l?A(R,$,V,t):U(R,V,t):(T(R,0,H),b(V,r,R,o,H,t)));else if(void 0===(O=F.___keyedElements[r])||O===R){if(d&&R){if(1===R.nodeType&&(V.___preserve||z(R.nodeName,V.___nodeName||""))){($=h(R)).___nodeName=V.___nodeName,v.set(R,r),F.___keyedElements[r]=R,V.___preserve?g.set(R,$):A(R,$,V,t),V=f,R=m;continue}if(12===V.___nodeType&&8===R.nodeType&&R.nodeValue=="F#"+Y){for(var q,W=R.nextSibling,Q=0;;){if(8===W.nodeType)if("F/"===(q=W.nodeValue)){if(0===Q)break;Q--}else 0===q.indexOf("F#")&&Q++;W=W.nextSibling}var G=E(R,W.nextSibling,o);v.set(G,r),g.set(G,V),F.___keyedElements[r]=G,N(R),N(W),V.___preserve||U(G,V,t),V=f,R=G.nextSibling;continue}}b(V,r,R,o,H,t),m=R}else void 0!==y.get(O)&&y.set(O,void 0),V.___preserve?(w(O,R,o),m=R):($=g.get(O))&&l===$.___nodeType&&(1!==l||M($,V))?(m===O?f&&f.___key===n?(m=R,w(O,R,o)):(m=x(m),R&&T(R,0,H)):(k(O,R,o),R&&T(R,0,H)),1===l?A(O,$,V,t):U(O,V,t)):(b(V,r,R,o,H,t),T(O,0,H));V=f,R=m}else{for(;R;)if(m=x(R),B=_.get(R))R=m,s.___renderedComponentsById[B.id]||I(B);else{var K=R.nodeType,J=void 0;if(K===l)if(1===K){if(void 0===($=g.get(R))){if(!d){R=m;continue}z(($=h(R)).___nodeName,V.___nodeName)&&($.___nodeName=V.___nodeName)}else(n=$.___key)&&(J=!1);!0===(J=!1!==J&&!0===M($,V))&&A(R,$,V,t)}else if(3===K||8===K){J=!0;var Z=V.___nodeValue,X=R.nodeValue;X!==Z&&(d&&f&&3===K&&3===f.___nodeType&&X.startsWith(Z)&&X.slice(Z.length).startsWith(f.___nodeValue)?m=R.splitText(Z.length):R.nodeValue=Z)}if(!0===J){V=f,R=m;continue o}T(R,0,H),R=m}b(V,r,R,o,H,t),V=f,R=m}else{var oo=V.___component;if(void 0===(P=i[oo.id]))if(d){var eo=L(R,o);oo.___rootNode=eo,_.set(eo,oo),H&&r&&(r=c(r,t.id),a(H.___keyedElements,r,eo,oo.id),v.set(eo,r)),j(oo,V),R=x(eo)}else D(V,R,o,oo,r,H,t);else{if(P.___rootNode!==R){if(R&&(B=_.get(R))&&void 0===s.___renderedComponentsById[B.id]){R=x(B.___rootNode),I(B);continue}w(P.___rootNode,R,o)}else R=R&&x(R);V.___preserve||j(oo,V)}V=f}}if(o.___finishFragment)o.___finishFragment(R);else for(var to=12===o.nodeType?o.endNode:null;R&&R!==to;)m=x(R),(B=_.get(R))?(R=m,s.___renderedComponentsById[B.id]||I(B)):($=g.get(R),T(R,0,F=!(n=v.get(o))||S(n)?t:[[bundle]]&$.___ownerComponent),R=m)}function A(o,e,t,r){var i=t.___nodeName,n=t.___constId;g.set(o,t),void 0!==n&&e.___constId===n||(f(o,e,t),t.___preserveBody||(m(i)?t.___textContent!==e.___textContent&&("textarea"===i?o.value=t.___textContent:o.textContent=t.___textContent):U(o,t,r)))}U(o,e,e.___component),O.forEach(function(o){var e=y.get(o);if(void 0!==e){y.set(o,void 0);var t=_.get(o);t?t.destroy():o.parentNode&&(n(o,!0!==e&&e),0!=l.___handleNodeDetach(o)&&N(o))}})}},1601:function(o){"use strict";o.exports=function(o){return o[1]}},1677:function(o,e,t){o.exports=t(9871)},2191:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28149.5, 74, 80%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Ccircle cx=%2712%27 cy=%2712%27 r=%2710%27%3E%3C/circle%3E%3Cline x1=%2712%27 y1=%278%27 x2=%2712%27 y2=%2712%27%3E%3C/line%3E%3Cline x1=%2712%27 y1=%2716%27 x2=%2712.01%27 y2=%2716%27%3E%3C/line%3E%3C/svg%3E"},2261:function(o,e,t){var r=t(9451),i=t(9508);function n(o,e,t,r){this.___VNode(null,t),this.___key=e,this.___component=o,this.___preserve=r}n.prototype={___nodeType:2},r(n,i),o.exports=n},2263:function(o,e,t){var r=t(9451),i=t(9508);function n(o,e){this.___VNode(-1,e),this.___nodeValue=o}n.prototype={___Text:!0,___nodeType:3,___actualize:function(o){return(o.ownerDocument||o).createTextNode(this.___nodeValue)},___cloneNode:function(){return new n(this.___nodeValue)}},r(n,i),o.exports=n},2266:function(o,e,t){var r=t(8820).___nextComponentIdProvider;o.exports=function(o){this.___renderedComponentsById={},this.___rerenderComponent=void 0,this.___nextComponentId=r(o)}},2628:function(o){var e;o.exports="function"==typeof queueMicrotask?queueMicrotask:(e=Promise.resolve(),function(o){e.then(o)})},2821:function(o,e,t){var r=t(8798);function i(o){this.___component=o,this.___raw={},this.___dirty=!1,this.___old=null,this.___changes=null,this.___forced=null,Object.seal(this)}i.prototype={___reset:function(){this.___dirty=!1,this.___old=null,this.___changes=null,this.___forced=null},___replace:function(o){var e,t=this.___raw;for(e in t)e in o||this.___set(e,void 0,!1,!1);for(e in o)this.___set(e,o[e],!0,!1)},___set:function(o,e,t,i){var n,a,c=this.___raw;if(t&&(n=o,a=this.constructor.prototype,n in a||Object.defineProperty(a,n,{get:function(){return this.___raw[n]},set:function(o){this.___set(n,o,!1)}})),i)(this.___forced||(this.___forced={}))[o]=!0;else if(c[o]===e)return;this.___dirty||(this.___dirty=!0,this.___old=c,this.___raw=c=r({},c),this.___changes={},this.___component.___queueUpdate()),this.___changes[o]=e,void 0===e?delete c[o]:c[o]=e},toJSON:function(){return this.___raw}},o.exports=i},2933:function(o){"use strict";o.exports=function o(e){switch(typeof e){case"string":return e||void 0;case"object":var t="",r="";if(Array.isArray(e))for(var i=0,n=e.length;i<n;i++){var a=o(e[i]);a&&(t+=r+a,r=" ")}else for(var c in e)e[c]&&(t+=r+c,r=" ");return t||void 0}}},3084:function(o,e,t){"use strict";var r=t(862),i=t(2933),n=t(9836),a=t(107);o.exports=function(o){if("string"==typeof o)return r("Passing a string as a dynamic attribute value is deprecated - More details: https://github.com/marko-js/marko/wiki/Deprecation:-String-as-dynamic-attribute-value"),function(o){if(""===o)return{};for(var e,t=a("<a "+o+">").attributes,r={},i=t.length,n=0;n<i;n++)r[(e=t[n]).name]=e.value;return r}(o);if(o){var e={};for(var t in o){var c=o[t];"renderBody"!==t&&("class"===t?c=i(c):"style"===t&&(c=n(c)),e[t]=c)}return e}return o}},3448:function(o,e){function t(o,e,t){return o.insertInto?o.insertInto(t,e):t.insertBefore(o,e&&e.startNode||e)}e.___insertBefore=t,e.___insertAfter=function(o,e,r){return t(o,e&&e.nextSibling,r)},e.___nextSibling=function(o){var e=o.nextSibling,t=e&&e.fragment;return t?e===t.startNode?t:null:e},e.___firstChild=function(o){var e=o.firstChild;return e&&e.fragment||e},e.___removeChild=function(o){o.remove?o.remove():o.parentNode.removeChild(o)}},3503:function(o,e,t){var r=[],i=""+Math.random();window.addEventListener("message",function(o){if(o.data===i){var e=r;r=[];for(var t=0;t<e.length;t++)e[t]()}}),e.x=function(o){1===r.push(o)&&window.postMessage(i,"*")},t(2628)},3587:function(o,e,t){"use strict";var r,i=t(862),n=t(6764),a=t(9307),c=t(9451),s=t(8820),l=s.___componentLookup,p=s.___destroyNodeRecursive,d=t(5703),u=t(8229),b=t(3738),m=t(1197),h=t(4515).___getComponentsContext,f=t(5785),v=t(8899),_=t(5793),g=f.___componentByDOMNode,y=f.___ssrKeyedElementsByComponentId,w="__subtree_context__",k=Object.prototype.hasOwnProperty,x=Array.prototype.slice,C={addDestroyListener:!1},N=n.prototype.emit;function E(o){o()}function L(o){for(var e;o&&(e=o.firstChild);)o=e.fragment;return e}function S(o,e){return e?o+"_"+e:o}function M(o){n.call(this),this.id=o,this.___state=null,this.___rootNode=null,this.___subscriptions=null,this.___domEventListenerHandles=null,this.___bubblingDomEvents=null,this.___customEvents=null,this.___scope=null,this.___renderInput=null,this.___input=void 0,this.___mounted=!1,this.___global=void 0,this.___destroyed=!1,this.___updateQueued=!1,this.___dirty=!1,this.___settingInput=!1,this.___host=void 0;var e=y[o];e?(this.___keyedElements=e,delete y[o]):this.___keyedElements={}}M.prototype=r={___isComponent:!0,subscribeTo:function(o){if(!o)throw TypeError();var e=this.___subscriptions||(this.___subscriptions=new a),t=o.___isComponent?undefined:C;return e.subscribeTo(o,t)},emit:function(o){var e,t=this.___customEvents;if(t&&(e=t[o])){var r=e[0],i=e[1],n=e[2];!function(o,e,t,r){t.push(o),r&&(t=r.concat(t));var i=l[o.___scope],n="function"==typeof e?e:i[e];if(!n)throw Error("Method not found: "+e);n.apply(i,t)}(this,r,x.call(arguments,1),n),i&&delete t[o]}return N.apply(this,arguments)},getElId:function(o,e){return o?function(o,e,t){return o.id+"-"+S(e,t)}(this,o,e):this.id},getEl:function(o,e){if(o){var t=S(o,e),r=this.___keyedElements["@"+t];return r&&12===r.nodeType?(i("Accessing the elements of a child component using 'component.getEl' is deprecated."),L(r)):r}return this.el},getEls:function(o){o+="[]";for(var e,t=[],r=0;e=this.getEl(o,r);)t.push(e),r++;return t},getComponent:function(o,e){var t=this.___keyedElements["@"+S(o,e)];return/\[\]$/.test(o)&&(i("A repeated key[] was passed to getComponent. Use a non-repeating key if there is only one of these components."),t=t&&t[Object.keys(t)[0]]),t&&g.get(t)},getComponents:function(o){var e=this.___keyedElements["@"+o+"[]"];return e?Object.keys(e).map(function(o){return g.get(e[o])}).filter(Boolean):[]},destroy:function(){if(!this.___destroyed){var o=this.___rootNode;this.___destroyShallow(),o.nodes.forEach(function(o){p(o),!1!==v.___handleNodeDetach(o)&&o.parentNode.removeChild(o)}),o.detached=!0,delete l[this.id],this.___keyedElements={}}},___destroyShallow:function(){if(!this.___destroyed){this.___emitDestroy(),this.___destroyed=!0,g.set(this.___rootNode,void 0),this.___rootNode=null,this.___removeDOMEventListeners();var o=this.___subscriptions;o&&(o.removeAllListeners(),this.___subscriptions=null)}},isDestroyed:function(){return this.___destroyed},get state(){return this.___state},set state(o){var e=this.___state;(e||o)&&(e||(e=this.___state=new this.___State(this)),e.___replace(o||{}),e.___dirty&&this.___queueUpdate(),o||(this.___state=null))},setState:function(o,e){var t=this.___state;if(t||(t=this.___state=new this.___State(this)),"object"==typeof o){var r=o;for(var i in r)k.call(r,i)&&t.___set(i,r[i],!0)}else t.___set(o,e,!0)},setStateDirty:function(o,e){var t=this.___state;1==arguments.length&&(e=t[o]),t.___set(o,e,!0,!0)},replaceState:function(o){this.___state.___replace(o)},get input(){return this.___input},set input(o){this.___settingInput?this.___input=o:this.___setInput(o)},___setInput:function(o,e,t){var r;e=e||this.onInput;var i=this.___input;return this.___input=void 0,this.___context=t&&t[w]||this.___context,e&&(this.___settingInput=!0,r=e.call(this,o||{},t),this.___settingInput=!1),o=this.___renderInput=r||o,(this.___dirty=function(o,e,t){if(e!=t){if(null==e||null==t)return!0;var r=Object.keys(e),i=Object.keys(t),n=r.length;if(n!==i.length)return!0;for(var a=n;a--;){var c=r[a];if(!(c in t)||e[c]!==t[c])return!0}}return!1}(0,i,o))&&this.___queueUpdate(),void 0===this.___input&&(this.___input=o,o&&o.$global&&(this.___global=o.$global)),o},forceUpdate:function(){this.___dirty=!0,this.___queueUpdate()},___queueUpdate:function(){this.___updateQueued||(this.___updateQueued=!0,_.___queueComponentUpdate(this))},update:function(){if(!0!==this.___destroyed&&!1!==this.___isDirty){var o=this.___input,e=this.___state;!1===this.___dirty&&null!==e&&!0===e.___dirty&&function(o,e,t){var r,i;for(var n in e)if(k.call(e,n)){if(!(r=o["update_"+n]))return;(i||(i=[])).push([n,r])}return i&&(i.forEach(function(i){var n=i[0];r=i[1];var a=e[n],c=t[n];r.call(o,a,c)}),o.___emitUpdate(),o.___reset()),!0}(this,e.___changes,e.___old)&&(e.___dirty=!1),!0===this.___isDirty&&!1!==this.shouldUpdate(o,e)&&this.___scheduleRerender(),this.___reset()}},get ___isDirty(){return!0===this.___dirty||null!==this.___state&&!0===this.___state.___dirty},___reset:function(){this.___dirty=!1,this.___updateQueued=!1,this.___renderInput=null;var o=this.___state;o&&o.___reset()},shouldUpdate:function(){return!0},___scheduleRerender:function(){var o=this;if(!o.___renderer)throw TypeError();var e=this.___renderInput||this.___input;_.___batchUpdate(function(){o.___rerender(e,!1).afterInsert(o.___host)}),this.___reset()},___rerender:function(o,e){var t=this.___host,r=this.___global,i=this.___rootNode,n=this.___renderer,a=(n.createOut||d)(r);a.sync(),a.___host=this.___host,a[w]=this.___context;var c=h(a),s=c.___globalContext;s.___rerenderComponent=this,s.___isHydrate=e,n(o,a);var l=new b(a),p=a.___getOutput().___firstChild;return m(i,p,t,c),l},___detach:function(){var o=this.___rootNode;return o.remove(),o},___removeDOMEventListeners:function(){var o=this.___domEventListenerHandles;o&&(o.forEach(E),this.___domEventListenerHandles=null)},get ___rawState(){var o=this.___state;return o&&o.___raw},___setCustomEvents:function(o,e){var t=this.___customEvents={};this.___scope=e,o.forEach(function(o){var e=o[0],r=o[1],i=o[2],n=o[3];r&&(t[e]=[r,i,n])})},get el(){return L(this.___rootNode)},get els(){return i('The "this.els" attribute is deprecated. Please use "this.getEls(key)" instead.'),(this.___rootNode?this.___rootNode.nodes:[]).filter(function(o){return 1===o.nodeType})},___emit:N,___emitCreate(o,e){this.onCreate&&this.onCreate(o,e),this.___emit("create",o,e)},___emitRender(o){this.onRender&&this.onRender(o),this.___emit("render",o)},___emitUpdate(){this.onUpdate&&this.onUpdate(),this.___emit("update")},___emitMount(){this.onMount&&this.onMount(),this.___emit("mount")},___emitDestroy(){this.onDestroy&&this.onDestroy(),this.___emit("destroy")}},r.elId=r.getElId,r.___update=r.update,r.___destroy=r.destroy,u(r,function(o){return o.___detach()},function(o){return o}),c(M,n),o.exports=M},3684:function(o){"use strict";o.exports=function(o,e,t,r,i,n){t.c(r,i,n),(o._||(o._=o.render||o.renderer||o))(e,t),t.___assignedComponentDef=null}},3738:function(o,e,t){var r=t(8229),i=t(862);function n(o){for(var e=o;e.parentNode;)e=e.parentNode;return e}function a(o){this.out=this.___out=o,this.___components=void 0}o.exports=a;var c=a.prototype={getComponent:function(){return this.getComponents()[0]},getComponents:function(o){if(void 0===this.___components)throw Error("Not added to DOM");var e=function(o){var e=o.___components;if(!e)throw Error("No component");return e}(this),t=[];return e.forEach(function(e){var r=e.___component;o&&!o(r)||t.push(r)}),t},afterInsert:function(o){var e=this.___out.___components;return this.___components=e?e.___initComponents(o):null,this},getNode:function(o){return this.___out.___getNode(o)},getOutput:function(){return this.___out.___getOutput()},toString:function(){return this.___out.toString()},document:"object"==typeof document&&document};Object.defineProperty(c,"html",{get:function(){return i('The "html" property is deprecated. Please use "toString" instead.'),this.toString()}}),Object.defineProperty(c,"context",{get:function(){return i('The "context" property is deprecated. Please use "out" instead.'),this.___out}}),r(c,function(o,e){return o.getNode(n(e))},function(o,e){return o.afterInsert(n(e))})},3757:function(o,e,t){var r=t(7785),i=t(9008),n=t(9684),a=t(9871),c=t(8820),s=c.___componentLookup,l=t(4515),p=l.___getComponentsContext,d=!0===c.___isServer;function u(o,e){return"#"===o[0]?o.substring(1):e.id+"-"+e.___nextKey(o)}function b(o){o.isSync()||o.global.$wa||(o.on("beginAsync",m),o.on("beginDetachedAsync",h),o.global.$wa=!0)}function m(o){var e=o.parentOut,t=o.out,r=e.___components;void 0!==r&&(t.___components=new l(t,r)),t.c(e.___assignedComponentDef,e.___assignedKey,e.___assignedCustomEvents)}function h(o){var e=o.out;m(o),e.on("beginAsync",m),e.on("beginDetachedAsync",h)}function f(o,e,t){var c=t&&t.onInput,l=e.t,m=!0===e.s,h=!0===e.i,f=t&&m;if(!e.d)throw new Error("Component was compiled in a different NODE_ENV than the Marko runtime is using.");return function(e,v){b(v);var _,g,y,w=p(v),k=w.___globalContext,x=k.___rerenderComponent,C=void 0!==x,N=w.___componentDef,E=v.___assignedComponentDef,L=E&&E.id,S=v.___assignedKey;if(x?(_=x.id,g=!0,k.___rerenderComponent=null):N?(y=v.___assignedCustomEvents,_=null!=S?u(S.toString(),N):N.___nextComponentId()):_=k.___nextComponentId(),d)e=(x=a.___createComponent(t,_,e,v,l,y,L)).___updatedInput;else{if(!x){if(C&&(x=s[_])&&x.___type!==l&&(x.destroy(),x=void 0),x)g=!0;else if(g=!1,x=a.___createComponent(l,_),!0===f){f=!1;var M="function"==typeof t?t.prototype:t;r(M,x.constructor.prototype)}if(x.___updateQueued=!0,y&&x.___setCustomEvents(y,L),!1===g&&x.___emitCreate(e,v),e=x.___setInput(e,c,v),!0===g&&(!1===x.___isDirty||!1===x.shouldUpdate(e,x.___state)))return v.___preserveComponent(x),k.___renderedComponentsById[_]=!0,void x.___reset()}x.___global=v.global,x.___emitRender(v)}var z=i(w,x,S,E,m,h);z.___isExisting=g,o(e,v,z,x,x.___rawState,v.global),n(v,z),w.___componentDef=N}}o.exports=f,f.___resolveComponentKey=u,f.___trackAsyncComponents=b},3774:function(o,e){var t=window;e.NOOP=t.$W10NOOP=t.$W10NOOP||function(){}},4263:function(o,e,t){var r,i,n;!function(){"use strict";i=[t(343)],void 0===(n="function"==typeof(r=function(o){var e=/(^|@)\S+:\d+/,t=/^\s*at .*(\S+:\d+|\(native\))/m,r=/^(eval@)?(\[native code])?$/;return{parse:function(o){if(void 0!==o.stacktrace||void 0!==o["opera#sourceloc"])return this.parseOpera(o);if(o.stack&&o.stack.match(t))return this.parseV8OrIE(o);if(o.stack)return this.parseFFOrSafari(o);throw new Error("Cannot parse given Error object")},extractLocation:function(o){if(-1===o.indexOf(":"))return[o];var e=/(.+?)(?::(\d+))?(?::(\d+))?$/.exec(o.replace(/[()]/g,""));return[e[1],e[2]||void 0,e[3]||void 0]},parseV8OrIE:function(e){return e.stack.split("\n").filter(function(o){return!!o.match(t)},this).map(function(e){e.indexOf("(eval ")>-1&&(e=e.replace(/eval code/g,"eval").replace(/(\(eval at [^()]*)|(,.*$)/g,""));var t=e.replace(/^\s+/,"").replace(/\(eval code/g,"(").replace(/^.*?\s+/,""),r=t.match(/ (\(.+\)$)/);t=r?t.replace(r[0],""):t;var i=this.extractLocation(r?r[1]:t),n=r&&t||void 0,a=["eval","<anonymous>"].indexOf(i[0])>-1?void 0:i[0];return new o({functionName:n,fileName:a,lineNumber:i[1],columnNumber:i[2],source:e})},this)},parseFFOrSafari:function(e){return e.stack.split("\n").filter(function(o){return!o.match(r)},this).map(function(e){if(e.indexOf(" > eval")>-1&&(e=e.replace(/ line (\d+)(?: > eval line \d+)* > eval:\d+:\d+/g,":$1")),-1===e.indexOf("@")&&-1===e.indexOf(":"))return new o({functionName:e});var t=/((.*".+"[^@]*)?[^@]*)(?:@)/,r=e.match(t),i=r&&r[1]?r[1]:void 0,n=this.extractLocation(e.replace(t,""));return new o({functionName:i,fileName:n[0],lineNumber:n[1],columnNumber:n[2],source:e})},this)},parseOpera:function(o){return!o.stacktrace||o.message.indexOf("\n")>-1&&o.message.split("\n").length>o.stacktrace.split("\n").length?this.parseOpera9(o):o.stack?this.parseOpera11(o):this.parseOpera10(o)},parseOpera9:function(e){for(var t=/Line (\d+).*script (?:in )?(\S+)/i,r=e.message.split("\n"),i=[],n=2,a=r.length;n<a;n+=2){var c=t.exec(r[n]);c&&i.push(new o({fileName:c[2],lineNumber:c[1],source:r[n]}))}return i},parseOpera10:function(e){for(var t=/Line (\d+).*script (?:in )?(\S+)(?:: In function (\S+))?$/i,r=e.stacktrace.split("\n"),i=[],n=0,a=r.length;n<a;n+=2){var c=t.exec(r[n]);c&&i.push(new o({functionName:c[3]||void 0,fileName:c[2],lineNumber:c[1],source:r[n]}))}return i},parseOpera11:function(t){return t.stack.split("\n").filter(function(o){return!!o.match(e)&&!o.match(/^Error created at/)},this).map(function(e){var t,r=e.split("@"),i=this.extractLocation(r.pop()),n=r.shift()||"",a=n.replace(/<anonymous function(: (\w+))?>/,"$2").replace(/\([^)]*\)/g,"")||void 0;n.match(/\(([^)]*)\)/)&&(t=n.replace(/^[^(]+\(([^)]*)\)$/,"$1"));var c=void 0===t||"[arguments not available]"===t?void 0:t.split(",");return new o({functionName:a,args:c,fileName:i[0],lineNumber:i[1],columnNumber:i[2],source:e})},this)}}})?r.apply(e,i):r)||(o.exports=n)}()},4417:function(o){"use strict";o.exports=function(o,e){return e||(e={}),o?(o=String(o.__esModule?o.default:o),/^['"].*['"]$/.test(o)&&(o=o.slice(1,-1)),e.hash&&(o+=e.hash),/["'() \t\n]|(%20)/.test(o)||e.needQuotes?'"'.concat(o.replace(/"/g,'\\"').replace(/\n/g,"\\n"),'"'):o):o}},4515:function(o,e,t){"use strict";var r=t(2266);function i(o,e){var t,i,n;e?(t=e.___globalContext,i=e.___componentDef,(n=e.___nestedContexts)||(n=e.___nestedContexts=[]),n.push(this)):void 0===(t=o.global.___components)&&(o.global.___components=t=new r(o));this.___globalContext=t,this.___components=[],this.___out=o,this.___componentDef=i,this.___nestedContexts=void 0,this.___isPreserved=e&&e.___isPreserved}i.prototype={___initComponents:function(o){var e=this.___components;return i.___initClientRendered(e,o),this.___out.emit("___componentsInitialized"),this.___out.global.___components=void 0,e}},o.exports=e=i,e.___getComponentsContext=function(o){return o.___components||(o.___components=new i(o))}},4585:function(o,e){"use strict";var t=Object.create(null),r=Object.create(null);function i(o,e){return e.toUpperCase()}e.___camelToDashCase=function(o){var e=t[o];return e||(e=t[o]=o.replace(/([A-Z])/g,"-$1").toLowerCase())!==o&&(r[e]=o),e},e.___dashToCamelCase=function(o){var e=r[o];return e||(e=r[o]=o.replace(/-([a-z])/g,i))!==o&&(t[e]=o),e}},5007:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28200.25, 79.25, 72.25%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Ccircle cx=%2712%27 cy=%2712%27 r=%2710%27%3E%3C/circle%3E%3Cline x1=%2712%27 y1=%278%27 x2=%2712%27 y2=%2712%27%3E%3C/line%3E%3Cline x1=%2712%27 y1=%2716%27 x2=%2712.01%27 y2=%2716%27%3E%3C/line%3E%3C/svg%3E"},5056:function(o,e,t){"use strict";o.exports=function(o){var e=t.nc;e&&o.setAttribute("nonce",e)}},5072:function(o){"use strict";var e=[];function t(o){for(var t=-1,r=0;r<e.length;r++)if(e[r].identifier===o){t=r;break}return t}function r(o,r){for(var n={},a=[],c=0;c<o.length;c++){var s=o[c],l=r.base?s[0]+r.base:s[0],p=n[l]||0,d="".concat(l," ").concat(p);n[l]=p+1;var u=t(d),b={css:s[1],media:s[2],sourceMap:s[3],supports:s[4],layer:s[5]};if(-1!==u)e[u].references++,e[u].updater(b);else{var m=i(b,r);r.byIndex=c,e.splice(c,0,{identifier:d,updater:m,references:1})}a.push(d)}return a}function i(o,e){var t=e.domAPI(e);t.update(o);return function(e){if(e){if(e.css===o.css&&e.media===o.media&&e.sourceMap===o.sourceMap&&e.supports===o.supports&&e.layer===o.layer)return;t.update(o=e)}else t.remove()}}o.exports=function(o,i){var n=r(o=o||[],i=i||{});return function(o){o=o||[];for(var a=0;a<n.length;a++){var c=t(n[a]);e[c].references--}for(var s=r(o,i),l=0;l<n.length;l++){var p=t(n[l]);0===e[p].references&&(e[p].updater(),e.splice(p,1))}n=s}}},5328:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%271.5%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Ccircle cx=%2711%27 cy=%2711%27 r=%278%27%3E%3C/circle%3E%3Cline x1=%2721%27 y1=%2721%27 x2=%2716.65%27 y2=%2716.65%27%3E%3C/line%3E%3C/svg%3E"},5703:function(o){var e;function t(o){return e(o)}t.___setCreateOut=function(o){e=o},o.exports=t},5785:function(o){o.exports={___vPropsByDOMNode:new WeakMap,___vElementByDOMNode:new WeakMap,___componentByDOMNode:new WeakMap,___detachedByDOMNode:new WeakMap,___keyByDOMNode:new WeakMap,___ssrKeyedElementsByComponentId:{}}},5793:function(o,e,t){"use strict";var r=!1,i=[],n=[],a=t(3503).x;function c(){if(n.length)try{s(n)}finally{r=!1}}function s(o){for(var e=0;e<o.length;e++){o[e].___update()}o.length=0}e.___queueComponentUpdate=function(o){var e=i.length;e?i[e-1].push(o):(r||(r=!0,a(c)),n.push(o))},e.___batchUpdate=function(o){var e=[];i.push(e);try{o()}finally{try{s(e)}finally{i.length--}}}},5998:function(o,e,t){"use strict";var r=t(9451),i=t(3587),n=t(2821);o.exports=function(o,e){if(o.___isComponent)return o;var t,a=function(){},c=typeof o;if("function"==c)t=o.prototype;else{if("object"!=c)throw TypeError();t=o}function s(o){i.call(this,o)}function l(o){n.call(this,o)}return a.prototype=t,t.___isComponent||r(a,i),t=s.prototype=a.prototype,s.___isComponent=!0,r(l,n),t.___State=l,t.___renderer=e,s}},6032:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Crect x=%273%27 y=%274%27 width=%2718%27 height=%2718%27 rx=%272%27 ry=%272%27%3E%3C/rect%3E%3Cline x1=%2716%27 y1=%272%27 x2=%2716%27 y2=%276%27%3E%3C/line%3E%3Cline x1=%278%27 y1=%272%27 x2=%278%27 y2=%276%27%3E%3C/line%3E%3Cline x1=%273%27 y1=%2710%27 x2=%2721%27 y2=%2710%27%3E%3C/line%3E%3C/svg%3E"},6125:function(o){o.exports=function(o){switch(o){case"textarea":case"script":case"style":return!0}return!1}},6222:function(o,e,t){var r=t(107),i=t(1031),n=t(2261),a=t(7469),c=t(8338),s=t(9460),l=t(9508),p=t(2263),d=/[&<]/;function u(o,e,t){for(var r=o.firstChild;r;)e.___appendChild(b(r,t)),r=r.nextSibling}function b(o,e){switch(o.nodeType){case 1:return c.___virtualize(o,u,e);case 3:return new p(o.nodeValue,e);case 8:return new i(o.nodeValue,e);case 11:var t=new a;return u(o,t,e),t}}function m(o,e){if(!d.test(o))return new p(o,e);for(var t,i=new a,n=r(o);n;)(t=b(n,e))&&i.___appendChild(t),n=n.nextSibling;return i}var h=l.prototype;h.t=function(o){var e,t=typeof o;return"string"!==t&&(null==o?o="":"object"===t&&o.toHTML&&(e=m(o.toHTML()))),this.___appendChild(e||new p(o.toString())),this.___finishChild()},h.___appendDocumentFragment=function(){return this.___appendChild(new a)},e.___VComment=i,e.___VDocumentFragment=a,e.___VElement=c,e.___VText=p,e.___VComponent=n,e.___VFragment=s,e.___virtualize=b,e.___virtualizeHTML=m},6314:function(o){"use strict";o.exports=function(o){var e=[];return e.toString=function(){return this.map(function(e){var t="",r=void 0!==e[5];return e[4]&&(t+="@supports (".concat(e[4],") {")),e[2]&&(t+="@media ".concat(e[2]," {")),r&&(t+="@layer".concat(e[5].length>0?" ".concat(e[5]):""," {")),t+=o(e),r&&(t+="}"),e[2]&&(t+="}"),e[4]&&(t+="}"),t}).join("")},e.i=function(o,t,r,i,n){"string"==typeof o&&(o=[[null,o,void 0]]);var a={};if(r)for(var c=0;c<this.length;c++){var s=this[c][0];null!=s&&(a[s]=!0)}for(var l=0;l<o.length;l++){var p=[].concat(o[l]);r&&a[p[0]]||(void 0!==n&&(void 0===p[5]||(p[1]="@layer".concat(p[5].length>0?" ".concat(p[5]):""," {").concat(p[1],"}")),p[5]=n),t&&(p[2]?(p[1]="@media ".concat(p[2]," {").concat(p[1],"}"),p[2]=t):p[2]=t),i&&(p[4]?(p[1]="@supports (".concat(p[4],") {").concat(p[1],"}"),p[4]=i):p[4]="".concat(i)),e.push(p))}},e}},6624:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28255, 255, 255%29%27 stroke-width=%274%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cpolyline points=%2720 6 9 17 4 12%27%3E%3C/polyline%3E%3C/svg%3E"},6764:function(o){var e=Array.prototype.slice;function t(o){return"function"==typeof o}function r(o){if(!t(o))throw TypeError("Invalid listener")}function i(o,t,r){switch(r.length){case 1:t.call(o);break;case 2:t.call(o,r[1]);break;case 3:t.call(o,r[1],r[2]);break;default:t.apply(o,e.call(r,1))}}function n(o,e,i,n){r(i);var a=o.$e||(o.$e={}),c=a[e];return c?t(c)?a[e]=n?[i,c]:[c,i]:n?c.unshift(i):c.push(i):a[e]=i,o}function a(){this.$e=this.$e||{}}a.EventEmitter=a,a.prototype={$e:null,emit:function(o){var r=arguments,n=this.$e;if(n){var a=n&&n[o];if(!a){if("error"===o){var c=r[1];if(!(c instanceof Error)){var s=c;(c=new Error("Error: "+s)).context=s}throw c}return!1}if(t(a))i(this,a,r);else for(var l=0,p=(a=e.call(a)).length;l<p;l++){i(this,a[l],r)}return!0}},on:function(o,e){return n(this,o,e,!1)},prependListener:function(o,e){return n(this,o,e,!0)},once:function(o,e){return r(e),this.on(o,function t(){this.removeListener(o,t),e&&(e.apply(this,arguments),e=null)}),this},removeListener:function(o,e){r(e);var i,n=this.$e;if(n&&(i=n[o]))if(t(i))i===e&&delete n[o];else for(var a=i.length-1;a>=0;a--)i[a]===e&&i.splice(a,1);return this},removeAllListeners:function(o){var e=this.$e;e&&delete e[o]},listenerCount:function(o){var e=this.$e,r=e&&e[o];return r?t(r)?1:r.length:0}},o.exports=a},6961:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28255, 255, 255%29%27 stroke-width=%274%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cline x1=%275%27 y1=%2712%27 x2=%2719%27 y2=%2712%27%3E%3C/line%3E%3C/svg%3E"},6968:function(o,e,t){"use strict";var r=t(862),i=t(8798),n=t(8820),a=t(8288).a,c=n.___attachBubblingEvent,s=t(8899).___addDelegatedEventHandler,l=t(590),p={};function d(o,e,t){this.___componentsContext=t,this.___component=o,this.id=e,this.___domEvents=void 0,this.___isExisting=!1,this.___renderBoundary=!1,this.___flags=0,this.___nextIdIndex=0,this.___keySequence=null}d.prototype={___nextKey:function(o){return(this.___keySequence||(this.___keySequence=new l)).___nextKey(o)},elId:function(o){var e=this.id;return null==o?e:("string"!=typeof o&&(r("Using non strings as keys is deprecated."),o=String(o)),0===o.indexOf("#")&&(e="#"+e,o=o.substring(1)),e+"-"+o)},___nextComponentId:function(){return this.id+"-c"+this.___nextIdIndex++},d:function(o,e,t,r){return s(o),c(this,e,t,r)},get ___type(){return this.___component.___type}},d.prototype.nk=d.prototype.___nextKey,d.___deserialize=function(o,e,t,r){var n=o[0],c=e[o[1]],s=o[2]||null,l=o[3]||p,d=l.s,u=l.w||p,b=l.f,m=4&b,h=2&b?a:l.r,f=c&&r.___createComponent(c,n,m);if(f.___updateQueued=!0,f.___global=t,m?(f.widgetConfig=u,f.___widgetBody=h):h&&((s||(s={})).renderBody=h),m||!(1&b)||8&b){if(d){var v=l.u;v&&v.forEach(function(o){d[o]=void 0}),f.state=d}!m&&u&&i(f,u)}else f.onCreate&&f.onCreate(s,{global:t}),f.onInput&&(s=f.onInput(s,{global:t})||s);f.___input=s,l.b&&(f.___bubblingDomEvents=l.b);var _=l.p,g=l.e;return g&&f.___setCustomEvents(g,_),{id:n,___component:f,___domEvents:l.d,___flags:l.f||0}},o.exports=d},7041:function(o,e,t){var r=t(3448).___insertBefore,i={nodeType:12,get firstChild(){var o=this.startNode.nextSibling;return o===this.endNode?void 0:o},get lastChild(){var o=this.endNode.previousSibling;return o===this.startNode?void 0:o},get parentNode(){var o=this.startNode.parentNode;return o===this.detachedContainer?void 0:o},get namespaceURI(){return this.startNode.parentNode.namespaceURI},get nextSibling(){return this.endNode.nextSibling},get nodes(){if(this.___markersRemovedError)throw this.___markersRemovedError("Cannot get fragment nodes.");for(var o=[],e=this.startNode;e!==this.endNode;)o.push(e),e=e.nextSibling;return o.push(e),o},insertBefore:function(o,e){var t=null==e?this.endNode:e;return r(o,t,this.startNode.parentNode)},insertInto:function(o,e){return this.nodes.forEach(function(t){r(t,e,o)},this),this},remove:function(){this.nodes.forEach(function(o){this.detachedContainer.appendChild(o)},this)}};function n(o,e,t){var n=Object.create(i),a=o&&o.ownerDocument===o.parentNode;n.startNode=a?document.createComment(""):document.createTextNode(""),n.endNode=a?document.createComment(""):document.createTextNode(""),n.startNode.fragment=n,n.endNode.fragment=n;var c=n.detachedContainer=document.createDocumentFragment();return t=t||o&&o.parentNode||c,r(n.startNode,o,t),r(n.endNode,e,t),n}e.___createFragmentNode=n,e.___beginFragmentNode=function(o,e){var t=n(o,null,e);return t.___finishFragment=function(i){t.___finishFragment=null,r(t.endNode,i,e||o.parentNode)},t}},7098:function(o,e,t){o.exports=t(8053)},7167:function(o,e,t){"use strict";var r=t(1601),i=t.n(r),n=t(6314),a=t.n(n),c=t(4417),s=t.n(c),l=new URL(t(6624),t.b),p=new URL(t(6961),t.b),d=new URL(t(9927),t.b),u=new URL(t(6032),t.b),b=new URL(t(306),t.b),m=new URL(t(5328),t.b),h=new URL(t(9589),t.b),f=new URL(t(8103),t.b),v=new URL(t(7616),t.b),_=new URL(t(5007),t.b),g=new URL(t(1145),t.b),y=new URL(t(2191),t.b),w=a()(i()),k=s()(l),x=s()(p),C=s()(d),N=s()(u),E=s()(b),L=s()(m),S=s()(h),M=s()(f),z=s()(v),D=s()(_),j=s()(g),O=s()(y);w.push([o.id,'/*!\n * Pico CSS ✨ v2.1.1 (https://picocss.com)\n * Copyright 2019-2025 - Licensed under MIT\n */\n@-webkit-keyframes modal-overlay{0%{backdrop-filter:none;background-color:transparent}}@keyframes modal-overlay{0%{backdrop-filter:none;background-color:transparent}}@-webkit-keyframes modal{0%{-webkit-transform:translateY(-100%);transform:translateY(-100%);opacity:0}}@keyframes modal{0%{-webkit-transform:translateY(-100%);transform:translateY(-100%);opacity:0}}@-webkit-keyframes progress-indeterminate{0%{background-position:200%0}to{background-position:-200%0}}@keyframes progress-indeterminate{0%{background-position:200%0}to{background-position:-200%0}}@-webkit-keyframes tooltip-slide{to{-webkit-transform:var(--pico-tooltip-slide-to);transform:var(--pico-tooltip-slide-to);opacity:1}}@keyframes tooltip-slide{to{-webkit-transform:var(--pico-tooltip-slide-to);transform:var(--pico-tooltip-slide-to);opacity:1}}@-webkit-keyframes tooltip-caret-slide{50%{opacity:0}to{-webkit-transform:var(--pico-tooltip-caret-slide-to);transform:var(--pico-tooltip-caret-slide-to);opacity:1}}@keyframes tooltip-caret-slide{50%{opacity:0}to{-webkit-transform:var(--pico-tooltip-caret-slide-to);transform:var(--pico-tooltip-caret-slide-to);opacity:1}}@-webkit-keyframes h-spin{to{-webkit-transform:rotate(360deg);transform:rotate(360deg)}}@keyframes h-spin{to{-webkit-transform:rotate(360deg);transform:rotate(360deg)}}:host,:root{--pico-font-family-emoji:"Apple Color Emoji", "Segoe UI Emoji", "Segoe UI Symbol", "Noto Color Emoji";--pico-font-family-sans-serif:system-ui, -apple-system, Segoe UI, Roboto, Ubuntu, Cantarell, Noto Sans, sans-serif, "Segoe UI", Roboto, Oxygen, Ubuntu, Cantarell, Helvetica, Arial, "Helvetica Neue", sans-serif, var(--pico-font-family-emoji);--pico-font-family-monospace:ui-monospace, SFMono-Regular, "SF Mono", Menlo, Consolas, "Liberation Mono", monospace, var(--pico-font-family-emoji);--pico-font-family:var(--pico-font-family-sans-serif);--pico-line-height:1.5;--pico-font-weight:400;--pico-font-size:100%;--pico-text-underline-offset:0.1rem;--pico-border-radius:0.25rem;--pico-border-width:0.0625rem;--pico-outline-width:0.125rem;--pico-transition:0.2s ease-in-out;--pico-spacing:1rem;--pico-typography-spacing-vertical:1rem;--pico-block-spacing-vertical:var(--pico-spacing);--pico-block-spacing-horizontal:var(--pico-spacing);--pico-grid-column-gap:var(--pico-spacing);--pico-grid-row-gap:var(--pico-spacing);--pico-form-element-spacing-vertical:0.75rem;--pico-form-element-spacing-horizontal:1rem;--pico-group-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-group-box-shadow-focus-with-button:0 0 0 var(--pico-outline-width) var(--pico-primary-focus);--pico-group-box-shadow-focus-with-input:0 0 0 0.0625rem var(--pico-form-element-border-color);--pico-modal-overlay-backdrop-filter:blur(0.375rem);--pico-nav-element-spacing-vertical:1rem;--pico-nav-element-spacing-horizontal:0.5rem;--pico-nav-link-spacing-vertical:0.5rem;--pico-nav-link-spacing-horizontal:0.5rem;--pico-nav-breadcrumb-divider:">";--pico-icon-checkbox:url('+k+");--pico-icon-minus:url("+x+");--pico-icon-chevron:url("+C+");--pico-icon-date:url("+N+");--pico-icon-time:url("+E+");--pico-icon-search:url("+L+");--pico-icon-close:url("+S+");--pico-icon-loading:url("+M+")}@media (min-width:576px){:host,:root{--pico-font-size:106.25%}}@media (min-width:768px){:host,:root{--pico-font-size:112.5%}}@media (min-width:1024px){:host,:root{--pico-font-size:118.75%}}@media (min-width:1280px){:host,:root{--pico-font-size:125%}}@media (min-width:1536px){:host,:root{--pico-font-size:131.25%}}a,a.contrast,a.secondary{--pico-text-decoration:underline}small{--pico-font-size:0.875em}h1,h2,h3,h4,h5,h6{--pico-font-weight:700}h1{--pico-font-size:2rem;--pico-line-height:1.125;--pico-typography-spacing-top:3rem}h2{--pico-font-size:1.75rem;--pico-line-height:1.15;--pico-typography-spacing-top:2.625rem}h3{--pico-font-size:1.5rem;--pico-line-height:1.175;--pico-typography-spacing-top:2.25rem}h4{--pico-font-size:1.25rem;--pico-line-height:1.2;--pico-typography-spacing-top:1.874rem}h5{--pico-font-size:1.125rem;--pico-line-height:1.225;--pico-typography-spacing-top:1.6875rem}h6{--pico-font-size:1rem;--pico-line-height:1.25;--pico-typography-spacing-top:1.5rem}tfoot td,tfoot th,thead td,thead th{--pico-font-weight:600;--pico-border-width:0.1875rem}code,kbd,pre,samp{--pico-font-family:var(--pico-font-family-monospace)}kbd{--pico-font-weight:bolder}:where(select,textarea),input:not([type=submit]):not([type=button]):not([type=reset]):not([type=checkbox]):not([type=radio]):not([type=file]){--pico-outline-width:0.0625rem}[type=search]{--pico-border-radius:5rem}[type=checkbox],[type=radio]{--pico-border-width:0.125rem}[type=checkbox][role=switch]{--pico-border-width:0.1875rem}details.dropdown summary:not([role=button]){--pico-outline-width:0.0625rem}nav details.dropdown summary:focus-visible{--pico-outline-width:0.125rem}[role=search]{--pico-border-radius:5rem}[role=group]:has(button.secondary:focus,[type=submit].secondary:focus,[type=button].secondary:focus,[role=button].secondary:focus),[role=search]:has(button.secondary:focus,[type=submit].secondary:focus,[type=button].secondary:focus,[role=button].secondary:focus){--pico-group-box-shadow-focus-with-button:0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[role=group]:has(button.contrast:focus,[type=submit].contrast:focus,[type=button].contrast:focus,[role=button].contrast:focus),[role=search]:has(button.contrast:focus,[type=submit].contrast:focus,[type=button].contrast:focus,[role=button].contrast:focus){--pico-group-box-shadow-focus-with-button:0 0 0 var(--pico-outline-width) var(--pico-contrast-focus)}[role=group] [role=button],[role=group] [type=button],[role=group] [type=submit],[role=group] button,[role=search] [role=button],[role=search] [type=button],[role=search] [type=submit],[role=search] button{--pico-form-element-spacing-horizontal:2rem}[aria-busy=true][role=button]:not(input):not(select):not(textarea):not(.outline)::before,[aria-busy=true][type=button]:not(input):not(select):not(textarea):not(.outline)::before,[aria-busy=true][type=reset]:not(input):not(select):not(textarea):not(.outline)::before,[aria-busy=true][type=submit]:not(input):not(select):not(textarea):not(.outline)::before,button[aria-busy=true]:not(input):not(select):not(textarea):not(.does-not-exist):not(.outline)::before,details summary[role=button]:not(.outline)::after{-webkit-filter:brightness(0) invert(1);filter:brightness(0) invert(1)}[aria-busy=true]:not(input):not(select):not(textarea):is(button,[type=submit],[type=button],[type=reset],[role=button]):not(.outline)::before{-webkit-filter:brightness(0) invert(1);filter:brightness(0) invert(1)}:host(:not([data-theme=dark])),:root:not([data-theme=dark]),[data-theme=light]{--csstools-color-scheme--light:initial;color-scheme:light;--pico-background-color:#fff;--pico-color:#373c44;--pico-text-selection-color:rgba(2, 154, 232, 0.25);--pico-muted-color:#646b79;--pico-muted-border-color:rgb(231, 234, 239.5);--pico-primary:#0172ad;--pico-primary-background:#0172ad;--pico-primary-border:var(--pico-primary-background);--pico-primary-underline:rgba(1, 114, 173, 0.5);--pico-primary-hover:#015887;--pico-primary-hover-background:#02659a;--pico-primary-hover-border:var(--pico-primary-hover-background);--pico-primary-hover-underline:var(--pico-primary-hover);--pico-primary-focus:rgba(2, 154, 232, 0.5);--pico-primary-inverse:#fff;--pico-secondary:#5d6b89;--pico-secondary-background:#525f7a;--pico-secondary-border:var(--pico-secondary-background);--pico-secondary-underline:rgba(93, 107, 137, 0.5);--pico-secondary-hover:#48536b;--pico-secondary-hover-background:#48536b;--pico-secondary-hover-border:var(--pico-secondary-hover-background);--pico-secondary-hover-underline:var(--pico-secondary-hover);--pico-secondary-focus:rgba(93, 107, 137, 0.25);--pico-secondary-inverse:#fff;--pico-contrast:#181c25;--pico-contrast-background:#181c25;--pico-contrast-border:var(--pico-contrast-background);--pico-contrast-underline:rgba(24, 28, 37, 0.5);--pico-contrast-hover:#000;--pico-contrast-hover-background:#000;--pico-contrast-hover-border:var(--pico-contrast-hover-background);--pico-contrast-hover-underline:var(--pico-secondary-hover);--pico-contrast-focus:rgba(93, 107, 137, 0.25);--pico-contrast-inverse:#fff;--pico-box-shadow:0.0145rem 0.029rem 0.174rem rgba(129, 145, 181, 0.01698), 0.0335rem 0.067rem 0.402rem rgba(129, 145, 181, 0.024), 0.0625rem 0.125rem 0.75rem rgba(129, 145, 181, 0.03), 0.1125rem 0.225rem 1.35rem rgba(129, 145, 181, 0.036), 0.2085rem 0.417rem 2.502rem rgba(129, 145, 181, 0.04302), 0.5rem 1rem 6rem rgba(129, 145, 181, 0.06), 0 0 0 0.0625rem rgba(129, 145, 181, 0.015);--pico-h1-color:#2d3138;--pico-h2-color:#373c44;--pico-h3-color:#424751;--pico-h4-color:#4d535e;--pico-h5-color:#5c6370;--pico-h6-color:#646b79;--pico-mark-background-color:rgb(252.5, 230.5, 191.5);--pico-mark-color:#0f1114;--pico-ins-color:rgb(28.5, 105.5, 84);--pico-del-color:rgb(136, 56.5, 53);--pico-blockquote-border-color:var(--pico-muted-border-color);--pico-blockquote-footer-color:var(--pico-muted-color);--pico-button-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-button-hover-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-table-border-color:var(--pico-muted-border-color);--pico-table-row-stripped-background-color:rgba(111, 120, 135, 0.0375);--pico-code-background-color:rgb(243, 244.5, 246.75);--pico-code-color:#646b79;--pico-code-kbd-background-color:var(--pico-color);--pico-code-kbd-color:var(--pico-background-color);--pico-form-element-background-color:rgb(251, 251.5, 252.25);--pico-form-element-selected-background-color:#dfe3eb;--pico-form-element-border-color:#cfd5e2;--pico-form-element-color:#23262c;--pico-form-element-placeholder-color:var(--pico-muted-color);--pico-form-element-active-background-color:#fff;--pico-form-element-active-border-color:var(--pico-primary-border);--pico-form-element-focus-color:var(--pico-primary-border);--pico-form-element-disabled-opacity:0.5;--pico-form-element-invalid-border-color:rgb(183.5, 105.5, 106.5);--pico-form-element-invalid-active-border-color:rgb(200.25, 79.25, 72.25);--pico-form-element-invalid-focus-color:var(--pico-form-element-invalid-active-border-color);--pico-form-element-valid-border-color:rgb(76, 154.5, 137.5);--pico-form-element-valid-active-border-color:rgb(39, 152.75, 118.75);--pico-form-element-valid-focus-color:var(--pico-form-element-valid-active-border-color);--pico-switch-background-color:#bfc7d9;--pico-switch-checked-background-color:var(--pico-primary-background);--pico-switch-color:#fff;--pico-switch-thumb-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-range-border-color:#dfe3eb;--pico-range-active-border-color:#bfc7d9;--pico-range-thumb-border-color:var(--pico-background-color);--pico-range-thumb-color:var(--pico-secondary-background);--pico-range-thumb-active-color:var(--pico-primary-background);--pico-accordion-border-color:var(--pico-muted-border-color);--pico-accordion-active-summary-color:var(--pico-primary-hover);--pico-accordion-close-summary-color:var(--pico-color);--pico-accordion-open-summary-color:var(--pico-muted-color);--pico-card-background-color:var(--pico-background-color);--pico-card-border-color:var(--pico-muted-border-color);--pico-card-box-shadow:var(--pico-box-shadow);--pico-card-sectioning-background-color:rgb(251, 251.5, 252.25);--pico-dropdown-background-color:#fff;--pico-dropdown-border-color:#eff1f4;--pico-dropdown-box-shadow:var(--pico-box-shadow);--pico-dropdown-color:var(--pico-color);--pico-dropdown-hover-background-color:#eff1f4;--pico-loading-spinner-opacity:0.5;--pico-modal-overlay-background-color:rgba(232, 234, 237, 0.75);--pico-progress-background-color:#dfe3eb;--pico-progress-color:var(--pico-primary-background);--pico-tooltip-background-color:var(--pico-contrast-background);--pico-tooltip-color:var(--pico-contrast-inverse);--pico-icon-valid:url("+z+");--pico-icon-invalid:url("+D+")}:root:not([data-theme=dark]) input[type=button],:root:not([data-theme=dark]) input[type=checkbox],:root:not([data-theme=dark]) input[type=file],:root:not([data-theme=dark]) input[type=radio],:root:not([data-theme=dark]) input[type=reset],:root:not([data-theme=dark]) input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme=dark])) input[type=button],:host(:not([data-theme=dark])) input[type=checkbox],:host(:not([data-theme=dark])) input[type=file],:host(:not([data-theme=dark])) input[type=radio],:host(:not([data-theme=dark])) input[type=reset],:host(:not([data-theme=dark])) input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}[data-theme=light] input[type=button],[data-theme=light] input[type=checkbox],[data-theme=light] input[type=file],[data-theme=light] input[type=radio],[data-theme=light] input[type=reset],[data-theme=light] input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme=dark])) input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]),:root:not([data-theme=dark]) input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]),[data-theme=light] input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]){--pico-form-element-focus-color:var(--pico-primary-focus)}@media only screen and (prefers-color-scheme:dark){:host(:not([data-theme])),:root:not([data-theme]){--csstools-color-scheme--light: ;color-scheme:dark;--pico-background-color:rgb(19, 22.5, 30.5);--pico-color:#c2c7d0;--pico-text-selection-color:rgba(1, 170, 255, 0.1875);--pico-muted-color:#7b8495;--pico-muted-border-color:#202632;--pico-primary:#01aaff;--pico-primary-background:#0172ad;--pico-primary-border:var(--pico-primary-background);--pico-primary-underline:rgba(1, 170, 255, 0.5);--pico-primary-hover:#79c0ff;--pico-primary-hover-background:#017fc0;--pico-primary-hover-border:var(--pico-primary-hover-background);--pico-primary-hover-underline:var(--pico-primary-hover);--pico-primary-focus:rgba(1, 170, 255, 0.375);--pico-primary-inverse:#fff;--pico-secondary:#969eaf;--pico-secondary-background:#525f7a;--pico-secondary-border:var(--pico-secondary-background);--pico-secondary-underline:rgba(150, 158, 175, 0.5);--pico-secondary-hover:#b3b9c5;--pico-secondary-hover-background:#5d6b89;--pico-secondary-hover-border:var(--pico-secondary-hover-background);--pico-secondary-hover-underline:var(--pico-secondary-hover);--pico-secondary-focus:rgba(144, 158, 190, 0.25);--pico-secondary-inverse:#fff;--pico-contrast:#dfe3eb;--pico-contrast-background:#eff1f4;--pico-contrast-border:var(--pico-contrast-background);--pico-contrast-underline:rgba(223, 227, 235, 0.5);--pico-contrast-hover:#fff;--pico-contrast-hover-background:#fff;--pico-contrast-hover-border:var(--pico-contrast-hover-background);--pico-contrast-hover-underline:var(--pico-contrast-hover);--pico-contrast-focus:rgba(207, 213, 226, 0.25);--pico-contrast-inverse:#000;--pico-box-shadow:0.0145rem 0.029rem 0.174rem rgba(7, 8.5, 12, 0.01698), 0.0335rem 0.067rem 0.402rem rgba(7, 8.5, 12, 0.024), 0.0625rem 0.125rem 0.75rem rgba(7, 8.5, 12, 0.03), 0.1125rem 0.225rem 1.35rem rgba(7, 8.5, 12, 0.036), 0.2085rem 0.417rem 2.502rem rgba(7, 8.5, 12, 0.04302), 0.5rem 1rem 6rem rgba(7, 8.5, 12, 0.06), 0 0 0 0.0625rem rgba(7, 8.5, 12, 0.015);--pico-h1-color:#f0f1f3;--pico-h2-color:#e0e3e7;--pico-h3-color:#c2c7d0;--pico-h4-color:#b3b9c5;--pico-h5-color:#a4acba;--pico-h6-color:#8891a4;--pico-mark-background-color:#014063;--pico-mark-color:#fff;--pico-ins-color:#62af9a;--pico-del-color:rgb(205.5, 126, 123);--pico-blockquote-border-color:var(--pico-muted-border-color);--pico-blockquote-footer-color:var(--pico-muted-color);--pico-button-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-button-hover-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-table-border-color:var(--pico-muted-border-color);--pico-table-row-stripped-background-color:rgba(111, 120, 135, 0.0375);--pico-code-background-color:rgb(26, 30.5, 40.25);--pico-code-color:#8891a4;--pico-code-kbd-background-color:var(--pico-color);--pico-code-kbd-color:var(--pico-background-color);--pico-form-element-background-color:rgb(28, 33, 43.5);--pico-form-element-selected-background-color:#2a3140;--pico-form-element-border-color:#2a3140;--pico-form-element-color:#e0e3e7;--pico-form-element-placeholder-color:#8891a4;--pico-form-element-active-background-color:rgb(26, 30.5, 40.25);--pico-form-element-active-border-color:var(--pico-primary-border);--pico-form-element-focus-color:var(--pico-primary-border);--pico-form-element-disabled-opacity:0.5;--pico-form-element-invalid-border-color:rgb(149.5, 74, 80);--pico-form-element-invalid-active-border-color:rgb(183.25, 63.5, 59);--pico-form-element-invalid-focus-color:var(--pico-form-element-invalid-active-border-color);--pico-form-element-valid-border-color:#2a7b6f;--pico-form-element-valid-active-border-color:rgb(22, 137, 105.5);--pico-form-element-valid-focus-color:var(--pico-form-element-valid-active-border-color);--pico-switch-background-color:#333c4e;--pico-switch-checked-background-color:var(--pico-primary-background);--pico-switch-color:#fff;--pico-switch-thumb-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-range-border-color:#202632;--pico-range-active-border-color:#2a3140;--pico-range-thumb-border-color:var(--pico-background-color);--pico-range-thumb-color:var(--pico-secondary-background);--pico-range-thumb-active-color:var(--pico-primary-background);--pico-accordion-border-color:var(--pico-muted-border-color);--pico-accordion-active-summary-color:var(--pico-primary-hover);--pico-accordion-close-summary-color:var(--pico-color);--pico-accordion-open-summary-color:var(--pico-muted-color);--pico-card-background-color:#181c25;--pico-card-border-color:var(--pico-card-background-color);--pico-card-box-shadow:var(--pico-box-shadow);--pico-card-sectioning-background-color:rgb(26, 30.5, 40.25);--pico-dropdown-background-color:#181c25;--pico-dropdown-border-color:#202632;--pico-dropdown-box-shadow:var(--pico-box-shadow);--pico-dropdown-color:var(--pico-color);--pico-dropdown-hover-background-color:#202632;--pico-loading-spinner-opacity:0.5;--pico-modal-overlay-background-color:rgba(7.5, 8.5, 10, 0.75);--pico-progress-background-color:#202632;--pico-progress-color:var(--pico-primary-background);--pico-tooltip-background-color:var(--pico-contrast-background);--pico-tooltip-color:var(--pico-contrast-inverse);--pico-icon-valid:url("+j+");--pico-icon-invalid:url("+O+")}:root:not([data-theme]) input[type=button],:root:not([data-theme]) input[type=checkbox],:root:not([data-theme]) input[type=file],:root:not([data-theme]) input[type=radio],:root:not([data-theme]) input[type=reset],:root:not([data-theme]) input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme])) input[type=button],:host(:not([data-theme])) input[type=checkbox],:host(:not([data-theme])) input[type=file],:host(:not([data-theme])) input[type=radio],:host(:not([data-theme])) input[type=reset],:host(:not([data-theme])) input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme])) input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]),:root:not([data-theme]) input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]){--pico-form-element-focus-color:var(--pico-primary-focus)}:host(:not([data-theme])) details summary[role=button].contrast:not(.outline)::after,:root:not([data-theme]) details summary[role=button].contrast:not(.outline)::after{-webkit-filter:brightness(0);filter:brightness(0)}:root:not([data-theme]) .contrast[aria-busy=true][role=button]:not(input):not(select):not(textarea):not(.outline)::before,:root:not([data-theme]) .contrast[aria-busy=true][type=button]:not(input):not(select):not(textarea):not(.outline)::before,:root:not([data-theme]) .contrast[aria-busy=true][type=reset]:not(input):not(select):not(textarea):not(.outline)::before,:root:not([data-theme]) .contrast[aria-busy=true][type=submit]:not(input):not(select):not(textarea):not(.outline)::before,:root:not([data-theme]) button.contrast[aria-busy=true]:not(input):not(select):not(textarea):not(.does-not-exist):not(.outline)::before{-webkit-filter:brightness(0);filter:brightness(0)}:host(:not([data-theme])) .contrast[aria-busy=true][role=button]:not(input):not(select):not(textarea):not(.outline)::before,:host(:not([data-theme])) .contrast[aria-busy=true][type=button]:not(input):not(select):not(textarea):not(.outline)::before,:host(:not([data-theme])) .contrast[aria-busy=true][type=reset]:not(input):not(select):not(textarea):not(.outline)::before,:host(:not([data-theme])) .contrast[aria-busy=true][type=submit]:not(input):not(select):not(textarea):not(.outline)::before,:host(:not([data-theme])) button.contrast[aria-busy=true]:not(input):not(select):not(textarea):not(.does-not-exist):not(.outline)::before{-webkit-filter:brightness(0);filter:brightness(0)}:host(:not([data-theme])) [aria-busy=true]:not(input):not(select):not(textarea).contrast:is(button,[type=submit],[type=button],[type=reset],[role=button]):not(.outline)::before,:root:not([data-theme]) [aria-busy=true]:not(input):not(select):not(textarea).contrast:is(button,[type=submit],[type=button],[type=reset],[role=button]):not(.outline)::before{-webkit-filter:brightness(0);filter:brightness(0)}}[data-theme=dark]{--csstools-color-scheme--light: ;color-scheme:dark;--pico-background-color:rgb(19, 22.5, 30.5);--pico-color:#c2c7d0;--pico-text-selection-color:rgba(1, 170, 255, 0.1875);--pico-muted-color:#7b8495;--pico-muted-border-color:#202632;--pico-primary:#01aaff;--pico-primary-background:#0172ad;--pico-primary-border:var(--pico-primary-background);--pico-primary-underline:rgba(1, 170, 255, 0.5);--pico-primary-hover:#79c0ff;--pico-primary-hover-background:#017fc0;--pico-primary-hover-border:var(--pico-primary-hover-background);--pico-primary-hover-underline:var(--pico-primary-hover);--pico-primary-focus:rgba(1, 170, 255, 0.375);--pico-primary-inverse:#fff;--pico-secondary:#969eaf;--pico-secondary-background:#525f7a;--pico-secondary-border:var(--pico-secondary-background);--pico-secondary-underline:rgba(150, 158, 175, 0.5);--pico-secondary-hover:#b3b9c5;--pico-secondary-hover-background:#5d6b89;--pico-secondary-hover-border:var(--pico-secondary-hover-background);--pico-secondary-hover-underline:var(--pico-secondary-hover);--pico-secondary-focus:rgba(144, 158, 190, 0.25);--pico-secondary-inverse:#fff;--pico-contrast:#dfe3eb;--pico-contrast-background:#eff1f4;--pico-contrast-border:var(--pico-contrast-background);--pico-contrast-underline:rgba(223, 227, 235, 0.5);--pico-contrast-hover:#fff;--pico-contrast-hover-background:#fff;--pico-contrast-hover-border:var(--pico-contrast-hover-background);--pico-contrast-hover-underline:var(--pico-contrast-hover);--pico-contrast-focus:rgba(207, 213, 226, 0.25);--pico-contrast-inverse:#000;--pico-box-shadow:0.0145rem 0.029rem 0.174rem rgba(7, 8.5, 12, 0.01698), 0.0335rem 0.067rem 0.402rem rgba(7, 8.5, 12, 0.024), 0.0625rem 0.125rem 0.75rem rgba(7, 8.5, 12, 0.03), 0.1125rem 0.225rem 1.35rem rgba(7, 8.5, 12, 0.036), 0.2085rem 0.417rem 2.502rem rgba(7, 8.5, 12, 0.04302), 0.5rem 1rem 6rem rgba(7, 8.5, 12, 0.06), 0 0 0 0.0625rem rgba(7, 8.5, 12, 0.015);--pico-h1-color:#f0f1f3;--pico-h2-color:#e0e3e7;--pico-h3-color:#c2c7d0;--pico-h4-color:#b3b9c5;--pico-h5-color:#a4acba;--pico-h6-color:#8891a4;--pico-mark-background-color:#014063;--pico-mark-color:#fff;--pico-ins-color:#62af9a;--pico-del-color:rgb(205.5, 126, 123);--pico-blockquote-border-color:var(--pico-muted-border-color);--pico-blockquote-footer-color:var(--pico-muted-color);--pico-button-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-button-hover-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-table-border-color:var(--pico-muted-border-color);--pico-table-row-stripped-background-color:rgba(111, 120, 135, 0.0375);--pico-code-background-color:rgb(26, 30.5, 40.25);--pico-code-color:#8891a4;--pico-code-kbd-background-color:var(--pico-color);--pico-code-kbd-color:var(--pico-background-color);--pico-form-element-background-color:rgb(28, 33, 43.5);--pico-form-element-selected-background-color:#2a3140;--pico-form-element-border-color:#2a3140;--pico-form-element-color:#e0e3e7;--pico-form-element-placeholder-color:#8891a4;--pico-form-element-active-background-color:rgb(26, 30.5, 40.25);--pico-form-element-active-border-color:var(--pico-primary-border);--pico-form-element-focus-color:var(--pico-primary-border);--pico-form-element-disabled-opacity:0.5;--pico-form-element-invalid-border-color:rgb(149.5, 74, 80);--pico-form-element-invalid-active-border-color:rgb(183.25, 63.5, 59);--pico-form-element-invalid-focus-color:var(--pico-form-element-invalid-active-border-color);--pico-form-element-valid-border-color:#2a7b6f;--pico-form-element-valid-active-border-color:rgb(22, 137, 105.5);--pico-form-element-valid-focus-color:var(--pico-form-element-valid-active-border-color);--pico-switch-background-color:#333c4e;--pico-switch-checked-background-color:var(--pico-primary-background);--pico-switch-color:#fff;--pico-switch-thumb-box-shadow:0 0 0 rgba(0, 0, 0, 0);--pico-range-border-color:#202632;--pico-range-active-border-color:#2a3140;--pico-range-thumb-border-color:var(--pico-background-color);--pico-range-thumb-color:var(--pico-secondary-background);--pico-range-thumb-active-color:var(--pico-primary-background);--pico-accordion-border-color:var(--pico-muted-border-color);--pico-accordion-active-summary-color:var(--pico-primary-hover);--pico-accordion-close-summary-color:var(--pico-color);--pico-accordion-open-summary-color:var(--pico-muted-color);--pico-card-background-color:#181c25;--pico-card-border-color:var(--pico-card-background-color);--pico-card-box-shadow:var(--pico-box-shadow);--pico-card-sectioning-background-color:rgb(26, 30.5, 40.25);--pico-dropdown-background-color:#181c25;--pico-dropdown-border-color:#202632;--pico-dropdown-box-shadow:var(--pico-box-shadow);--pico-dropdown-color:var(--pico-color);--pico-dropdown-hover-background-color:#202632;--pico-loading-spinner-opacity:0.5;--pico-modal-overlay-background-color:rgba(7.5, 8.5, 10, 0.75);--pico-progress-background-color:#202632;--pico-progress-color:var(--pico-primary-background);--pico-tooltip-background-color:var(--pico-contrast-background);--pico-tooltip-color:var(--pico-contrast-inverse);--pico-icon-valid:url("+j+");--pico-icon-invalid:url("+O+')}[data-theme=dark] input[type=button],[data-theme=dark] input[type=checkbox],[data-theme=dark] input[type=file],[data-theme=dark] input[type=radio],[data-theme=dark] input[type=reset],[data-theme=dark] input[type=submit]{--pico-form-element-focus-color:var(--pico-primary-focus)}[data-theme=dark] input:is([type=submit],[type=button],[type=reset],[type=checkbox],[type=radio],[type=file]){--pico-form-element-focus-color:var(--pico-primary-focus)}[data-theme=dark] .contrast[aria-busy=true][role=button]:not(input):not(select):not(textarea):not(.outline)::before,[data-theme=dark] .contrast[aria-busy=true][type=button]:not(input):not(select):not(textarea):not(.outline)::before,[data-theme=dark] .contrast[aria-busy=true][type=reset]:not(input):not(select):not(textarea):not(.outline)::before,[data-theme=dark] .contrast[aria-busy=true][type=submit]:not(input):not(select):not(textarea):not(.outline)::before,[data-theme=dark] button.contrast[aria-busy=true]:not(input):not(select):not(textarea):not(.does-not-exist):not(.outline)::before,[data-theme=dark] details summary[role=button].contrast:not(.outline)::after{-webkit-filter:brightness(0);filter:brightness(0)}[data-theme=dark] [aria-busy=true]:not(input):not(select):not(textarea).contrast:is(button,[type=submit],[type=button],[type=reset],[role=button]):not(.outline)::before{-webkit-filter:brightness(0);filter:brightness(0)}[type=checkbox],[type=radio],[type=range],progress{accent-color:var(--pico-primary)}*,::after,::before{-webkit-box-sizing:border-box;box-sizing:border-box;background-repeat:no-repeat}::after,::before{text-decoration:inherit;vertical-align:inherit}:where(:host),:where(:root){-webkit-tap-highlight-color:transparent;-webkit-text-size-adjust:100%;-moz-text-size-adjust:100%;-ms-text-size-adjust:100%;text-size-adjust:100%;background-color:var(--pico-background-color);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);font-size:95%;font-size:var(--pico-font-size);line-height:1.5;line-height:var(--pico-line-height);font-family:system-ui,-apple-system,Segoe UI,Roboto,Ubuntu,Cantarell,Noto Sans,sans-serif,"Segoe UI",Roboto,Oxygen,Ubuntu,Cantarell,Helvetica,Arial,"Helvetica Neue",sans-serif,"Apple Color Emoji","Segoe UI Emoji","Segoe UI Symbol","Noto Color Emoji";font-family:var(--pico-font-family);text-underline-offset:.1rem;text-underline-offset:var(--pico-text-underline-offset);text-rendering:optimizeLegibility;word-wrap:break-word;overflow-wrap:break-word;-moz-tab-size:4;-o-tab-size:4;tab-size:4}body{width:100%;margin:0}main{display:block}body>footer,body>header,body>main{padding-top:1rem;padding-bottom:1rem;padding-top:var(--pico-block-spacing-vertical);padding-bottom:var(--pico-block-spacing-vertical)}section{margin-bottom:1rem;margin-bottom:var(--pico-block-spacing-vertical)}.container,.container-fluid{width:100%;margin-right:auto;margin-left:auto;padding-right:1rem;padding-right:var(--pico-spacing);padding-left:1rem;padding-left:var(--pico-spacing)}@media (min-width:576px){.container{max-width:510px;padding-right:0;padding-left:0}}@media (min-width:768px){.container{max-width:700px}}@media (min-width:1024px){.container{max-width:950px}}@media (min-width:1280px){.container{max-width:1200px}}@media (min-width:1536px){.container{max-width:1450px}}.grid{grid-column-gap:1rem;grid-column-gap:var(--pico-grid-column-gap);grid-row-gap:1rem;grid-row-gap:var(--pico-grid-row-gap);display:grid;grid-template-columns:1fr}@media (min-width:768px){.grid{grid-template-columns:repeat(auto-fit,minmax(0,1fr))}}.grid>*{min-width:0}.overflow-auto{overflow:auto}b,strong{font-weight:bolder}sub,sup{position:relative;font-size:.75em;line-height:0;vertical-align:baseline}sub{bottom:-.25em}sup{top:-.5em}address,dl,ol,table,ul{margin-bottom:1rem;margin-bottom:var(--pico-typography-spacing-vertical);font-style:normal}address,blockquote,dl,h1,h2,h3,h4,h5,h6,ol,p,table,ul{margin-top:0;color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight)}blockquote,p,pre{font-style:normal}pre{margin-top:0}h1,h2,h3,h4,h5,h6{margin-bottom:1rem;margin-bottom:var(--pico-typography-spacing-vertical);font-size:95%;font-size:var(--pico-font-size);line-height:1.5;line-height:var(--pico-line-height);font-family:system-ui,-apple-system,Segoe UI,Roboto,Ubuntu,Cantarell,Noto Sans,sans-serif,"Segoe UI",Roboto,Oxygen,Ubuntu,Cantarell,Helvetica,Arial,"Helvetica Neue",sans-serif,"Apple Color Emoji","Segoe UI Emoji","Segoe UI Symbol","Noto Color Emoji";font-family:var(--pico-font-family)}h1{--pico-color:var(--pico-h1-color)}h2{--pico-color:var(--pico-h2-color)}h3{--pico-color:var(--pico-h3-color)}h4{--pico-color:var(--pico-h4-color)}h5{--pico-color:var(--pico-h5-color)}h6{--pico-color:var(--pico-h6-color)}:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h1,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h2,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h3,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h4,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h5,:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~h6{margin-top:var(--pico-typography-spacing-top)}:where(article,address,blockquote,dl,figure,form,ol,p,pre,table,ul)~:is(h1,h2,h3,h4,h5,h6){margin-top:var(--pico-typography-spacing-top)}hgroup,p{margin-bottom:1rem;margin-bottom:var(--pico-typography-spacing-vertical)}hgroup>*{margin-top:0;margin-bottom:0}hgroup>:not(:first-child):last-child{--pico-color:var(--pico-muted-color);--pico-font-weight:unset;font-size:1rem}:where(ol,ul) li{margin-bottom:calc(1rem*.25);margin-bottom:calc(var(--pico-typography-spacing-vertical)*.25)}:where(dl,ol,ul) :where(dl,ol,ul){margin:0;margin-top:calc(1rem*.25);margin-top:calc(var(--pico-typography-spacing-vertical)*.25)}ul li{list-style:square}mark{padding:.125rem .25rem;background-color:var(--pico-mark-background-color);color:var(--pico-mark-color);vertical-align:baseline}blockquote{display:block;margin:1rem 0;margin:var(--pico-typography-spacing-vertical)0;padding:1rem;padding:var(--pico-spacing);border-right:none;border-left:.25rem solid var(--pico-blockquote-border-color);-webkit-border-start:.25rem solid var(--pico-blockquote-border-color);border-inline-start:.25rem solid var(--pico-blockquote-border-color);-webkit-border-end:none;border-inline-end:none}blockquote footer{margin-top:calc(1rem*.5);margin-top:calc(var(--pico-typography-spacing-vertical)*.5);color:var(--pico-blockquote-footer-color)}abbr[title],ins{-webkit-text-decoration:none;text-decoration:none}abbr[title]{border-bottom:1px dotted;cursor:help}ins{color:var(--pico-ins-color)}del{color:var(--pico-del-color)}::-moz-selection{background-color:var(--pico-text-selection-color)}::selection{background-color:var(--pico-text-selection-color)}:where(a:not([role=button])),[role=link]{--pico-color:var(--pico-primary);--pico-background-color:transparent;--pico-underline:var(--pico-primary-underline);outline:0;background-color:transparent;background-color:var(--pico-background-color);color:var(--pico-color);-webkit-text-decoration:var(--pico-text-decoration);text-decoration:var(--pico-text-decoration);text-decoration-color:var(--pico-underline);text-underline-offset:.125em;-webkit-transition:background-color .2s ease-in-out,color .2s ease-in-out,-webkit-text-decoration .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,color .2s ease-in-out,text-decoration .2s ease-in-out,box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),color var(--pico-transition),-webkit-text-decoration var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),color var(--pico-transition),text-decoration var(--pico-transition),box-shadow var(--pico-transition);transition:background-color .2s ease-in-out,color .2s ease-in-out,text-decoration .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-text-decoration .2s ease-in-out;transition:background-color var(--pico-transition),color var(--pico-transition),text-decoration var(--pico-transition),box-shadow var(--pico-transition),-webkit-text-decoration var(--pico-transition)}:where(a:not([role=button])):active:not(.does-not-exist),:where(a:not([role=button])):hover:not(.does-not-exist),[aria-current]:where(a:not([role=button])):not([aria-current=false]){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}:where(a:not([role=button])):focus:not(.does-not-exist){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}[role=link]:active:not(.does-not-exist){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}[role=link]:focus:not(.does-not-exist),[role=link]:hover:not(.does-not-exist),[role=link][aria-current]:not([aria-current=false]){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}:where(a:not([role=button])):is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[role=link]:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-primary-hover);--pico-underline:var(--pico-primary-hover-underline);--pico-text-decoration:underline}:where(a:not([role=button])):focus-visible,[role=link]:focus-visible{-webkit-box-shadow:0 0 0 .125rem var(--pico-primary-focus);box-shadow:0 0 0 .125rem var(--pico-primary-focus);-webkit-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-primary-focus);box-shadow:0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}:where(a:not([role=button])).secondary,[role=link].secondary{--pico-color:var(--pico-secondary);--pico-underline:var(--pico-secondary-underline)}.secondary:where(a:not([role=button])):active:not(.does-not-exist),.secondary:where(a:not([role=button])):hover:not(.does-not-exist),.secondary[aria-current]:where(a:not([role=button])):not([aria-current=false]){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}.secondary:where(a:not([role=button])):focus:not(.does-not-exist){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}.secondary[role=link]:active:not(.does-not-exist){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}.secondary[role=link]:focus:not(.does-not-exist),.secondary[role=link]:hover:not(.does-not-exist),.secondary[role=link][aria-current]:not([aria-current=false]){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}:where(a:not([role=button])).secondary:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[role=link].secondary:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-secondary-hover);--pico-underline:var(--pico-secondary-hover-underline)}:where(a:not([role=button])).contrast,[role=link].contrast{--pico-color:var(--pico-contrast);--pico-underline:var(--pico-contrast-underline)}.contrast:where(a:not([role=button])):active:not(.does-not-exist),.contrast:where(a:not([role=button])):hover:not(.does-not-exist),.contrast[aria-current]:where(a:not([role=button])):not([aria-current=false]){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}.contrast:where(a:not([role=button])):focus:not(.does-not-exist){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}.contrast[role=link]:active:not(.does-not-exist){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}.contrast[role=link]:focus:not(.does-not-exist),.contrast[role=link]:hover:not(.does-not-exist),.contrast[role=link][aria-current]:not([aria-current=false]){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}:where(a:not([role=button])).contrast:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[role=link].contrast:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-contrast-hover);--pico-underline:var(--pico-contrast-hover-underline)}a[role=button],audio,canvas,video{display:inline-block}button{margin:0;overflow:visible;font-family:inherit;text-transform:none}[type=button],[type=reset],[type=submit],button{-webkit-appearance:button}[type=file]::-webkit-file-upload-button{--pico-background-color:var(--pico-primary-background);--pico-border-color:var(--pico-primary-border);--pico-color:var(--pico-primary-inverse);--pico-box-shadow:var(--pico-button-box-shadow, 0 0 0 rgba(0, 0, 0, 0));padding:.75rem 1rem;padding:var(--pico-form-element-spacing-vertical) var(--pico-form-element-spacing-horizontal);border:.0625rem solid #0172ad;border:var(--pico-border-width) solid var(--pico-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);outline:0;background-color:#0172ad;background-color:var(--pico-background-color);-webkit-box-shadow:0 0 0 transparent;box-shadow:0 0 0 transparent;-webkit-box-shadow:var(--pico-box-shadow);box-shadow:var(--pico-box-shadow);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);font-size:1rem;line-height:1.5;line-height:var(--pico-line-height);text-align:center;-webkit-text-decoration:none;text-decoration:none;-webkit-user-select:none;-moz-user-select:none;user-select:none;-webkit-transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}[role=button],[type=button],[type=file]::file-selector-button,[type=reset],[type=submit],button{--pico-background-color:var(--pico-primary-background);--pico-border-color:var(--pico-primary-border);--pico-color:var(--pico-primary-inverse);--pico-box-shadow:var(--pico-button-box-shadow, 0 0 0 rgba(0, 0, 0, 0));padding:.75rem 1rem;padding:var(--pico-form-element-spacing-vertical) var(--pico-form-element-spacing-horizontal);border:.0625rem solid #0172ad;border:var(--pico-border-width) solid var(--pico-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);outline:0;background-color:#0172ad;background-color:var(--pico-background-color);-webkit-box-shadow:0 0 0 transparent;box-shadow:0 0 0 transparent;-webkit-box-shadow:var(--pico-box-shadow);box-shadow:var(--pico-box-shadow);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);font-size:1rem;line-height:1.5;line-height:var(--pico-line-height);text-align:center;-webkit-text-decoration:none;text-decoration:none;cursor:pointer;-webkit-user-select:none;-moz-user-select:none;-ms-user-select:none;user-select:none;-webkit-transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}[role=button]:active,[type=button]:active,[type=reset]:active,[type=submit]:active,button:active{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::file-selector-button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button:hover{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::file-selector-button:hover{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button:active{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::file-selector-button:active{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button:focus{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::file-selector-button:focus{--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[role=button]:focus,[role=button]:hover,[role=button][aria-current]:not([aria-current=false]),[type=button]:focus,[type=button]:hover,[type=button][aria-current]:not([aria-current=false]),[type=reset]:focus,[type=reset]:hover,[type=reset][aria-current]:not([aria-current=false]),[type=submit]:focus,[type=submit]:hover,[type=submit][aria-current]:not([aria-current=false]),button:focus,button:hover,button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button:is(:hover,:active,:focus),[type=file]::-webkit-file-upload-button:is([aria-current]:not([aria-current=false])){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[role=button]:is(:hover,:active,:focus),[role=button]:is([aria-current]:not([aria-current=false])),[type=button]:is(:hover,:active,:focus),[type=button]:is([aria-current]:not([aria-current=false])),[type=file]::file-selector-button:is(:hover,:active,:focus),[type=file]::file-selector-button:is([aria-current]:not([aria-current=false])),[type=reset]:is(:hover,:active,:focus),[type=reset]:is([aria-current]:not([aria-current=false])),[type=submit]:is(:hover,:active,:focus),[type=submit]:is([aria-current]:not([aria-current=false])),button:is(:hover,:active,:focus),button:is([aria-current]:not([aria-current=false])){--pico-background-color:var(--pico-primary-hover-background);--pico-border-color:var(--pico-primary-hover-border);--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0));--pico-color:var(--pico-primary-inverse)}[type=file]::-webkit-file-upload-button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[type=file]::file-selector-button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[type=file]::-webkit-file-upload-button:focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[role=button]:focus,[role=button][aria-current]:not([aria-current=false]):focus,[type=button]:focus,[type=button][aria-current]:not([aria-current=false]):focus,[type=file]::file-selector-button:focus,[type=reset]:focus,[type=reset][aria-current]:not([aria-current=false]):focus,[type=submit]:focus,[type=submit][aria-current]:not([aria-current=false]):focus,button:focus,button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[type=file]::-webkit-file-upload-button:focus,[type=file]::-webkit-file-upload-button:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[role=button]:focus,[role=button]:is([aria-current]:not([aria-current=false])):focus,[type=button]:focus,[type=button]:is([aria-current]:not([aria-current=false])):focus,[type=file]::file-selector-button:focus,[type=file]::file-selector-button:is([aria-current]:not([aria-current=false])):focus,[type=reset]:focus,[type=reset]:is([aria-current]:not([aria-current=false])):focus,[type=submit]:focus,[type=submit]:is([aria-current]:not([aria-current=false])):focus,button:focus,button:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}[type=button],[type=reset],[type=submit]{margin-bottom:1rem;margin-bottom:var(--pico-spacing)}.secondary[role=button],.secondary[type=button],.secondary[type=submit],[type=file]::file-selector-button,[type=reset],button.secondary:not(.does-not-exist){--pico-background-color:var(--pico-secondary-background);--pico-border-color:var(--pico-secondary-border);--pico-color:var(--pico-secondary-inverse);cursor:pointer}[type=file]::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-background);--pico-border-color:var(--pico-secondary-border);--pico-color:var(--pico-secondary-inverse);cursor:pointer}:is(button,[type=submit],[type=button],[role=button]).secondary,[type=file]::file-selector-button,[type=reset]{--pico-background-color:var(--pico-secondary-background);--pico-border-color:var(--pico-secondary-border);--pico-color:var(--pico-secondary-inverse);cursor:pointer}.secondary[role=button]:active:not(.does-not-exist),.secondary[type=button]:active:not(.does-not-exist),.secondary[type=submit]:active:not(.does-not-exist),[type=reset]:active:not(.does-not-exist),button.secondary:not(.does-not-exist):active:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::file-selector-button[aria-current]:not([aria-current=false]){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button:hover:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::file-selector-button:hover:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button:active:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::file-selector-button:active:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button:focus:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::file-selector-button:focus:not(.does-not-exist){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}.secondary[role=button]:focus:not(.does-not-exist),.secondary[role=button]:hover:not(.does-not-exist),.secondary[role=button][aria-current]:not([aria-current=false]),.secondary[type=button]:focus:not(.does-not-exist),.secondary[type=button]:hover:not(.does-not-exist),.secondary[type=button][aria-current]:not([aria-current=false]),.secondary[type=submit]:focus:not(.does-not-exist),.secondary[type=submit]:hover:not(.does-not-exist),.secondary[type=submit][aria-current]:not([aria-current=false]),[type=reset]:focus:not(.does-not-exist),[type=reset]:hover:not(.does-not-exist),[type=reset][aria-current]:not([aria-current=false]),button.secondary:not(.does-not-exist):focus:not(.does-not-exist),button.secondary:not(.does-not-exist):hover:not(.does-not-exist),button.secondary[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}:is(button,[type=submit],[type=button],[role=button]).secondary:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[type=file]::file-selector-button:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[type=reset]:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border);--pico-color:var(--pico-secondary-inverse)}[type=file]::-webkit-file-upload-button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=file]::file-selector-button[aria-current]:not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=file]::-webkit-file-upload-button:focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}.secondary[role=button]:focus,.secondary[role=button][aria-current]:not([aria-current=false]):focus,.secondary[type=button]:focus,.secondary[type=button][aria-current]:not([aria-current=false]):focus,.secondary[type=submit]:focus,.secondary[type=submit][aria-current]:not([aria-current=false]):focus,[type=file]::file-selector-button:focus,[type=reset]:focus,[type=reset][aria-current]:not([aria-current=false]):focus,button.secondary:not(.does-not-exist):focus,button.secondary[aria-current]:not(.does-not-exist):not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=file]::-webkit-file-upload-button:focus,[type=file]::-webkit-file-upload-button:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}:is(button,[type=submit],[type=button],[role=button]).secondary:focus,:is(button,[type=submit],[type=button],[role=button]).secondary:is([aria-current]:not([aria-current=false])):focus,[type=file]::file-selector-button:focus,[type=file]::file-selector-button:is([aria-current]:not([aria-current=false])):focus,[type=reset]:focus,[type=reset]:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}.contrast[role=button],.contrast[type=button],.contrast[type=submit],button.contrast:not(.does-not-exist){--pico-background-color:var(--pico-contrast-background);--pico-border-color:var(--pico-contrast-border);--pico-color:var(--pico-contrast-inverse)}:is(button,[type=submit],[type=button],[role=button]).contrast{--pico-background-color:var(--pico-contrast-background);--pico-border-color:var(--pico-contrast-border);--pico-color:var(--pico-contrast-inverse)}.contrast[role=button]:active:not(.does-not-exist),.contrast[type=button]:active:not(.does-not-exist),.contrast[type=submit]:active:not(.does-not-exist),button.contrast:not(.does-not-exist):active:not(.does-not-exist){--pico-background-color:var(--pico-contrast-hover-background);--pico-border-color:var(--pico-contrast-hover-border);--pico-color:var(--pico-contrast-inverse)}.contrast[role=button]:focus:not(.does-not-exist),.contrast[role=button]:hover:not(.does-not-exist),.contrast[role=button][aria-current]:not([aria-current=false]),.contrast[type=button]:focus:not(.does-not-exist),.contrast[type=button]:hover:not(.does-not-exist),.contrast[type=button][aria-current]:not([aria-current=false]),.contrast[type=submit]:focus:not(.does-not-exist),.contrast[type=submit]:hover:not(.does-not-exist),.contrast[type=submit][aria-current]:not([aria-current=false]),button.contrast:not(.does-not-exist):focus:not(.does-not-exist),button.contrast:not(.does-not-exist):hover:not(.does-not-exist),button.contrast[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-background-color:var(--pico-contrast-hover-background);--pico-border-color:var(--pico-contrast-hover-border);--pico-color:var(--pico-contrast-inverse)}:is(button,[type=submit],[type=button],[role=button]).contrast:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-background-color:var(--pico-contrast-hover-background);--pico-border-color:var(--pico-contrast-hover-border);--pico-color:var(--pico-contrast-inverse)}.contrast[role=button]:focus,.contrast[role=button][aria-current]:not([aria-current=false]):focus,.contrast[type=button]:focus,.contrast[type=button][aria-current]:not([aria-current=false]):focus,.contrast[type=submit]:focus,.contrast[type=submit][aria-current]:not([aria-current=false]):focus,button.contrast:not(.does-not-exist):focus,button.contrast[aria-current]:not(.does-not-exist):not([aria-current=false]):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-contrast-focus)}:is(button,[type=submit],[type=button],[role=button]).contrast:focus,:is(button,[type=submit],[type=button],[role=button]).contrast:is([aria-current]:not([aria-current=false])):focus{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-contrast-focus)}.outline[role=button],.outline[type=button],.outline[type=submit],[type=reset].outline,button.outline:not(.does-not-exist){--pico-background-color:transparent;--pico-color:var(--pico-primary);--pico-border-color:var(--pico-primary)}:is(button,[type=submit],[type=button],[role=button]).outline,[type=reset].outline{--pico-background-color:transparent;--pico-color:var(--pico-primary);--pico-border-color:var(--pico-primary)}.outline[role=button]:active:not(.does-not-exist),.outline[type=button]:active:not(.does-not-exist),.outline[type=reset]:active:not(.does-not-exist),.outline[type=submit]:active:not(.does-not-exist),button.outline:not(.does-not-exist):active:not(.does-not-exist){--pico-background-color:transparent;--pico-color:var(--pico-primary-hover);--pico-border-color:var(--pico-primary-hover)}.outline[role=button]:focus:not(.does-not-exist),.outline[role=button]:hover:not(.does-not-exist),.outline[role=button][aria-current]:not([aria-current=false]),.outline[type=button]:focus:not(.does-not-exist),.outline[type=button]:hover:not(.does-not-exist),.outline[type=button][aria-current]:not([aria-current=false]),.outline[type=reset]:focus:not(.does-not-exist),.outline[type=reset]:hover:not(.does-not-exist),.outline[type=reset][aria-current]:not([aria-current=false]),.outline[type=submit]:focus:not(.does-not-exist),.outline[type=submit]:hover:not(.does-not-exist),.outline[type=submit][aria-current]:not([aria-current=false]),button.outline:not(.does-not-exist):focus:not(.does-not-exist),button.outline:not(.does-not-exist):hover:not(.does-not-exist),button.outline[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-background-color:transparent;--pico-color:var(--pico-primary-hover);--pico-border-color:var(--pico-primary-hover)}:is(button,[type=submit],[type=button],[role=button]).outline:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[type=reset].outline:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-background-color:transparent;--pico-color:var(--pico-primary-hover);--pico-border-color:var(--pico-primary-hover)}.outline.secondary[role=button],.outline.secondary[type=button],.outline.secondary[type=submit],[type=reset].outline,button.outline.secondary:not(.does-not-exist){--pico-color:var(--pico-secondary);--pico-border-color:var(--pico-secondary)}:is(button,[type=submit],[type=button],[role=button]).outline.secondary,[type=reset].outline{--pico-color:var(--pico-secondary);--pico-border-color:var(--pico-secondary)}.outline.secondary[role=button]:active:not(.does-not-exist),.outline.secondary[type=button]:active:not(.does-not-exist),.outline.secondary[type=submit]:active:not(.does-not-exist),.outline[type=reset]:active:not(.does-not-exist),button.outline.secondary:not(.does-not-exist):active:not(.does-not-exist){--pico-color:var(--pico-secondary-hover);--pico-border-color:var(--pico-secondary-hover)}.outline.secondary[role=button]:focus:not(.does-not-exist),.outline.secondary[role=button]:hover:not(.does-not-exist),.outline.secondary[role=button][aria-current]:not([aria-current=false]),.outline.secondary[type=button]:focus:not(.does-not-exist),.outline.secondary[type=button]:hover:not(.does-not-exist),.outline.secondary[type=button][aria-current]:not([aria-current=false]),.outline.secondary[type=submit]:focus:not(.does-not-exist),.outline.secondary[type=submit]:hover:not(.does-not-exist),.outline.secondary[type=submit][aria-current]:not([aria-current=false]),.outline[type=reset]:focus:not(.does-not-exist),.outline[type=reset]:hover:not(.does-not-exist),.outline[type=reset][aria-current]:not([aria-current=false]),button.outline.secondary:not(.does-not-exist):focus:not(.does-not-exist),button.outline.secondary:not(.does-not-exist):hover:not(.does-not-exist),button.outline.secondary[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-color:var(--pico-secondary-hover);--pico-border-color:var(--pico-secondary-hover)}:is(button,[type=submit],[type=button],[role=button]).outline.secondary:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),[type=reset].outline:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-secondary-hover);--pico-border-color:var(--pico-secondary-hover)}.outline.contrast[role=button],.outline.contrast[type=button],.outline.contrast[type=submit],button.outline.contrast:not(.does-not-exist){--pico-color:var(--pico-contrast);--pico-border-color:var(--pico-contrast)}:is(button,[type=submit],[type=button],[role=button]).outline.contrast{--pico-color:var(--pico-contrast);--pico-border-color:var(--pico-contrast)}.outline.contrast[role=button]:active:not(.does-not-exist),.outline.contrast[type=button]:active:not(.does-not-exist),.outline.contrast[type=submit]:active:not(.does-not-exist),button.outline.contrast:not(.does-not-exist):active:not(.does-not-exist){--pico-color:var(--pico-contrast-hover);--pico-border-color:var(--pico-contrast-hover)}.outline.contrast[role=button]:focus:not(.does-not-exist),.outline.contrast[role=button]:hover:not(.does-not-exist),.outline.contrast[role=button][aria-current]:not([aria-current=false]),.outline.contrast[type=button]:focus:not(.does-not-exist),.outline.contrast[type=button]:hover:not(.does-not-exist),.outline.contrast[type=button][aria-current]:not([aria-current=false]),.outline.contrast[type=submit]:focus:not(.does-not-exist),.outline.contrast[type=submit]:hover:not(.does-not-exist),.outline.contrast[type=submit][aria-current]:not([aria-current=false]),button.outline.contrast:not(.does-not-exist):focus:not(.does-not-exist),button.outline.contrast:not(.does-not-exist):hover:not(.does-not-exist),button.outline.contrast[aria-current]:not(.does-not-exist):not([aria-current=false]){--pico-color:var(--pico-contrast-hover);--pico-border-color:var(--pico-contrast-hover)}:is(button,[type=submit],[type=button],[role=button]).outline.contrast:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){--pico-color:var(--pico-contrast-hover);--pico-border-color:var(--pico-contrast-hover)}:where(fieldset[disabled]) button:not(.does-not-exist){opacity:.5;pointer-events:none}:where(button,[type=submit],[type=reset],[type=button],[role=button])[disabled],:where(fieldset[disabled]) [role=button],:where(fieldset[disabled]) [type=button],:where(fieldset[disabled]) [type=reset],:where(fieldset[disabled]) [type=submit]{opacity:.5;pointer-events:none}:where(button,[type=submit],[type=reset],[type=button],[role=button])[disabled],:where(fieldset[disabled]) :is(button,[type=submit],[type=button],[type=reset],[role=button]){opacity:.5;pointer-events:none}:where(table){width:100%;border-collapse:collapse;border-spacing:0;text-indent:0}td,th{padding:calc(1rem/2) 1rem;padding:calc(var(--pico-spacing)/2) var(--pico-spacing);border-bottom:.0625rem solid var(--pico-table-border-color);border-bottom:var(--pico-border-width) solid var(--pico-table-border-color);background-color:var(--pico-background-color);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);text-align:left;text-align:start}tfoot td,tfoot th{border-top:.0625rem solid var(--pico-table-border-color);border-top:var(--pico-border-width) solid var(--pico-table-border-color);border-bottom:0}table.striped tbody tr:nth-child(odd) td,table.striped tbody tr:nth-child(odd) th{background-color:var(--pico-table-row-stripped-background-color)}:where(audio,canvas,iframe,img,svg,video){vertical-align:middle}audio:not([controls]){display:none;height:0}:where(iframe){border-style:none}img{max-width:100%;height:auto;border-style:none}:where(svg:not([fill])){fill:currentColor}svg:not(:host),svg:not(:root){overflow:hidden}code,kbd,pre,samp{font-size:.875em;font-family:system-ui,-apple-system,Segoe UI,Roboto,Ubuntu,Cantarell,Noto Sans,sans-serif,"Segoe UI",Roboto,Oxygen,Ubuntu,Cantarell,Helvetica,Arial,"Helvetica Neue",sans-serif,"Apple Color Emoji","Segoe UI Emoji","Segoe UI Symbol","Noto Color Emoji";font-family:var(--pico-font-family)}pre code,pre samp{font-size:inherit;font-family:inherit}pre{-ms-overflow-style:scrollbar;overflow:auto}code,kbd,pre,samp{border-radius:.25rem;border-radius:var(--pico-border-radius);background:var(--pico-code-background-color);color:var(--pico-code-color);font-weight:400;font-weight:var(--pico-font-weight);line-height:initial}kbd{background-color:var(--pico-code-kbd-background-color);color:var(--pico-code-kbd-color);vertical-align:baseline}code,kbd,samp{display:inline-block;padding:.375rem}figure,pre{display:block}pre{margin-bottom:1rem;margin-bottom:var(--pico-spacing);overflow-x:auto}input,optgroup,pre>code,pre>samp,select,textarea{line-height:1.5;line-height:var(--pico-line-height)}pre>code,pre>samp{display:block;padding:1rem;padding:var(--pico-spacing);background:0 0}figure{margin:0;padding:0}figure figcaption{padding:calc(1rem*.5)0;padding:calc(var(--pico-spacing)*.5)0;color:var(--pico-muted-color)}hr,legend{color:inherit}hr{height:0;margin:1rem 0;margin:var(--pico-typography-spacing-vertical)0;border:0;border-top:1px solid var(--pico-muted-border-color)}[hidden],template{display:none!important}input,optgroup,select,textarea{margin:0;font-size:1rem;font-family:inherit;letter-spacing:inherit}input{overflow:visible}select{text-transform:none}legend{max-width:100%;white-space:normal}textarea{overflow:auto}[type=checkbox],[type=radio],legend{padding:0}::-webkit-inner-spin-button,::-webkit-outer-spin-button{height:auto}[type=search]{-webkit-appearance:textfield;outline-offset:-2px}[type=search]::-webkit-search-decoration{-webkit-appearance:none}::-webkit-file-upload-button{-webkit-appearance:button;font:inherit}::-moz-focus-inner{padding:0;border-style:none}:-moz-focusring{outline:0}:-moz-ui-invalid{box-shadow:none}::-ms-expand{display:none}[type=file]{padding:0}[type=range]{padding:0;border-width:0}input:not([type=checkbox]):not([type=radio]):not([type=range]){height:calc(1rem*1.5 + .75rem*2 + .0625rem*2);height:calc(1rem*var(--pico-line-height) + var(--pico-form-element-spacing-vertical)*2 + var(--pico-border-width)*2)}fieldset{width:100%;margin:0;margin-bottom:1rem;margin-bottom:var(--pico-spacing);padding:0;border:0}fieldset legend,label{display:block;margin-bottom:calc(1rem*.375);margin-bottom:calc(var(--pico-spacing)*.375);color:var(--pico-color);font-weight:400;font-weight:var(--pico-form-label-font-weight, var(--pico-font-weight))}fieldset legend{margin-bottom:calc(1rem*.5);margin-bottom:calc(var(--pico-spacing)*.5)}button[type=submit],input:not([type=checkbox]):not([type=radio]),select,textarea{width:100%}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),select,textarea{-webkit-appearance:none;-moz-appearance:none;appearance:none;padding:.75rem 1rem;padding:var(--pico-form-element-spacing-vertical) var(--pico-form-element-spacing-horizontal)}input,select,textarea{--pico-background-color:var(--pico-form-element-background-color);--pico-border-color:var(--pico-form-element-border-color);--pico-color:var(--pico-form-element-color);--pico-box-shadow:none;border:.0625rem solid var(--pico-border-color);border:var(--pico-border-width) solid var(--pico-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);outline:0;background-color:var(--pico-background-color);-webkit-box-shadow:none;box-shadow:none;-webkit-box-shadow:var(--pico-box-shadow);box-shadow:var(--pico-box-shadow);color:var(--pico-color);font-weight:400;font-weight:var(--pico-font-weight);-webkit-transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}input:not([type=submit]):not([type=button]):not([type=reset]):not([type=checkbox]):not([type=radio]):not([readonly]):active{--pico-background-color:var(--pico-form-element-active-background-color)}:where(select,textarea):not([readonly]):active{--pico-background-color:var(--pico-form-element-active-background-color)}:where(select,textarea):not([readonly]):focus{--pico-background-color:var(--pico-form-element-active-background-color)}input:not([type=submit]):not([type=button]):not([type=reset]):not([type=checkbox]):not([type=radio]):not([readonly]):focus{--pico-background-color:var(--pico-form-element-active-background-color)}:where(select,textarea):not([readonly]):is(:active,:focus),input:not([type=submit]):not([type=button]):not([type=reset]):not([type=checkbox]):not([type=radio]):not([readonly]):is(:active,:focus){--pico-background-color:var(--pico-form-element-active-background-color)}input:not([type=submit]):not([type=button]):not([type=reset]):not([role=switch]):not([readonly]):active{--pico-border-color:var(--pico-form-element-active-border-color)}:where(select,textarea):not([readonly]):active{--pico-border-color:var(--pico-form-element-active-border-color)}:where(select,textarea):not([readonly]):focus{--pico-border-color:var(--pico-form-element-active-border-color)}input:not([type=submit]):not([type=button]):not([type=reset]):not([role=switch]):not([readonly]):focus{--pico-border-color:var(--pico-form-element-active-border-color)}:where(select,textarea):not([readonly]):is(:active,:focus),input:not([type=submit]):not([type=button]):not([type=reset]):not([role=switch]):not([readonly]):is(:active,:focus){--pico-border-color:var(--pico-form-element-active-border-color)}:where(select,textarea):not([readonly]):focus,input:not([type=submit]):not([type=button]):not([type=reset]):not([type=range]):not([type=file]):not([readonly]):focus{--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-focus-color)}:where(fieldset[disabled]) input:not([type=submit]):not([type=button]):not([type=reset]),:where(fieldset[disabled]) select:not(.does-not-exist):not(.does-not-exist):not(.does-not-exist),:where(fieldset[disabled]) textarea:not(.does-not-exist):not(.does-not-exist):not(.does-not-exist){opacity:var(--pico-form-element-disabled-opacity);pointer-events:none}input:not([type=submit]):not([type=button]):not([type=reset])[disabled],label[aria-disabled=true],select[disabled],textarea[disabled]{opacity:var(--pico-form-element-disabled-opacity);pointer-events:none}:where(fieldset[disabled]) :is(input:not([type=submit]):not([type=button]):not([type=reset]),select,textarea),input:not([type=submit]):not([type=button]):not([type=reset])[disabled],label[aria-disabled=true],select[disabled],textarea[disabled]{opacity:var(--pico-form-element-disabled-opacity);pointer-events:none}label[aria-disabled=true] input[disabled]{opacity:1}:where(input,select,textarea):not([type=checkbox]):not([type=radio]):not([type=date]):not([type=datetime-local]):not([type=month]):not([type=time]):not([type=week]):not([type=range])[aria-invalid]{padding-right:calc(1rem + 1.5rem)!important;padding-right:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem)!important;padding-left:1rem;padding-left:var(--pico-form-element-spacing-horizontal);-webkit-padding-start:1rem!important;padding-inline-start:1rem!important;-webkit-padding-start:var(--pico-form-element-spacing-horizontal)!important;padding-inline-start:var(--pico-form-element-spacing-horizontal)!important;-webkit-padding-end:calc(1rem + 1.5rem)!important;padding-inline-end:calc(1rem + 1.5rem)!important;-webkit-padding-end:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem)!important;padding-inline-end:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem)!important;background-position:center right .75rem;background-size:1rem auto;background-repeat:no-repeat}:where(input,select,textarea):not([type=checkbox]):not([type=radio]):not([type=date]):not([type=datetime-local]):not([type=month]):not([type=time]):not([type=week]):not([type=range])[aria-invalid=false]:not(select){background-image:var(--pico-icon-valid)}:where(input,select,textarea):not([type=checkbox]):not([type=radio]):not([type=date]):not([type=datetime-local]):not([type=month]):not([type=time]):not([type=week]):not([type=range])[aria-invalid=true]:not(select){background-image:var(--pico-icon-invalid)}:where(input,select,textarea)[aria-invalid=false]{--pico-border-color:var(--pico-form-element-valid-border-color)}[aria-invalid=false]:where(input,select,textarea):active{--pico-border-color:var(--pico-form-element-valid-active-border-color)!important}[aria-invalid=false]:where(input,select,textarea):focus{--pico-border-color:var(--pico-form-element-valid-active-border-color)!important}:where(input,select,textarea)[aria-invalid=false]:is(:active,:focus){--pico-border-color:var(--pico-form-element-valid-active-border-color)!important}[aria-invalid=false]:where(input,select,textarea):active:not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-valid-focus-color)!important}[aria-invalid=false]:where(input,select,textarea):focus:not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-valid-focus-color)!important}:where(input,select,textarea)[aria-invalid=false]:is(:active,:focus):not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-valid-focus-color)!important}:where(input,select,textarea)[aria-invalid=true]{--pico-border-color:var(--pico-form-element-invalid-border-color)}[aria-invalid=true]:where(input,select,textarea):active{--pico-border-color:var(--pico-form-element-invalid-active-border-color)!important}[aria-invalid=true]:where(input,select,textarea):focus{--pico-border-color:var(--pico-form-element-invalid-active-border-color)!important}:where(input,select,textarea)[aria-invalid=true]:is(:active,:focus){--pico-border-color:var(--pico-form-element-invalid-active-border-color)!important}[aria-invalid=true]:where(input,select,textarea):active:not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-invalid-focus-color)!important}[aria-invalid=true]:where(input,select,textarea):focus:not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-invalid-focus-color)!important}:where(input,select,textarea)[aria-invalid=true]:is(:active,:focus):not([type=checkbox]):not([type=radio]){--pico-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-invalid-focus-color)!important}[dir=rtl] [aria-invalid=false]:where(input,select,textarea):not([type=checkbox]):not([type=radio]),[dir=rtl] [aria-invalid=true]:where(input,select,textarea):not([type=checkbox]):not([type=radio]),[dir=rtl] [aria-invalid]:where(input,select,textarea):not([type=checkbox]):not([type=radio]){background-position:center left .75rem}[dir=rtl] :where(input,select,textarea):not([type=checkbox]):not([type=radio]):is([aria-invalid],[aria-invalid=true],[aria-invalid=false]){background-position:center left .75rem}input::-webkit-input-placeholder,textarea::-webkit-input-placeholder{color:var(--pico-form-element-placeholder-color);opacity:1}input::-webkit-input-placeholder,input::placeholder,select:invalid,textarea::-webkit-input-placeholder,textarea::placeholder{color:var(--pico-form-element-placeholder-color);opacity:1}input:not([type=checkbox]):not([type=radio]),select,textarea{margin-bottom:1rem;margin-bottom:var(--pico-spacing)}select::-ms-expand{border:0;background-color:transparent}select:not([multiple]):not([size]){padding-right:calc(1rem + 1.5rem);padding-right:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem);padding-left:1rem;padding-left:var(--pico-form-element-spacing-horizontal);-webkit-padding-start:1rem;padding-inline-start:1rem;-webkit-padding-start:var(--pico-form-element-spacing-horizontal);padding-inline-start:var(--pico-form-element-spacing-horizontal);-webkit-padding-end:calc(1rem + 1.5rem);padding-inline-end:calc(1rem + 1.5rem);-webkit-padding-end:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem);padding-inline-end:calc(var(--pico-form-element-spacing-horizontal) + 1.5rem);background-image:url('+C+");background-image:var(--pico-icon-chevron);background-position:center right .75rem;background-size:1rem auto;background-repeat:no-repeat}select[multiple] option:checked{background:var(--pico-form-element-selected-background-color);color:var(--pico-form-element-color)}[dir=rtl] select:not([multiple]):not([size]){background-position:center left .75rem}textarea{display:block;resize:vertical}textarea[aria-invalid]{--pico-icon-height:calc(1rem * var(--pico-line-height) + var(--pico-form-element-spacing-vertical) * 2 + var(--pico-border-width) * 2);background-position:top right .75rem!important;background-size:1rem calc(1rem*1.5 + .75rem*2 + .0625rem*2)!important;background-size:1rem var(--pico-icon-height)!important}:where(input,select,textarea,fieldset,.grid)+small{display:block;width:100%;margin-top:calc(1rem*-.75);margin-top:calc(var(--pico-spacing)*-.75);margin-bottom:1rem;margin-bottom:var(--pico-spacing);color:var(--pico-muted-color)}:where(input,select,textarea,fieldset,.grid)[aria-invalid=false]+small{color:var(--pico-ins-color)}:where(input,select,textarea,fieldset,.grid)[aria-invalid=true]+small{color:var(--pico-del-color)}label>:where(input,select,textarea){margin-top:calc(1rem*.25);margin-top:calc(var(--pico-spacing)*.25)}label:has([type=checkbox],[type=radio]){width:-moz-fit-content;width:-webkit-fit-content;width:fit-content;cursor:pointer}[type=checkbox],[type=radio]{-webkit-appearance:none;-moz-appearance:none;appearance:none;width:1.25em;height:1.25em;margin-top:-.125em;margin-right:.5em;border-width:.0625rem;border-width:var(--pico-border-width);vertical-align:middle;cursor:pointer}[type=checkbox]::-ms-check,[type=radio]::-ms-check{display:none}[type=checkbox]:checked,[type=checkbox]:checked:active,[type=checkbox]:checked:focus{background-image:url("+k+")}[type=checkbox]:checked,[type=checkbox]:checked:active,[type=checkbox]:checked:focus,[type=radio]:checked,[type=radio]:checked:active,[type=radio]:checked:focus{--pico-background-color:var(--pico-primary-background);--pico-border-color:var(--pico-primary-border);background-image:var(--pico-icon-checkbox);background-position:center;background-size:.75em auto;background-repeat:no-repeat}[type=checkbox]~label,[type=radio]~label{display:inline-block;margin-bottom:0;cursor:pointer}[type=checkbox]~label:not(:last-of-type),[type=radio]~label:not(:last-of-type){margin-right:1em}[type=checkbox]:indeterminate{--pico-background-color:var(--pico-primary-background);--pico-border-color:var(--pico-primary-border);background-image:url("+x+');background-image:var(--pico-icon-minus);background-position:center;background-size:.75em auto;background-repeat:no-repeat}[type=radio]{border-radius:50%}[type=radio]:checked,[type=radio]:checked:active,[type=radio]:checked:focus{--pico-background-color:var(--pico-primary-inverse);border-width:.35em;background-image:none}[type=checkbox][role=switch]{--pico-background-color:var(--pico-switch-background-color);--pico-color:var(--pico-switch-color);width:2.25em;height:1.25em;border:.0625rem solid var(--pico-border-color);border:var(--pico-border-width) solid var(--pico-border-color);border-radius:1.25em;background-color:var(--pico-background-color);line-height:1.25em}[type=checkbox][role=switch]:not([aria-invalid]){--pico-border-color:var(--pico-switch-background-color)}[type=checkbox][role=switch]:before{display:block;aspect-ratio:1;height:100%;border-radius:50%;background-color:var(--pico-color);-webkit-box-shadow:var(--pico-switch-thumb-box-shadow);box-shadow:var(--pico-switch-thumb-box-shadow);content:"";-webkit-transition:margin .1s ease-in-out;transition:margin .1s ease-in-out}[type=checkbox][role=switch]:focus{--pico-background-color:var(--pico-switch-background-color);--pico-border-color:var(--pico-switch-background-color)}[type=checkbox][role=switch]:checked{--pico-background-color:var(--pico-switch-checked-background-color);--pico-border-color:var(--pico-switch-checked-background-color);background-image:none}[type=checkbox][role=switch]:checked::before{margin-left:1em}[type=checkbox][role=switch][disabled]{--pico-background-color:var(--pico-border-color)}[type=checkbox][aria-invalid=false]:checked,[type=checkbox][aria-invalid=false]:checked:active,[type=checkbox][aria-invalid=false]:checked:focus,[type=checkbox][role=switch][aria-invalid=false]:checked,[type=checkbox][role=switch][aria-invalid=false]:checked:active,[type=checkbox][role=switch][aria-invalid=false]:checked:focus{--pico-background-color:var(--pico-form-element-valid-border-color)}[type=checkbox]:checked:active[aria-invalid=true],[type=checkbox]:checked:focus[aria-invalid=true],[type=checkbox]:checked[aria-invalid=true],[type=checkbox][role=switch]:checked:active[aria-invalid=true],[type=checkbox][role=switch]:checked:focus[aria-invalid=true],[type=checkbox][role=switch]:checked[aria-invalid=true]{--pico-background-color:var(--pico-form-element-invalid-border-color)}[type=checkbox][aria-invalid=false]:checked,[type=checkbox][aria-invalid=false]:checked:active,[type=checkbox][aria-invalid=false]:checked:focus,[type=checkbox][role=switch][aria-invalid=false]:checked,[type=checkbox][role=switch][aria-invalid=false]:checked:active,[type=checkbox][role=switch][aria-invalid=false]:checked:focus,[type=radio][aria-invalid=false]:checked,[type=radio][aria-invalid=false]:checked:active,[type=radio][aria-invalid=false]:checked:focus{--pico-border-color:var(--pico-form-element-valid-border-color)}[type=checkbox]:checked:active[aria-invalid=true],[type=checkbox]:checked:focus[aria-invalid=true],[type=checkbox]:checked[aria-invalid=true],[type=checkbox][role=switch]:checked:active[aria-invalid=true],[type=checkbox][role=switch]:checked:focus[aria-invalid=true],[type=checkbox][role=switch]:checked[aria-invalid=true],[type=radio]:checked:active[aria-invalid=true],[type=radio]:checked:focus[aria-invalid=true],[type=radio]:checked[aria-invalid=true]{--pico-border-color:var(--pico-form-element-invalid-border-color)}[type=color]::-webkit-color-swatch-wrapper{padding:0}[type=color]::-moz-focus-inner{padding:0}[type=color]::-webkit-color-swatch{border:0;border-radius:calc(.25rem*.5);border-radius:calc(var(--pico-border-radius)*.5)}[type=color]::-moz-color-swatch{border:0;border-radius:calc(.25rem*.5);border-radius:calc(var(--pico-border-radius)*.5)}input[type=date]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),input[type=datetime-local]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),input[type=month]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),input[type=time]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),input[type=week]:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]){--pico-icon-position:0.75rem;--pico-icon-width:1rem;padding-right:calc(1rem + .75rem);padding-right:calc(var(--pico-icon-width) + var(--pico-icon-position));background-image:url('+N+");background-image:var(--pico-icon-date);background-position:center right .75rem;background-position:center right var(--pico-icon-position);background-size:1rem auto;background-size:var(--pico-icon-width) auto;background-repeat:no-repeat}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]):is([type=date],[type=datetime-local],[type=month],[type=time],[type=week]){--pico-icon-position:0.75rem;--pico-icon-width:1rem;padding-right:calc(1rem + .75rem);padding-right:calc(var(--pico-icon-width) + var(--pico-icon-position));background-image:url("+N+");background-image:var(--pico-icon-date);background-position:center right .75rem;background-position:center right var(--pico-icon-position);background-size:1rem auto;background-size:var(--pico-icon-width) auto;background-repeat:no-repeat}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=time]{background-image:url("+E+");background-image:var(--pico-icon-time)}[type=date]::-webkit-calendar-picker-indicator,[type=datetime-local]::-webkit-calendar-picker-indicator,[type=month]::-webkit-calendar-picker-indicator,[type=time]::-webkit-calendar-picker-indicator,[type=week]::-webkit-calendar-picker-indicator{width:var(--pico-icon-width);margin-right:calc(var(--pico-icon-width)*-1);margin-left:var(--pico-icon-position);opacity:0}@-moz-document url-prefix(){[type=date],[type=datetime-local],[type=month],[type=time],[type=week]{padding-right:1rem!important;padding-right:var(--pico-form-element-spacing-horizontal)!important;background-image:none!important}}[dir=rtl] [type=date],[dir=rtl] [type=datetime-local],[dir=rtl] [type=month],[dir=rtl] [type=time],[dir=rtl] [type=week]{text-align:right}[dir=rtl] :is([type=date],[type=datetime-local],[type=month],[type=time],[type=week]){text-align:right}[type=file]{--pico-color:var(--pico-muted-color);margin-left:calc(.125rem*-1);margin-left:calc(var(--pico-outline-width)*-1);padding:calc(.75rem*.5)0;padding:calc(var(--pico-form-element-spacing-vertical)*.5)0;padding-left:.125rem;padding-left:var(--pico-outline-width);border:0;border-radius:0;background:0 0}[type=file]::-webkit-file-upload-button{margin-right:calc(1rem/2);margin-right:calc(var(--pico-spacing)/2);padding:calc(.75rem*.5) 1rem;padding:calc(var(--pico-form-element-spacing-vertical)*.5) var(--pico-form-element-spacing-horizontal)}[type=file]::file-selector-button{margin-right:calc(1rem/2);margin-right:calc(var(--pico-spacing)/2);padding:calc(.75rem*.5) 1rem;padding:calc(var(--pico-form-element-spacing-vertical)*.5) var(--pico-form-element-spacing-horizontal)}[type=file]:hover::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:hover::file-selector-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:active::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:active::file-selector-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:focus::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:focus::file-selector-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:is(:hover,:active,:focus)::-webkit-file-upload-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:is(:hover,:active,:focus)::file-selector-button{--pico-background-color:var(--pico-secondary-hover-background);--pico-border-color:var(--pico-secondary-hover-border)}[type=file]:focus::-webkit-file-upload-button{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=file]:focus::file-selector-button{--pico-box-shadow:var(--pico-button-hover-box-shadow, 0 0 0 rgba(0, 0, 0, 0)), 0 0 0 var(--pico-outline-width) var(--pico-secondary-focus)}[type=range]{-webkit-appearance:none;-moz-appearance:none;appearance:none;width:100%;height:1.25rem;background:0 0}[type=range]::-webkit-slider-runnable-track{width:100%;height:.375rem;border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-range-border-color);-webkit-transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),box-shadow var(--pico-transition);-webkit-transition:background-color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}[type=range]::-moz-range-track{width:100%;height:.375rem;border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-range-border-color);-moz-transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;-moz-transition:background-color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),box-shadow var(--pico-transition)}[type=range]::-ms-track{width:100%;height:.375rem;border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-range-border-color);-ms-transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,box-shadow .2s ease-in-out;-ms-transition:background-color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),box-shadow var(--pico-transition)}[type=range]::-webkit-slider-thumb{-webkit-appearance:none;width:1.25rem;height:1.25rem;margin-top:-.4375rem;border:2px solid var(--pico-range-thumb-border-color);border-radius:50%;background-color:var(--pico-range-thumb-color);cursor:pointer;-webkit-transition:background-color .2s ease-in-out,transform .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),transform var(--pico-transition);-webkit-transition:background-color .2s ease-in-out,-webkit-transform .2s ease-in-out;transition:background-color .2s ease-in-out,transform .2s ease-in-out;transition:background-color .2s ease-in-out,transform .2s ease-in-out,-webkit-transform .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),-webkit-transform var(--pico-transition);transition:background-color var(--pico-transition),transform var(--pico-transition);transition:background-color var(--pico-transition),transform var(--pico-transition),-webkit-transform var(--pico-transition)}[type=range]::-moz-range-thumb{-webkit-appearance:none;width:1.25rem;height:1.25rem;margin-top:-.4375rem;border:2px solid var(--pico-range-thumb-border-color);border-radius:50%;background-color:var(--pico-range-thumb-color);cursor:pointer;-moz-transition:background-color .2s ease-in-out,transform .2s ease-in-out;transition:background-color .2s ease-in-out,transform .2s ease-in-out;-moz-transition:background-color var(--pico-transition),transform var(--pico-transition);transition:background-color var(--pico-transition),transform var(--pico-transition)}[type=range]::-ms-thumb{-webkit-appearance:none;width:1.25rem;height:1.25rem;margin-top:-.4375rem;border:2px solid var(--pico-range-thumb-border-color);border-radius:50%;background-color:var(--pico-range-thumb-color);cursor:pointer;-ms-transition:background-color .2s ease-in-out,transform .2s ease-in-out;transition:background-color .2s ease-in-out,transform .2s ease-in-out;-ms-transition:background-color var(--pico-transition),transform var(--pico-transition);transition:background-color var(--pico-transition),transform var(--pico-transition)}[type=range]:active,[type=range]:focus-within{--pico-range-border-color:var(--pico-range-active-border-color);--pico-range-thumb-color:var(--pico-range-thumb-active-color)}[type=range]:active::-webkit-slider-thumb{-webkit-transform:scale(1.25);transform:scale(1.25)}[type=range]:active::-moz-range-thumb{transform:scale(1.25)}[type=range]:active::-ms-thumb{transform:scale(1.25)}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search]{padding-left:calc(1rem + 1.75rem);padding-left:calc(var(--pico-form-element-spacing-horizontal) + 1.75rem);background-image:url("+L+");background-image:var(--pico-icon-search);background-position:center left calc(1rem + .125rem);background-position:center left calc(var(--pico-form-element-spacing-horizontal) + .125rem);background-size:1rem auto;background-repeat:no-repeat}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search][aria-invalid]{padding-left:calc(1rem + 1.75rem)!important;padding-left:calc(var(--pico-form-element-spacing-horizontal) + 1.75rem)!important;background-position:center left 1.125rem,center right .75rem}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search][aria-invalid=false]{background-image:var(--pico-icon-search),var(--pico-icon-valid)}input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search][aria-invalid=true]{background-image:var(--pico-icon-search),var(--pico-icon-invalid)}[dir=rtl] :where(input):not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search]{background-position:center right 1.125rem}[dir=rtl] :where(input):not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file])[type=search][aria-invalid]{background-position:center right 1.125rem,center left .75rem}details{display:block;margin-bottom:1rem;margin-bottom:var(--pico-spacing)}details summary{line-height:1rem;list-style-type:none;cursor:pointer;-webkit-transition:color .2s ease-in-out;transition:color .2s ease-in-out;-webkit-transition:color var(--pico-transition);transition:color var(--pico-transition)}details summary:not([role]){color:var(--pico-accordion-close-summary-color)}details summary::-webkit-details-marker{display:none}details summary::marker{display:none}details summary::-moz-list-bullet{list-style-type:none}details summary::after{display:block;width:1rem;height:1rem;margin-left:calc(1rem*.5);margin-left:calc(var(--pico-spacing, 1rem)*.5);float:right;-webkit-transform:rotate(-90deg);transform:rotate(-90deg);background-image:url("+C+');background-image:var(--pico-icon-chevron);background-position:right center;background-size:1rem auto;background-repeat:no-repeat;content:"";-webkit-transition:-webkit-transform .2s ease-in-out;transition:transform .2s ease-in-out;transition:transform .2s ease-in-out,-webkit-transform .2s ease-in-out;-webkit-transition:-webkit-transform var(--pico-transition);transition:transform var(--pico-transition);transition:transform var(--pico-transition),-webkit-transform var(--pico-transition)}details summary:focus{outline:0}details summary:focus:not([role]){color:var(--pico-accordion-active-summary-color)}details summary:focus-visible:not([role]){outline:.125rem solid var(--pico-primary-focus);outline:var(--pico-outline-width) solid var(--pico-primary-focus);outline-offset:calc(1rem*.5);outline-offset:calc(var(--pico-spacing, 1rem)*.5);color:var(--pico-primary)}details summary[role=button]{width:100%;text-align:left}details summary[role=button]::after{height:calc(1rem*1.5);height:calc(1rem*var(--pico-line-height, 1.5))}details[open]>summary{margin-bottom:1rem;margin-bottom:var(--pico-spacing)}details[open]>summary:not([role]):not(:focus){color:var(--pico-accordion-open-summary-color)}details[open]>summary::after{-webkit-transform:rotate(0);transform:rotate(0)}[dir=rtl] details summary,dialog>article>footer{text-align:right}[dir=rtl] details summary::after{float:left;background-position:left center}article{padding:1rem;padding:var(--pico-block-spacing-vertical) var(--pico-block-spacing-horizontal);border-radius:.25rem;border-radius:var(--pico-border-radius);background:var(--pico-card-background-color);-webkit-box-shadow:var(--pico-card-box-shadow);box-shadow:var(--pico-card-box-shadow)}article>footer,article>header{margin-right:calc(1rem*-1);margin-right:calc(var(--pico-block-spacing-horizontal)*-1);margin-left:calc(1rem*-1);margin-left:calc(var(--pico-block-spacing-horizontal)*-1);padding:calc(1rem*.66) 1rem;padding:calc(var(--pico-block-spacing-vertical)*.66) var(--pico-block-spacing-horizontal);background-color:var(--pico-card-sectioning-background-color)}article,article>header{margin-bottom:1rem;margin-bottom:var(--pico-block-spacing-vertical)}article>header{margin-top:calc(1rem*-1);margin-top:calc(var(--pico-block-spacing-vertical)*-1);border-bottom:.0625rem solid var(--pico-card-border-color);border-bottom:var(--pico-border-width) solid var(--pico-card-border-color);border-top-right-radius:.25rem;border-top-right-radius:var(--pico-border-radius);border-top-left-radius:.25rem;border-top-left-radius:var(--pico-border-radius)}article>footer{margin-top:1rem;margin-top:var(--pico-block-spacing-vertical);margin-bottom:calc(1rem*-1);margin-bottom:calc(var(--pico-block-spacing-vertical)*-1);border-top:.0625rem solid var(--pico-card-border-color);border-top:var(--pico-border-width) solid var(--pico-card-border-color);border-bottom-right-radius:.25rem;border-bottom-right-radius:var(--pico-border-radius);border-bottom-left-radius:.25rem;border-bottom-left-radius:var(--pico-border-radius)}details.dropdown{position:relative;border-bottom:none}details.dropdown>a::after,details.dropdown>button::after,details.dropdown>summary::after{display:block;width:1rem;height:calc(1rem*1.5);height:calc(1rem*var(--pico-line-height, 1.5));margin-left:.25rem;float:right;-webkit-transform:rotate(0deg) translateX(.2rem);transform:rotate(0deg) translateX(.2rem);background-image:url('+C+');background-image:var(--pico-icon-chevron);background-position:right center;background-size:1rem auto;background-repeat:no-repeat;content:""}nav details.dropdown{margin-bottom:0;display:inline;margin:calc(1rem*-1)0;margin:calc(var(--pico-nav-element-spacing-vertical)*-1)0}details.dropdown>summary:not([role]){height:calc(1rem*1.5 + .75rem*2 + .0625rem*2);height:calc(1rem*var(--pico-line-height) + var(--pico-form-element-spacing-vertical)*2 + var(--pico-border-width)*2);padding:.75rem 1rem;padding:var(--pico-form-element-spacing-vertical) var(--pico-form-element-spacing-horizontal);border:.0625rem solid var(--pico-form-element-border-color);border:var(--pico-border-width) solid var(--pico-form-element-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-form-element-background-color);color:var(--pico-form-element-placeholder-color);line-height:inherit;cursor:pointer;-webkit-user-select:none;-moz-user-select:none;-ms-user-select:none;user-select:none;-webkit-transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out;transition:background-color .2s ease-in-out,border-color .2s ease-in-out,color .2s ease-in-out,box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),-webkit-box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition);transition:background-color var(--pico-transition),border-color var(--pico-transition),color var(--pico-transition),box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}details.dropdown>summary:not([role]):active,details.dropdown>summary:not([role]):focus{border-color:var(--pico-form-element-active-border-color);background-color:var(--pico-form-element-active-background-color)}details.dropdown>summary:not([role]):focus{-webkit-box-shadow:0 0 0 .125rem var(--pico-form-element-focus-color);box-shadow:0 0 0 .125rem var(--pico-form-element-focus-color);-webkit-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-focus-color);box-shadow:0 0 0 var(--pico-outline-width) var(--pico-form-element-focus-color)}details.dropdown>summary:not([role]):focus-visible{outline:0}details.dropdown>summary:not([role])[aria-invalid=false]{--pico-form-element-border-color:var(--pico-form-element-valid-border-color);--pico-form-element-active-border-color:var(--pico-form-element-valid-focus-color);--pico-form-element-focus-color:var(--pico-form-element-valid-focus-color)}details.dropdown>summary:not([role])[aria-invalid=true]{--pico-form-element-border-color:var(--pico-form-element-invalid-border-color);--pico-form-element-active-border-color:var(--pico-form-element-invalid-focus-color);--pico-form-element-focus-color:var(--pico-form-element-invalid-focus-color)}nav details.dropdown>summary::after{-webkit-transform:rotate(0deg) translateX(0);transform:rotate(0deg) translateX(0)}nav details.dropdown>summary:not([role]){height:calc(1rem*1.5 + .5rem*2);height:calc(1rem*var(--pico-line-height) + var(--pico-nav-link-spacing-vertical)*2);padding:calc(.5rem - .0625rem*2) .5rem;padding:calc(var(--pico-nav-link-spacing-vertical) - var(--pico-border-width)*2) var(--pico-nav-link-spacing-horizontal)}nav details.dropdown>summary:not([role]):focus-visible{-webkit-box-shadow:0 0 0 .125rem var(--pico-primary-focus);box-shadow:0 0 0 .125rem var(--pico-primary-focus);-webkit-box-shadow:0 0 0 var(--pico-outline-width) var(--pico-primary-focus);box-shadow:0 0 0 var(--pico-outline-width) var(--pico-primary-focus)}details.dropdown>summary+ul{display:-webkit-box;display:-ms-flexbox;display:flex;z-index:99;position:absolute;left:0;-webkit-box-orient:vertical;-webkit-box-direction:normal;-ms-flex-direction:column;flex-direction:column;width:100%;min-width:-moz-fit-content;min-width:-webkit-fit-content;min-width:fit-content;margin:0;margin-top:.125rem;margin-top:var(--pico-outline-width);padding:0;border:.0625rem solid var(--pico-dropdown-border-color);border:var(--pico-border-width) solid var(--pico-dropdown-border-color);border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-dropdown-background-color);-webkit-box-shadow:var(--pico-dropdown-box-shadow);box-shadow:var(--pico-dropdown-box-shadow);color:var(--pico-dropdown-color);white-space:nowrap;opacity:0;-webkit-transition:opacity .2s ease-in-out,-webkit-transform 0s ease-in-out 1s;transition:opacity .2s ease-in-out,transform 0s ease-in-out 1s;transition:opacity .2s ease-in-out,transform 0s ease-in-out 1s,-webkit-transform 0s ease-in-out 1s;-webkit-transition:opacity var(--pico-transition),-webkit-transform 0s ease-in-out 1s;transition:opacity var(--pico-transition),transform 0s ease-in-out 1s;transition:opacity var(--pico-transition),transform 0s ease-in-out 1s,-webkit-transform 0s ease-in-out 1s}details.dropdown>summary+ul[dir=rtl]{right:0;left:auto}details.dropdown>summary+ul li{width:100%;margin-bottom:0;padding:calc(.75rem*.5) 1rem;padding:calc(var(--pico-form-element-spacing-vertical)*.5) var(--pico-form-element-spacing-horizontal);list-style:none}details.dropdown>summary+ul li:first-of-type{margin-top:calc(.75rem*.5);margin-top:calc(var(--pico-form-element-spacing-vertical)*.5)}details.dropdown>summary+ul li:last-of-type{margin-bottom:calc(.75rem*.5);margin-bottom:calc(var(--pico-form-element-spacing-vertical)*.5)}details.dropdown>summary+ul li a{display:block;margin:calc(var(--pico-form-element-spacing-vertical)*-.5) calc(var(--pico-form-element-spacing-horizontal)*-1);padding:calc(.75rem*.5) 1rem;padding:calc(var(--pico-form-element-spacing-vertical)*.5) var(--pico-form-element-spacing-horizontal);overflow:hidden;border-radius:0;color:var(--pico-dropdown-color);-webkit-text-decoration:none;text-decoration:none;text-overflow:ellipsis}details.dropdown>summary+ul li a:active,details.dropdown>summary+ul li a:focus,details.dropdown>summary+ul li a:focus-visible,details.dropdown>summary+ul li a:hover,details.dropdown>summary+ul li a[aria-current]:not([aria-current=false]){background-color:var(--pico-dropdown-hover-background-color)}details.dropdown>summary+ul li label{width:100%}details.dropdown>summary+ul li:has(label):hover{background-color:var(--pico-dropdown-hover-background-color)}details.dropdown[open]>summary,dialog>article>header>*{margin-bottom:0}details.dropdown[open]>summary+ul{-webkit-transform:scaleY(1);transform:scaleY(1);opacity:1;-webkit-transition:opacity .2s ease-in-out,-webkit-transform 0s ease-in-out 0s;transition:opacity .2s ease-in-out,transform 0s ease-in-out 0s;transition:opacity .2s ease-in-out,transform 0s ease-in-out 0s,-webkit-transform 0s ease-in-out 0s;-webkit-transition:opacity var(--pico-transition),-webkit-transform 0s ease-in-out 0s;transition:opacity var(--pico-transition),transform 0s ease-in-out 0s;transition:opacity var(--pico-transition),transform 0s ease-in-out 0s,-webkit-transform 0s ease-in-out 0s}details.dropdown[open]>summary::before{display:block;z-index:1;position:fixed;width:100vw;height:100vh;top:0;right:0;bottom:0;left:0;background:0 0;content:"";cursor:default}label>details.dropdown{margin-top:calc(1rem*.25);margin-top:calc(var(--pico-spacing)*.25)}[role=group],[role=search]{display:-webkit-inline-box;display:-ms-inline-flexbox;display:inline-flex;position:relative;width:100%;margin-bottom:1rem;margin-bottom:var(--pico-spacing);border-radius:.25rem;border-radius:var(--pico-border-radius);-webkit-box-shadow:0 0 0 transparent;box-shadow:0 0 0 transparent;-webkit-box-shadow:var(--pico-group-box-shadow, 0 0 0 rgba(0, 0, 0, 0));box-shadow:var(--pico-group-box-shadow, 0 0 0 rgba(0, 0, 0, 0));vertical-align:middle;-webkit-transition:-webkit-box-shadow .2s ease-in-out;transition:box-shadow .2s ease-in-out;transition:box-shadow .2s ease-in-out,-webkit-box-shadow .2s ease-in-out;-webkit-transition:-webkit-box-shadow var(--pico-transition);transition:box-shadow var(--pico-transition);transition:box-shadow var(--pico-transition),-webkit-box-shadow var(--pico-transition)}[role=group] input:not([type=checkbox]):not([type=radio]),[role=group] select,[role=group]>*,[role=search] input:not([type=checkbox]):not([type=radio]),[role=search] select,[role=search]>*{position:relative;-webkit-box-flex:1;-ms-flex:1 1 auto;flex:1 1 auto;margin-bottom:0}[role=group] input:not([type=checkbox]):not([type=radio]):not(:first-child),[role=group] select:not(:first-child),[role=group]>:not(:first-child),[role=search] input:not([type=checkbox]):not([type=radio]):not(:first-child),[role=search] select:not(:first-child),[role=search]>:not(:first-child){margin-left:0;border-top-left-radius:0;border-bottom-left-radius:0}[role=group] input:not([type=checkbox]):not([type=radio]):not(:last-child),[role=group] select:not(:last-child),[role=group]>:not(:last-child),[role=search] input:not([type=checkbox]):not([type=radio]):not(:last-child),[role=search] select:not(:last-child),[role=search]>:not(:last-child){border-top-right-radius:0;border-bottom-right-radius:0}[role=group] input:not([type=checkbox]):not([type=radio]):focus,[role=group] select:focus,[role=group]>:focus,[role=search] input:not([type=checkbox]):not([type=radio]):focus,[role=search] select:focus,[role=search]>:focus{z-index:2}[role=group] [role=button]:not(:first-child),[role=group] [type=button]:not(:first-child),[role=group] [type=reset]:not(:first-child),[role=group] [type=submit]:not(:first-child),[role=group] button:not(:first-child),[role=group] input:not([type=checkbox]):not([type=radio]):not(:first-child),[role=group] select:not(:first-child),[role=search] [role=button]:not(:first-child),[role=search] [type=button]:not(:first-child),[role=search] [type=reset]:not(:first-child),[role=search] [type=submit]:not(:first-child),[role=search] button:not(:first-child),[role=search] input:not([type=checkbox]):not([type=radio]):not(:first-child),[role=search] select:not(:first-child){margin-left:calc(.0625rem*-1);margin-left:calc(var(--pico-border-width)*-1)}[role=group] [role=button],[role=group] [type=button],[role=group] [type=reset],[role=group] [type=submit],[role=group] button,[role=search] [role=button],[role=search] [type=button],[role=search] [type=reset],[role=search] [type=submit],[role=search] button{width:auto}@supports selector(:has(*)){[role=group]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus),[role=search]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus){--pico-group-box-shadow:var(--pico-group-box-shadow-focus-with-button)}[role=group]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus) input:not([type=checkbox]):not([type=radio]),[role=group]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus) select,[role=search]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus) input:not([type=checkbox]):not([type=radio]),[role=search]:has(button:focus,[type=submit]:focus,[type=button]:focus,[role=button]:focus) select{border-color:transparent}[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus),[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus){--pico-group-box-shadow:var(--pico-group-box-shadow-focus-with-input)}[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [role=button],[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [type=button],[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [type=submit],[role=group]:has(input:not([type=submit]):not([type=button]):focus,select:focus) button,[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [role=button],[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [type=button],[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus) [type=submit],[role=search]:has(input:not([type=submit]):not([type=button]):focus,select:focus) button{--pico-button-box-shadow:0 0 0 var(--pico-border-width) var(--pico-primary-border);--pico-button-hover-box-shadow:0 0 0 var(--pico-border-width) var(--pico-primary-hover-border)}[role=group] [role=button]:focus,[role=group] [type=button]:focus,[role=group] [type=reset]:focus,[role=group] [type=submit]:focus,[role=group] button:focus,[role=search] [role=button]:focus,[role=search] [type=button]:focus,[role=search] [type=reset]:focus,[role=search] [type=submit]:focus,[role=search] button:focus{-webkit-box-shadow:none;box-shadow:none}}[role=search]>:first-child{border-top-left-radius:5rem;border-bottom-left-radius:5rem}[role=search]>:last-child{border-top-right-radius:5rem;border-bottom-right-radius:5rem}[aria-busy=true]:not(input):not(select):not(textarea):not(html):not(form){white-space:nowrap}[aria-busy=true]:not(input):not(select):not(textarea):not(html):not(form)::before{display:inline-block;width:1em;height:1em;background-image:url('+M+');background-image:var(--pico-icon-loading);background-size:1em auto;background-repeat:no-repeat;content:"";vertical-align:-.125em}[aria-busy=true]:not(input):not(select):not(textarea):not(html):not(form):not(:empty)::before{margin-right:calc(1rem*.5);margin-right:calc(var(--pico-spacing)*.5)}[aria-busy=true]:not(input):not(select):not(textarea):not(html):not(form):empty{text-align:center}[role=button][aria-busy=true],[type=button][aria-busy=true],[type=reset][aria-busy=true],[type=submit][aria-busy=true],a[aria-busy=true],button[aria-busy=true]{pointer-events:none}:host,:root{--pico-scrollbar-width:0px}dialog{display:-webkit-box;display:-ms-flexbox;display:flex;z-index:999;position:fixed;top:0;right:0;bottom:0;left:0;-webkit-box-align:center;-ms-flex-align:center;align-items:center;-webkit-box-pack:center;-ms-flex-pack:center;justify-content:center;width:inherit;min-width:100%;height:inherit;min-height:100%;padding:0;border:0;backdrop-filter:blur(.375rem);backdrop-filter:var(--pico-modal-overlay-backdrop-filter);background-color:var(--pico-modal-overlay-background-color);color:var(--pico-color)}dialog>article{width:100%;max-height:calc(100vh - 1rem*2);max-height:calc(100vh - var(--pico-spacing)*2);margin:1rem;margin:var(--pico-spacing);overflow:auto}@media (min-width:576px){dialog>article{max-width:510px}}@media (min-width:768px){dialog>article{max-width:700px}}dialog>article>header .close,dialog>article>header a[rel=prev],dialog>article>header button[rel=prev]{margin:0;margin-left:1rem;margin-left:var(--pico-spacing);padding:0;float:right}dialog>article>header .close,dialog>article>header :is(a,button)[rel=prev]{margin:0;margin-left:1rem;margin-left:var(--pico-spacing);padding:0;float:right}dialog>article>footer [role=button],dialog>article>footer button{margin-bottom:0}dialog>article>footer [role=button]:not(:first-of-type),dialog>article>footer button:not(:first-of-type){margin-left:calc(1rem*.5);margin-left:calc(var(--pico-spacing)*.5)}dialog>article .close,dialog>article a[rel=prev],dialog>article button[rel=prev]{display:block;width:1rem;height:1rem;margin-top:calc(1rem*-1);margin-top:calc(var(--pico-spacing)*-1);margin-bottom:1rem;margin-bottom:var(--pico-spacing);margin-left:auto;border:0;background-image:url('+S+");background-image:var(--pico-icon-close);background-position:center;background-size:auto 1rem;background-repeat:no-repeat;background-color:transparent;opacity:.5;-webkit-transition:opacity .2s ease-in-out;transition:opacity .2s ease-in-out;-webkit-transition:opacity var(--pico-transition);transition:opacity var(--pico-transition)}dialog>article .close,dialog>article :is(a,button)[rel=prev]{display:block;width:1rem;height:1rem;margin-top:calc(1rem*-1);margin-top:calc(var(--pico-spacing)*-1);margin-bottom:1rem;margin-bottom:var(--pico-spacing);margin-left:auto;border:0;background-image:url("+S+');background-image:var(--pico-icon-close);background-position:center;background-size:auto 1rem;background-repeat:no-repeat;background-color:transparent;opacity:.5;-webkit-transition:opacity .2s ease-in-out;transition:opacity .2s ease-in-out;-webkit-transition:opacity var(--pico-transition);transition:opacity var(--pico-transition)}dialog>article .close:active:not(.does-not-exist),dialog>article a[rel=prev]:active:not(.does-not-exist),dialog>article button[rel=prev]:active:not(.does-not-exist){opacity:1}dialog>article .close:focus:not(.does-not-exist),dialog>article .close:hover:not(.does-not-exist),dialog>article .close[aria-current]:not([aria-current=false]),dialog>article a[rel=prev]:focus:not(.does-not-exist),dialog>article a[rel=prev]:hover:not(.does-not-exist),dialog>article a[rel=prev][aria-current]:not([aria-current=false]),dialog>article button[rel=prev]:focus:not(.does-not-exist),dialog>article button[rel=prev]:hover:not(.does-not-exist),dialog>article button[rel=prev][aria-current]:not([aria-current=false]){opacity:1}dialog>article .close:is([aria-current]:not([aria-current=false]),:hover,:active,:focus),dialog>article :is(a,button)[rel=prev]:is([aria-current]:not([aria-current=false]),:hover,:active,:focus){opacity:1}dialog:not([open]),dialog[open=false]{display:none}.modal-is-open{padding-right:0;padding-right:var(--pico-scrollbar-width, 0px);overflow:hidden;pointer-events:none;-ms-touch-action:none;touch-action:none}.modal-is-open dialog{pointer-events:auto;-ms-touch-action:auto;touch-action:auto}:where(.modal-is-opening,.modal-is-closing) dialog,:where(.modal-is-opening,.modal-is-closing) dialog>article{-webkit-animation-timing-function:ease-in-out;animation-timing-function:ease-in-out;-webkit-animation-fill-mode:both;animation-fill-mode:both;-webkit-animation-duration:.8s;animation-duration:.8s;-webkit-animation-name:modal-overlay;animation-name:modal-overlay}:where(.modal-is-opening,.modal-is-closing) dialog>article{-webkit-animation-duration:.2s;animation-duration:.2s;-webkit-animation-delay:.2s;animation-delay:.2s;-webkit-animation-name:modal;animation-name:modal}.modal-is-closing dialog,.modal-is-closing dialog>article{-webkit-animation-delay:0s;animation-delay:0s;animation-direction:reverse}:where(nav li)::before{float:left;content:"​"}nav,nav ul{display:-webkit-box;display:-ms-flexbox;display:flex}nav{-webkit-box-pack:justify;-ms-flex-pack:justify;justify-content:space-between;overflow:visible}nav ol,nav ul{-webkit-box-align:center;-ms-flex-align:center;align-items:center;margin-bottom:0;padding:0;list-style:none}nav ol:first-of-type,nav ul:first-of-type{margin-left:calc(.5rem*-1);margin-left:calc(var(--pico-nav-element-spacing-horizontal)*-1)}nav ol:last-of-type,nav ul:last-of-type{margin-right:calc(.5rem*-1);margin-right:calc(var(--pico-nav-element-spacing-horizontal)*-1)}nav li{display:inline-block;margin:0;padding:1rem .5rem;padding:var(--pico-nav-element-spacing-vertical) var(--pico-nav-element-spacing-horizontal)}nav li :where(a,[role=link]){display:inline-block;margin:calc(var(--pico-nav-link-spacing-vertical)*-1) calc(var(--pico-nav-link-spacing-horizontal)*-1);padding:.5rem;padding:var(--pico-nav-link-spacing-vertical) var(--pico-nav-link-spacing-horizontal);border-radius:.25rem;border-radius:var(--pico-border-radius)}nav li :where(a,[role=link]):not(:hover){-webkit-text-decoration:none;text-decoration:none}nav li [role=button],nav li [type=button],nav li button,nav li input:not([type=checkbox]):not([type=radio]):not([type=range]):not([type=file]),nav li select{height:auto;margin-right:inherit;margin-bottom:0;margin-left:inherit;padding:calc(.5rem - .0625rem*2) .5rem;padding:calc(var(--pico-nav-link-spacing-vertical) - var(--pico-border-width)*2) var(--pico-nav-link-spacing-horizontal)}nav[aria-label=breadcrumb]{-webkit-box-align:center;-ms-flex-align:center;align-items:center;-webkit-box-pack:start;-ms-flex-pack:start;justify-content:start}nav[aria-label=breadcrumb] ul li:not(:first-child){margin-left:.5rem;margin-left:var(--pico-nav-link-spacing-horizontal)}nav[aria-label=breadcrumb] ul li a{margin:calc(.5rem*-1)0;margin:calc(var(--pico-nav-link-spacing-vertical)*-1)0;margin-left:calc(.5rem*-1);margin-left:calc(var(--pico-nav-link-spacing-horizontal)*-1)}nav[aria-label=breadcrumb] ul li:not(:last-child)::after{display:inline-block;position:absolute;width:calc(.5rem*4);width:calc(var(--pico-nav-link-spacing-horizontal)*4);margin:0 calc(.5rem*-1);margin:0 calc(var(--pico-nav-link-spacing-horizontal)*-1);content:">";content:var(--pico-nav-breadcrumb-divider);color:var(--pico-muted-color);text-align:center;-webkit-text-decoration:none;text-decoration:none;white-space:nowrap}nav[aria-label=breadcrumb] a[aria-current]:not([aria-current=false]){background-color:transparent;color:inherit;-webkit-text-decoration:none;text-decoration:none;pointer-events:none}aside li,aside li a,aside nav,aside ol,aside ul{display:block}aside li{padding:calc(1rem*.5) .5rem;padding:calc(var(--pico-nav-element-spacing-vertical)*.5) var(--pico-nav-element-spacing-horizontal)}aside li [role=button]{margin:inherit}[dir=rtl] nav[aria-label=breadcrumb] ul li:not(:last-child) ::after{content:"\\\\"}progress{vertical-align:baseline;-webkit-appearance:none;-moz-appearance:none;display:inline-block;appearance:none;width:100%;height:.5rem;margin-bottom:calc(1rem*.5);margin-bottom:calc(var(--pico-spacing)*.5);overflow:hidden;border:0;border-radius:.25rem;border-radius:var(--pico-border-radius);background-color:var(--pico-progress-background-color);color:var(--pico-progress-color)}progress::-webkit-progress-bar{border-radius:.25rem;border-radius:var(--pico-border-radius);background:0 0}progress[value]::-webkit-progress-value{background-color:var(--pico-progress-color);-webkit-transition:width .2s ease-in-out;transition:width .2s ease-in-out;-webkit-transition:width var(--pico-transition);transition:width var(--pico-transition)}progress::-moz-progress-bar{background-color:var(--pico-progress-color)}@media (prefers-reduced-motion:no-preference){progress:indeterminate{background:var(--pico-progress-background-color) -webkit-gradient(linear,left top,right top,color-stop(30%,var(--pico-progress-color)),color-stop(30%,var(--pico-progress-background-color))) top left/150% 150%no-repeat;background:var(--pico-progress-background-color) linear-gradient(to right,var(--pico-progress-color) 30%,var(--pico-progress-background-color) 30%) top left/150% 150%no-repeat;-webkit-animation:progress-indeterminate 1s linear infinite;animation:progress-indeterminate 1s linear infinite}progress:indeterminate[value]::-webkit-progress-value{background-color:transparent}progress:indeterminate::-moz-progress-bar{background-color:transparent}[dir=rtl] progress:indeterminate{animation-direction:reverse}}[data-tooltip]{position:relative}[data-tooltip]:not(a):not(button):not(input):not([role=button]){border-bottom:1px dotted;-webkit-text-decoration:none;text-decoration:none;cursor:help}[data-tooltip][data-placement=top]::before{display:block;z-index:99;position:absolute;bottom:100%;left:50%;padding:.25rem .5rem;overflow:hidden;-webkit-transform:translate(-50%,-.25rem);transform:translate(-50%,-.25rem);border-radius:.25rem;border-radius:var(--pico-border-radius);background:var(--pico-tooltip-background-color);content:attr(data-tooltip);color:var(--pico-tooltip-color);font-style:normal;font-weight:400;font-weight:var(--pico-font-weight);font-size:.875rem;-webkit-text-decoration:none;text-decoration:none;text-overflow:ellipsis;white-space:nowrap;opacity:0;pointer-events:none}[data-tooltip]::before{color:var(--pico-tooltip-color)}[data-tooltip]::after,[data-tooltip]::before,[data-tooltip][data-placement=top]::after{display:block;z-index:99;position:absolute;bottom:100%;left:50%;padding:.25rem .5rem;overflow:hidden;-webkit-transform:translate(-50%,-.25rem);transform:translate(-50%,-.25rem);border-radius:.25rem;border-radius:var(--pico-border-radius);background:var(--pico-tooltip-background-color);content:attr(data-tooltip);font-style:normal;font-weight:400;font-weight:var(--pico-font-weight);font-size:.875rem;-webkit-text-decoration:none;text-decoration:none;text-overflow:ellipsis;white-space:nowrap;opacity:0;pointer-events:none}[data-tooltip]::after,[data-tooltip][data-placement=top]::after{padding:0;-webkit-transform:translate(-50%,0);transform:translate(-50%,0);border-top:.3rem solid;border-right:.3rem solid transparent;border-left:.3rem solid transparent;border-radius:0;background-color:transparent;content:"";color:var(--pico-tooltip-background-color)}[data-tooltip][data-placement=bottom]::after,[data-tooltip][data-placement=bottom]::before{top:100%;bottom:auto;-webkit-transform:translate(-50%,.25rem);transform:translate(-50%,.25rem)}[data-tooltip][data-placement=bottom]:after{-webkit-transform:translate(-50%,-.3rem);transform:translate(-50%,-.3rem);border:.3rem solid transparent;border-bottom:.3rem solid}[data-tooltip][data-placement=left]::after,[data-tooltip][data-placement=left]::before{top:50%;right:100%;bottom:auto;left:auto;-webkit-transform:translate(-.25rem,-50%);transform:translate(-.25rem,-50%)}[data-tooltip][data-placement=left]:after{-webkit-transform:translate(.3rem,-50%);transform:translate(.3rem,-50%);border:.3rem solid transparent;border-left:.3rem solid}[data-tooltip][data-placement=right]::after,[data-tooltip][data-placement=right]::before{top:50%;right:auto;bottom:auto;left:100%;-webkit-transform:translate(.25rem,-50%);transform:translate(.25rem,-50%)}[data-tooltip][data-placement=right]:after{-webkit-transform:translate(-.3rem,-50%);transform:translate(-.3rem,-50%);border:.3rem solid transparent;border-right:.3rem solid}[data-tooltip]:focus::after,[data-tooltip]:focus::before,[data-tooltip]:hover::after,[data-tooltip]:hover::before{opacity:1}@media (hover:hover) and (pointer:fine){[data-tooltip]:focus::before{-webkit-transform:translate(-50%,.75rem);transform:translate(-50%,.75rem);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip]:focus::after,[data-tooltip]:focus::before{--pico-tooltip-slide-to:translate(-50%, -0.25rem);-webkit-animation-duration:.2s;animation-duration:.2s;-webkit-animation-fill-mode:forwards;animation-fill-mode:forwards;opacity:0}[data-tooltip]:hover::before{-webkit-transform:translate(-50%,.75rem);transform:translate(-50%,.75rem);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip]:hover::after,[data-tooltip]:hover::before{--pico-tooltip-slide-to:translate(-50%, -0.25rem);-webkit-animation-duration:.2s;animation-duration:.2s;-webkit-animation-fill-mode:forwards;animation-fill-mode:forwards;opacity:0}[data-tooltip]:focus::after,[data-tooltip]:hover::after{--pico-tooltip-caret-slide-to:translate(-50%, 0rem);-webkit-transform:translate(-50%,-.25rem);transform:translate(-50%,-.25rem);-webkit-animation-name:tooltip-caret-slide;animation-name:tooltip-caret-slide}[data-tooltip][data-placement=bottom]:focus::before{--pico-tooltip-slide-to:translate(-50%, 0.25rem);-webkit-transform:translate(-50%,-.75rem);transform:translate(-50%,-.75rem);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=bottom]:focus::after{--pico-tooltip-slide-to:translate(-50%, 0.25rem)}[data-tooltip][data-placement=bottom]:hover::before{--pico-tooltip-slide-to:translate(-50%, 0.25rem);-webkit-transform:translate(-50%,-.75rem);transform:translate(-50%,-.75rem);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=bottom]:hover::after{--pico-tooltip-slide-to:translate(-50%, 0.25rem)}[data-tooltip][data-placement=bottom]:focus::after,[data-tooltip][data-placement=bottom]:hover::after{--pico-tooltip-caret-slide-to:translate(-50%, -0.3rem);-webkit-transform:translate(-50%,-.5rem);transform:translate(-50%,-.5rem);-webkit-animation-name:tooltip-caret-slide;animation-name:tooltip-caret-slide}[data-tooltip][data-placement=left]:focus::before{--pico-tooltip-slide-to:translate(-0.25rem, -50%);-webkit-transform:translate(.75rem,-50%);transform:translate(.75rem,-50%);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=left]:focus::after{--pico-tooltip-slide-to:translate(-0.25rem, -50%)}[data-tooltip][data-placement=left]:hover::before{--pico-tooltip-slide-to:translate(-0.25rem, -50%);-webkit-transform:translate(.75rem,-50%);transform:translate(.75rem,-50%);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=left]:hover::after{--pico-tooltip-slide-to:translate(-0.25rem, -50%)}[data-tooltip][data-placement=left]:focus::after,[data-tooltip][data-placement=left]:hover::after{--pico-tooltip-caret-slide-to:translate(0.3rem, -50%);-webkit-transform:translate(.05rem,-50%);transform:translate(.05rem,-50%);-webkit-animation-name:tooltip-caret-slide;animation-name:tooltip-caret-slide}[data-tooltip][data-placement=right]:focus::before{--pico-tooltip-slide-to:translate(0.25rem, -50%);-webkit-transform:translate(-.75rem,-50%);transform:translate(-.75rem,-50%);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=right]:focus::after{--pico-tooltip-slide-to:translate(0.25rem, -50%)}[data-tooltip][data-placement=right]:hover::before{--pico-tooltip-slide-to:translate(0.25rem, -50%);-webkit-transform:translate(-.75rem,-50%);transform:translate(-.75rem,-50%);-webkit-animation-name:tooltip-slide;animation-name:tooltip-slide}[data-tooltip][data-placement=right]:hover::after{--pico-tooltip-slide-to:translate(0.25rem, -50%)}[data-tooltip][data-placement=right]:focus::after,[data-tooltip][data-placement=right]:hover::after{--pico-tooltip-caret-slide-to:translate(-0.3rem, -50%);-webkit-transform:translate(-.05rem,-50%);transform:translate(-.05rem,-50%);-webkit-animation-name:tooltip-caret-slide;animation-name:tooltip-caret-slide}}[aria-controls]{cursor:pointer}[aria-disabled=true],[disabled]{cursor:not-allowed}[aria-hidden=false][hidden]{display:initial}[aria-hidden=false][hidden]:not(:focus){clip:rect(0,0,0,0);position:absolute}[tabindex],a,area,button,input,label,select,summary,textarea{-ms-touch-action:manipulation}[dir=rtl]{direction:rtl}@media (prefers-reduced-motion:reduce){:not([aria-busy=true]),:not([aria-busy=true])::after,:not([aria-busy=true])::before{background-attachment:initial!important;-webkit-animation-duration:1ms!important;animation-duration:1ms!important;-webkit-animation-delay:-1ms!important;animation-delay:-1ms!important;-webkit-animation-iteration-count:1!important;animation-iteration-count:1!important;scroll-behavior:auto!important;-webkit-transition-delay:0s!important;transition-delay:0s!important;-webkit-transition-duration:0s!important;transition-duration:0s!important}}:root{--pico-font-size:95%}.h-logo{width:200px}.h-table{margin-bottom:0}.h-error{background-color:#f06c41;color:#fff;font-weight:700}.h-table>tbody>tr>th:first-child{font-weight:700;width:1%;white-space:nowrap;padding-right:.5rem}.mt-2{margin-top:.5rem}.mb-2{margin-bottom:.5rem!important}.h-btns>*{margin:.2rem}.h-btns>:first-child{margin-left:0}.h-btns>:last-child{margin-right:0}.alert{margin-bottom:var(--spacing);padding:1rem;border-radius:var(--border-radius);color:var(--color);background-color:var(--background-color);border:1px solid var(--background-color)}.alert-danger{--background-color:#ffebee;--color:#b71c1c}.alert-warning{--background-color:#fff8e1;--color:rgb(204, 88.8, 0)}.alert-success{--background-color:#e8f5e9;--color:#1b5e20}.overlay{position:fixed;top:0;right:0;bottom:0;left:0;width:100vw;height:100vh;background:rgba(0,0,0,.4);backdrop-filter:blur(2px);display:-webkit-box;display:-ms-flexbox;display:flex;-webkit-box-align:center;-ms-flex-align:center;align-items:center;-webkit-box-pack:center;-ms-flex-pack:center;justify-content:center;z-index:9999}.overlay.hidden{display:none}.loader{width:3rem;height:3rem;border:.35rem solid rgba(255,255,255,.35);border-top-color:#fff;border-radius:50%;-webkit-animation:h-spin .8s linear infinite;animation:h-spin .8s linear infinite}.alert.notification{position:fixed;top:1rem;left:50%;-webkit-transform:translateX(-50%);transform:translateX(-50%);max-width:500px;width:calc(100% - 2rem);margin:0;z-index:10000;-webkit-box-shadow:0 4px 12px rgba(0,0,0,.15);box-shadow:0 4px 12px rgba(0,0,0,.15)}',""]),e.A=w},7331:function(o,e,t){"use strict";function r(o){return(e=t(o)).default||e;var e}r.e=function(){return!1},o.exports=r},7469:function(o,e,t){var r=t(8798),i=t(9451),n=t(9508);function a(o){r(this,o),this.___parentNode=null,this.___nextSiblingInternal=null}function c(o){this.___VNode(null),this.___out=o}c.prototype={___nodeType:11,___DocumentFragment:!0,___cloneNode:function(){return new a(this)},___actualize:function(o){return(o.ownerDocument||o).createDocumentFragment()}},i(c,n),a.prototype=c.prototype,o.exports=c},7521:function(o,e,t){var r=t(6764),i=t(3738),n=t(3084),a=t(1197),c=t(6222),s=c.___VElement,l=c.___VComment,p=c.___VDocumentFragment,d=c.___VText,u=c.___VComponent,b=c.___VFragment,m=c.___virtualizeHTML,h="update",f="finish";function v(o){this.___events=new r,this.___tree=o,this.___finished=!1}function _(o,e,t){var r;e||(e=new p),r=t?t.___state:new v(e),this.___remaining=1,this.___lastCount=0,this.___last=null,this.___parentOut=t,this.data={},this.___state=r,this.___parent=e,this.global=o||{},this.___stack=[e],this.___sync=!1,this.___vnode=void 0,this.___components=null,this.___assignedComponentDef=null,this.___assignedKey=null,this.___assignedCustomEvents=null}var g=_.prototype={___isOut:!0,___host:"object"==typeof document&&document,bc:function(o,e,t){var r=new u(o,e,t);return this.___beginNode(r,0,!0)},___preserveComponent:function(o,e,t){var r=new u(o,e,t,!0);this.___beginNode(r,0)},___beginNode:function(o,e,t){return this.___parent.___appendChild(o),!0===t&&(this.___stack.push(o),this.___parent=o),0===e?this:o},element:function(o,e,t,r,i,n,a){var c=new s(o,e,t,r,i,n,a);return this.___beginNode(c,i)},___elementDynamic:function(o,e,t,r,i){return this.element(o,n(e),t,r.___component,0,0,i)},n:function(o,e){var t=o.___cloneNode();return this.node(t),t.___ownerComponent=e,this},node:function(o){return this.___parent.___appendChild(o),this},text:function(o,e){var t=typeof o;if("string"!=t){if(null==o)return;if("object"===t&&o.toHTML)return this.h(o.toHTML(),e);o=o.toString()}return this.___parent.___appendChild(new d(o,e)),this},comment:function(o,e){return this.node(new l(o,e))},html:function(o,e){if(null!=o){var t=m(o,e);this.node(t)}return this},beginElement:function(o,e,t,r,i,n,a){var c=new s(o,e,t,r,i,n,a);return this.___beginNode(c,i,!0),this},___beginElementDynamic:function(o,e,t,r,i){return this.beginElement(o,n(e),t,r.___component,0,0,i)},bf:function(o,e,t){var r=new b(o,e,t);return this.___beginNode(r,null,!0),this},ef:function(){this.endElement()},endElement:function(){var o=this.___stack;o.pop(),this.___parent=o[o.length-1]},end:function(){this.___parent=void 0;var o=--this.___remaining,e=this.___parentOut;return 0===o?e?e.___handleChildDone():this.___doFinish():o-this.___lastCount===0&&this.___emitLast(),this},___handleChildDone:function(){var o=--this.___remaining;if(0===o){var e=this.___parentOut;e?e.___handleChildDone():this.___doFinish()}else o-this.___lastCount===0&&this.___emitLast()},___doFinish:function(){var o=this.___state;o.___finished=!0,o.___events.emit(f,this.___getResult())},___emitLast:function(){var o=this._last,e=0;!function t(){if(e!==o.length){var r=o[e++];r(t),r.length||t()}}()},error:function(o){try{this.emit("error",o)}finally{this.end()}return this},beginAsync:function(o){if(this.___sync)throw Error("Tried to render async while in sync mode. Note: Client side await is not currently supported in re-renders (Issue: #942).");var e=this.___state;o&&o.last&&this.___lastCount++,this.___remaining++;var t=this.___parent.___appendDocumentFragment(),r=new _(this.global,t,this);return e.___events.emit("beginAsync",{out:r,parentOut:this}),r},createOut:function(){return new _(this.global)},flush:function(){var o=this.___state.___events;o.listenerCount(h)&&o.emit(h,new i(this))},___getOutput:function(){return this.___state.___tree},___getResult:function(){return this.___result||(this.___result=new i(this))},on:function(o,e){var t=this.___state;return o===f&&t.___finished?e(this.___getResult()):"last"===o?this.onLast(e):t.___events.on(o,e),this},once:function(o,e){var t=this.___state;return o===f&&t.___finished?e(this.___getResult()):"last"===o?this.onLast(e):t.___events.once(o,e),this},emit:function(o,e){var t=this.___state.___events;switch(arguments.length){case 1:t.emit(o);break;case 2:t.emit(o,e);break;default:t.emit.apply(t,arguments)}return this},removeListener:function(){var o=this.___state.___events;return o.removeListener.apply(o,arguments),this},sync:function(){this.___sync=!0},isSync:function(){return this.___sync},onLast:function(o){var e=this._last;return void 0===e?this._last=[o]:e.push(o),this},___getNode:function(o){var e=this.___vnode;if(!e){var t=this.___getOutput();o||(o=this.___host),this.___vnode=e=t.___actualize(o,null),a(e,t,o,this.___components)}return e},toString:function(o){for(var e=this.___getNode(o),t="",r=e.firstChild;r;){var i=r.nextSibling;if(1!=r.nodeType){var n=e.ownerDocument.createElement("div");n.appendChild(r.cloneNode()),t+=n.innerHTML}else t+=r.outerHTML;r=i}return t},then:function(o,e){var t=this,r=new Promise(function(o,e){t.on("error",e).on(f,function(e){o(e)})});return Promise.resolve(r).then(o,e)},catch:function(o){return this.then(void 0,o)},isVDOM:!0,c:function(o,e,t){this.___assignedComponentDef=o,this.___assignedKey=e,this.___assignedCustomEvents=t}};g.e=g.element,g.be=g.beginElement,g.ee=g.___endElement=g.endElement,g.t=g.text,g.h=g.w=g.write=g.html,o.exports=_},7616:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%2876, 154.5, 137.5%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cpolyline points=%2720 6 9 17 4 12%27%3E%3C/polyline%3E%3C/svg%3E"},7639:function(o){var e=[];o.exports=function(o){return o||e}},7659:function(o){"use strict";var e={};o.exports=function(o,t){var r=function(o){if(void 0===e[o]){var t=document.querySelector(o);if(window.HTMLIFrameElement&&t instanceof window.HTMLIFrameElement)try{t=t.contentDocument.head}catch(o){t=null}e[o]=t}return e[o]}(o);if(!r)throw new Error("Couldn't find a style target. This probably means that the value for the 'insert' parameter is invalid.");r.appendChild(t)}},7785:function(o){o.exports=function(o,e){Object.getOwnPropertyNames(o).forEach(function(t){var r=Object.getOwnPropertyDescriptor(o,t);Object.defineProperty(e,t,r)})}},7825:function(o){"use strict";o.exports=function(o){if("undefined"==typeof document)return{update:function(){},remove:function(){}};var e=o.insertStyleElement(o);return{update:function(t){!function(o,e,t){var r="";t.supports&&(r+="@supports (".concat(t.supports,") {")),t.media&&(r+="@media ".concat(t.media," {"));var i=void 0!==t.layer;i&&(r+="@layer".concat(t.layer.length>0?" ".concat(t.layer):""," {")),r+=t.css,i&&(r+="}"),t.media&&(r+="}"),t.supports&&(r+="}");var n=t.sourceMap;n&&"undefined"!=typeof btoa&&(r+="\n/*# sourceMappingURL=data:application/json;base64,".concat(btoa(unescape(encodeURIComponent(JSON.stringify(n))))," */")),e.styleTagTransform(r,o,e.options)}(e,o,t)},remove:function(){!function(o){if(null===o.parentNode)return!1;o.parentNode.removeChild(o)}(e)}}}},8053:function(o,e,t){var r=t(3774),i=Array.isArray;function n(o,e,t){for(var r=o,i=0;i<t;i++)r=r[e[i]];return r}function a(o){if("Date"===o.type)return new Date(o.value);if("URL"===o.type)return new URL(o.value);if("URLSearchParams"===o.type)return new URLSearchParams(o.value);if("NOOP"===o.type)return r.NOOP;throw new Error("Bad type")}o.exports=function(o){if(!o)return o;var e=o.$;if(e){var t,r=o.o;if(e&&(t=e.length))for(var c=0;c<t;c++){var s,l=e[c],p=l.r;s=i(p)?n(r,p,p.length):a(p);var d=l.l,u=d.length-1;if(-1===u){r=o.o=s;break}n(r,d,u)[d[u]]=s}return e.length=0,null==r?null:r}return o}},8103:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg fill=%27none%27 height=%2724%27 width=%2724%27 viewBox=%270 0 24 24%27 xmlns=%27http://www.w3.org/2000/svg%27 %3E%3Cstyle%3E g %7B animation: rotate 2s linear infinite; transform-origin: center center; %7D circle %7B stroke-dasharray: 75,100; stroke-dashoffset: -5; animation: dash 1.5s ease-in-out infinite; stroke-linecap: round; %7D @keyframes rotate %7B 0%25 %7B transform: rotate%280deg%29; %7D 100%25 %7B transform: rotate%28360deg%29; %7D %7D @keyframes dash %7B 0%25 %7B stroke-dasharray: 1,100; stroke-dashoffset: 0; %7D 50%25 %7B stroke-dasharray: 44.5,100; stroke-dashoffset: -17.5; %7D 100%25 %7B stroke-dasharray: 44.5,100; stroke-dashoffset: -62; %7D %7D %3C/style%3E%3Cg%3E%3Ccircle cx=%2712%27 cy=%2712%27 r=%2710%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%274%27 /%3E%3C/g%3E%3C/svg%3E"},8170:function(o,e,t){"use strict";function r(o){this.path=this.___typeName=o}t(586),e.t=function(o){return new r(o)};var i=t(7521);t(5703).___setCreateOut(r.prototype.createOut=function(o,e,t){return new i(o,e,t)}),t(8831)(r.prototype)},8229:function(o,e,t){var r=t(8798),i=t(8820),n=i.___destroyComponentForNode,a=i.___destroyNodeRecursive,c=t(3448),s=c.___insertBefore,l=c.___insertAfter,p=c.___removeChild;function d(o){if("string"==typeof o){var e=o;if(!(o=document.getElementById(e)))throw Error("Not found: "+e)}return o}function u(o){a(o),n(o)}o.exports=function(o,e,t){r(o,{appendTo:function(o){o=d(o);var r=e(this,o);return s(r,null,o),t(this,o)},prependTo:function(o){o=d(o);var r=e(this,o);return s(r,o.firstChild||null,o),t(this,o)},replace:function(o){o=d(o);var r=e(this,o);return u(o),s(r,o,o.parentNode),p(o),t(this,o)},replaceChildrenOf:function(o){o=d(o);for(var r=e(this,o),i=o.firstChild;i;){var n=i.nextSibling;u(i),i=n}return o.innerHTML="",s(r,null,o),t(this,o)},insertBefore:function(o){o=d(o);var r=e(this,o);return s(r,o,o.parentNode),t(this,o)},insertAfter:function(o){o=d(o);var r=e(this,o);return l(r,o,o.parentNode),t(this,o)}})}},8288:function(o,e,t){var r=t(851).NOOP;e.a=r},8338:function(o,e,t){var r=t(862),i=t(9451),n=t(8820),a=t(5785).___vElementByDOMNode,c=t(9508),s=t(6125),l="xlink:href",p=/^xmlns(:|$)/,d=Object.prototype.hasOwnProperty,u="http://www.w3.org/1999/xlink",b="http://www.w3.org/1999/xhtml",m={svg:"http://www.w3.org/2000/svg",math:"http://www.w3.org/1998/Math/MathML"},h="href",f=Object.freeze(Object.create(null)),v={option:{selected:function(o,e){o.selected=void 0!==e}},input:{value:function(o,e){o.value=void 0===e?"":e},checked:function(o,e){o.checked=void 0!==e}}};function _(o){if(!0===o)return"";if(null!=o&&!1!==o){switch(typeof o){case"string":return o;case"object":switch(o.toString){case Object.prototype.toString:case Array.prototype.toString:return r("Relying on JSON.stringify for attribute values is deprecated, in future versions of Marko these will be cast to strings instead."),JSON.stringify(o);case RegExp.prototype.toString:return o.source}}return o+""}}function g(o,e){for(var t in e)d.call(e,t)&&(o[t]=e[t])}function y(o){this.___firstChildInternal=o.___firstChildInternal,this.___parentNode=null,this.___nextSiblingInternal=null,this.___key=o.___key,this.___attributes=o.___attributes,this.___properties=o.___properties,this.___nodeName=o.___nodeName,this.___flags=o.___flags,this.___textContent=o.___textContent,this.___constId=o.___constId}function w(o,e,t,r,i,n,a){var c;this.___VNode(i,r),a&&(c=a.i),this.___key=t,this.___flags=n||0,this.___attributes=e||f,this.___properties=a||f,this.___nodeName=o,this.___textContent="",this.___constId=c,this.___preserve=!1,this.___preserveBody=!1}w.prototype={___nodeType:1,___cloneNode:function(){return new y(this)},e:function(o,e,t,r,i,n,a){var c=this.___appendChild(new w(o,e,t,r,i,n,a));return 0===i?this.___finishChild():c},n:function(o,e){return(o=o.___cloneNode()).___ownerComponent=e,this.___appendChild(o),this.___finishChild()},___actualize:function(o,e){var t=this.___nodeName,r=this.___attributes,i=m[t]||e||b,n=this.___flags,c=(o.ownerDocument||o).createElementNS(i,t);if(2&n)g(c,r);else{for(var p in r){var d=_(r[p]);void 0!==d&&(p==l?c.setAttributeNS(u,h,d):c.setAttribute(p,d))}s(t)&&(c.textContent=this.___textContent)}return a.set(c,this),c}},i(w,c),y.prototype=w.prototype,w.___virtualize=function(o,e,t){var r=o.attributes,i=r.length,a=null,c=null;if(i){a={};for(var d=0;d<i;d++){var m=r[d],h=m.name;p.test(h)||("data-marko"===h?c=n.___getMarkoPropsFromEl(o):m.namespaceURI===u?a[l]=m.value:a[h]=m.value)}}var f=o.nodeName;o.namespaceURI===b&&(f=f.toLowerCase());var v=new w(f,a,null,t,0,0,c);return s(f)?v.___textContent=o.textContent:e&&e(o,v,t),v},w.___morphAttrs=function(o,e,t){var r=e.___flags,i=t.___flags,n=t.___attributes;if(2&i)return g(o,n);var a,c=t.___properties,s=e.___attributes;if(s!==n){var p;if(1&i&&1&r)return s.class!==(p=n.class)&&(p?o.className=p:o.removeAttribute("class")),s.id!==(p=n.id)&&(p?o.id=p:o.removeAttribute("id")),void(s.style!==(p=n.style)&&(p?o.style.cssText=p:o.removeAttribute("style")));var d,b=c&&c.pa||f,m=v[t.___nodeName]||f;for(a in n)b[a]||(p=_(n[a]),(d=m[a])?d(o,p):_(s[a])!==p&&(a===l?void 0===p?o.removeAttributeNS(u,h):o.setAttributeNS(u,h,p):void 0===p?o.removeAttribute(a):o.setAttribute(a,p)));if(null===t.___key||4&r)for(a in s)a in n||((d=m[a])?d(o,void 0):a===l?o.removeAttributeNS(l,h):o.removeAttribute(a))}},o.exports=w},8798:function(o){o.exports=function(o,e){if(o||(o={}),e)for(var t in e)e.hasOwnProperty(t)&&(o[t]=e[t]);return o}},8820:function(o,e,t){var r=t(5785),i=r.___componentByDOMNode,n=r.___keyByDOMNode,a=r.___vElementByDOMNode,c=r.___vPropsByDOMNode,s=window.$MUID||(window.$MUID={i:0}),l=s.i++,p={},d={};function u(o){var e=i.get(o.fragment||o);e&&(e.___destroyShallow(),delete p[e.id])}function b(){return"c"+s.i++}e.___runtimeId=l,e.___componentLookup=p,e.___getComponentForEl=function(o,e){for(var t,r,n="string"==typeof o?((e?e.ownerDocument:e)||document).getElementById(o):o;n;){if(n.fragment?n.fragment.endNode===n?n=n.fragment.startNode:(n=n.fragment,t=i.get(n)):(r=a.get(n))&&(t=r.___ownerComponent),t)return t;n=n.previousSibling||n.parentNode}},e.___destroyComponentForNode=u,e.___destroyNodeRecursive=function o(e,t){if(u(e),1===e.nodeType||12===e.nodeType){var r;t&&(r=n.get(e))&&e===t.___keyedElements[r]&&(i.get(e)&&/\[\]$/.test(r)?delete t.___keyedElements[r][i.get(e).id]:delete t.___keyedElements[r]);for(var a=e.firstChild;a&&a!==e.endNode;)o(a,t),a=a.nextSibling}},e.___nextComponentIdProvider=function(){return b},e.___attachBubblingEvent=function(o,e,t,r){if(e){var i=o.id;return r?[e,i,t,r]:[e,i,t]}},e.___getMarkoPropsFromEl=function(o){var e,t=a.get(o);return t?e=t.___properties:(e=c.get(o))||(e=o.getAttribute("data-marko"),c.set(o,e=e?JSON.parse(e):d)),e},e.___addComponentRootToKeyedElements=function(o,e,t,r){/\[\]$/.test(e)?(o[e]=o[e]||{})[r]=t:o[e]=t},e.___normalizeComponentKey=function(o,e){return"#"===o[0]&&(o=o.replace("#"+e+"-","")),o}},8831:function(o,e,t){"use strict";var r=t(8798),i=t(3503).x,n=t(5703);function a(o,e,t,r){try{o(e,t),r&&t.end()}catch(o){var n=t.end;t.end=function(){},i(function(){t.end=n,t.error(o)})}return t}o.exports=function(o,e){var t=e&&(e.renderer||e.render||e),i=o.createOut||e.createOut||n;return r(o,{_:t,createOut:i,renderToString:function(o,e){var r=o||{},n=t||this._,c=r.$global,s=i(c);return s.global.template=this,c&&(r.$global=void 0),e?(s.on("finish",function(){e(null,s.toString(),s)}).once("error",e),a(n,r,s,!0)):(s.sync(),n(r,s),s.toString())},renderSync:function(o){var e=o||{},r=t||this._,n=e.$global,a=i(n);return a.sync(),a.global.template=this,n&&(e.$global=void 0),r(e,a),a.___getResult()},mount:function(o,e,t){const r=this.renderSync(o);switch(t){case"afterbegin":r.prependTo(e);break;case"afterend":r.insertAfter(e);break;case"beforebegin":r.insertBefore(e);break;default:r.appendTo(e)}const i=r.getComponent();return{update(o){i.input=o,i.update()},destroy(){i.destroy()}}},render:function(o,e){var n,c,s,l,p=t||this._,d=this.___shouldBuffer,u=!0;return o?(s=o,(l=o.$global)&&(s.$global=void 0)):s={},e&&e.___isOut?(c=e,u=!1,r(e.global,l)):"function"==typeof e?(c=i(l),n=e):c=i(l,e,void 0,d),n&&c.on("finish",function(){n(null,c.___getResult(),c)}).once("error",n),(l=c.global).template=l.template||this,a(p,s,c,u)}})}},8899:function(o,e,t){var r=t(8820),i=r.___runtimeId,n=r.___componentLookup,a=r.___getMarkoPropsFromEl,c="$MDE"+i,s={};function l(o,e){var t=a(o)[e];return"string"==typeof t&&((t=t.split(" "))[2]&&(t[2]="true"===t[2]),4==t.length&&(t[3]=parseInt(t[3],10))),t}function p(o,e,t,r){var i=t[0],c=t[1],s=t[2],l=t[3];s&&delete a(o)[e];var p=n[c];if(p){var d="function"==typeof i?i:p[i];if(!d)throw Error("Method not found: "+i);null!=l&&"number"==typeof l&&(l=p.___bubblingDomEvents[l]),l?d.apply(p,l.concat(r,o)):d.call(p,r,o)}}function d(){}e.___handleNodeAttach=d,e.___handleNodeDetach=d,e.___delegateEvent=p,e.___getEventFromEl=l,e.___addDelegatedEventHandler=function(o){s[o]||(s[o]=!0)},e.___init=function(o){Object.keys(s).forEach(function(e){!function(o,e){var t=e[c]=e[c]||{};t[o]||(e.body||e).addEventListener(o,t[o]=function(e){var t=e.target;if(t){t=t.correspondingUseElement||(3===t.nodeType?t.parentNode:t);var r,i="on"+o;if(e.bubbles){var n=!1,a=e.stopPropagation;e.stopPropagation=function(){a.call(e),n=!0};do{if((r=l(t,i))&&(p(t,i,r,e),n))break}while((t=t.parentNode)&&t.getAttribute)}else(r=l(t,i))&&p(t,i,r,e)}},!0)}(e,o)})}},9008:function(o,e,t){var r=t(6968);o.exports=function(o,e,t,i){var n=e.id,a=o.___componentDef=new r(e,n,o);return o.___globalContext.___renderedComponentsById[n]=!0,o.___components.push(a),o.___out.bc(e,t,i&&i.___component),a}},9307:function(o,e){var t="destroy";function r(o){return!o.once}function i(o){this.$__target=o,this.$__listeners=[],this.$__subscribeTo=null}function n(o){this.$__target=o}function a(){this.$__subscribeToList=[]}i.prototype={$__remove:function(o,e){var t=this.$__target,r=this.$__listeners;this.$__listeners=r.filter(function(r){var i=r[0],n=r[1],a=r[2];if(e){if(a&&o(i,a))return t.removeListener(i,a),!1}else if(o(i,n))return t.removeListener(i,a||n),!1;return!0});var i=this.$__subscribeTo;if(!this.$__listeners.length&&i){var n=this,a=i.$__subscribeToList;i.$__subscribeToList=a.filter(function(o){return o!==n})}},on:function(o,e){return this.$__target.on(o,e),this.$__listeners.push([o,e]),this},once:function(o,e){var t=this,r=function(){t.$__remove(function(o,e){return r===e},!0),e.apply(this,arguments)};return this.$__target.once(o,r),this.$__listeners.push([o,e,r]),this},removeListener:function(o,e){return"function"==typeof o&&(e=o,o=null),e&&o?this.$__remove(function(t,r){return o===t&&e===r}):e?this.$__remove(function(o,t){return e===t}):o&&this.removeAllListeners(o),this},removeAllListeners:function(o){var e=this.$__listeners,t=this.$__target;if(o)this.$__remove(function(e,t){return o===e});else{for(var r=e.length-1;r>=0;r--){var i=e[r];t.removeListener(i[0],i[1])}this.$__listeners.length=0}return this}},n.prototype={on:function(o,e){return this.$__target.addEventListener(o,e),this},once:function(o,e){var t=this,r=function(){t.$__target.removeEventListener(o,r),e()};return this.$__target.addEventListener(o,r),this},removeListener:function(o,e){return this.$__target.removeEventListener(o,e),this}},a.prototype={subscribeTo:function(o,e){for(var a,c,s=!e||!1!==e.addDestroyListener,l=this.$__subscribeToList,p=0,d=l.length;p<d;p++){var u=l[p];if(u.$__target===o){a=u;break}}return a||(r(o)&&(c=new n(o)),a=new i(c||o),s&&!c&&a.once(t,function(){a.removeAllListeners();for(var e=l.length-1;e>=0;e--)if(l[e].$__target===o){l.splice(e,1);break}}),a.$__subscribeTo=this,l.push(a)),a},removeAllListeners:function(o,e){var t,r=this.$__subscribeToList;if(o)for(t=r.length-1;t>=0;t--){var i=r[t];if(i.$__target===o){i.removeAllListeners(e),i.$__listeners.length||r.splice(t,1);break}}else{for(t=r.length-1;t>=0;t--)r[t].removeAllListeners();r.length=0}}},(e=o.exports=a).wrap=function(o){var e,a;return r(o)&&(e=new n(o)),a=new i(e||o),e||o.once(t,function(){a.$__listeners.length=0}),a},e.createTracker=function(){return new a}},9451:function(o,e,t){var r=t(7785);function i(o,e,t){var i=o.prototype,n=o.prototype=Object.create(e.prototype,{constructor:{value:o,writable:!0,configurable:!0}});return i&&!1!==t&&r(i,n),o.$super=e,o.prototype=n,o}o.exports=i,i._inherit=i},9460:function(o,e,t){var r=t(9451),i=t(5785),n=i.___keyByDOMNode,a=i.___vElementByDOMNode,c=t(7041).___createFragmentNode,s=t(9508);function l(o,e,t){this.___VNode(null,e),this.___key=o,this.___preserve=t}l.prototype={___nodeType:12,___actualize:function(){var o=c();return n.set(o,this.___key),a.set(o,this),o}},r(l,s),o.exports=l},9508:function(o,e,t){var r=t(6125);function i(){}i.prototype={___VNode:function(o,e){this.___finalChildCount=o,this.___childCount=0,this.___firstChildInternal=null,this.___lastChild=null,this.___parentNode=null,this.___nextSiblingInternal=null,this.___ownerComponent=e},get ___firstChild(){var o=this.___firstChildInternal;return o&&o.___DocumentFragment?o.___firstChild||o.___nextSibling:o},get ___nextSibling(){var o=this.___nextSiblingInternal;if(o){if(o.___DocumentFragment)return o.___firstChild||o.___nextSibling}else{var e=this.___parentNode;if(e&&e.___DocumentFragment)return e.___nextSibling}return o},___appendChild:function(o){if(this.___childCount++,r(this.___nodeName)){if(!o.___Text)throw TypeError();this.___textContent+=o.___nodeValue}else{var e=this.___lastChild;o.___parentNode=this,e?e.___nextSiblingInternal=o:this.___firstChildInternal=o,this.___lastChild=o}return o},___finishChild:function(){return this.___childCount===this.___finalChildCount&&this.___parentNode?this.___parentNode.___finishChild():this}},o.exports=i},9589:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%273%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cline x1=%2718%27 y1=%276%27 x2=%276%27 y2=%2718%27%3E%3C/line%3E%3Cline x1=%276%27 y1=%276%27 x2=%2718%27 y2=%2718%27%3E%3C/line%3E%3C/svg%3E"},9684:function(o){"use strict";o.exports=function(o){o.ee()}},9836:function(o,e,t){"use strict";var r=t(4585);o.exports=function o(e){if(e){var t=typeof e;if("string"!==t){var i="",n="";if(Array.isArray(e))for(var a=0,c=e.length;a<c;a++){var s=o(e[a]);s&&(i+=n+s,n=";")}else if("object"===t)for(var l in e){var p=e[l];null!=p&&!1!==p&&("number"==typeof p&&p&&(p+="px"),i+=n+r.___camelToDashCase(l)+":"+p,n=";")}return i||void 0}return e}}},9871:function(o,e,t){var r=t(862),i=t(3503).x,n=t(7098),a=t(5998),c=t(8899),s=t(7041).___createFragmentNode,l=t(6968),p=t(5785),d=t(8820),u=t(7331),b=d.___componentLookup,m=d.___addComponentRootToKeyedElements,h=p.___keyByDOMNode,f=p.___ssrKeyedElementsByComponentId,v=p.___componentByDOMNode,_={},g={},y=window;y.Marko={Component:function(){}};var w,k,x={},C={},N={};function E(o,t){var i=N[o];if(i)return i;i=function(o,t){var i=C[o];if(!i){if((i=x[o])?i=i():t?i=e.___legacy.load(o):(i=u(o),r("Looks like you used `require:` in your browser.json to load a component.  This requires that Marko has knowledge of how lasso generates paths and will be removed in a future version.  `marko-dependencies:/path/to/template.marko` should be used instead.")),!i)throw Error("Component not found: "+o);C[o]=i}return i}(o,t),(i=i.Component||i).___isComponent||(i=a(i,i.renderer)),i.prototype.___type=o;var n=/\/([^/]+?)(?:\/index|\/template|)(?:\.marko|\.component(?:-browser)?|)$/.exec(o),c=n?n[1]:"AnonymousComponent";c=(c=(c=c.replace(/-(.)/g,function(o){return o[1].toUpperCase()})).replace(/\$\d+\.\d+\.\d+$/,"").replace(/^[^a-z$_]/i,"_[[bundle]]").replace(/[^0-9a-z$_]+/gi,"_"))[0].toUpperCase()+c.slice(1);var s=i;return(i={[c]:function(o,e){s.call(this,o,e)}}[c]).prototype=s.prototype,N[o]=i,i}function L(o,e,t){var r,i,n,a,l,p=e.length;for(t=t||[],o=o.firstChild;o;){if(l=o.nextSibling,8===o.nodeType){var u=o.nodeValue;if(u.slice(0,p)===e){var v=u[p];if("^"===v||"#"===v)t.push(o);else if("/"===v){var g,y=o,w=t.pop();if(g=w.parentNode===y.parentNode?s(w.nextSibling,y):s(y.parentNode.firstChild,y),r=w.nodeValue.substring(p+1),"^"===(v=w.nodeValue[p])){var k=r.split(/ /g),x=k[2];i=k[1],r=k[0],a=(n=b[i])?n.___keyedElements:f[i]||(f[i]={}),m(a,x,g,r)}_[r]=g,w.parentNode.removeChild(w),y.parentNode.removeChild(y)}}}else if(1===o.nodeType){var C=o.getAttribute("data-marko-key"),N=d.___getMarkoPropsFromEl(o);if(C){var E=C.indexOf(" ");i=C.substring(E+1),C=C.substring(0,E),a=(n=b[i])?n.___keyedElements:f[i]||(f[i]={}),h.set(o,C),a[C]=o}N&&Object.keys(N).forEach(function(o){"on"===o.slice(0,2)&&c.___addDelegatedEventHandler(o.slice(2))}),L(o,e,t)}o=l}}function S(o,e,t,r,i,n,a){var c=function(o,e,t,r){var i=r;return t&&(i=function(t){r(t),o.removeEventListener(e,i)}),o.addEventListener(e,i,!1),function(){o.removeEventListener(e,i)}}(e,t,i,function(t){var i=[t,e];n&&(i=n.concat(i)),function(o,e,t){var r=o[e];if(!r)throw Error("Method not found: "+e);r.apply(o,t)}(o,r,i)});a.push(c)}function M(o,e){var t=o.___component;if(t&&t.___isComponent){t.___reset(),t.___host=e,o.___isExisting&&t.___removeDOMEventListeners();var r=o.___domEvents;if(r){var i=[];r.forEach(function(o){var e=o[0],r=o[1],n=t.___keyedElements[o[2]],a=o[3],c=o[4];S(t,n,e,r,a,c,i)}),i.length&&(t.___domEventListenerHandles=i)}t.___mounted?t.___emitUpdate():(t.___mounted=!0,t.___emitMount())}}function z(o,t,r,i){var n=l.___deserialize(o,t.___types,t.___globals,e),a=D(n,r);return a||(w?w.push(n):(w=[n],document.addEventListener("DOMContentLoaded",function(){L(r,i),w.map(function(o){return D(o,r)}).reverse().forEach(O),w.length=0}))),a}function D(o,e){var t,r=o.id,i=o.___component,n=_[r];if(n)return delete _[r],i.___rootNode=n,v.set(n,i),1&o.___flags?(i.___host=e,t=i.___rerender(i.___input,!0),j(o),function(){t.afterInsert(e)}):(j(o),function(){M(o,e)})}function j(o){var e=o.___component;e&&(b[e.id]=e)}function O(o){o&&o()}e.r=function(o,e){var t;return k&&(t=k[o]),x[o]=e,delete C[o],delete N[o],t&&(delete k[o],i(function(){t.forEach(function(o){z(o[0],o[1],o[2],o[3])()})})),o},e.___createComponent=function(o,e,t){return new(E(o,t))(e)},e.___getComponentClass=E,e.___initServerRendered=y.$initComponents=function o(e,t){var i,a=typeof e,s="$";if("object"!==a){s+="string"===a?(i=e)+"_C":(i="M")+"C",(e=y[s])&&void 0!==e.i&&e.i!==d.___runtimeId&&console.warn("Multiple instances of Marko have attached to the same runtime id. This could mean that more than one copy of Marko is loaded on the page, or that the script containing Marko has executed more than once.");var l=y[s]={r:i,concat:o};return l.i=d.___runtimeId,e&&e.forEach&&e.forEach(function(o){l.concat(o)}),l}var p=this.concat===o;e=n(e),p?(i=this.r,t=document):(i=e.r||"M",t||(t=document),r("Passing serialized data to `require('marko/components).init` is deprecated. Instead set '$global.runtimeId' and provide the 'runtimeId' option to your Marko bundler plugin.")),t!==document&&r("Passing a document other than the current document to `require('marko/components).init` is deprecated.");var b=e.p||"s",m=g[b],h=e.l;return m?h&&delete g[b]:(m={},h||(g[b]=m)),L(t,i),c.___init(t),m.___globals||(m.___globals=Object.assign({renderId:b,runtimeId:i,componentIdPrefix:b},e.g)),e.t&&(m.___types=m.___types?m.___types.concat(e.t):e.t),(e.w||[]).map(function(o){var e=m.___types[o[1]];return x[e]||u.e(e)?z(o,m,t,i):function(o,e,t,r,i){k||(k={}),(k[e]=k[e]||[]).push([o,t,r,i])}(o,e,m,t,i)}).reverse().forEach(O),this},t(4515).___initClientRendered=function(o,e){e||(e=document),c.___init(e);var t,r=o.length;for(t=r;t--;)j(o[t]);for(t=r;t--;)M(o[t],e)}},9927:function(o){"use strict";o.exports="data:image/svg+xml,%3Csvg xmlns=%27http://www.w3.org/2000/svg%27 width=%2724%27 height=%2724%27 viewBox=%270 0 24 24%27 fill=%27none%27 stroke=%27rgb%28136, 145, 164%29%27 stroke-width=%272%27 stroke-linecap=%27round%27 stroke-linejoin=%27round%27%3E%3Cpolyline points=%276 9 12 15 18 9%27%3E%3C/polyline%3E%3C/svg%3E"}},e={};function t(r){var i=e[r];if(void 0!==i)return i.exports;var n=e[r]={id:r,exports:{}};return o[r].call(n.exports,n,n.exports,t),n.exports}t.m=o,t.n=function(o){var e=o&&o.__esModule?function(){return o.default}:function(){return o};return t.d(e,{a:e}),e},t.d=function(o,e){for(var r in e)t.o(e,r)&&!t.o(o,r)&&Object.defineProperty(o,r,{enumerable:!0,get:e[r]})},t.o=function(o,e){return Object.prototype.hasOwnProperty.call(o,e)},t.b=document&&document.baseURI||self.location.href,t.nc=void 0;!function(){"use strict";var o=t(8170),e=t(5072),r=t.n(e),i=t(7825),n=t.n(i),a=t(7659),c=t.n(a),s=t(5056),l=t.n(s),p=t(540),d=t.n(p),u=t(1113),b=t.n(u),m=t(7167),h={};h.styleTagTransform=b(),h.setAttributes=l(),h.insert=c().bind(null,"head"),h.domAPI=n(),h.insertStyleElement=d();r()(m.A,h),m.A&&m.A.locals&&m.A.locals;var f=t(7639),v=t.n(f);function _(o,e,t,r,i,n,a){try{var c=o[n](a),s=c.value}catch(o){return void t(o)}c.done?e(s):Promise.resolve(s).then(r,i)}function g(o){return function(){var e=this,t=arguments;return new Promise(function(r,i){var n=o.apply(e,t);function a(o){_(n,r,i,a,c,"next",o)}function c(o){_(n,r,i,a,c,"throw",o)}a(void 0)})}}function y(o){return y="function"==typeof Symbol&&"symbol"==typeof Symbol.iterator?function(o){return typeof o}:function(o){return o&&"function"==typeof Symbol&&o.constructor===Symbol&&o!==Symbol.prototype?"symbol":typeof o},y(o)}function w(o){var e=function(o,e){if("object"!=y(o)||!o)return o;var t=o[Symbol.toPrimitive];if(void 0!==t){var r=t.call(o,e||"default");if("object"!=y(r))return r;throw new TypeError("@@toPrimitive must return a primitive value.")}return("string"===e?String:Number)(o)}(o,"string");return"symbol"==y(e)?e:e+""}function k(o,e,t){return(e=w(e))in o?Object.defineProperty(o,e,{value:t,enumerable:!0,configurable:!0,writable:!0}):o[e]=t,o}function x(o,e){var t=Object.keys(o);if(Object.getOwnPropertySymbols){var r=Object.getOwnPropertySymbols(o);e&&(r=r.filter(function(e){return Object.getOwnPropertyDescriptor(o,e).enumerable})),t.push.apply(t,r)}return t}function C(o){for(var e=1;e<arguments.length;e++){var t=null!=arguments[e]?arguments[e]:{};e%2?x(Object(t),!0).forEach(function(e){k(o,e,t[e])}):Object.getOwnPropertyDescriptors?Object.defineProperties(o,Object.getOwnPropertyDescriptors(t)):x(Object(t)).forEach(function(e){Object.defineProperty(o,e,Object.getOwnPropertyDescriptor(t,e))})}return o}var N=t(3757),E=t.n(N),L=t(1677),S=t(5998),M=t.n(S);const z="src/hs-main/index.marko",D=(0,o.t)(z);var j=D;(0,L.r)(z,()=>D);const O=class{onCreate(){this.state={ready:!1,error:!1,status:{},settings:{},settingsDialogError:!1,loading:!1,confirmationData:!1},this.bauds=[9600,300,1200,2400,4800,19200,38400,57600,115200],this.baseURL="/"}fetchWithTimeout(o,e={},t=1e4){const r=new AbortController,i=setTimeout(()=>r.abort(),t);return fetch(o,C(C({},e),{},{signal:r.signal})).finally(()=>clearTimeout(i))}loadStatusAndSettings(){var o=this;return g(function*(){const e=yield o.fetchWithTimeout(`${o.baseURL}api/get/status`);if(!e.ok)throw new Error(`HTTP error, status: ${e.status}`);const t=yield e.json();o.setState("status",t);const r=yield o.fetchWithTimeout(`${o.baseURL}api/get/settings`);if(!r.ok)throw new Error(`HTTP error, status: ${r.status}`);const i=yield r.json();o.setState("settings",i)})()}showNotification(o,e="alert-success"){this._notifCounter||(this._notifCounter=0);const t="notification-"+ ++this._notifCounter,r=document.createElement("div");r.id=t,r.className=`alert notification ${e}`,r.textContent=o,r.style.transition="top 180ms ease, opacity 180ms ease",r.style.opacity="0",document.body.appendChild(r),requestAnimationFrame(()=>{this._reflowNotifications(),r.style.opacity="1"});setTimeout(()=>{r.style.opacity="0";const o=e=>{"opacity"===e.propertyName&&(r.removeEventListener("transitionend",o),r.parentNode&&(r.parentNode.removeChild(r),requestAnimationFrame(()=>this._reflowNotifications())))};r.addEventListener("transitionend",o)},2e3)}_reflowNotifications(){const o=Array.from(document.querySelectorAll(".alert.notification"));if(!o.length)return;if(null==this._notifBaseTop){const e=getComputedStyle(o[0]);this._notifBaseTop=parseFloat(e.top)||16}let e=this._notifBaseTop;o.forEach(o=>{o.style.top=e+"px",e+=o.offsetHeight+8})}onMount(){var o=this;return g(function*(){try{yield o.loadStatusAndSettings()}catch(e){const t="AbortError"===e.name?"Request timed out (10s)":`Could not retrieve data: ${e.message}`;o.setState("error",t)}o.setState("ready",!0)})()}onCommandButtonClick(o){var e=this;return g(function*(){if(!o.target.closest("[data-id]"))return;o.preventDefault();const{id:t}=o.target.closest("[data-id]").dataset;switch(t){case"settings":const o=document.getElementById("settingsDialog");o&&!o.hasAttribute("open")&&o.setAttribute("open","");const{ssid:t="",password:r="",serialSpeed:i="",tcpServerPort:n="",busyMsg:a="",ipType:c="d",staticIp:s="",staticMask:l="",staticGateway:d="",staticDns:u=""}=e.state.settings||{},p=o=>"0.0.0.0"===o?"":o,h={s_ssid:t,s_password:r,s_serialSpeed:i,s_tcpServerPort:n,s_busyMsg:a,s_ipType:"s"===c?"s":"d",s_staticIp:p(s),s_staticMask:p(l),s_staticGateway:p(d),s_staticDns:p(u)};let f=null;for(const[o,e]of Object.entries(h)){const t=document.getElementById(o);t&&(t.value=null!=e?e:"",f||(f=t))}e.onIpTypeChange(),f&&f.focus();break;case"reboot":e.setState("confirmationData",{message:"Are you sure you want to reboot the ESP Modem?",action:"reboot"});break;case"hangup":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/ath`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Hang up successful"),e.loadStatusAndSettings()}catch(o){e.showNotification("Could not hang up","alert-danger")}finally{e.setState("loading",!1)}break;case"update":e.setState("confirmationData",{message:"Are you sure you want to update your ESP firmware?",action:"update"});break;case"factory":e.setState("confirmationData",{message:"Are you sure you want to reset your ESP to factory defaults? All settings will be lost.",action:"factory"});break;case"eepsave":e.setState("confirmationData",{message:"Are you sure you want to save your current settings to EEPROM?",action:"eepsave"});break;case"eepload":e.setState("confirmationData",{message:"Are you sure you want to load settings to EEPROM? Your current settings will be lost.",action:"eepload"})}})()}onIpTypeChange(){const o=document.getElementById("s_ipType"),e=o&&"s"===o.value;["s_staticIp","s_staticMask","s_staticGateway","s_staticDns"].forEach(o=>{const t=document.getElementById(o);t&&(t.disabled=!e)})}onSettingsDialogCancel(){const o=document.getElementById("settingsDialog");o&&o.hasAttribute("open")&&o.removeAttribute("open")}onSettingsDialogSave(o){var e=this;o.preventDefault();const t=document.getElementById("settingsDialog");t&&t.querySelectorAll("input, select").forEach(o=>o.setAttribute("aria-invalid","false"));const r=o=>document.getElementById(o),i={ssid:r("s_ssid").value.trim(),password:r("s_password").value,serialSpeed:parseInt(r("s_serialSpeed").value,10),tcpServerPort:Number(r("s_tcpServerPort").value),busyMsg:r("s_busyMsg").value.trim(),ipType:r("s_ipType").value,staticIp:r("s_staticIp").value.trim(),staticMask:r("s_staticMask").value.trim(),staticGateway:r("s_staticGateway").value.trim(),staticDns:r("s_staticDns").value.trim()};if(!i.ssid)return void r("s_ssid").setAttribute("aria-invalid","true");if(!i.password)return void r("s_password").setAttribute("aria-invalid","true");if(!Number.isInteger(i.tcpServerPort)||i.tcpServerPort<1||i.tcpServerPort>65535)return void r("s_tcpServerPort").setAttribute("aria-invalid","true");if(!i.busyMsg)return void r("s_busyMsg").setAttribute("aria-invalid","true");if("s"===i.ipType){const o=o=>/^(\d{1,3})\.(\d{1,3})\.(\d{1,3})\.(\d{1,3})$/.test(o)&&o.split(".").every(o=>Number(o)<=255);for(const e of["staticIp","staticMask","staticGateway"])if(!o(i[e])||"0.0.0.0"===i[e])return void r(`s_${e}`).setAttribute("aria-invalid","true");if(i.staticDns&&!o(i.staticDns))return void r("s_staticDns").setAttribute("aria-invalid","true")}const n=new URLSearchParams;Object.entries(i).forEach(([o,e])=>n.append(o,e)),this.setState("loading",!0),this.setState("settingsDialogError",!1),g(function*(){try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/save/settings`,{method:"POST",mode:"cors",headers:{Accept:"application/json"},body:JSON.stringify(i)});if(!o.ok)throw new Error(`HTTP error ${o.status}`);yield e.loadStatusAndSettings(),e.onSettingsDialogCancel(),e.showNotification("Settings updated")}catch(o){e.setState("settingsDialogError",o.message||"Unknown error")}finally{e.setState("loading",!1)}})()}onConfirmationDialogCancel(){this.setState("confirmationData",!1)}onConfirmationDialogConfirm(o){var e=this;return g(function*(){if(!o.target.closest("[data-id]"))return;o.preventDefault(),e.onConfirmationDialogCancel();const{id:t}=o.target.closest("[data-id]").dataset;switch(t){case"reboot":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/reboot`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Device is rebooting")}catch(o){e.showNotification("Could not restart","alert-danger")}finally{e.setState("loading",!1)}break;case"update":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/update`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Device is updating")}catch(o){e.showNotification("Could not update","alert-danger")}finally{e.setState("loading",!1)}break;case"eepsave":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/eeprom/save`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Settings are saved")}catch(o){e.showNotification("Could not save settings","alert-danger")}finally{e.setState("loading",!1)}break;case"eepload":e.setState("loading",!0);try{const o=yield e.fetchWithTimeout(`${e.baseURL}api/commands/eeprom/load`,{method:"GET"});if(!o.ok)throw new Error(`HTTP error ${o.status}`);e.showNotification("Settings are loaded")}catch(o){e.showNotification("Could not load settings","alert-danger")}finally{e.setState("loading",!1)}}})()}};D._=E()(function(o,e,t,r,i,n){e.be("main",{class:"container"},"0",r,null,1),e.be("a",{href:"/"},"1",r,null,0),e.e("img",{src:"data:image/svg+xml;base64,PD94bWwgdmVyc2lvbj0iMS4wIiBlbmNvZGluZz0iVVRGLTgiPz48c3ZnIGlkPSJhIiB4bWxucz0iaHR0cDovL3d3dy53My5vcmcvMjAwMC9zdmciIHZpZXdCb3g9IjAgMCA0MzUuNSA2MS41Ij48ZGVmcz48c3R5bGU+LmJ7ZmlsbDojMzkzRTQ2O30uY3tpc29sYXRpb246aXNvbGF0ZTt9PC9zdHlsZT48L2RlZnM+PGcgY2xhc3M9ImMiPjxnIGNsYXNzPSJjIj48cGF0aCBjbGFzcz0iYiIgZD0iTTIsNy41aDUyLjVjMi4yLDAsNC4xNy40LDUuOSwxLjIsMS43My44LDMuMiwxLjg2LDQuNCwzLjE3LDEuMiwxLjMyLDIuMTIsMi44MSwyLjc1LDQuNDcuNjMsMS42Ny45NSwzLjM4Ljk1LDUuMTVzLS4zMiwzLjQ0LS45NSw1LjEyYy0uNjMsMS42OC0xLjU1LDMuMTgtMi43NSw0LjUtMS4yLDEuMzItMi42NywyLjM4LTQuNCwzLjE3LTEuNzMuOC0zLjcsMS4yLTUuOSwxLjJIMTcuOHY3SDJWNy41Wk0xNy44LDE5LjV2NGgzMi43YzEuNDcsMCwyLjItLjY3LDIuMi0ycy0uNzMtMi0yLjItMkgxNy44WiIvPjxwYXRoIGNsYXNzPSJiIiBkPSJNNzMsNy41aDUyLjVjMi4yLDAsNC4xNy40LDUuOSwxLjIsMS43My44LDMuMiwxLjg2LDQuNCwzLjE3LDEuMiwxLjMyLDIuMTIsMi44MSwyLjc1LDQuNDcuNjMsMS42Ny45NSwzLjM4Ljk1LDUuMTUsMCwxLjUtLjI0LDIuOTgtLjczLDQuNDUtLjQ4LDEuNDctMS4xOCwyLjgyLTIuMSw0LjA1LS45MiwxLjIzLTIuMDMsMi4zLTMuMzUsMy4yLTEuMzIuOS0yLjgxLDEuNTUtNC40OCwxLjk1bDEwLjY1LDcuMzVoLTIwLjRsLTEwLjE1LTdoLTIwLjE1djdoLTE1LjhWNy41Wk04OC44LDE5LjV2NGgzMi43YzEuNDcsMCwyLjItLjY3LDIuMi0ycy0uNzMtMi0yLjItMmgtMzIuN1oiLz48cGF0aCBjbGFzcz0iYiIgZD0iTTE5OCw3YzIuNCwwLDQuNjcuNDgsNi44LDEuNDUsMi4xMy45NywzLjk5LDIuMjcsNS41OCwzLjkyLDEuNTgsMS42NSwyLjgzLDMuNTcsMy43NSw1Ljc1LjkyLDIuMTgsMS4zOCw0LjQ3LDEuMzgsNi44OHMtLjQ2LDQuNjktMS4zOCw2Ljg4Yy0uOTIsMi4xOC0yLjE3LDQuMS0zLjc1LDUuNzUtMS41OCwxLjY1LTMuNDQsMi45Ni01LjU4LDMuOTItMi4xMy45Ny00LjQsMS40NS02LjgsMS40NWgtMzYuNWMtMi40LDAtNC42Ny0uNDgtNi44LTEuNDUtMi4xMy0uOTctMy45OS0yLjI3LTUuNTgtMy45Mi0xLjU4LTEuNjUtMi44My0zLjU3LTMuNzUtNS43NS0uOTItMi4xOC0xLjM4LTQuNDctMS4zOC02Ljg4cy40Ni00LjY5LDEuMzgtNi44OGMuOTItMi4xOCwyLjE3LTQuMSwzLjc1LTUuNzUsMS41OC0xLjY1LDMuNDQtMi45Niw1LjU4LTMuOTIsMi4xMy0uOTcsNC40LTEuNDUsNi44LTEuNDVoMzYuNVpNMTk0Ljc1LDIwaC0zMGMtMS40LDAtMi41OC40OC0zLjU1LDEuNDUtLjk3Ljk3LTEuNDUsMi4xNS0xLjQ1LDMuNTVzLjQ4LDIuNTgsMS40NSwzLjU1Yy45Ny45NywyLjE1LDEuNDUsMy41NSwxLjQ1aDMwYzEuNCwwLDIuNTgtLjQ4LDMuNTUtMS40NS45Ny0uOTcsMS40NS0yLjE1LDEuNDUtMy41NXMtLjQ4LTIuNTgtMS40NS0zLjU1LTIuMTUtMS40NS0zLjU1LTEuNDVaIi8+PHBhdGggY2xhc3M9ImIiIGQ9Ik0yNDQuOCwxOS41aC0yNS4zVjcuNWg2Ni41djEyaC0yNS40djIzaC0xNS44di0yM1oiLz48cGF0aCBjbGFzcz0iYiIgZD0iTTI5Miw3LjVoNjV2OWgtNDkuMnY0aDQ5LjJ2OWgtNDkuMnY0aDQ5LjJ2OWgtNjVWNy41WiIvPjxwYXRoIGNsYXNzPSJiIiBkPSJNNDM1LjUsNDIuNWgtMTcuOGwtNC4wNS01aC0zMC44bC00LjA1LDVoLTE3LjhsMjguMzUtMzVoMTcuOGwyOC4zNSwzNVpNNDA1LjU1LDI3LjVsLTcuMy05LTcuMyw5aDE0LjZaIi8+PC9nPjwvZz48L3N2Zz4=",alt:"Protea",class:"h-logo mt-2"},"2",r,0,0),e.ee(),i.ready&&!i.error&&(e.be("p",{class:"mt-2"},"3",r,null,1),e.t("Hermes, ESP8266-based Serial WiFi Modem is up and running.",r),e.ee(),e.be("h3",null,"4",r,null,0),e.t("Status",r),e.ee(),e.be("article",null,"5",r,null,0),e.be("table",{class:"h-table striped"},"6",r,null,1),e.be("tbody",null,"7",r,null,0),e.be("tr",null,"8",r,null,0),e.be("th",{scope:"row"},"9",r,null,0),e.t("SSID",r),e.ee(),e.be("td",null,"10",r,null,0),e.t(i.status.ssid,r),e.ee(),e.ee(),e.be("tr",null,"11",r,null,0),e.be("th",{scope:"row"},"12",r,null,0),e.t("IP Address",r),e.ee(),e.be("td",null,"13",r,null,0),e.t(i.status.ip,r),e.ee(),e.ee(),e.be("tr",null,"14",r,null,0),e.be("th",{scope:"row"},"15",r,null,0),e.t("MAC Address",r),e.ee(),e.be("td",null,"16",r,null,0),e.t(i.status.mac,r),e.ee(),e.ee(),e.be("tr",null,"17",r,null,0),e.be("th",{scope:"row"},"18",r,null,0),e.t("Gateway",r),e.ee(),e.be("td",null,"19",r,null,0),e.t(i.status.gateway,r),e.ee(),e.ee(),e.be("tr",null,"20",r,null,0),e.be("th",{scope:"row"},"21",r,null,0),e.t("Subnet Mask",r),e.ee(),e.be("td",null,"22",r,null,0),e.t(i.status.subnet,r),e.ee(),e.ee(),e.be("tr",null,"23",r,null,0),e.be("th",{scope:"row"},"24",r,null,0),e.t("Call Status",r),e.ee(),e.be("td",null,"25",r,null,0),e.t(i.status.callStatus,r),e.ee(),e.ee(),e.be("tr",null,"26",r,null,0),e.be("th",{scope:"row"},"27",r,null,0),e.t("Call Length",r),e.ee(),e.be("td",null,"28",r,null,0),e.t(i.status.callLength,r),e.ee(),e.ee(),e.be("tr",null,"29",r,null,0),e.be("th",{scope:"row"},"30",r,null,0),e.t("Baud Rate",r),e.ee(),e.be("td",null,"31",r,null,0),e.t(i.status.baud,r),e.ee(),e.ee(),e.be("tr",null,"32",r,null,0),e.be("th",{scope:"row"},"33",r,null,0),e.t("Server Port",r),e.ee(),e.be("td",null,"34",r,null,0),e.t(i.status.tcpServerPort,r),e.ee(),e.ee(),e.ee(),e.ee(),e.ee(),e.be("h3",null,"35",r,null,0),e.t("Settings",r),e.ee(),e.be("article",null,"36",r,null,0),e.be("table",{class:"h-table striped"},"37",r,null,1),e.be("tbody",null,"38",r,null,0),e.be("tr",null,"39",r,null,0),e.be("th",{scope:"row"},"40",r,null,0),e.t("Echo",r),e.ee(),e.be("td",null,"41",r,null,0),e.t("1"===i.settings.echo?"Yes":"No",r),e.ee(),e.ee(),e.be("tr",null,"42",r,null,0),e.be("th",{scope:"row"},"43",r,null,0),e.t("Auto Answer",r),e.ee(),e.be("td",null,"44",r,null,0),e.t("1"===i.settings.autoAnswer?"Yes":"No",r),e.ee(),e.ee(),e.be("tr",null,"45",r,null,0),e.be("th",{scope:"row"},"46",r,null,0),e.t("Baud Rate",r),e.ee(),e.be("td",null,"47",r,null,0),e.t(r.bauds[parseInt(i.settings.serialSpeed,10)],r),e.ee(),e.ee(),e.be("tr",null,"48",r,null,0),e.be("th",{scope:"row"},"49",r,null,0),e.t("SSID",r),e.ee(),e.be("td",null,"50",r,null,0),e.t(i.settings.ssid,r),e.ee(),e.ee(),e.be("tr",null,"51",r,null,0),e.be("th",{scope:"row"},"52",r,null,0),e.t("IP Address",r),e.ee(),e.be("td",null,"53",r,null,0),e.t("s"===i.settings.ipType?`Static ${i.settings.staticIp}/${i.settings.staticMask}, gateway ${i.settings.staticGateway}, DNS ${i.settings.staticDns}`:"DHCP",r),e.ee(),e.ee(),e.be("tr",null,"54",r,null,0),e.be("th",{scope:"row"},"55",r,null,0),e.t("BUSY Message",r),e.ee(),e.be("td",null,"56",r,null,0),e.t(i.settings.busyMsg,r),e.ee(),e.ee(),e.be("tr",null,"57",r,null,0),e.be("th",{scope:"row"},"58",r,null,0),e.t("Server Port",r),e.ee(),e.be("td",null,"59",r,null,0),e.t(i.status.tcpServerPort,r),e.ee(),e.ee(),e.be("tr",null,"60",r,null,0),e.be("th",{scope:"row"},"61",r,null,0),e.t("Telnet Mode",r),e.ee(),e.be("td",null,"62",r,null,0),e.t("1"===i.settings.telnet?"Yes":"No",r),e.ee(),e.ee(),e.be("tr",null,"63",r,null,0),e.be("th",{scope:"row"},"64",r,null,0),e.t("Verbose Results",r),e.ee(),e.be("td",null,"65",r,null,0),e.t("1"===i.settings.verboseResults?"Yes":"No",r),e.ee(),e.ee(),e.be("tr",null,"66",r,null,0),e.be("th",{scope:"row"},"67",r,null,0),e.t("Quiet Mode",r),e.ee(),e.be("td",null,"68",r,null,0),e.t("1"===i.settings.quietMode?"Yes":"No",r),e.ee(),e.ee(),e.ee(),e.ee(),e.ee(),e.be("h3",null,"69",r,null,0),e.t("Commands",r),e.ee(),e.be("article",null,"70",r,null,0),e.be("p",null,"71",r,null,0),e.be("mark",null,"72",r,null,0),e.t("Note",r),e.ee(),e.t(" ",r),e.t(" ",r),e.t(" ",r),e.be("b",null,"73",r,null,0),e.t("Update",r),e.ee(),e.t(" ",r),e.t(",",r),e.t(" ",r),e.be("b",null,"74",r,null,0),e.t("Reboot",r),e.ee(),e.t(" ",r),e.t("and",r),e.t(" ",r),e.be("b",null,"75",r,null,0),e.t("Factory Reset",r),e.ee(),e.t(" ",r),e.t("will disconnect the web server. You will need to reconnect before you will be able to use this page again.",r),e.ee(),e.be("div",{class:"mt-2 h-btns"},"76",r,null,1,{onclick:t.d("click","onCommandButtonClick",!1)}),e.be("button",{"data-id":"settings"},"77",r,null,0),e.t("Settings",r),e.ee(),e.be("button",{"data-id":"hangup"},"78",r,null,0),e.t("Hang Up",r),e.ee(),e.be("button",{"data-id":"update"},"79",r,null,0),e.t("Update",r),e.ee(),e.be("button",{"data-id":"reboot"},"80",r,null,0),e.t("Reboot",r),e.ee(),e.be("button",{"data-id":"factory",class:"contrast"},"81",r,null,0),e.t("Factory Reset",r),e.ee(),e.ee(),e.be("p",{class:"mt-2"},"82",r,null,1),e.t("Until saved to EEPROM, your current changes to the settings are temporary.",r),e.ee(),e.be("div",{class:"mt-2 h-btns"},"83",r,null,1,{onclick:t.d("click","onCommandButtonClick",!1)}),e.be("button",{"data-id":"eepsave",class:"contrast"},"84",r,null,0),e.t("EEPROM Save",r),e.ee(),e.t(" ",r),e.be("button",{"data-id":"eepload"},"85",r,null,0),e.t("EEPROM Load",r),e.ee(),e.ee(),e.ee()),i.ready||i.error||e.e("progress",{class:"mt-2"},"86",r,0,1),i.error&&(e.be("article",{class:"h-error mt-2"},"87",r,null,1),e.t(i.error,r),e.ee()),e.be("p",{class:"mt-2"},"88",r,null,1),e.be("small",null,"89",r,null,0),e.t("© 2025",r),e.t(" ",r),e.be("a",{href:"https://rh1.tech",target:"_blank"},"90",r,null,0),e.t("Mikhail Matveev",r),e.ee(),e.t(" ",r),e.t(". Licensed under",r),e.t(" ",r),e.be("a",{href:"https://www.gnu.org/licenses/gpl-3.0.html",target:"_blank"},"91",r,null,0),e.t("GPLv3 license",r),e.ee(),e.t(" ",r),e.t(".",r),e.ee(),e.ee(),e.t(" ",r),e.ee(),e.be("dialog",{id:"settingsDialog"},"92",r,null,1),e.be("article",null,"93",r,null,0),e.be("h3",null,"94",r,null,0),e.t("Settings",r),e.ee(),i.settingsDialogError&&(e.be("article",{class:"alert alert-danger mb-2"},"95",r,null,1),e.t(i.settingsDialogError,r),e.ee()),e.be("form",null,"96",r,null,0),e.be("fieldset",null,"97",r,null,0),e.be("label",null,"98",r,null,0),e.t("SSID",r),e.t(" ",r),e.e("input",{name:"ssid",placeholder:"Your Wi-Fi Network Name",id:"s_ssid"},"99",r,0,0),e.ee(),e.be("label",null,"100",r,null,0),e.t("Password",r),e.t(" ",r),e.e("input",{type:"password",name:"password",placeholder:"Wi-Fi Password",id:"s_password"},"101",r,0,0),e.ee(),e.be("div",{class:"grid"},"102",r,null,1),e.be("label",null,"103",r,null,0),e.t("Baud Rate",r),e.t(" ",r),e.be("select",{name:"serialSpeed",id:"s_serialSpeed"},"104",r,null,0);{let o=0;for(const t of v()(r.bauds)){let i=o++;const n=`[${i}]`;e.be("option",{value:i},"105"+n,r,null,0),e.t(t,r),e.ee()}}e.ee(),e.ee(),e.be("label",null,"106",r,null,0),e.t("Server Port",r),e.t(" ",r),e.e("input",{type:"number",name:"serverPort",placeholder:"23",id:"s_tcpServerPort"},"107",r,0,0),e.ee(),e.ee(),e.be("label",null,"108",r,null,0),e.t("BUSY Message",r),e.t(" ",r),e.e("input",{name:"busyMsg",placeholder:"Your BUSY Message",id:"s_busyMsg"},"109",r,0,0),e.ee(),e.be("label",null,"110",r,null,0),e.t("IP Address",r),e.t(" ",r),e.be("select",{name:"ipType",id:"s_ipType"},"111",r,null,0,{onchange:t.d("change","onIpTypeChange",!1)}),e.be("option",{value:"d"},"112",r,null,0),e.t("DHCP",r),e.ee(),e.be("option",{value:"s"},"113",r,null,0),e.t("Static",r),e.ee(),e.ee(),e.ee(),e.be("div",{class:"grid"},"114",r,null,1),e.be("label",null,"115",r,null,0),e.t("Address",r),e.t(" ",r),e.e("input",{name:"staticIp",placeholder:"192.168.1.50",id:"s_staticIp"},"116",r,0,0),e.ee(),e.be("label",null,"117",r,null,0),e.t("Subnet Mask",r),e.t(" ",r),e.e("input",{name:"staticMask",placeholder:"255.255.255.0",id:"s_staticMask"},"118",r,0,0),e.ee(),e.ee(),e.be("div",{class:"grid"},"119",r,null,1),e.be("label",null,"120",r,null,0),e.t("Gateway",r),e.t(" ",r),e.e("input",{name:"staticGateway",placeholder:"192.168.1.1",id:"s_staticGateway"},"121",r,0,0),e.ee(),e.be("label",null,"122",r,null,0),e.t("DNS Server",r),e.t(" ",r),e.e("input",{name:"staticDns",placeholder:"Same as gateway",id:"s_staticDns"},"123",r,0,0),e.ee(),e.ee(),e.ee(),e.ee(),e.be("footer",null,"124",r,null,0),e.be("button",{class:"secondary"},"125",r,null,1,{onclick:t.d("click","onSettingsDialogCancel",!1)}),e.t("Cancel",r),e.ee(),e.be("button",null,"126",r,null,0,{onclick:t.d("click","onSettingsDialogSave",!1)}),e.t("Save",r),e.ee(),e.ee(),e.ee(),e.ee(),i.confirmationData&&(e.be("dialog",{open:""},"127",r,null,0),e.be("article",null,"128",r,null,0),e.be("h3",null,"129",r,null,0),e.t("Confirmation",r),e.ee(),e.be("p",null,"130",r,null,0),e.t(i.confirmationData.message,r),e.ee(),e.be("footer",null,"131",r,null,0),e.be("button",{class:"secondary"},"132",r,null,1,{onclick:t.d("click","onConfirmationDialogCancel",!1)}),e.t("Cancel",r),e.ee(),e.be("button",{"data-id":i.confirmationData.action},"133",r,null,0,{onclick:t.d("click","onConfirmationDialogConfirm",!1)}),e.t("Confirm",r),e.ee(),e.ee(),e.ee(),e.ee()),i.loading&&(e.be("div",{id:"loadingOverlay",class:"overlay"},"134",r,null,1),e.e("div",{class:"loader"},"135",r,0,1),e.ee())},{t:z,d:!0},O),D.Component=M()(O,D._);var T=t(3684),I=t.n(T);const U="src/entrypoint.marko",A=(0,o.t)(U);var P=A;(0,L.r)(U,()=>A);const $={};A._=E()(function(o,e,t,r,i,n){I()(j,{},e,t,"0")},{t:U,i:!0,d:!0},$),A.Component=M()($,A._);P.renderSync({}).appendTo(document.body)}(),bundle={}}();</script>
     </body>
 </html>
 )=====";
@@ -10,11 +10,63 @@
 #error "Unsupported platform"
 #endif
 #include "globals.h"
+#include "httpstream.h"
+#include "ansi.h"
+#include "ppp.h"
+#include "dnsproxy.h"
+#include "wifi.h"
+#include "ssh.h"
+
+WifiStats wifiStats = {0, 0, 0, 0, 0};
+String wifiExtraSsid[WIFI_EXTRA_NETWORKS];
+String wifiExtraPass[WIFI_EXTRA_NETWORKS];
 
 namespace
 {
-  const uint8_t MAX_CONNECT_ATTEMPTS = 25;
-  const uint16_t CONNECT_RETRY_DELAY_MS = 500;
+  const uint16_t CONNECT_TIMEOUT_MS = 12500;
+  const uint16_t FAST_CONNECT_TIMEOUT_MS = 4000; // With a cached BSSID and channel
+  const uint16_t CONNECT_POLL_MS = 20;
+  const uint16_t DOT_INTERVAL_MS = 500;
+  const uint16_t SIGNAL_INTERVAL_MS = 5000;
+
+  unsigned long assocMs = 0;   // How long the last connect took
+  bool assocFast = false;      // Whether it used the cached access point
+  int32_t signalRssi = 0;      // Sampled from loop() while connected
+  unsigned long signalAt = 0;
+
+  // Supervisor
+  enum SupervisorState
+  {
+    SUP_OFF,  // ATC0, or never connected
+    SUP_UP,   // Connected
+    SUP_ROAM, // Connected, scanning for a stronger access point
+    SUP_WAIT, // Down, waiting for the next attempt
+    SUP_SCAN, // Down, scanning for the stored networks
+    SUP_JOIN  // Down, waiting for WiFi.begin() to get through
+  };
+  SupervisorState supState = SUP_OFF;
+  unsigned long supBackoff = WIFI_BACKOFF_MIN_MS;
+  unsigned long supNextAt = 0;  // When SUP_WAIT tries again
+  unsigned long supJoinAt = 0;  // When WiFi.begin() was called
+  unsigned long supDownAt = 0;  // When the link went, 0 while it is up
+  unsigned long supRoamAt = 0;  // Last look for a stronger access point
+  bool supRoaming = false;      // The current join is a move, not a rejoin
+  bool supCached = false;       // The current join goes to the cached access point
+  bool supSkipCache = false;    // It did not work, so let the driver scan
+  bool supStarting = false;     // The join started at boot has not settled
+  volatile bool supLinkLost = false; // Set from the driver's event
+#ifdef ESP8266
+  WiFiEventHandler supDisconnectHandler;
+#endif
+
+  // A candidate from a scan
+  struct AccessPoint
+  {
+    int slot; // 0 for AT$SSID, 1 and up for the extra networks
+    int32_t rssi;
+    int32_t channel;
+    uint8_t bssid[6];
+  };
 
   const char *wifiStatusToString(wl_status_t st)
   {
@@ -39,6 +91,221 @@ namespace
     }
   }
 
+  // Waits for the connection, printing a dot every half second
+  bool waitForConnect(uint16_t timeoutMs)
+  {
+    unsigned long start = millis();
+    unsigned long dot = start;
+    while (WiFi.status() != WL_CONNECTED && millis() - start < timeoutMs)
+    {
+      if (millis() - dot >= DOT_INTERVAL_MS)
+      {
+        Serial.print('.');
+        dot = millis();
+      }
+      delay(CONNECT_POLL_MS);
+    }
+    return WiFi.status() == WL_CONNECTED;
+  }
+
+  // Remembers where the connection went, so the next one can skip the scan
+  void saveAccessPoint()
+  {
+    const uint8_t *bssid = WiFi.BSSID();
+    byte channel = WiFi.channel();
+    if (bssid == NULL || (channel == wifiChannel && memcmp(bssid, wifiBssid, 6) == 0))
+      return;
+    memcpy(wifiBssid, bssid, 6);
+    wifiChannel = channel;
+    for (int i = 0; i < 6; i++)
+    {
+      EEPROM.write(WIFI_BSSID_ADDRESS + i, wifiBssid[i]);
+    }
+    EEPROM.write(WIFI_CHANNEL_ADDRESS, wifiChannel);
+    EEPROM.commit();
+  }
+
+  // Only used to explain a failed connect
+  void printScannedSignal()
+  {
+    int n = WiFi.scanNetworks();
+    for (int i = 0; i < n; ++i)
+    {
+      if (WiFi.SSID(i) == ssid)
+      {
+        Serial.print("Signal strength (RSSI): ");
+        Serial.print(WiFi.RSSI(i));
+        Serial.println(" dBm");
+        WiFi.scanDelete();
+        return;
+      }
+    }
+    WiFi.scanDelete();
+    Serial.println("Signal strength: unknown (SSID not found)");
+  }
+
+  // Static addressing belongs to the main network, the others use DHCP
+  void applyAddressing(bool mainNetwork)
+  {
+    if (mainNetwork && staticIp)
+      WiFi.config(staticAddress, staticGateway, staticMask, staticDns);
+    else
+      WiFi.config(IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0), IPAddress(0, 0, 0, 0));
+  }
+
+  bool haveExtraNetworks()
+  {
+    for (const String &name : wifiExtraSsid)
+    {
+      if (!name.isEmpty())
+        return true;
+    }
+    return false;
+  }
+
+  // Strongest stored network in the finished scan of n results
+  bool bestAccessPoint(int n, AccessPoint &best)
+  {
+    best.slot = -1;
+    for (int i = 0; i < n; ++i)
+    {
+      String found = WiFi.SSID(i);
+      int slot = found == ssid ? 0 : -1;
+      for (int k = 0; slot < 0 && k < WIFI_EXTRA_NETWORKS; k++)
+      {
+        if (!wifiExtraSsid[k].isEmpty() && found == wifiExtraSsid[k])
+          slot = k + 1;
+      }
+      if (slot < 0 || (best.slot >= 0 && WiFi.RSSI(i) <= best.rssi))
+        continue;
+      best.slot = slot;
+      best.rssi = WiFi.RSSI(i);
+      best.channel = WiFi.channel(i);
+      memcpy(best.bssid, WiFi.BSSID(i), 6);
+    }
+    return best.slot >= 0;
+  }
+
+  // Starts joining a stored network; with no channel and BSSID the main
+  // network uses the cached access point, if any
+  void joinNetwork(int slot, int32_t channel, const uint8_t *bssid)
+  {
+    const String &name = slot == 0 ? ssid : wifiExtraSsid[slot - 1];
+    const String &pass = slot == 0 ? password : wifiExtraPass[slot - 1];
+    supCached = slot == 0 && bssid == NULL && !supSkipCache && wifiChannel >= 1 && wifiChannel <= 14;
+    if (supCached)
+    {
+      channel = wifiChannel;
+      bssid = wifiBssid;
+    }
+    applyAddressing(slot == 0);
+    WiFi.begin(name.c_str(), pass.c_str(), channel, bssid);
+    supJoinAt = millis();
+    supState = SUP_JOIN;
+  }
+
+  void linkUp()
+  {
+    if (supDownAt != 0)
+    {
+      wifiStats.lastOutageMs = millis() - supDownAt;
+      wifiStats.downMs += wifiStats.lastOutageMs;
+      if (supRoaming)
+        wifiStats.roams++;
+      else
+        wifiStats.reconnects++;
+      supDownAt = 0;
+    }
+    if (WiFi.SSID() == ssid)
+      saveAccessPoint();
+    assocMs = millis() - supJoinAt;
+    assocFast = supCached;
+    signalRssi = WiFi.RSSI();
+    signalAt = millis();
+    supBackoff = WIFI_BACKOFF_MIN_MS;
+    supRoaming = false;
+    supSkipCache = false;
+    supStarting = false;
+    supLinkLost = false;
+    supState = SUP_UP;
+  }
+
+  void linkDown()
+  {
+    if (supState == SUP_ROAM)
+      WiFi.scanDelete();
+    supDownAt = millis();
+    supLinkLost = false;
+    supBackoff = WIFI_BACKOFF_MIN_MS;
+    supNextAt = millis(); // The first attempt goes straight away
+    supState = SUP_WAIT;
+  }
+
+  void joinFailed()
+  {
+    wifiStats.failures++;
+    if (supStarting && supDownAt == 0)
+      supDownAt = millis(); // Count the time until the boot join succeeds
+    supRoaming = false;
+    supSkipCache = false;
+    supStarting = false;
+    supNextAt = millis() + supBackoff;
+    supBackoff = min(supBackoff * 2, (unsigned long)WIFI_BACKOFF_MAX_MS);
+    supState = SUP_WAIT;
+  }
+
+  bool haveCredentials()
+  {
+    return !ssid.isEmpty() && (byte)ssid[0] != 0xFF && !password.isEmpty();
+  }
+
+  void printWiFiHelp()
+  {
+    Serial.println("Welcome to to Hermes, the Protea Wi-Fi to Serial Modem!");
+    Serial.println("Default baud rate is 9600 bps. You can change it using the command: \x1b[36mAT$SB=N\x1b[0m,");
+    Serial.println("where \x1b[36mN\x1b[0m is one of: 1200, 2400, 4800, 9600, 19200, 38400, 57600, 115200.");  
+    Serial.println("You need to connect to a Wi-Fi network before making calls.");
+    Serial.println("To do this, set the SSID and password using the following commands:");
+    Serial.println("\x1b[36mAT$SSID=YOUR_WIFI_NETWORK\x1b[0m");
+    Serial.println("\x1b[36mAT$PASS=YOUR_WIFI_PASSWORD\x1b[0m");
+    Serial.println("When done, connect using the command: \x1b[36mATC1\x1b[0m");
+    Serial.println("Enter \x1b[36mAT?\x1b[0m for help. When done, save your settings by entering: \x1b[36mAT&W\x1b[0m");
+  }
+
+  void printConnected()
+  {
+    Serial.print("Connected to ");
+    Serial.print(WiFi.SSID());
+    Serial.print(" in ");
+    Serial.print(assocMs);
+    Serial.println(assocFast ? " ms (cached access point)" : " ms");
+    Serial.print("Signal strength (RSSI): ");
+    Serial.print(signalRssi);
+    Serial.println(" dBm");
+    Serial.print("IP address: ");
+    Serial.print(WiFi.localIP());
+    Serial.println(staticIp ? " (static)" : " (DHCP)");
+  }
+
+  void printConnectFailed()
+  {
+    Serial.print("Could not connect to ");
+    Serial.print(ssid);
+    Serial.println(". Check SSID, password and signal strength.");
+  }
+
+#ifdef ESP32
+  void onStationDisconnected(WiFiEvent_t event, WiFiEventInfo_t info)
+  {
+    supLinkLost = true;
+  }
+#else
+  void onStationDisconnected(const WiFiEventStationModeDisconnected &event)
+  {
+    supLinkLost = true;
+  }
+#endif
+
   void printMac()
   {
     byte mac[6];
@@ -64,8 +331,43 @@ void wifiSetup()
   const char *hostname = "PROTEA";
   WiFi.setHostname(hostname);
 
-  connectWiFi();
-  sendResult(RES_OK);
+  // Reconnecting is left to the supervisor, which hears of drops at once
+  WiFi.setAutoReconnect(false);
+#ifdef ESP32
+  WiFi.onEvent(onStationDisconnected, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+#else
+  supDisconnectHandler = WiFi.onStationModeDisconnected(onStationDisconnected);
+#endif
+
+  // Join in the background while the rest of the boot goes on
+  if (haveCredentials())
+  {
+    supStarting = true;
+    joinNetwork(0, 0, NULL);
+  }
+}
+
+bool wifiSetupSettled()
+{
+  return !supStarting;
+}
+
+// Tells how the join started by wifiSetup() went
+void wifiSetupReport()
+{
+  if (!haveCredentials())
+  {
+    printWiFiHelp();
+  }
+  else if (WiFi.status() == WL_CONNECTED)
+  {
+    printConnected();
+  }
+  else
+  {
+    printConnectFailed();
+    Serial.println("Retrying in the background.");
+  }
 
 #ifdef ESP8266
   mdns.begin("ProteaWiFi", WiFi.localIP());
@@ -76,91 +378,193 @@ void wifiSetup()
 
 void connectWiFi()
 {
-  if (ssid.isEmpty() || ssid[0] == 0xFF || password.isEmpty())
+  if (!haveCredentials())
   {
-    Serial.println("Welcome to to Hermes, the Protea Wi-Fi to Serial Modem!");
-    Serial.println("Default baud rate is 9600 bps. You can change it using the command: \x1b[36mAT$SB=N\x1b[0m,");
-    Serial.println("where \x1b[36mN\x1b[0m is one of: 1200, 2400, 4800, 9600, 19200, 38400, 57600, 115200.");  
-    Serial.println("You need to connect to a Wi-Fi network before making calls.");
-    Serial.println("To do this, set the SSID and password using the following commands:");
-    Serial.println("\x1b[36mAT$SSID=YOUR_WIFI_NETWORK\x1b[0m");
-    Serial.println("\x1b[36mAT$PASS=YOUR_WIFI_PASSWORD\x1b[0m");
-    Serial.println("When done, connect using the command: \x1b[36mATC1\x1b[0m");
-    Serial.println("Enter \x1b[36mAT?\x1b[0m for help. When done, save your settings by entering: \x1b[36mAT&W\x1b[0m");
+    printWiFiHelp();
     return;
   }
 
   if (WiFi.status() == WL_CONNECTED && WiFi.SSID() == ssid)
   {
     Serial.println("Already connected.");
+    supState = SUP_UP;
     return;
   }
 
+  supState = SUP_OFF;
+  supStarting = false;
   WiFi.disconnect();
-  delay(100);
-  Serial.print("Checking Wi-Fi signal strength (SSID: ");
+  // A static address saves the DHCP exchange on every connect
+  applyAddressing(true);
+  Serial.print("Connecting to SSID: ");
   Serial.print(ssid);
-  Serial.println(")...");
 
-  int16_t rssi = 0;
-  bool found = false;
-  int n = WiFi.scanNetworks();
-  for (int i = 0; i < n; ++i)
+  // Go straight to the access point of the last connect, and only let
+  // the driver scan for it if that does not work
+  unsigned long start = millis();
+  assocFast = wifiChannel >= 1 && wifiChannel <= 14;
+  bool connected = false;
+  if (assocFast)
   {
-    if (WiFi.SSID(i) == ssid)
+    WiFi.begin(ssid.c_str(), password.c_str(), wifiChannel, wifiBssid);
+    connected = waitForConnect(FAST_CONNECT_TIMEOUT_MS);
+    if (!connected)
     {
-      rssi = WiFi.RSSI(i);
-      found = true;
-      break;
+      assocFast = false;
+      WiFi.disconnect();
+      Serial.print(" (scanning)");
     }
   }
-  WiFi.scanDelete();
-  if (found)
+  if (!connected)
   {
-    Serial.print("Signal strength (RSSI): ");
-    Serial.print(rssi);
-    Serial.println(" dBm");
+    WiFi.begin(ssid.c_str(), password.c_str());
+    connected = waitForConnect(CONNECT_TIMEOUT_MS);
   }
-  else
+  Serial.println();
+
+  if (!connected)
   {
-    Serial.println("Signal strength: unknown (SSID not found)");
+    printConnectFailed();
+    printScannedSignal();
+    WiFi.disconnect();
+    Serial.println(haveExtraNetworks() ? "Trying the other stored networks in the background."
+                                       : "Retrying in the background.");
+    supDownAt = millis();
+    joinFailed();
+    if (haveExtraNetworks())
+      supNextAt = millis(); // Straight on with the other networks
+    return;
   }
+  supJoinAt = start;
+  supCached = assocFast;
+  linkUp();
+  printConnected();
+  startFirmwareCheck();
+}
 
-  Serial.print("\nConnecting to SSID: ");
-  Serial.print(ssid);
-
-  delay(100);
-  WiFi.begin(ssid.c_str(), password.c_str());
+void disconnectWiFi()
+{
+  supState = SUP_OFF;
+  supDownAt = 0;
+  WiFi.disconnect();
+}
 
-  uint8_t attempt = 0;
-  while (WiFi.status() != WL_CONNECTED && attempt++ < MAX_CONNECT_ATTEMPTS)
+// Called from loop(): notices a lost link and gets it back without blocking
+void handleWiFiSupervisor()
+{
+  switch (supState)
   {
-    Serial.print('.');
-    delay(CONNECT_RETRY_DELAY_MS);
-    yield();
-  }
-  Serial.println();
+  case SUP_OFF:
+    break;
+
+  case SUP_UP:
+  case SUP_ROAM:
+    if (supLinkLost || WiFi.status() != WL_CONNECTED)
+    {
+      linkDown();
+      break;
+    }
+    if (supState == SUP_UP)
+    {
+      // A weak link on an idle modem looks around now and then
+      if (!callConnected && signalRssi < WIFI_ROAM_RSSI && millis() - supRoamAt >= WIFI_ROAM_CHECK_MS)
+      {
+        supRoamAt = millis();
+        if (WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING)
+          supState = SUP_ROAM;
+      }
+      break;
+    }
+    {
+      int n = WiFi.scanComplete();
+      if (n == WIFI_SCAN_RUNNING)
+        break;
+      AccessPoint best;
+      bool found = n > 0 && bestAccessPoint(n, best);
+      WiFi.scanDelete();
+      supState = SUP_UP;
+      if (callConnected || !found || best.rssi < signalRssi + WIFI_ROAM_MARGIN ||
+          memcmp(best.bssid, WiFi.BSSID(), 6) == 0)
+        break;
+      supRoaming = true;
+      supDownAt = millis();
+      joinNetwork(best.slot, best.channel, best.bssid);
+    }
+    break;
+
+  case SUP_WAIT:
+    if ((long)(millis() - supNextAt) < 0)
+      break;
+    if (haveExtraNetworks() && WiFi.scanNetworks(true) == WIFI_SCAN_RUNNING)
+      supState = SUP_SCAN;
+    else
+      joinNetwork(0, 0, NULL);
+    break;
 
-  if (WiFi.status() != WL_CONNECTED)
+  case SUP_SCAN:
   {
-    Serial.print("Could not connect to ");
-    Serial.print(ssid);
-    Serial.println(". Check SSID, password and signal strength.");
-    WiFi.disconnect();
-    return;
+    int n = WiFi.scanComplete();
+    if (n == WIFI_SCAN_RUNNING)
+      break;
+    AccessPoint best;
+    bool found = n > 0 && bestAccessPoint(n, best);
+    WiFi.scanDelete();
+    if (found)
+      joinNetwork(best.slot, best.channel, best.bssid);
+    else
+      joinFailed();
+    break;
   }
 
-  Serial.print("Connected to ");
-  Serial.println(WiFi.SSID());
-  Serial.print("IP address: ");
-  Serial.println(WiFi.localIP());
+  case SUP_JOIN:
+    if (WiFi.status() == WL_CONNECTED)
+    {
+      linkUp();
+    }
+    else if (supCached && millis() - supJoinAt >= FAST_CONNECT_TIMEOUT_MS)
+    {
+      // The access point may have moved, look for it right away
+      WiFi.disconnect();
+      wifiStats.failures++;
+      supSkipCache = true;
+      joinNetwork(0, 0, NULL);
+    }
+    else if (millis() - supJoinAt >= WIFI_JOIN_TIMEOUT_MS)
+    {
+      WiFi.disconnect();
+      joinFailed();
+    }
+    break;
+  }
+}
 
-  check_for_firmware_update();
+const char *wifiSupervisorState()
+{
+  switch (supState)
+  {
+  case SUP_OFF:
+    return "OFF";
+  case SUP_UP:
+    return "UP";
+  case SUP_ROAM:
+    return "UP, SCANNING";
+  case SUP_WAIT:
+    return "DOWN, WAITING";
+  case SUP_SCAN:
+    return "DOWN, SCANNING";
+  case SUP_JOIN:
+    return "DOWN, JOINING";
+  }
+  return "UNKNOWN";
 }
 
-void disconnectWiFi()
+// Called from loop(): keeps the signal strength for ATI current without a scan
+void pollWiFiSignal()
 {
-  WiFi.disconnect();
+  if (millis() - signalAt < SIGNAL_INTERVAL_MS || WiFi.status() != WL_CONNECTED)
+    return;
+  signalRssi = WiFi.RSSI();
+  signalAt = millis();
 }
 
 void displayNetworkStatus()
@@ -172,13 +576,49 @@ void displayNetworkStatus()
 
   Serial.print("SSID: ");
   Serial.println(WiFi.SSID());
+  if (st == WL_CONNECTED)
+  {
+    Serial.print("BSSID: ");
+    Serial.print(WiFi.BSSIDstr());
+    Serial.print(", channel ");
+    Serial.print(WiFi.channel());
+    Serial.print(", RSSI ");
+    Serial.print(signalRssi);
+    Serial.println(" dBm");
+    Serial.print("Associated in ");
+    Serial.print(assocMs);
+    Serial.println(assocFast ? " ms (cached access point)" : " ms (scan)");
+  }
   Serial.print("MAC Address: ");
   printMac();
   Serial.println();
   yield();
 
+  Serial.print("Supervisor: ");
+  Serial.print(wifiSupervisorState());
+  Serial.print(", ");
+  Serial.print(wifiStats.reconnects);
+  Serial.print(" reconnects, ");
+  Serial.print(wifiStats.roams);
+  Serial.print(" roams, ");
+  Serial.print(wifiStats.failures);
+  Serial.print(" failed attempts, ");
+  Serial.print(wifiStats.downMs);
+  Serial.print(" ms down (last ");
+  Serial.print(wifiStats.lastOutageMs);
+  Serial.println(" ms)");
+  yield();
+
+  Serial.print("Power save: ");
+  Serial.print(powerSaveName(powerSave));
+  Serial.print(", radio ");
+  Serial.println(sleepModeName());
+  printLatency();
+  yield();
+
   Serial.print("IP Address: ");
-  Serial.println(WiFi.localIP());
+  Serial.print(WiFi.localIP());
+  Serial.println(staticIp ? " (static)" : " (DHCP)");
   yield();
 
   Serial.print("Gateway: ");
@@ -201,20 +641,24 @@ void displayNetworkStatus()
   if (callConnected)
   {
 #ifdef PPP_ENABLED
-    if (ppp)
+    if (ppp || slipActive)
     {
-      Serial.print("Connected to PPP");
+      Serial.println(ppp ? "Connected to PPP" : "Connected to SLIP");
     }
     else
+#endif
     {
       Serial.print("Connected to ");
+#ifdef ESP32
+      if (tlsConnected)
+      {
+        Serial.print(ipToString(tlsClient.remoteIP()));
+        Serial.println(" (TLS)");
+      }
+      else
+#endif
       Serial.println(ipToString(tcpClient.remoteIP()));
     }
-#endif
-#ifndef PPP_ENABLED
-    Serial.print("Connected to ");
-    Serial.println(ipToString(tcpClient.remoteIP()));
-#endif
     yield();
     Serial.print("Call length: ");
     Serial.println(connectTimeString());
@@ -224,4 +668,103 @@ void displayNetworkStatus()
     Serial.println("Not connected");
   }
   yield();
+
+  if (httpStats.requests)
+  {
+    Serial.print("HTTP: ");
+    Serial.print(httpStats.requests);
+    Serial.print(" requests, ");
+    Serial.print(httpStats.redirects);
+    Serial.print(" redirects, ");
+    Serial.print(httpStats.chunked);
+    Serial.print(" chunked, ");
+    Serial.print(httpStats.failures);
+    Serial.print(" failed, ");
+    Serial.print(httpStats.bodyBytes);
+    Serial.println(" bytes");
+    Serial.print("Last HTTP: status ");
+    Serial.print(httpStats.lastStatus);
+    Serial.print(", ");
+    Serial.print(httpStats.lastBytes);
+    Serial.print(" bytes in ");
+    Serial.print(httpStats.lastMs);
+    Serial.println(" ms");
+    yield();
+  }
+
+  if (ansiStats.bytesIn)
+  {
+    Serial.print("ANSI filter: ");
+    Serial.print(ansiStats.bytesIn);
+    Serial.print(" bytes in, ");
+    Serial.print(ansiStats.bytesOut);
+    Serial.println(" bytes out");
+    yield();
+  }
+
+  if (pppStats.bytesIn || pppStats.bytesOut)
+  {
+    Serial.print("PPP/SLIP: ");
+    Serial.print(pppStats.framesIn);
+    Serial.print(" frames/");
+    Serial.print(pppStats.bytesIn);
+    Serial.print(" bytes in, ");
+    Serial.print(pppStats.framesOut);
+    Serial.print(" frames/");
+    Serial.print(pppStats.bytesOut);
+    Serial.print(" bytes out, ");
+    Serial.print(pppStats.txDrops);
+    Serial.println(" dropped");
+    printPPPInfo();
+    yield();
+  }
+
+  printNATInfo();
+  yield();
+
+  if (dnsStats.queries)
+  {
+    Serial.print("DNS cache: ");
+    Serial.print(dnsStats.queries);
+    Serial.print(" queries, ");
+    Serial.print(dnsStats.hits);
+    Serial.print(" hits (");
+    Serial.print(dnsStats.negativeHits);
+    Serial.print(" negative), ");
+    Serial.print(dnsStats.forwarded);
+    Serial.print(" forwarded, ");
+    Serial.print(dnsStats.failures);
+    Serial.print(" failed, ");
+    Serial.print(dnsCacheEntries());
+    Serial.print(" entries/");
+    Serial.print(dnsCacheBytes());
+    Serial.println(" bytes");
+    yield();
+  }
+
+  if (sshStackPeak())
+  {
+    Serial.print("SSH task stack: peak ");
+    Serial.print(sshStackPeak());
+    Serial.print(" of ");
+    Serial.print(SSH_TASK_STACK);
+    Serial.println(" bytes");
+    yield();
+  }
+
+#ifdef ESP32
+  if (tlsStats.handshakes || tlsStats.failures)
+  {
+    Serial.print("TLS: ");
+    Serial.print(tlsStats.handshakes);
+    Serial.print(" handshakes, ");
+    Serial.print(tlsStats.resumed);
+    Serial.print(" resumed, ");
+    Serial.print(tlsStats.failures);
+    Serial.print(" failed, last ");
+    Serial.print(tlsStats.lastMs);
+    Serial.println(tlsStats.lastResumed ? " ms (resumed)" : " ms");
+    yield();
+  }
+#endif
 }
@@ -0,0 +1,87 @@
+#ifndef WIFI_H
+#define WIFI_H
+
+#include <Arduino.h>
+
+// Wi-Fi supervisor. Once connected with ATC1 (or at boot), loop() keeps
+// the link up: a dropped link is noticed from the driver's events and
+// rejoined with growing pauses between attempts. Besides the network in
+// AT$SSID/AT$PASS, up to WIFI_EXTRA_NETWORKS more can be stored; when
+// there is a choice the strongest one found in a scan is joined, and an
+// idle modem on a weak signal moves to a clearly stronger access point.
+
+#define WIFI_EXTRA_NETWORKS 3
+#define WIFI_BACKOFF_MIN_MS 1000
+#define WIFI_BACKOFF_MAX_MS 60000
+#define WIFI_JOIN_TIMEOUT_MS 15000
+#define WIFI_ROAM_CHECK_MS 60000 // How often a weak link looks for a better one
+#define WIFI_ROAM_RSSI -75       // Only look below this signal, dBm
+#define WIFI_ROAM_MARGIN 10      // and move for at least this much more, dB
+
+struct WifiStats
+{
+  uint32_t reconnects;   // Links restored after a drop
+  uint32_t failures;     // Attempts that did not get a link
+  uint32_t roams;        // Moves to a stronger access point
+  uint32_t downMs;       // Time without a link since boot, not counting ATC0
+  uint32_t lastOutageMs; // Length of the last drop
+};
+
+extern WifiStats wifiStats;
+extern String wifiExtraSsid[WIFI_EXTRA_NETWORKS];
+extern String wifiExtraPass[WIFI_EXTRA_NETWORKS];
+
+// Called from loop()
+void handleWiFiSupervisor();
+
+// "UP", "DOWN" and so on, for ATI and the web status
+const char *wifiSupervisorState();
+
+// Power save policy, in power.cpp. Modem sleep turns the radio off
+// between beacons and light sleep also stops the CPU, both adding delay
+// to whatever arrives. So the radio stays awake during calls and from a
+// RING on, and sleeps while the modem sits in command mode.
+#define PS_OFF 0   // Never sleep
+#define PS_MODEM 1 // Modem sleep always, the platform default
+#define PS_AUTO 2  // Awake in calls, modem sleep when idle
+#define PS_LIGHT 3 // Awake in calls, light sleep when idle
+#define PS_MODE_COUNT 4
+#define PS_DEFAULT PS_AUTO
+#define PS_RING_AWAKE_MS 30000 // How long a RING keeps the radio up
+
+// What the radio is doing, latency is kept for each
+#define SLEEP_NONE 0
+#define SLEEP_MODEM 1
+#define SLEEP_LIGHT 2
+#define SLEEP_MODE_COUNT 3
+
+// Time from a keystroke sent in a call to the first byte back, which is
+// the echo on most hosts. Calls only ever run awake or, with AT$PS=MODEM,
+// in modem sleep, so light sleep has no bucket
+#define LATENCY_MODE_COUNT 2
+struct LatencyStats
+{
+  uint32_t samples;
+  uint64_t totalUs;
+  uint32_t maxUs;
+};
+
+extern LatencyStats echoLatency[LATENCY_MODE_COUNT];
+
+const char *powerSaveName(byte mode);
+int powerSaveFromName(const String &name); // -1 if unknown
+
+// Called from loop(), puts the radio in the mode the policy asks for
+void handlePowerSave();
+
+// Keeps the radio awake for a while, such as when a call comes in
+void powerSaveWake();
+
+void latencySent(size_t len);
+void latencyReceived();
+void printLatency();
+
+// "awake", "modem sleep" or "light sleep"
+const char *sleepModeName();
+
+#endif
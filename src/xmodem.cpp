@@ -1,4 +1,5 @@
 #include "xmodem.h"
+#include <new>
 
 #ifdef ESP8266
 #include <ESP8266WiFi.h>
@@ -6,6 +7,16 @@
 #include <WiFi.h>
 #endif
 
+const uint8_t XModem::SOH;
+const uint8_t XModem::STX;
+const uint8_t XModem::EOT;
+const uint8_t XModem::ACK;
+const uint8_t XModem::NAK;
+const uint8_t XModem::CAN;
+const uint8_t XModem::CRC;
+const size_t XModem::BLOCK_SIZE;
+const size_t XModem::BLOCK_1K_SIZE;
+
 XModem::XModem(Client &client, Stream &output, XModemMode mode)
     : client_(client), out_(output), mode_(mode)
 {
@@ -142,3 +153,303 @@ bool XModem::processIncomingByte(uint8_t rxByte)
     }
     return true;
 }
+
+// ========================= Sender =========================
+
+XModemSender::XModemSender(Stream &link, bool batch)
+    : link_(link), batch_(batch)
+{
+    ring_ = new (std::nothrow) uint8_t[RING_SIZE];
+    frame_ = new (std::nothrow) uint8_t[FRAME_SIZE];
+}
+
+XModemSender::~XModemSender()
+{
+    delete[] ring_;
+    delete[] frame_;
+}
+
+bool XModemSender::pump(size_t maxBytes)
+{
+    if (!source_ || sourceEof_ || ringCount_ == RING_SIZE)
+        return false;
+    size_t tail = (ringHead_ + ringCount_) % RING_SIZE;
+    size_t space = RING_SIZE - ringCount_;
+    if (space > RING_SIZE - tail)
+        space = RING_SIZE - tail;
+    if (space > maxBytes)
+        space = maxBytes;
+    int r = source_->read(ring_ + tail, space);
+    if (r < 0)
+    {
+        sourceEof_ = true;
+        return false;
+    }
+    ringCount_ += r;
+    return r > 0;
+}
+
+size_t XModemSender::take(uint8_t *dst, size_t len)
+{
+    if (len > ringCount_)
+        len = ringCount_;
+    for (size_t i = 0; i < len; i++)
+    {
+        dst[i] = ring_[ringHead_];
+        ringHead_ = (ringHead_ + 1) % RING_SIZE;
+    }
+    ringCount_ -= len;
+    return len;
+}
+
+int XModemSender::readByte(unsigned long timeoutMs)
+{
+    unsigned long start = millis();
+    while (!link_.available())
+    {
+        if (millis() - start >= timeoutMs)
+            return -1;
+        // Waiting for the receiver: read ahead meanwhile
+        if (!pump(256))
+            yield();
+    }
+    return link_.read();
+}
+
+void XModemSender::writeOut(const uint8_t *data, size_t len)
+{
+    while (len)
+    {
+        size_t room = link_.availableForWrite();
+        if (room == 0)
+        {
+            // UART FIFO is full: read ahead while it drains
+            if (pump(256))
+                continue;
+            room = 64;
+        }
+        if (room > len)
+            room = len;
+        link_.write(data, room);
+        data += room;
+        len -= room;
+    }
+}
+
+bool XModemSender::waitStart()
+{
+    unsigned long start = millis();
+    uint8_t cans = 0;
+    while (millis() - start < 60000)
+    {
+        int c = readByte(1000);
+        if (c < 0)
+            continue;
+        if (c == XModem::CRC)
+        {
+            crc_ = true;
+            return true;
+        }
+        if (c == XModem::NAK)
+        {
+            if (batch_)
+            {
+                error_ = "Receiver does not support YMODEM";
+                return false;
+            }
+            crc_ = false;
+            return true;
+        }
+        if (c == XModem::CAN)
+        {
+            if (++cans >= 2)
+            {
+                error_ = "Cancelled by receiver";
+                return false;
+            }
+        }
+        else
+        {
+            cans = 0;
+        }
+    }
+    error_ = "Receiver did not start";
+    return false;
+}
+
+// Frames the data already placed at frame_ + 3
+void XModemSender::buildFrame(uint8_t blk, size_t len, size_t blockSize, uint8_t pad)
+{
+    frame_[0] = (blockSize == XModem::BLOCK_1K_SIZE) ? XModem::STX : XModem::SOH;
+    frame_[1] = blk;
+    frame_[2] = 255 - blk;
+    memset(frame_ + 3 + len, pad, blockSize - len);
+    if (crc_)
+    {
+        uint16_t crc = XModem::calcCRC(frame_ + 3, blockSize);
+        frame_[3 + blockSize] = crc >> 8;
+        frame_[4 + blockSize] = crc & 0xFF;
+        frameLen_ = 5 + blockSize;
+    }
+    else
+    {
+        frame_[3 + blockSize] = XModem::calcChecksum(frame_ + 3, blockSize);
+        frameLen_ = 4 + blockSize;
+    }
+}
+
+bool XModemSender::sendFrame()
+{
+    for (uint8_t tries = 0; tries < MAX_RETRIES; tries++)
+    {
+        if (tries)
+            resent_++;
+        writeOut(frame_, frameLen_);
+        uint8_t cans = 0;
+        while (true)
+        {
+            int c = readByte(10000);
+            if (c < 0 || c == XModem::NAK)
+                break;
+            if (c == XModem::ACK)
+                return true;
+            // A YMODEM receiver that missed the header asks again with 'C'
+            if (c == XModem::CRC && batch_ && frame_[1] == 0)
+                break;
+            if (c == XModem::CAN)
+            {
+                if (++cans >= 2)
+                {
+                    error_ = "Cancelled by receiver";
+                    return false;
+                }
+                continue;
+            }
+            cans = 0;
+        }
+    }
+    error_ = "Too many retries";
+    return false;
+}
+
+bool XModemSender::sendEOT()
+{
+    // YMODEM receivers NAK the first EOT on purpose
+    for (uint8_t tries = 0; tries < MAX_RETRIES; tries++)
+    {
+        link_.write(XModem::EOT);
+        int c = readByte(10000);
+        if (c == XModem::ACK)
+            return true;
+    }
+    error_ = "No ACK for EOT";
+    return false;
+}
+
+void XModemSender::cancel()
+{
+    const uint8_t cans[] = {XModem::CAN, XModem::CAN, XModem::CAN, XModem::CAN, XModem::CAN};
+    link_.write(cans, sizeof(cans));
+}
+
+bool XModemSender::sendFile(XModemSource &source, const String &name, int32_t size)
+{
+    if (!ring_ || !frame_)
+    {
+        error_ = "Out of memory";
+        return false;
+    }
+    source_ = &source;
+    ringHead_ = ringCount_ = 0;
+    sourceEof_ = false;
+
+    if (batch_ || !started_)
+    {
+        if (!waitStart())
+        {
+            source_ = nullptr;
+            return false;
+        }
+    }
+    started_ = true;
+
+    if (batch_)
+    {
+        // Block 0: "name NUL size"
+        size_t n = 0;
+        for (size_t i = 0; i < name.length() && n < XModem::BLOCK_1K_SIZE - 16; i++)
+            frame_[3 + n++] = name[i];
+        frame_[3 + n++] = 0;
+        if (size >= 0)
+        {
+            String sz = String(size);
+            memcpy(frame_ + 3 + n, sz.c_str(), sz.length());
+            n += sz.length();
+        }
+        buildFrame(0, n, n > XModem::BLOCK_SIZE ? XModem::BLOCK_1K_SIZE : XModem::BLOCK_SIZE, 0);
+        if (!sendFrame() || !waitStart())
+        {
+            source_ = nullptr;
+            return false;
+        }
+    }
+
+    blkNum_ = 1;
+    const size_t blockSize = crc_ ? XModem::BLOCK_1K_SIZE : XModem::BLOCK_SIZE;
+    unsigned long lastData = millis();
+    while (true)
+    {
+        while (ringCount_ < blockSize && !sourceEof_)
+        {
+            if (pump(RING_SIZE))
+            {
+                lastData = millis();
+            }
+            else if (millis() - lastData > 30000)
+            {
+                error_ = "Source stalled";
+                cancel();
+                source_ = nullptr;
+                return false;
+            }
+            else
+            {
+                yield();
+            }
+        }
+        if (ringCount_ == 0)
+            break;
+
+        // Short tails go out as 128-byte blocks to save padding
+        size_t bs = (ringCount_ <= XModem::BLOCK_SIZE) ? XModem::BLOCK_SIZE : blockSize;
+        size_t n = take(frame_ + 3, bs);
+        buildFrame(blkNum_, n, bs, 0x1A);
+        if (!sendFrame())
+        {
+            cancel();
+            source_ = nullptr;
+            return false;
+        }
+        bytes_ += n;
+        blkNum_++;
+    }
+
+    source_ = nullptr;
+    return sendEOT();
+}
+
+bool XModemSender::endBatch()
+{
+    if (!batch_)
+        return true;
+    if (!frame_)
+    {
+        error_ = "Out of memory";
+        return false;
+    }
+    if (!waitStart())
+        return false;
+    memset(frame_ + 3, 0, XModem::BLOCK_SIZE);
+    buildFrame(0, 0, XModem::BLOCK_SIZE, 0);
+    return sendFrame();
+}
@@ -25,6 +25,12 @@ public:
     static const uint8_t CAN = 0x18;
     static const uint8_t CRC = 'C';
 
+    static const size_t BLOCK_SIZE = 128;
+    static const size_t BLOCK_1K_SIZE = 1024;
+
+    static uint8_t calcChecksum(const uint8_t *data, size_t len);
+    static uint16_t calcCRC(const uint8_t *data, size_t len);
+
 private:
     Client &client_;
     Stream &out_;
@@ -55,12 +61,73 @@ private:
     size_t dataIndex_ = 0;
     uint8_t expectedSeq_, seqComp_;
     uint16_t receivedCrc_ = 0;
+};
 
-    static const size_t BLOCK_SIZE = 128;
-    static const size_t BLOCK_1K_SIZE = 1024;
+// Data source for XModemSender. read() returns the number of bytes copied,
+// 0 if nothing is ready yet, or -1 once the data is exhausted.
+class XModemSource
+{
+public:
+    virtual ~XModemSource() {}
+    virtual int read(uint8_t *buf, size_t len) = 0;
+};
+
+// Sends files to a receiver on the other end of link (normally Serial) as
+// XMODEM-1K or, in batch mode, YMODEM. The source is read ahead into a ring
+// buffer whenever the UART FIFO is full or we are waiting for an ACK, so SD
+// reads overlap with the line draining instead of stalling it.
+class XModemSender
+{
+public:
+    XModemSender(Stream &link, bool batch);
+    ~XModemSender();
+
+    bool sendFile(XModemSource &source, const String &name, int32_t size);
+    bool endBatch();
+
+    const String &lastError() const { return error_; }
+    size_t bytesSent() const { return bytes_; }
+    uint32_t blocksResent() const { return resent_; }
+    bool usingCRC() const { return crc_; }
+
+private:
+#ifdef ESP8266
+    static const size_t RING_SIZE = 2048;
+#else
+    static const size_t RING_SIZE = 4096;
+#endif
+    static const uint8_t MAX_RETRIES = 10;
+
+    Stream &link_;
+    XModemSource *source_ = nullptr;
+    bool batch_;
+    bool crc_ = true;
+    bool started_ = false;
+    uint8_t blkNum_ = 1;
+    String error_;
+    size_t bytes_ = 0;
+    uint32_t resent_ = 0;
+
+    static const size_t FRAME_SIZE = 3 + 1024 + 2;
+
+    // On the heap, the ESP8266 loop stack is only about 4 KB
+    uint8_t *ring_;
+    size_t ringHead_ = 0;
+    size_t ringCount_ = 0;
+    bool sourceEof_ = false;
+
+    uint8_t *frame_;
+    size_t frameLen_ = 0;
 
-    uint8_t calcChecksum(const uint8_t *data, size_t len);
-    uint16_t calcCRC(const uint8_t *data, size_t len);
+    bool pump(size_t maxBytes);
+    size_t take(uint8_t *dst, size_t len);
+    int readByte(unsigned long timeoutMs);
+    void writeOut(const uint8_t *data, size_t len);
+    bool waitStart();
+    void buildFrame(uint8_t blk, size_t len, size_t blockSize, uint8_t pad);
+    bool sendFrame();
+    bool sendEOT();
+    void cancel();
 };
 
 #endif
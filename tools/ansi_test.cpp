@@ -0,0 +1,116 @@
+// Host test of the escape sequence filter in src/ansi.cpp.
+//
+//   g++ -O2 -std=c++17 -Itools/host -Isrc tools/ansi_test.cpp src/ansi.cpp -o ansi_test
+//   ./ansi_test
+//
+// Feeds sample screens through each mode, whole and one byte at a time,
+// and checks the output. Exits non-zero on the first mismatch.
+
+#include <Arduino.h>
+#include <cstdio>
+#include "ansi.h"
+
+class Capture : public Print
+{
+public:
+    std::string data;
+
+    size_t write(uint8_t c) override
+    {
+        data += (char)c;
+        return 1;
+    }
+    size_t write(const uint8_t *buf, size_t len) override
+    {
+        data.append((const char *)buf, len);
+        return len;
+    }
+};
+
+static int failures = 0;
+
+static std::string filter(uint8_t mode, const std::string &in, bool bytewise, uint8_t rows = 24, uint8_t cols = 80)
+{
+    Capture out;
+    AnsiFilter f(out);
+    f.begin(mode, rows, cols);
+    if (bytewise)
+    {
+        for (char c : in)
+            f.write((uint8_t)c);
+    }
+    else
+    {
+        f.write((const uint8_t *)in.data(), in.size());
+    }
+    f.flush();
+    return out.data;
+}
+
+static std::string printable(const std::string &s)
+{
+    std::string r;
+    for (char c : s)
+    {
+        if (c == 0x1B)
+            r += "\\e";
+        else if (c == '\r')
+            r += "\\r";
+        else if (c == '\n')
+            r += "\\n";
+        else
+            r += c;
+    }
+    return r;
+}
+
+static void expect(const char *name, uint8_t mode, const std::string &in, const std::string &want,
+                   uint8_t rows = 24, uint8_t cols = 80)
+{
+    for (int bytewise = 0; bytewise < 2; bytewise++)
+    {
+        std::string got = filter(mode, in, bytewise, rows, cols);
+        if (got != want)
+        {
+            printf("FAIL %s (%s, %s)\n  want %s\n  got  %s\n", name, ansiModeName(mode),
+                   bytewise ? "bytewise" : "whole", printable(want).c_str(), printable(got).c_str());
+            failures++;
+        }
+    }
+}
+
+int main()
+{
+    // A BBS screen header: clear, colours and a title
+    const std::string header = "\x1b[2J\x1b[1;1H\x1b[0;1;33;44mHERMES BBS\x1b[0m\r\n\x1b[36mMain menu\x1b[0m";
+
+    expect("off", ANSI_OFF, header, header);
+    expect("mono header", ANSI_MONO, header, "\x1b[2J\x1b[0;1m\x1b[HHERMES BBS\x1b[0m\r\nMain menu\x1b[0m");
+    expect("dumb header", ANSI_DUMB, header, "\r\nHERMES BBS\r\nMain menu");
+    expect("vt52 header", ANSI_VT52, header, "\x1bH\x1bJ\x1bHHERMES BBS\r\nMain menu");
+
+    // Moves with nothing between them collapse into one
+    expect("merge abs", ANSI_MONO, "\x1b[5;10H\x1b[2B\x1b[3CX", "\x1b[7;13HX");
+    expect("merge rel", ANSI_MONO, "\x1b[A\x1b[A\x1b[AX", "\x1b[3AX");
+    expect("vt52 goto", ANSI_VT52, "\x1b[5;10HX", std::string("\x1bY") + (char)(31 + 5) + (char)(31 + 10) + "X");
+
+    // Relative moves that change direction are not a no-op at an edge
+    expect("no cancel", ANSI_MONO, "\x1b[A\x1b[BX", "\x1b[A\x1b[BX");
+
+    // The merge stops at the terminal size, not at 24x80
+    expect("edge 80", ANSI_MONO, "\x1b[1;75H\x1b[10CX", "\x1b[1;75H\x1b[10CX");
+    expect("edge 132", ANSI_MONO, "\x1b[1;75H\x1b[10CX", "\x1b[1;85HX", 24, 132);
+    expect("edge 20 rows", ANSI_MONO, "\x1b[15;1H\x1b[10BX", "\x1b[15H\x1b[10BX", 20, 80);
+    expect("edge 50 rows", ANSI_MONO, "\x1b[15;1H\x1b[10BX", "\x1b[25HX", 50, 80);
+    expect("rows unknown", ANSI_MONO, "\x1b[15;1H\x1b[10BX", "\x1b[15H\x1b[10BX", 0, 80);
+
+    // Strings and private modes
+    expect("osc dumb", ANSI_DUMB, "\x1b]0;title\x07text", "text");
+    expect("private mono", ANSI_MONO, "\x1b[?25lX", "\x1b[?25lX");
+    expect("extended colour", ANSI_MONO, "\x1b[1;38;5;196mX", "\x1b[1mX");
+
+    if (failures)
+        return 1;
+    printf("ansi_test: all passed\n");
+    return 0;
+}
@@ -0,0 +1,73 @@
+// Host benchmark of the UTF-8 decoder and encoder in src/charset.cpp.
+//
+//   g++ -O2 -std=c++17 -Itools/host -Isrc tools/charset_bench.cpp src/charset.cpp -o charset_bench
+//   ./charset_bench
+//
+// Prints MB/s for ASCII and Cyrillic text through the decoder, and for
+// encoding typed text back to UTF-8. Host numbers only show that the
+// ASCII path is a copy; the ESP is far slower but still well beyond any
+// serial rate.
+
+#include <Arduino.h>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "charset.h"
+
+static double seconds(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void decode(const char *label, uint8_t charset, const std::string &text)
+{
+    const size_t block = 256; // RX_BUF_SIZE in tcp.cpp
+    const size_t total = 256 * 1024 * 1024;
+    std::vector<uint8_t> in(block);
+    std::vector<uint8_t> out(block);
+    for (size_t i = 0; i < block; i++)
+        in[i] = text[i % text.size()];
+
+    Utf8Decoder decoder;
+    decoder.begin(charset);
+    size_t kept = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t done = 0; done < total; done += block)
+        kept += decoder.convert(in.data(), block, out.data());
+    double s = seconds(start);
+    printf("decode %-18s %8.1f MB/s (%zu bytes out)\n", label, total / s / 1e6, kept);
+}
+
+static void encode(const char *label, uint8_t charset, uint8_t first, uint8_t last)
+{
+    const size_t block = 85; // TX_BUF_SIZE / 3 in tcp.cpp
+    const size_t total = 64 * 1024 * 1024;
+    std::vector<uint8_t> typed(block);
+    for (size_t i = 0; i < block; i++)
+        typed[i] = first + i % (last - first + 1);
+    std::vector<uint8_t> buf(block * 3);
+    size_t out = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (size_t done = 0; done < total; done += block)
+    {
+        memcpy(buf.data(), typed.data(), block);
+        out += encodeUtf8(charset, buf.data(), block);
+    }
+    double s = seconds(start);
+    printf("encode %-18s %8.1f MB/s (%zu bytes out)\n", label, total / s / 1e6, out);
+}
+
+int main()
+{
+    std::string ascii = "The quick brown fox jumps over the lazy dog. 0123456789\r\n";
+    std::string cyrillic = "\xD0\xA1\xD1\x8A\xD0\xB5\xD1\x88\xD1\x8C \xD0\xB6\xD0\xB5 \xD0\xB5\xD1\x89\xD1\x91 "
+                           "\xD1\x8D\xD1\x82\xD0\xB8\xD1\x85 \xD0\xB1\xD1\x83\xD0\xBB\xD0\xBE\xD0\xBA\r\n";
+
+    decode("ASCII, CP437", CHARSET_CP437, ascii);
+    decode("ASCII, PETSCII", CHARSET_PETSCII, ascii);
+    decode("Cyrillic, KOI8-R", CHARSET_KOI8R, cyrillic);
+    decode("Cyrillic, CP1251", CHARSET_CP1251, cyrillic);
+    encode("ASCII, CP437", CHARSET_CP437, 0x20, 0x7E);
+    encode("Cyrillic, CP1251", CHARSET_CP1251, 0xC0, 0xFF);
+    return 0;
+}
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+"""Generates src/charset_tables.h from Python's codecs for the code pages.
+
+    python3 tools/gen_charset_tables.py > src/charset_tables.h
+"""
+
+CODEPAGES = [
+    ("CP437", "cp437"),
+    ("KOI8R", "koi8_r"),
+    ("CP1251", "cp1251"),
+]
+
+
+def forward(codec):
+    table = []
+    for b in range(0x80, 0x100):
+        try:
+            table.append(ord(bytes([b]).decode(codec)))
+        except UnicodeDecodeError:
+            table.append(0)  # No character
+    return table
+
+
+def rows(items, per_row):
+    return ["    " + " ".join(items[i:i + per_row]) for i in range(0, len(items), per_row)]
+
+
+def main():
+    out = [
+        "#ifndef CHARSET_TABLES_H",
+        "#define CHARSET_TABLES_H",
+        "",
+        "#include <Arduino.h>",
+        "",
+        "// Generated from the Unicode mappings of the code pages by",
+        "// tools/gen_charset_tables.py. Bytes 0x80-0xFF to code points, and code",
+        "// points back to bytes sorted for binary search. 0 marks a byte with no",
+        "// character.",
+        "",
+        "struct CharsetReverse",
+        "{",
+        "    uint16_t cp;",
+        "    uint8_t byte;",
+        "};",
+    ]
+    for name, codec in CODEPAGES:
+        table = forward(codec)
+        reverse = sorted((cp, 0x80 + i) for i, cp in enumerate(table) if cp)
+        out.append("")
+        out.append("static const uint16_t %s_TO_UNICODE[128] PROGMEM = {" % name)
+        out += rows(["0x%04X," % cp for cp in table], 8)
+        out.append("};")
+        out.append("")
+        out.append("static const CharsetReverse %s_FROM_UNICODE[%d] PROGMEM = {" % (name, len(reverse)))
+        out += rows(["{0x%04X, 0x%02X}," % entry for entry in reverse], 4)
+        out.append("};")
+    out.append("")
+    out.append("#endif")
+    print("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,114 @@
+// Just enough of the Arduino core to build the plain C++ modules of the
+// firmware (charset.cpp, ansi.cpp, knownhosts.cpp) on the host for tools/.
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+typedef uint8_t byte;
+
+#define PROGMEM
+#define pgm_read_byte(p) (*(const uint8_t *)(p))
+#define pgm_read_word(p) (*(const uint16_t *)(p))
+
+using std::max;
+using std::min;
+
+template <typename T, typename L, typename H>
+T constrain(T x, L lo, H hi)
+{
+    return x < (T)lo ? (T)lo : x > (T)hi ? (T)hi : x;
+}
+
+class String
+{
+public:
+    String(const char *s = "") : s_(s) {}
+    String(const std::string &s) : s_(s) {}
+    explicit String(unsigned int n) : s_(std::to_string(n)) {}
+    explicit String(int n) : s_(std::to_string(n)) {}
+
+    unsigned int length() const { return s_.length(); }
+    char operator[](unsigned int i) const { return s_[i]; }
+    bool operator==(const char *s) const { return s_ == s; }
+    bool operator==(const String &s) const { return s_ == s.s_; }
+    bool operator!=(const String &s) const { return s_ != s.s_; }
+    const char *c_str() const { return s_.c_str(); }
+
+    String &operator+=(const String &s)
+    {
+        s_ += s.s_;
+        return *this;
+    }
+    String &operator+=(const char *s)
+    {
+        s_ += s;
+        return *this;
+    }
+    String &operator+=(char c)
+    {
+        s_ += c;
+        return *this;
+    }
+    friend String operator+(String a, const String &b) { return a += b; }
+    friend String operator+(String a, const char *b) { return a += b; }
+    friend String operator+(const char *a, const String &b) { return String(a) += b; }
+
+    int indexOf(char c, unsigned int from = 0) const
+    {
+        size_t i = s_.find(c, from);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    bool startsWith(const String &prefix, unsigned int offset = 0) const
+    {
+        return offset <= s_.length() && s_.compare(offset, prefix.s_.length(), prefix.s_) == 0;
+    }
+    String substring(unsigned int from) const { return from < s_.length() ? s_.substr(from) : ""; }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        return from < to && from < s_.length() ? s_.substr(from, to - from) : "";
+    }
+    void remove(unsigned int index, unsigned int count)
+    {
+        if (index < s_.length())
+            s_.erase(index, count);
+    }
+
+    void trim()
+    {
+        size_t a = s_.find_first_not_of(" \t\r\n");
+        size_t b = s_.find_last_not_of(" \t\r\n");
+        s_ = a == std::string::npos ? "" : s_.substr(a, b - a + 1);
+    }
+    void toUpperCase()
+    {
+        for (char &c : s_)
+            c = toupper((unsigned char)c);
+    }
+
+private:
+    std::string s_;
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buf, size_t len)
+    {
+        for (size_t i = 0; i < len; i++)
+            write(buf[i]);
+        return len;
+    }
+    virtual void flush() {}
+};
+
+#endif
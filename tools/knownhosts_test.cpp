@@ -0,0 +1,66 @@
+// Host test of the known hosts list in src/knownhosts.cpp, shared by the
+// SSH host keys and the TLS certificate pins.
+//
+//   g++ -O2 -std=c++17 -Itools/host -Isrc tools/knownhosts_test.cpp src/knownhosts.cpp -o knownhosts_test
+//   ./knownhosts_test
+//
+// Exits non-zero on the first failed check.
+
+#include <Arduino.h>
+#include <cstdio>
+#include "knownhosts.h"
+
+static int failures = 0;
+
+static void check(const char *name, bool ok)
+{
+    if (!ok)
+    {
+        printf("FAIL %s\n", name);
+        failures++;
+    }
+}
+
+int main()
+{
+    String hosts;
+    addKnownHost(hosts, "bbs.example.org:22", "SHA256:aaaa");
+    addKnownHost(hosts, "example.com:443", "SHA256:bbbb");
+    addKnownHost(hosts, "bbs.example.org:992", "SHA256:cccc");
+
+    check("lookup", knownHostFingerprint(hosts, "example.com:443") == "SHA256:bbbb");
+    check("last line", knownHostFingerprint(hosts, "bbs.example.org:992") == "SHA256:cccc");
+    check("port matters", knownHostFingerprint(hosts, "example.com:992").length() == 0);
+    check("no prefix match", findKnownHost(hosts, "example.com:44") < 0);
+
+    // A repeated host replaces its line rather than adding a second one
+    addKnownHost(hosts, "example.com:443", "SHA256:dddd");
+    check("replace", knownHostFingerprint(hosts, "example.com:443") == "SHA256:dddd");
+    String once = hosts;
+    removeKnownHost(once, "example.com:443");
+    check("one line", findKnownHost(once, "example.com:443") < 0);
+
+    // Bare hosts get the default port of the list they are forgotten from
+    check("ssh key", knownHostKey(" bbs.example.org ", SSH_KNOWN_HOSTS_PORT) == "bbs.example.org:22");
+    check("port kept", knownHostKey("bbs.example.org:992", TLS_KNOWN_HOSTS_PORT) == "bbs.example.org:992");
+
+    // AT$TLSFORGET=example.com clears the pin an HTTPS fetch saved
+    check("forget https", removeKnownHost(hosts, knownHostKey("example.com", TLS_KNOWN_HOSTS_PORT)));
+    check("forgotten", findKnownHost(hosts, "example.com:443") < 0);
+    check("others kept", knownHostFingerprint(hosts, "bbs.example.org:992") == "SHA256:cccc" &&
+                             knownHostFingerprint(hosts, "bbs.example.org:22") == "SHA256:aaaa");
+    check("forget twice", !removeKnownHost(hosts, "example.com:443"));
+
+    // The oldest lines make room once the list reaches the NVS limit
+    String full;
+    for (int i = 0; i < 200; i++)
+        addKnownHost(full, "host" + String(i) + ".example.net:443", "SHA256:0123456789abcdef0123456789abcdef");
+    check("size cap", full.length() <= KNOWN_HOSTS_MAX);
+    check("newest kept", knownHostFingerprint(full, "host199.example.net:443").length() > 0);
+    check("oldest dropped", findKnownHost(full, "host0.example.net:443") < 0);
+
+    if (failures)
+        return 1;
+    printf("knownhosts_test: all passed\n");
+    return 0;
+}
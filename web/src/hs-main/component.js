@@ -116,14 +116,26 @@ export default class {
                     password = "",
                     serialSpeed = "",
                     tcpServerPort = "",
-                    busyMsg = ""
+                    busyMsg = "",
+                    ipType = "d",
+                    staticIp = "",
+                    staticMask = "",
+                    staticGateway = "",
+                    staticDns = ""
                 } = this.state.settings || {};
+                // An unset static address reads back as 0.0.0.0
+                const ip = val => (val === "0.0.0.0" ? "" : val);
                 const fieldMap = {
                     s_ssid: ssid,
                     s_password: password,
                     s_serialSpeed: serialSpeed,
                     s_tcpServerPort: tcpServerPort,
-                    s_busyMsg: busyMsg
+                    s_busyMsg: busyMsg,
+                    s_ipType: ipType === "s" ? "s" : "d",
+                    s_staticIp: ip(staticIp),
+                    s_staticMask: ip(staticMask),
+                    s_staticGateway: ip(staticGateway),
+                    s_staticDns: ip(staticDns)
                 };
                 let firstField = null;
                 for (const [eid, val] of Object.entries(fieldMap)) {
@@ -132,6 +144,7 @@ export default class {
                     el.value = val ?? "";
                     if (!firstField) firstField = el;
                 }
+                this.onIpTypeChange();
                 if (firstField) firstField.focus();
                 break;
             case "reboot":
@@ -184,6 +197,15 @@ export default class {
         }
     }
 
+    onIpTypeChange() {
+        const type = document.getElementById("s_ipType");
+        const isStatic = type && type.value === "s";
+        ["s_staticIp", "s_staticMask", "s_staticGateway", "s_staticDns"].forEach(eid => {
+            const el = document.getElementById(eid);
+            if (el) el.disabled = !isStatic;
+        });
+    }
+
     onSettingsDialogCancel() {
         const dialog = document.getElementById("settingsDialog");
         if (dialog && dialog.hasAttribute("open")) {
@@ -203,7 +225,12 @@ export default class {
             password: $("s_password").value,
             serialSpeed: parseInt($("s_serialSpeed").value, 10),
             tcpServerPort: Number($("s_tcpServerPort").value),
-            busyMsg: $("s_busyMsg").value.trim()
+            busyMsg: $("s_busyMsg").value.trim(),
+            ipType: $("s_ipType").value,
+            staticIp: $("s_staticIp").value.trim(),
+            staticMask: $("s_staticMask").value.trim(),
+            staticGateway: $("s_staticGateway").value.trim(),
+            staticDns: $("s_staticDns").value.trim()
         };
         if (!values.ssid) { $("s_ssid").setAttribute("aria-invalid", "true"); return; }
         if (!values.password) { $("s_password").setAttribute("aria-invalid", "true"); return; }
@@ -216,6 +243,22 @@ export default class {
             return;
         }
         if (!values.busyMsg) { $("s_busyMsg").setAttribute("aria-invalid", "true"); return; }
+        if (values.ipType === "s") {
+            const isIPv4 = v => /^(\d{1,3})\.(\d{1,3})\.(\d{1,3})\.(\d{1,3})$/.test(v) &&
+                v.split(".").every(n => Number(n) <= 255);
+            const required = ["staticIp", "staticMask", "staticGateway"];
+            for (const key of required) {
+                if (!isIPv4(values[key]) || values[key] === "0.0.0.0") {
+                    $(`s_${key}`).setAttribute("aria-invalid", "true");
+                    return;
+                }
+            }
+            // Left empty, the modem uses the gateway as DNS server
+            if (values.staticDns && !isIPv4(values.staticDns)) {
+                $("s_staticDns").setAttribute("aria-invalid", "true");
+                return;
+            }
+        }
         // const { ssid, password, serialSpeed, tcpServerPort, busyMsg } = values;
         // Use form data to avoid triggering a CORS preflight (no non-simple headers)
         const formParams = new URLSearchParams();